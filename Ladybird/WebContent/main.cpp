@@ -14,6 +14,7 @@
 #include <LibCore/LocalServer.h>
 #include <LibCore/Process.h>
 #include <LibCore/Resource.h>
+#include <LibCore/StandardPaths.h>
 #include <LibCore/System.h>
 #include <LibCore/SystemServerTakeover.h>
 #include <LibIPC/ConnectionFromClient.h>
@@ -22,6 +23,7 @@
 #include <LibProtocol/RequestClient.h>
 #include <LibWeb/Bindings/MainThreadVM.h>
 #include <LibWeb/HTML/Window.h>
+#include <LibWeb/IndexedDB/Internal/DatabaseState.h>
 #include <LibWeb/Loader/ContentFilter.h>
 #include <LibWeb/Loader/GeneratedPagesLoader.h>
 #include <LibWeb/Loader/ResourceLoader.h>
@@ -153,6 +155,10 @@ ErrorOr<int> serenity_main(Main::Arguments arguments)
 
     Web::Platform::FontPlugin::install(*new Ladybird::FontPlugin(is_layout_test_mode));
 
+    // Layout tests keep their databases in memory, so that they start from a clean slate every time.
+    if (!is_layout_test_mode)
+        Web::IndexedDB::DatabaseState::set_storage_directory(ByteString::formatted("{}/Ladybird/IndexedDB", Core::StandardPaths::data_directory()));
+
     TRY(Web::Bindings::initialize_main_thread_vm());
 
     if (log_all_js_exceptions) {
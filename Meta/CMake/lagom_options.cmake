@@ -7,6 +7,7 @@ include(${CMAKE_CURRENT_LIST_DIR}/lagom_install_options.cmake)
 
 serenity_option(ENABLE_ADDRESS_SANITIZER OFF CACHE BOOL "Enable address sanitizer testing in gcc/clang")
 serenity_option(ENABLE_MEMORY_SANITIZER OFF CACHE BOOL "Enable memory sanitizer testing in gcc/clang")
+serenity_option(ENABLE_ALLOCATION_TRACKING OFF CACHE BOOL "Replace malloc() in every process linking LibCore to support Core::AllocationTracker (glibc only)")
 serenity_option(ENABLE_FUZZERS OFF CACHE BOOL "Build fuzzing targets")
 serenity_option(ENABLE_FUZZERS_LIBFUZZER OFF CACHE BOOL "Build fuzzers using Clang's libFuzzer")
 serenity_option(ENABLE_FUZZERS_OSSFUZZ OFF CACHE BOOL "Build OSS-Fuzz compatible fuzzers")
@@ -51,6 +51,7 @@ struct CodePointDecomposition {
 using PropList = HashMap<ByteString, Vector<Unicode::CodePointRange>>;
 
 // https://www.unicode.org/reports/tr44/#DerivedNormalizationProps.txt
+// NOTE: The values of this enum must match Unicode::QuickCheckResult.
 enum class QuickCheck {
     Yes,
     No,
@@ -112,6 +113,10 @@ struct BlockName {
 
 using PropertyTable = Vector<bool>;
 
+// The quick check values of each normalization form for a code point, packed 2 bits per form in the order of
+// Unicode::NormalizationForm.
+using NormalizationQuickCheckTable = u8;
+
 static constexpr auto CODE_POINT_TABLES_MSB_COUNT = 16u;
 static_assert(CODE_POINT_TABLES_MSB_COUNT < 24u);
 
@@ -180,7 +185,6 @@ struct UnicodeData {
 
     Vector<BlockName> block_display_names;
 
-    // FIXME: We are not yet doing anything with this data. It will be needed for String.prototype.normalize.
     NormalizationProps normalization_props;
 
     PropList grapheme_break_props;
@@ -195,6 +199,7 @@ struct UnicodeData {
     CodePointTables<PropertyTable> grapheme_break_tables;
     CodePointTables<PropertyTable> word_break_tables;
     CodePointTables<PropertyTable> sentence_break_tables;
+    CodePointTables<NormalizationQuickCheckTable> normalization_quick_check_tables;
 
     HashTable<ByteString> bidirectional_classes;
     Vector<CodePointBidiClass> code_point_bidirectional_classes;
@@ -916,6 +921,7 @@ static ErrorOr<void> generate_unicode_data_implementation(Core::InputBufferedFil
 #include <AK/Array.h>
 #include <AK/BinarySearch.h>
 #include <AK/CharacterTypes.h>
+#include <AK/NumericLimits.h>
 #include <AK/Optional.h>
 #include <AK/Span.h>
 #include <AK/ByteString.h>
@@ -1206,6 +1212,56 @@ static constexpr Array<Array<bool, @inner_size@>, @outer_size@> @name@ { {)~~~")
         return {};
     };
 
+    // The break properties are single-valued, so rather than a set of booleans, we store the index of the property that
+    // a code point has (or a sentinel if it has none). This lets the segmentation algorithms look up a code point once.
+    auto append_break_property_table = [&](auto collection_snake, auto const& unique_properties) -> ErrorOr<void> {
+        generator.set("name", TRY(String::formatted("{}_unique_properties", collection_snake)));
+        generator.set("size", TRY(String::number(unique_properties.size())));
+
+        generator.append(R"~~~(
+static constexpr Array<u8, @size@> @name@ { {
+    )~~~");
+
+        bool first = true;
+        for (auto const& property_set : unique_properties) {
+            auto property_index = property_set.find_first_index(true);
+            VERIFY(property_set.size() < NumericLimits<u8>::max());
+            VERIFY(!property_index.has_value() || !property_set.span().slice(*property_index + 1).contains_slow(true));
+
+            generator.set("value", TRY(String::number(property_index.value_or(NumericLimits<u8>::max()))));
+            generator.append(first ? "@value@"sv : ", @value@"sv);
+            first = false;
+        }
+
+        generator.append(R"~~~(
+} };
+)~~~");
+
+        return {};
+    };
+
+    auto append_quick_check_table = [&](auto collection_snake, auto const& unique_properties) -> ErrorOr<void> {
+        generator.set("name", TRY(String::formatted("{}_unique_properties", collection_snake)));
+        generator.set("size", TRY(String::number(unique_properties.size())));
+
+        generator.append(R"~~~(
+static constexpr Array<u8, @size@> @name@ { {
+    )~~~");
+
+        bool first = true;
+        for (auto quick_checks : unique_properties) {
+            generator.set("value", TRY(String::formatted("{:#x}", quick_checks)));
+            generator.append(first ? "@value@"sv : ", @value@"sv);
+            first = false;
+        }
+
+        generator.append(R"~~~(
+} };
+)~~~");
+
+        return {};
+    };
+
     auto append_code_point_tables = [&](StringView collection_snake, auto const& tables, auto& append_unique_properties) -> ErrorOr<void> {
         auto append_stage = [&](auto const& stage, auto name, auto type) -> ErrorOr<void> {
             generator.set("name", TRY(String::formatted("{}_{}", collection_snake, name)));
@@ -1250,9 +1306,10 @@ static constexpr Array<@type@, @size@> @name@ { {
     TRY(append_code_point_tables("s_properties"sv, unicode_data.property_tables, append_property_table));
     TRY(append_code_point_tables("s_scripts"sv, unicode_data.script_tables, append_property_table));
     TRY(append_code_point_tables("s_script_extensions"sv, unicode_data.script_extension_tables, append_property_table));
-    TRY(append_code_point_tables("s_grapheme_break_properties"sv, unicode_data.grapheme_break_tables, append_property_table));
-    TRY(append_code_point_tables("s_word_break_properties"sv, unicode_data.word_break_tables, append_property_table));
-    TRY(append_code_point_tables("s_sentence_break_properties"sv, unicode_data.sentence_break_tables, append_property_table));
+    TRY(append_code_point_tables("s_grapheme_break_properties"sv, unicode_data.grapheme_break_tables, append_break_property_table));
+    TRY(append_code_point_tables("s_word_break_properties"sv, unicode_data.word_break_tables, append_break_property_table));
+    TRY(append_code_point_tables("s_sentence_break_properties"sv, unicode_data.sentence_break_tables, append_break_property_table));
+    TRY(append_code_point_tables("s_normalization_quick_checks"sv, unicode_data.normalization_quick_check_tables, append_quick_check_table));
 
     auto append_code_point_display_names = [&](StringView type, StringView name, auto const& display_names) {
         constexpr size_t max_values_per_row = 30;
@@ -1473,6 +1530,33 @@ bool code_point_has_@enum_snake@(u32 code_point, @enum_title@ @enum_snake@)
         return {};
     };
 
+    auto append_break_prop_search = [&](StringView enum_title, StringView enum_snake, StringView collection_name) -> ErrorOr<void> {
+        generator.set("enum_title", enum_title);
+        generator.set("enum_snake", enum_snake);
+        generator.set("collection_name", collection_name);
+
+        generator.append(R"~~~(
+Optional<@enum_title@> @enum_snake@(u32 code_point)
+{
+    auto stage1_index = code_point >> @CODE_POINT_TABLES_LSB_COUNT@;
+    auto stage2_index = @collection_name@_stage1[stage1_index] + (code_point & @CODE_POINT_TABLES_LSB_MASK@);
+    auto unique_properties_index = @collection_name@_stage2[stage2_index];
+
+    auto property_index = @collection_name@_unique_properties[unique_properties_index];
+    if (property_index == NumericLimits<u8>::max())
+        return {};
+    return static_cast<@enum_title@>(property_index);
+}
+
+bool code_point_has_@enum_snake@(u32 code_point, @enum_title@ property)
+{
+    return @enum_snake@(code_point) == property;
+}
+)~~~");
+
+        return {};
+    };
+
     auto append_from_string = [&](StringView enum_title, StringView enum_snake, auto const& prop_list, Vector<Alias> const& aliases) -> ErrorOr<void> {
         HashValueMap<StringView> hashes;
         TRY(hashes.try_ensure_capacity(prop_list.size() + aliases.size()));
@@ -1508,9 +1592,21 @@ bool code_point_has_@enum_snake@(u32 code_point, @enum_title@ @enum_snake@)
     TRY(append_prop_search("Script"sv, "script_extension"sv, "s_script_extensions"sv));
     TRY(append_from_string("Script"sv, "script"sv, unicode_data.script_list, unicode_data.script_aliases));
 
-    TRY(append_prop_search("GraphemeBreakProperty"sv, "grapheme_break_property"sv, "s_grapheme_break_properties"sv));
-    TRY(append_prop_search("WordBreakProperty"sv, "word_break_property"sv, "s_word_break_properties"sv));
-    TRY(append_prop_search("SentenceBreakProperty"sv, "sentence_break_property"sv, "s_sentence_break_properties"sv));
+    TRY(append_break_prop_search("GraphemeBreakProperty"sv, "grapheme_break_property"sv, "s_grapheme_break_properties"sv));
+    TRY(append_break_prop_search("WordBreakProperty"sv, "word_break_property"sv, "s_word_break_properties"sv));
+    TRY(append_break_prop_search("SentenceBreakProperty"sv, "sentence_break_property"sv, "s_sentence_break_properties"sv));
+
+    generator.append(R"~~~(
+QuickCheckResult normalization_quick_check(u32 code_point, NormalizationForm form)
+{
+    auto stage1_index = code_point >> @CODE_POINT_TABLES_LSB_COUNT@;
+    auto stage2_index = s_normalization_quick_checks_stage1[stage1_index] + (code_point & @CODE_POINT_TABLES_LSB_MASK@);
+    auto unique_properties_index = s_normalization_quick_checks_stage2[stage2_index];
+
+    auto quick_checks = s_normalization_quick_checks_unique_properties[unique_properties_index];
+    return static_cast<QuickCheckResult>((quick_checks >> (to_underlying(form) * 2)) & 0x3);
+}
+)~~~");
 
     TRY(append_from_string("BidirectionalClass"sv, "bidirectional_class"sv, unicode_data.bidirectional_classes, {}));
 
@@ -1689,6 +1785,31 @@ struct PropertyMetadata {
     HashMap<decltype(current_block), size_t> unique_blocks;
 };
 
+struct NormalizationMetadata {
+    static ErrorOr<NormalizationMetadata> create(NormalizationProps const& normalization_props)
+    {
+        NormalizationMetadata data;
+
+        // These must be in the same order as Unicode::NormalizationForm.
+        for (auto property : { "NFD_QC"sv, "NFC_QC"sv, "NFKD_QC"sv, "NFKC_QC"sv }) {
+            auto quick_checks = normalization_props.get(property).value_or({});
+
+            quick_sort(quick_checks, [](auto const& lhs, auto const& rhs) {
+                return lhs.code_point_range.first < rhs.code_point_range.first;
+            });
+
+            TRY(data.quick_check_values.try_append(move(quick_checks)));
+        }
+
+        return data;
+    }
+
+    Vector<Vector<Normalization>> quick_check_values;
+
+    Vector<size_t> current_block;
+    HashMap<decltype(current_block), size_t> unique_blocks;
+};
+
 // The goal here is to produce a set of tables that represent a category of code point properties for every code point.
 // The most naive method would be to generate a single table per category, each with one entry per code point. Each of
 // those tables would have a size of 0x10ffff though, which is a non-starter. Instead, we create a set of 2-stage lookup
@@ -1806,6 +1927,31 @@ static ErrorOr<void> create_code_point_tables(UnicodeData& unicode_data)
         return {};
     };
 
+    auto update_normalization_tables = [&](u32 code_point, CodePointTables<NormalizationQuickCheckTable>& tables, NormalizationMetadata& metadata) -> ErrorOr<void> {
+        static Unicode::CodePointRangeComparator comparator {};
+        NormalizationQuickCheckTable quick_checks = 0;
+
+        for (size_t form = 0; form < metadata.quick_check_values.size(); ++form) {
+            auto& quick_check_values = metadata.quick_check_values[form];
+            size_t ranges_to_remove = 0;
+
+            for (auto const& normalization : quick_check_values) {
+                if (auto comparison = comparator(code_point, normalization.code_point_range); comparison <= 0) {
+                    if (comparison == 0)
+                        quick_checks |= to_underlying(normalization.quick_check) << (form * 2);
+                    break;
+                }
+
+                ++ranges_to_remove;
+            }
+
+            quick_check_values.remove(0, ranges_to_remove);
+        }
+
+        TRY(update_tables(code_point, tables, metadata, quick_checks));
+        return {};
+    };
+
     CasingMetadata casing_metadata { unicode_data.code_point_data };
     auto general_category_metadata = TRY(PropertyMetadata::create(unicode_data.general_categories));
     auto property_metadata = TRY(PropertyMetadata::create(unicode_data.prop_list));
@@ -1814,6 +1960,7 @@ static ErrorOr<void> create_code_point_tables(UnicodeData& unicode_data)
     auto grapheme_break_metadata = TRY(PropertyMetadata::create(unicode_data.grapheme_break_props));
     auto word_break_metadata = TRY(PropertyMetadata::create(unicode_data.word_break_props));
     auto sentence_break_metadata = TRY(PropertyMetadata::create(unicode_data.sentence_break_props));
+    auto normalization_metadata = TRY(NormalizationMetadata::create(unicode_data.normalization_props));
 
     for (u32 code_point = 0; code_point <= MAX_CODE_POINT; ++code_point) {
         TRY(update_casing_tables(code_point, unicode_data.casing_tables, casing_metadata));
@@ -1824,6 +1971,7 @@ static ErrorOr<void> create_code_point_tables(UnicodeData& unicode_data)
         TRY(update_property_tables(code_point, unicode_data.grapheme_break_tables, grapheme_break_metadata));
         TRY(update_property_tables(code_point, unicode_data.word_break_tables, word_break_metadata));
         TRY(update_property_tables(code_point, unicode_data.sentence_break_tables, sentence_break_metadata));
+        TRY(update_normalization_tables(code_point, unicode_data.normalization_quick_check_tables, normalization_metadata));
     }
 
     return {};
@@ -33,6 +33,7 @@ static bool is_platform_object(Type const& type)
         "AnimationEffect"sv,
         "AnimationTimeline"sv,
         "Attr"sv,
+        "AudioDestinationNode"sv,
         "AudioNode"sv,
         "AudioParam"sv,
         "AudioScheduledSourceNode"sv,
@@ -52,6 +53,9 @@ static bool is_platform_object(Type const& type)
         "FontFace"sv,
         "FormData"sv,
         "HTMLCollection"sv,
+        "IDBCursor"sv,
+        "IDBIndex"sv,
+        "IDBObjectStore"sv,
         "ImageBitmap"sv,
         "ImageData"sv,
         "Instance"sv,
@@ -253,7 +257,7 @@ CppType idl_type_name_to_cpp_type(Type const& type, Interface const& interface)
 
 static ByteString make_input_acceptable_cpp(ByteString const& input)
 {
-    if (input.is_one_of("class", "template", "for", "default", "char", "namespace", "delete", "inline")) {
+    if (input.is_one_of("class", "template", "for", "default", "char", "namespace", "delete", "inline", "continue")) {
         StringBuilder builder;
         builder.append(input);
         builder.append('_');
@@ -412,7 +416,10 @@ static void generate_to_integral(SourceGenerator& scoped_generator, ParameterTyp
     scoped_generator.set("enforce_range", parameter.extended_attributes.contains("EnforceRange") ? "Yes" : "No");
     scoped_generator.set("clamp", parameter.extended_attributes.contains("Clamp") ? "Yes" : "No");
 
-    if ((!optional && !parameter.type->is_nullable()) || optional_default_value.has_value()) {
+    // A nullable integer that defaults to null is left empty.
+    auto has_default_value = optional_default_value.has_value() && optional_default_value.value() != "null"sv;
+
+    if ((!optional && !parameter.type->is_nullable()) || has_default_value) {
         scoped_generator.append(R"~~~(
     @cpp_type@ @cpp_name@;
 )~~~");
@@ -442,7 +449,7 @@ static void generate_to_integral(SourceGenerator& scoped_generator, ParameterTyp
 )~~~");
     }
 
-    if (optional_default_value.has_value()) {
+    if (has_default_value) {
         scoped_generator.append(R"~~~(
     else
         @cpp_name@ = static_cast<@cpp_type@>(@parameter.optional_default_value@);
@@ -1669,6 +1676,9 @@ static void generate_wrap_statement(SourceGenerator& generator, ByteString const
         @result_expression@ JS::js_null();
     } else {
 )~~~");
+            // The wrapping below expects the primitive itself, not the Optional holding it.
+            if (type.is_primitive())
+                scoped_generator.set("value", ByteString::formatted("{}.value()", value));
         } else {
             scoped_generator.append(R"~~~(
     if (!@value@) {
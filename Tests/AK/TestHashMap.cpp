@@ -327,3 +327,33 @@ TEST_CASE(move_assign)
     EXPECT_EQ(second.size(), static_cast<size_t>(3));
     EXPECT_EQ(second.get(2), Optional<int>(20));
 }
+
+BENCHMARK_CASE(hashmap_set_and_get_integers)
+{
+    HashMap<u32, u32> map;
+    for (u32 i = 0; i < 100'000; ++i)
+        map.set(i * 2654435761u, i);
+
+    u64 sum = 0;
+    for (u32 i = 0; i < 100'000; ++i)
+        sum += map.get(i * 2654435761u).value();
+    EXPECT_EQ(sum, 4'999'950'000u);
+}
+
+BENCHMARK_CASE(hashmap_set_and_get_strings)
+{
+    Vector<String> keys;
+    for (size_t i = 0; i < 20'000; ++i)
+        keys.append(MUST(String::formatted("key-{}", i)));
+
+    HashMap<String, size_t> map;
+    for (size_t i = 0; i < keys.size(); ++i)
+        map.set(keys[i], i);
+
+    for (size_t i = 0; i < keys.size(); ++i)
+        EXPECT_EQ(map.get(keys[i]), i);
+
+    for (auto const& key : keys)
+        map.remove(key);
+    EXPECT(map.is_empty());
+}
@@ -126,6 +126,43 @@ TEST_CASE(deflate_decompress_zeroes)
     EXPECT(uncompressed == decompressed.value().bytes());
 }
 
+TEST_CASE(deflate_decompress_available_input)
+{
+    // Two messages that are sync-flushed and share a window, as with the WebSocket permessage-deflate extension.
+    Array<u8, 23> const first_message {
+        0xf2, 0x48, 0xcd, 0xc9, 0xc9, 0xd7, 0x51, 0x08, 0xcf, 0x2f, 0xca, 0x49,
+        0x51, 0x54, 0xf0, 0x40, 0xe6, 0x01, 0x00, 0x00, 0x00, 0xff, 0xff
+    };
+    Array<u8, 9> const second_message {
+        0xf2, 0xc0, 0x2d, 0x05, 0x00, 0x00, 0x00, 0xff, 0xff
+    };
+
+    // A message that ends with a final block, followed by one that refers back to it (RFC 7692, section 7.2.3).
+    Array<u8, 12> const final_message {
+        0xf3, 0x48, 0xcd, 0xc9, 0xc9, 0x07, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff
+    };
+    Array<u8, 8> const message_after_final {
+        0x02, 0x13, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff
+    };
+
+    AllocatingMemoryStream input_stream;
+    LittleEndianInputBitStream bit_stream { MaybeOwned<Stream>(input_stream) };
+    auto decompressor = MUST(Compress::DeflateDecompressor::construct(MaybeOwned<LittleEndianInputBitStream>(bit_stream)));
+
+    auto decompress = [&](ReadonlyBytes message) {
+        MUST(input_stream.write_until_depleted(message));
+
+        ByteBuffer output;
+        MUST(decompressor->decompress_available_input(output));
+        return ByteString { output.bytes() };
+    };
+
+    EXPECT_EQ(decompress(first_message), "Hello, World! Hello, World!"sv);
+    EXPECT_EQ(decompress(second_message), "Hello, World! Hello, World!"sv);
+    EXPECT_EQ(decompress(final_message), "Hello"sv);
+    EXPECT_EQ(decompress(message_after_final), "Hello"sv);
+}
+
 TEST_CASE(deflate_round_trip_store)
 {
     auto original = ByteBuffer::create_uninitialized(1024).release_value();
@@ -180,3 +217,39 @@ TEST_CASE(ossfuzz_58046)
     auto test_data = TRY_OR_FAIL(test_file->read_until_eof());
     EXPECT(Compress::DeflateDecompressor::decompress_all(test_data).is_error());
 }
+
+static ByteBuffer generate_text(size_t word_count)
+{
+    static constexpr Array words { "lorem"sv, "ipsum"sv, "dolor"sv, "sit"sv, "amet"sv, "consectetur"sv, "adipiscing"sv, "elit"sv, "sed"sv, "do"sv, "eiusmod"sv, "tempor"sv, "incididunt"sv, "ut"sv, "labore"sv, "et"sv };
+
+    // A fixed linear congruential generator keeps the input (and so the results) the same across runs.
+    u32 seed = 42;
+    StringBuilder builder;
+    for (size_t i = 0; i < word_count; ++i) {
+        seed = seed * 1103515245 + 12345;
+        builder.append(words[(seed >> 16) % words.size()]);
+        builder.append((seed >> 8) % 12 == 0 ? ".\n"sv : " "sv);
+    }
+    return MUST(builder.to_byte_buffer());
+}
+
+static auto g_text = generate_text(200'000);
+static auto g_compressed_text = Compress::DeflateCompressor::compress_all(g_text, Compress::DeflateCompressor::CompressionLevel::GOOD).release_value();
+
+BENCHMARK_CASE(deflate_compress_text_fast)
+{
+    auto compressed = TRY_OR_FAIL(Compress::DeflateCompressor::compress_all(g_text, Compress::DeflateCompressor::CompressionLevel::FAST));
+    EXPECT(compressed.size() < g_text.size());
+}
+
+BENCHMARK_CASE(deflate_compress_text_good)
+{
+    auto compressed = TRY_OR_FAIL(Compress::DeflateCompressor::compress_all(g_text, Compress::DeflateCompressor::CompressionLevel::GOOD));
+    EXPECT(compressed.size() < g_text.size());
+}
+
+BENCHMARK_CASE(deflate_decompress_text)
+{
+    auto decompressed = TRY_OR_FAIL(Compress::DeflateDecompressor::decompress_all(g_compressed_text));
+    EXPECT_EQ(decompressed.size(), g_text.size());
+}
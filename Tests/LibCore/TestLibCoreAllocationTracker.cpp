@@ -0,0 +1,129 @@
+/*
+ * Copyright (c) 2024, the SerenityOS developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/JsonObject.h>
+#include <LibCore/AllocationTracker.h>
+#include <LibTest/TestCase.h>
+#include <errno.h>
+#include <stdlib.h>
+
+// NOTE: Calls through a volatile pointer, so that the compiler cannot elide the allocations.
+static void* (*volatile s_malloc)(size_t) = malloc;
+
+static void allocate(size_t size, size_t count)
+{
+    for (size_t i = 0; i < count; ++i)
+        free(s_malloc(size));
+}
+
+TEST_CASE(disabled_tracker_counts_nothing)
+{
+    Core::AllocationTracker::set_enabled(false);
+    (void)Core::AllocationTracker::take_report();
+
+    {
+        Core::AllocationTracker::ScopedTag tag { "Test"sv };
+        allocate(64, 10);
+    }
+
+    auto report = Core::AllocationTracker::take_report();
+    EXPECT(!report.get_object("tags"sv)->has("Test"sv));
+}
+
+TEST_CASE(allocations_are_attributed_to_innermost_tag)
+{
+    if (!Core::AllocationTracker::is_supported())
+        return;
+
+    Core::AllocationTracker::set_enabled(true);
+    (void)Core::AllocationTracker::take_report();
+
+    {
+        Core::AllocationTracker::ScopedTag outer { "Outer"sv };
+        allocate(100, 3);
+
+        {
+            Core::AllocationTracker::ScopedTag inner { "Inner"sv };
+            allocate(1000, 5);
+        }
+    }
+
+    Core::AllocationTracker::set_enabled(false);
+
+    auto report = Core::AllocationTracker::take_report();
+    auto tags = report.get_object("tags"sv).release_value();
+
+    auto outer = tags.get_object("Outer"sv).release_value();
+    EXPECT_EQ(outer.get_u64("allocations"sv), 3u);
+    EXPECT_EQ(outer.get_u64("bytes"sv), 300u);
+
+    auto inner = tags.get_object("Inner"sv).release_value();
+    EXPECT_EQ(inner.get_u64("allocations"sv), 5u);
+    EXPECT_EQ(inner.get_u64("bytes"sv), 5000u);
+
+    // Taking the report resets the statistics.
+    report = Core::AllocationTracker::take_report();
+    EXPECT(!report.get_object("tags"sv)->has("Inner"sv));
+}
+
+TEST_CASE(sampled_allocation_sites)
+{
+    if (!Core::AllocationTracker::is_supported())
+        return;
+
+    Core::AllocationTracker::set_sample_interval(4096);
+    Core::AllocationTracker::set_enabled(true);
+    (void)Core::AllocationTracker::take_report();
+
+    {
+        Core::AllocationTracker::ScopedTag tag { "Sampled"sv };
+        allocate(4096, 8);
+    }
+
+    Core::AllocationTracker::set_enabled(false);
+    Core::AllocationTracker::set_sample_interval(0);
+
+    auto report = Core::AllocationTracker::take_report();
+    auto sites = report.get_array("sampled_allocation_sites"sv).release_value();
+    EXPECT(!sites.is_empty());
+
+    u64 samples = 0;
+    sites.for_each([&](auto const& site) {
+        if (site.as_object().get_byte_string("tag"sv) == "Sampled"sv)
+            samples += site.as_object().get_u64("samples"sv).value_or(0);
+    });
+    EXPECT(samples >= 7u);
+}
+
+TEST_CASE(aligned_allocations_are_tracked)
+{
+    if (!Core::AllocationTracker::is_supported())
+        return;
+
+    Core::AllocationTracker::set_enabled(true);
+    (void)Core::AllocationTracker::take_report();
+
+    {
+        Core::AllocationTracker::ScopedTag tag { "Aligned"sv };
+
+        void* pointer = nullptr;
+        EXPECT_EQ(posix_memalign(&pointer, 64, 256), 0);
+        free(pointer);
+
+        // NOTE: Called through a volatile pointer for the same reason as malloc() above.
+        void* (*volatile aligned_alloc_function)(size_t, size_t) = aligned_alloc;
+        free(aligned_alloc_function(128, 512));
+
+        EXPECT_EQ(posix_memalign(&pointer, 3, 256), EINVAL);
+    }
+
+    Core::AllocationTracker::set_enabled(false);
+
+    auto report = Core::AllocationTracker::take_report();
+    auto aligned = report.get_object("tags"sv)->get_object("Aligned"sv).release_value();
+    EXPECT_EQ(aligned.get_u64("allocations"sv), 2u);
+    EXPECT_EQ(aligned.get_u64("bytes"sv), 768u);
+}
@@ -0,0 +1,77 @@
+/*
+ * Copyright (c) 2024, the SerenityOS developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/JsonObject.h>
+#include <AK/JsonValue.h>
+#include <LibCore/Tracing.h>
+#include <LibTest/TestCase.h>
+
+static JsonArray take_trace_events()
+{
+    auto json = MUST(JsonValue::from_string(MUST(Core::Tracing::take_events_as_chrome_trace_json())));
+    return json.as_object().get_array("traceEvents"sv).release_value();
+}
+
+TEST_CASE(disabled_tracer_records_nothing)
+{
+    Core::Tracing::set_enabled(false);
+    (void)take_trace_events();
+
+    {
+        Core::Tracing::ScopedEvent event { "Test"sv, "disabled"sv };
+    }
+
+    EXPECT(take_trace_events().is_empty());
+}
+
+TEST_CASE(scoped_events)
+{
+    Core::Tracing::set_enabled(true);
+    (void)take_trace_events();
+
+    {
+        Core::Tracing::ScopedEvent outer { "Test"sv, "outer"sv };
+        Core::Tracing::ScopedEvent inner { "Test"sv, "inner"sv };
+    }
+
+    Core::Tracing::set_enabled(false);
+
+    auto events = take_trace_events();
+    EXPECT_EQ(events.size(), 2u);
+
+    // Events are recorded when they end, so the innermost scope comes first.
+    auto const& inner = events.at(0).as_object();
+    EXPECT_EQ(inner.get_byte_string("name"sv), "inner"sv);
+    EXPECT_EQ(inner.get_byte_string("cat"sv), "Test"sv);
+    EXPECT_EQ(inner.get_byte_string("ph"sv), "X"sv);
+
+    auto const& outer = events.at(1).as_object();
+    EXPECT_EQ(outer.get_byte_string("name"sv), "outer"sv);
+    EXPECT(outer.get_double_with_precision_loss("ts"sv).value() <= inner.get_double_with_precision_loss("ts"sv).value());
+    EXPECT(outer.get_double_with_precision_loss("dur"sv).value() >= inner.get_double_with_precision_loss("dur"sv).value());
+
+    // Taking the events empties the buffers.
+    EXPECT(take_trace_events().is_empty());
+}
+
+TEST_CASE(ring_buffer_keeps_most_recent_events)
+{
+    Core::Tracing::set_enabled(true);
+    (void)take_trace_events();
+
+    auto now = MonotonicTime::now();
+    Core::Tracing::record_event("Test"sv, "old"sv, now, now);
+    for (size_t i = 0; i < 20000; ++i)
+        Core::Tracing::record_event("Test"sv, "new"sv, now, now);
+
+    Core::Tracing::set_enabled(false);
+
+    auto events = take_trace_events();
+    EXPECT(events.size() < 20000u);
+    events.for_each([](auto const& event) {
+        EXPECT_EQ(event.as_object().get_byte_string("name"sv), "new"sv);
+    });
+}
@@ -0,0 +1,49 @@
+/*
+ * Copyright (c) 2024, the SerenityOS developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibCore/File.h>
+#include <LibGfx/Bitmap.h>
+#include <LibGfx/ImageFormats/PNGLoader.h>
+#include <LibGfx/ImageFormats/PNGWriter.h>
+#include <LibTest/TestCase.h>
+
+#ifdef AK_OS_SERENITY
+#    define TEST_INPUT(x) ("/usr/Tests/LibGfx/test-inputs/" x)
+#else
+#    define TEST_INPUT(x) ("test-inputs/" x)
+#endif
+
+static ByteBuffer encode_gradient_image()
+{
+    auto bitmap = MUST(Gfx::Bitmap::create(Gfx::BitmapFormat::BGRA8888, { 1024, 768 }));
+    for (int y = 0; y < bitmap->height(); ++y) {
+        for (int x = 0; x < bitmap->width(); ++x)
+            bitmap->set_pixel(x, y, Color(x % 256, y % 256, (x + y) % 256, 255 - (x % 128)));
+    }
+    return MUST(Gfx::PNGWriter::encode(*bitmap));
+}
+
+auto small_image = Core::File::open(TEST_INPUT("png/buggie.png"sv), Core::File::OpenMode::Read).release_value()->read_until_eof().release_value();
+auto wide_gamut_image = Core::File::open(TEST_INPUT("png/wide-gamut-only.png"sv), Core::File::OpenMode::Read).release_value()->read_until_eof().release_value();
+auto big_image = encode_gradient_image();
+
+BENCHMARK_CASE(small_image)
+{
+    auto plugin_decoder = MUST(Gfx::PNGImageDecoderPlugin::create(small_image));
+    MUST(plugin_decoder->frame(0));
+}
+
+BENCHMARK_CASE(wide_gamut_image)
+{
+    auto plugin_decoder = MUST(Gfx::PNGImageDecoderPlugin::create(wide_gamut_image));
+    MUST(plugin_decoder->frame(0));
+}
+
+BENCHMARK_CASE(big_image)
+{
+    auto plugin_decoder = MUST(Gfx::PNGImageDecoderPlugin::create(big_image));
+    MUST(plugin_decoder->frame(0));
+}
@@ -0,0 +1,246 @@
+/*
+ * Copyright (c) 2024, the SerenityOS developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibJS/Bytecode/Interpreter.h>
+#include <LibJS/Runtime/GlobalObject.h>
+#include <LibJS/Runtime/VM.h>
+#include <LibJS/Script.h>
+#include <LibTest/TestCase.h>
+
+static JS::Realm& realm()
+{
+    // NOTE: These are intentionally leaked, as tearing down the VM at exit is not what we're measuring.
+    static auto& vm = MUST(JS::VM::create()).leak_ref();
+    static auto* execution_context = JS::create_simple_execution_context<JS::GlobalObject>(vm).leak_ptr();
+    return *execution_context->realm;
+}
+
+static void run_script(StringView source)
+{
+    auto& realm = ::realm();
+
+    auto script = JS::Script::parse(source, realm);
+    VERIFY(!script.is_error());
+
+    auto result = realm.vm().bytecode_interpreter().run(*script.value());
+    EXPECT(!result.is_error());
+}
+
+BENCHMARK_CASE(parse_functions)
+{
+    StringBuilder builder;
+    for (size_t i = 0; i < 1000; ++i)
+        builder.appendff("function f{}(a, b) {{ let c = a + b * {}; if (c > 10) return [c, {{ a, b }}]; return c; }}\n", i, i);
+
+    auto& realm = ::realm();
+    auto script = JS::Script::parse(builder.string_view(), realm);
+    EXPECT(!script.is_error());
+}
+
+BENCHMARK_CASE(arithmetic_loop)
+{
+    run_script(R"(
+        let sum = 0;
+        for (let i = 0; i < 1000000; ++i)
+            sum = (sum + i * 3) % 65521;
+    )"sv);
+}
+
+BENCHMARK_CASE(property_access)
+{
+    run_script(R"(
+        let points = [];
+        for (let i = 0; i < 10000; ++i)
+            points.push({ x: i, y: i * 2, z: i * 3 });
+
+        let total = 0;
+        for (let j = 0; j < 10; ++j) {
+            for (const point of points)
+                total += point.x + point.y + point.z;
+        }
+    )"sv);
+}
+
+BENCHMARK_CASE(function_calls)
+{
+    run_script(R"(
+        function fib(n) { return n < 2 ? n : fib(n - 1) + fib(n - 2); }
+        fib(22);
+    )"sv);
+}
+
+BENCHMARK_CASE(string_building)
+{
+    run_script(R"(
+        let parts = [];
+        for (let i = 0; i < 20000; ++i)
+            parts.push("item" + i);
+        let joined = parts.join(",");
+        joined.split(",").length;
+    )"sv);
+}
+
+BENCHMARK_CASE(array_sort)
+{
+    run_script(R"(
+        let values = [];
+        let seed = 42;
+        for (let i = 0; i < 20000; ++i) {
+            seed = (seed * 1103515245 + 12345) % 2147483648;
+            values.push(seed);
+        }
+        values.sort((a, b) => a - b);
+    )"sv);
+}
+
+BENCHMARK_CASE(await_loop)
+{
+    run_script(R"(
+        async function leaf(i) { return i; }
+        async function chain() {
+            let total = 0;
+            for (let i = 0; i < 50000; ++i) {
+                total += await leaf(i);
+                total += await i;
+            }
+            return total;
+        }
+        chain();
+    )"sv);
+}
+
+BENCHMARK_CASE(promise_then_chain)
+{
+    run_script(R"(
+        let promise = Promise.resolve(0);
+        for (let i = 0; i < 50000; ++i)
+            promise = promise.then(value => value + 1);
+    )"sv);
+}
+
+BENCHMARK_CASE(global_variable_access)
+{
+    // Lexical globals from one script, read through GetGlobal by functions in another.
+    run_script(R"(
+        const globalScale = 3;
+        let globalOffset = 7;
+        var globalTotal = 0;
+    )"sv);
+
+    run_script(R"(
+        function accumulate(i) { globalTotal = (globalTotal + i * globalScale + globalOffset) % 65521; }
+        for (let i = 0; i < 500000; ++i)
+            accumulate(i);
+    )"sv);
+}
+
+BENCHMARK_CASE(typed_array_access)
+{
+    run_script(R"(
+        const pixels = new Uint8ClampedArray(256 * 256 * 4);
+        const weights = new Float32Array(256 * 256);
+        for (let i = 0; i < weights.length; ++i)
+            weights[i] = (i % 255) / 255;
+
+        for (let pass = 0; pass < 4; ++pass) {
+            for (let i = 0; i < weights.length; ++i)
+                pixels[i * 4] = pixels[i * 4 + 1] + weights[i] * 255;
+        }
+
+        pixels.fill(0x7f);
+        pixels.copyWithin(0, 4);
+        pixels.indexOf(0x80);
+        new Float64Array(1 << 20).fill(0.5).indexOf(1);
+    )"sv);
+}
+
+BENCHMARK_CASE(array_sort_presorted_and_default)
+{
+    run_script(R"(
+        const ascending = Array.from({ length: 1 << 20 }, (_, i) => i);
+        ascending.sort((a, b) => a - b);
+        ascending.reverse().sort((a, b) => a - b);
+
+        let seed = 42;
+        const strings = [];
+        for (let i = 0; i < 1 << 20; ++i) {
+            seed = (seed * 1103515245 + 12345) % 2147483648;
+            strings.push(seed);
+        }
+        strings.sort();
+    )"sv);
+}
+
+BENCHMARK_CASE(typed_array_sort)
+{
+    run_script(R"(
+        let seed = 42;
+        const integers = new Int32Array(1 << 20);
+        const floats = new Float64Array(1 << 20);
+        for (let i = 0; i < integers.length; ++i) {
+            seed = (seed * 1103515245 + 12345) % 2147483648;
+            integers[i] = seed - 1073741824;
+            floats[i] = seed / 1024;
+        }
+        integers.sort();
+        floats.toSorted();
+    )"sv);
+}
+
+BENCHMARK_CASE(string_split_and_slice)
+{
+    run_script(R"(
+        const row = "2024-01-01T00:00:00Z,INFO,some component name,a somewhat longer log message for this row\n";
+        const log = row.repeat(20000);
+
+        let total = 0;
+        for (const line of log.split("\n")) {
+            const fields = line.split(",");
+            if (fields.length === 4)
+                total += fields[3].slice(2).trim().length + line.substring(0, 20).length;
+        }
+    )"sv);
+}
+
+BENCHMARK_CASE(regexp_compile_and_exec)
+{
+    run_script(R"(
+        const template = "Hello {{name}}, you have {{count}} new {{things}}! ".repeat(10);
+        const values = { name: "friend", count: "3", things: "messages" };
+
+        let total = 0;
+        for (let i = 0; i < 20000; ++i) {
+            const key = ["name", "count", "things"][i % 3];
+            const re = new RegExp("\\{\\{" + key + "\\}\\}", "g");
+            total += template.replace(re, values[key]).length;
+            total += template.split(/\s+/).length;
+            if (/^Hello/.test(template))
+                ++total;
+        }
+    )"sv);
+}
+
+BENCHMARK_CASE(object_literal_and_class_allocation)
+{
+    run_script(R"(
+        class Vector3 {
+            constructor(x, y, z) {
+                this.x = x;
+                this.y = y;
+                this.z = z;
+                this.length = Math.sqrt(x * x + y * y + z * z);
+                this.normalized = false;
+            }
+        }
+
+        let total = 0;
+        for (let i = 0; i < 200000; ++i) {
+            const point = { x: i, y: i + 1, z: i + 2, label: "point", visible: true, weight: 1.5 };
+            const vector = new Vector3(point.x, point.y, point.z);
+            total += point.weight + vector.length;
+        }
+    )"sv);
+}
@@ -998,6 +998,28 @@ BENCHMARK_CASE(fork_performance)
     EXPECT_EQ(result.success, true);
 }
 
+static auto g_log_lines = [] {
+    StringBuilder builder;
+    for (size_t i = 0; i < 10'000; ++i)
+        builder.appendff("2024-01-{:02} 12:{:02}:{:02} [worker-{}] GET /api/items/{} from user{}@example.com took {}ms\n", i % 28 + 1, i % 60, (i * 7) % 60, i % 8, i, i % 100, i % 500);
+    return builder.to_byte_string();
+}();
+
+BENCHMARK_CASE(search_all_matches)
+{
+    Regex<ECMA262> re("[a-z0-9]+@[a-z]+\\.com", ECMAScriptFlags::Global);
+    auto result = re.match(g_log_lines);
+    EXPECT_EQ(result.success, true);
+    EXPECT_EQ(result.matches.size(), 10'000u);
+}
+
+BENCHMARK_CASE(case_insensitive_search)
+{
+    Regex<ECMA262> re("took 4\\d\\dMS", ECMAScriptFlags::Global | ECMAScriptFlags::Insensitive);
+    auto result = re.match(g_log_lines);
+    EXPECT_EQ(result.success, true);
+}
+
 TEST_CASE(optimizer_atomic_groups)
 {
     Array tests {
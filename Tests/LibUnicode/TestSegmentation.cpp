@@ -51,6 +51,19 @@ TEST_CASE(grapheme_segmentation)
     test_grapheme_segmentation("a👩🏼‍❤️‍👨🏻b"sv, { 0u, 1u, 29u, 30u });
 }
 
+TEST_CASE(grapheme_segmentation_from_known_boundary)
+{
+    Utf8View view { "a\r\nb👨‍👩‍👧‍👦🇺🇸🇬🇧c"sv };
+
+    Vector<size_t> boundaries;
+    for (size_t boundary = 0; boundary < view.byte_length();)
+        boundaries.append(boundary = *Unicode::next_grapheme_segmentation_boundary(view, boundary, boundary));
+
+    EXPECT_EQ(boundaries, (Vector<size_t> { 1u, 3u, 4u, 29u, 37u, 45u, 46u }));
+    EXPECT_EQ(Unicode::next_grapheme_segmentation_boundary(view, 5u, 4u), 29u);
+    EXPECT_EQ(Unicode::next_grapheme_segmentation_boundary(view, 33u, 29u), 37u);
+}
+
 TEST_CASE(grapheme_segmentation_indic_conjunct_break)
 {
     test_grapheme_segmentation("\u0915"sv, { 0u, 3u });
@@ -93,3 +93,29 @@ TEST_CASE(normalize_nfkc)
     EXPECT_EQ(normalize("\u0958"sv, NormalizationForm::NFKC), "\u0915\u093C"sv);
     EXPECT_EQ(normalize("\u2126"sv, NormalizationForm::NFKC), "\u03A9"sv);
 }
+
+TEST_CASE(normalization_quick_check)
+{
+    auto expect_quick_check = [](StringView string, QuickCheckResult nfd, QuickCheckResult nfc, QuickCheckResult nfkd, QuickCheckResult nfkc) {
+        EXPECT_EQ(normalization_quick_check(string, NormalizationForm::NFD), nfd);
+        EXPECT_EQ(normalization_quick_check(string, NormalizationForm::NFC), nfc);
+        EXPECT_EQ(normalization_quick_check(string, NormalizationForm::NFKD), nfkd);
+        EXPECT_EQ(normalization_quick_check(string, NormalizationForm::NFKC), nfkc);
+    };
+
+    auto yes = QuickCheckResult::Yes;
+    auto no = QuickCheckResult::No;
+    auto maybe = QuickCheckResult::Maybe;
+
+    expect_quick_check(""sv, yes, yes, yes, yes);
+    expect_quick_check("Hello"sv, yes, yes, yes, yes);
+    expect_quick_check("Am\u00E9lie"sv, no, yes, no, yes);
+    expect_quick_check("Ame\u0301lie"sv, yes, maybe, yes, maybe);
+    expect_quick_check("O\uFB00ice"sv, yes, yes, no, no);
+    expect_quick_check("\u2126"sv, no, no, no, no);
+
+    expect_quick_check("\u0044\u0323\u0307"sv, yes, maybe, yes, maybe);
+
+    // Combining marks that are not in canonical order.
+    expect_quick_check("\u0044\u0307\u0323"sv, no, no, no, no);
+}
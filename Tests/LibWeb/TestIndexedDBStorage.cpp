@@ -0,0 +1,413 @@
+/*
+ * Copyright (c) 2024, the SerenityOS developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibTest/TestCase.h>
+
+#include <AK/ByteString.h>
+#include <AK/Math.h>
+#include <LibCore/System.h>
+#include <LibWeb/IndexedDB/Internal/BTree.h>
+#include <LibWeb/IndexedDB/Internal/Database.h>
+#include <LibWeb/IndexedDB/Internal/DatabaseFile.h>
+
+using namespace Web::IndexedDB;
+
+static Key string_key(StringView string)
+{
+    return Key::string(MUST(String::from_utf8(string)));
+}
+
+static ByteBuffer value_for(u32 number)
+{
+    return MUST(ByteBuffer::copy(&number, sizeof(number)));
+}
+
+static ByteString temporary_path(StringView name)
+{
+    auto path = ByteString::formatted("/tmp/TestIndexedDBStorage-{}-{}", getpid(), name);
+    MUST(DatabaseFile::remove(path));
+    return path;
+}
+
+TEST_CASE(key_ordering)
+{
+    // Keys of different types are ordered by type: numbers, dates, strings, binary, and arrays.
+    Vector<Key> keys {
+        Key::number(-AK::Infinity<double>),
+        Key::number(-1),
+        Key::number(0),
+        Key::number(AK::Infinity<double>),
+        Key::date(0),
+        string_key(""sv),
+        string_key("a"sv),
+        string_key("ab"sv),
+        string_key("\U0001f600"sv),
+        string_key("\uffff"sv),
+        Key::binary(MUST(ByteBuffer::copy("\x01"sv.bytes()))),
+        Key::array({}),
+        Key::array({ Key::number(1) }),
+        Key::array({ Key::number(1), Key::number(0) }),
+        Key::array({ string_key("a"sv) }),
+    };
+
+    for (size_t i = 0; i < keys.size(); ++i) {
+        EXPECT_EQ(Key::compare(keys[i], keys[i]), 0);
+        for (size_t j = i + 1; j < keys.size(); ++j) {
+            EXPECT_EQ(Key::compare(keys[i], keys[j]), -1);
+            EXPECT_EQ(Key::compare(keys[j], keys[i]), 1);
+        }
+    }
+
+    // Strings are compared by UTF-16 code units, so a surrogate pair sorts before U+FFFF.
+    EXPECT_EQ(Key::compare(string_key("\U0001f600"sv), string_key("\uffff"sv)), -1);
+
+    // Keys survive being encoded.
+    ByteBuffer encoded;
+    for (auto const& key : keys)
+        key.encode(encoded);
+
+    size_t offset = 0;
+    for (auto const& key : keys) {
+        auto decoded = MUST(Key::decode(encoded, offset));
+        EXPECT_EQ(decoded.type(), key.type());
+        EXPECT_EQ(Key::compare(decoded, key), 0);
+    }
+    EXPECT_EQ(offset, encoded.size());
+}
+
+TEST_CASE(btree)
+{
+    BTree<Key, u32> tree;
+
+    // Insert enough keys out of order to split the leaves a few times.
+    for (u32 i = 0; i < 1000; ++i) {
+        auto number = (i * 7919) % 1000;
+        EXPECT(!tree.set(Key::number(number), number).has_value());
+    }
+    EXPECT_EQ(tree.size(), 1000u);
+
+    u32 expected = 0;
+    tree.for_each([&](auto const& entry) {
+        EXPECT_EQ(entry.key.number_value(), expected);
+        EXPECT_EQ(entry.value, expected);
+        ++expected;
+        return IterationDecision::Continue;
+    });
+    EXPECT_EQ(expected, 1000u);
+
+    EXPECT_EQ(tree.set(Key::number(500), 0), 500u);
+    EXPECT_EQ(*tree.find(Key::number(500)), 0u);
+    EXPECT_EQ(tree.remove(Key::number(500)), 0u);
+    EXPECT(!tree.contains(Key::number(500)));
+
+    EXPECT_EQ(tree.first_after(Key::number(499), false)->value, 501u);
+    EXPECT_EQ(tree.first_after(Key::number(499), true)->value, 499u);
+    EXPECT_EQ(tree.last_before(Key::number(501), false)->value, 499u);
+    EXPECT_EQ(tree.last_before(Key::number(1000), true)->value, 999u);
+    EXPECT_EQ(tree.first_after(Key::number(999), false), nullptr);
+    EXPECT_EQ(tree.last_before(Key::number(0), false), nullptr);
+    EXPECT_EQ(tree.first()->value, 0u);
+    EXPECT_EQ(tree.last()->value, 999u);
+
+    // Walk backwards from a position given by a predicate, across a few leaves.
+    Vector<u32> values;
+    tree.for_each_backward_before([](auto const& key) { return key.number_value() < 300.5; }, [&](auto const& entry) {
+        values.append(entry.value);
+        return values.size() == 200 ? IterationDecision::Break : IterationDecision::Continue;
+    });
+    EXPECT_EQ(values.size(), 200u);
+    EXPECT_EQ(values.first(), 300u);
+    EXPECT_EQ(values.last(), 101u);
+
+    for (u32 i = 0; i < 1000; ++i)
+        tree.remove(Key::number(i));
+    EXPECT(tree.is_empty());
+    EXPECT_EQ(tree.first(), nullptr);
+}
+
+TEST_CASE(revert_write_batch)
+{
+    auto database = Database::create("test"_string);
+
+    WriteBatch setup;
+    database->set_version(setup, 1);
+    auto& store = database->create_object_store(setup, "store"_string, KeyPath { "id"_string }, false);
+    auto& index = store.create_index(setup, "by_name"_string, KeyPath { "name"_string }, true, false);
+    store.put_record(setup, Key::number(1), value_for(1), { { string_key("one"sv) } });
+    store.put_record(setup, Key::number(2), value_for(2), { { string_key("two"sv) } });
+
+    EXPECT(index.has_conflicting_record(string_key("one"sv), Key::number(2)));
+    EXPECT(!index.has_conflicting_record(string_key("one"sv), Key::number(1)));
+    EXPECT(!index.has_conflicting_record(string_key("three"sv), Key::number(3)));
+
+    WriteBatch batch;
+    store.put_record(batch, Key::number(1), value_for(10), { { string_key("ten"sv) } });
+    store.put_record(batch, Key::number(3), value_for(3), { { string_key("three"sv) } });
+    store.delete_records(batch, KeyRange::only(Key::number(2)));
+    EXPECT_EQ(store.records().size(), 2u);
+    EXPECT_EQ(index.records().size(), 2u);
+    EXPECT(!index.has_conflicting_record(string_key("one"sv), Key::number(2)));
+
+    batch.revert();
+    EXPECT_EQ(store.records().size(), 2u);
+    EXPECT_EQ(*store.records().find(Key::number(1)), value_for(1));
+    EXPECT_EQ(*store.records().find(Key::number(2)), value_for(2));
+    EXPECT(!store.records().contains(Key::number(3)));
+    EXPECT_EQ(index.records().first()->key.key, string_key("one"sv));
+    EXPECT_EQ(index.records().last()->key.key, string_key("two"sv));
+
+    // Reverting a versionchange transaction takes its object stores and indexes with it.
+    WriteBatch upgrade;
+    database->set_version(upgrade, 2);
+    database->create_object_store(upgrade, "other"_string, {}, true);
+    store.delete_index(upgrade, index);
+    upgrade.revert();
+    EXPECT_EQ(database->version(), 1u);
+    EXPECT_EQ(database->object_stores().size(), 1u);
+    EXPECT_EQ(store.indexes().size(), 1u);
+}
+
+TEST_CASE(revert_write_batch_to_savepoint)
+{
+    auto database = Database::create("test"_string);
+
+    WriteBatch batch;
+    database->set_version(batch, 1);
+    auto& store = database->create_object_store(batch, "store"_string, {}, false);
+    store.put_record(batch, Key::number(1), value_for(1), {});
+
+    // A failed request only reverts its own changes, and leaves those of the requests before it in place.
+    auto savepoint = batch.savepoint();
+    store.put_record(batch, Key::number(1), value_for(10), {});
+    store.put_record(batch, Key::number(2), value_for(2), {});
+    batch.revert_to(savepoint);
+
+    EXPECT_EQ(store.records().size(), 1u);
+    EXPECT_EQ(*store.records().find(Key::number(1)), value_for(1));
+
+    store.put_record(batch, Key::number(3), value_for(3), {});
+
+    // The journal no longer contains the reverted changes either.
+    auto replayed = Database::create("test"_string);
+    MUST(replayed->replay(batch.journal()));
+    EXPECT_EQ(replayed->version(), 1u);
+    auto replayed_store = replayed->object_store("store"sv);
+    EXPECT(replayed_store);
+    EXPECT_EQ(replayed_store->records().size(), 2u);
+    EXPECT_EQ(*replayed_store->records().find(Key::number(1)), value_for(1));
+    EXPECT(!replayed_store->records().contains(Key::number(2)));
+}
+
+TEST_CASE(key_generator)
+{
+    auto database = Database::create("test"_string);
+
+    WriteBatch batch;
+    auto& store = database->create_object_store(batch, "store"_string, {}, true);
+
+    EXPECT_EQ(store.generate_key(batch)->number_value(), 1);
+    store.possibly_update_key_generator(batch, Key::number(10.5));
+    EXPECT_EQ(store.generate_key(batch)->number_value(), 11);
+    store.possibly_update_key_generator(batch, Key::number(5));
+    store.possibly_update_key_generator(batch, string_key("20"sv));
+    EXPECT_EQ(store.generate_key(batch)->number_value(), 12);
+
+    // The generator runs out after 2^53.
+    store.possibly_update_key_generator(batch, Key::number(AK::Infinity<double>));
+    EXPECT(!store.generate_key(batch).has_value());
+}
+
+TEST_CASE(journal_round_trip)
+{
+    auto path = temporary_path("round-trip"sv);
+
+    {
+        auto file = MUST(DatabaseFile::open(path));
+        auto database = MUST(file->load_database("test"_string));
+        EXPECT_EQ(database->version(), 0u);
+
+        WriteBatch upgrade;
+        database->set_version(upgrade, 3);
+        auto& store = database->create_object_store(upgrade, "store"_string, {}, true);
+        store.create_index(upgrade, "index"_string, KeyPath { Vector { "a"_string, "b"_string } }, false, true);
+        MUST(file->append_entry(upgrade.journal()));
+
+        WriteBatch batch;
+        for (u32 i = 0; i < 100; ++i) {
+            auto key = store.generate_key(batch).release_value();
+            store.put_record(batch, key, value_for(i), { { Key::number(i % 10), Key::number(i % 10 + 100) } });
+        }
+        store.delete_records(batch, { Key::number(50), Key::number(60), true, false });
+        MUST(file->append_entry(batch.journal()));
+
+        // An aborted transaction never reaches the journal.
+        WriteBatch aborted;
+        database->delete_object_store(aborted, store);
+        aborted.revert();
+    }
+
+    auto file = MUST(DatabaseFile::open(path));
+    auto database = MUST(file->load_database("test"_string));
+    EXPECT_EQ(database->version(), 3u);
+    EXPECT_EQ(database->object_stores().size(), 1u);
+
+    auto store = database->object_store("store"sv);
+    EXPECT(store);
+    EXPECT_EQ(store->records().size(), 90u);
+    EXPECT_EQ(*store->records().find(Key::number(50)), value_for(49));
+    EXPECT(!store->records().contains(Key::number(51)));
+    EXPECT_EQ(*store->records().find(Key::number(61)), value_for(60));
+
+    auto index = store->index("index"sv);
+    EXPECT(index);
+    EXPECT(index->multi_entry());
+    EXPECT_EQ(index->records().size(), 180u);
+
+    WriteBatch batch;
+    EXPECT_EQ(store->generate_key(batch)->number_value(), 101);
+
+    MUST(DatabaseFile::remove(path));
+}
+
+TEST_CASE(journal_torn_entry)
+{
+    auto path = temporary_path("torn-entry"sv);
+
+    {
+        auto file = MUST(DatabaseFile::open(path));
+        auto database = MUST(file->load_database("test"_string));
+
+        WriteBatch batch;
+        auto& store = database->create_object_store(batch, "store"_string, {}, false);
+        store.put_record(batch, Key::number(1), value_for(1), {});
+        MUST(file->append_entry(batch.journal()));
+    }
+
+    // Pretend the process went away halfway through writing a second entry.
+    {
+        auto file = MUST(Core::File::open(path, Core::File::OpenMode::Write | Core::File::OpenMode::Append));
+        u32 header[2] = { 1000, 0 };
+        MUST(file->write_until_depleted({ header, sizeof(header) }));
+        MUST(file->write_until_depleted("partial"sv.bytes()));
+    }
+
+    auto size_with_torn_entry = MUST(Core::System::stat(path)).st_size;
+
+    auto file = MUST(DatabaseFile::open(path));
+    auto database = MUST(file->load_database("test"_string));
+    EXPECT_EQ(database->object_store("store"sv)->records().size(), 1u);
+    EXPECT(MUST(Core::System::stat(path)).st_size < size_with_torn_entry);
+
+    MUST(DatabaseFile::remove(path));
+}
+
+TEST_CASE(journal_compaction)
+{
+    auto path = temporary_path("compaction"sv);
+
+    {
+        auto file = MUST(DatabaseFile::open(path));
+        auto database = MUST(file->load_database("test"_string));
+
+        WriteBatch upgrade;
+        auto& store = database->create_object_store(upgrade, "store"_string, {}, false);
+        MUST(file->append_entry(upgrade.journal()));
+
+        // Keep overwriting the same record, so that most of the journal is redundant.
+        for (u32 i = 0; i < 100; ++i) {
+            WriteBatch batch;
+            store.put_record(batch, Key::number(0), value_for(i), {});
+            MUST(file->append_entry(batch.journal()));
+        }
+    }
+
+    auto size_before_compaction = MUST(Core::System::stat(path)).st_size;
+
+    {
+        auto file = MUST(DatabaseFile::open(path));
+        auto database = MUST(file->load_database("test"_string));
+        EXPECT_EQ(*database->object_store("store"sv)->records().find(Key::number(0)), value_for(99));
+    }
+
+    EXPECT(MUST(Core::System::stat(path)).st_size < size_before_compaction);
+
+    auto file = MUST(DatabaseFile::open(path));
+    auto database = MUST(file->load_database("test"_string));
+    EXPECT_EQ(*database->object_store("store"sv)->records().find(Key::number(0)), value_for(99));
+
+    MUST(DatabaseFile::remove(path));
+}
+
+TEST_CASE(journal_is_locked_while_open)
+{
+    auto path = temporary_path("locked"sv);
+
+    {
+        auto file = MUST(DatabaseFile::open(path));
+        (void)MUST(file->load_database("test"_string));
+
+        // Entries from two owners would interleave, so a journal that is in use can't be opened again.
+        EXPECT(DatabaseFile::open(path).is_error());
+
+        // Compacting the journal replaces its file, which must be locked as well.
+        MUST(file->rewrite(Database::create("test"_string)->snapshot()));
+        EXPECT(DatabaseFile::open(path).is_error());
+    }
+
+    auto file = MUST(DatabaseFile::open(path));
+    (void)MUST(file->load_database("test"_string));
+
+    MUST(DatabaseFile::remove(path));
+}
+
+static constexpr u32 bulk_record_count = 100'000;
+
+BENCHMARK_CASE(bulk_put_and_get)
+{
+    auto path = temporary_path("bulk"sv);
+    RefPtr<DatabaseFile> file = MUST(DatabaseFile::open(path));
+    auto database = MUST(file->load_database("bulk"_string));
+
+    WriteBatch upgrade;
+    auto& store = database->create_object_store(upgrade, "store"_string, {}, true);
+    store.create_index(upgrade, "index"_string, KeyPath { "value"_string }, false, false);
+    MUST(file->append_entry(upgrade.journal()));
+
+    // Put every record in one transaction, so that they are written to disk together.
+    WriteBatch batch;
+    for (u32 i = 0; i < bulk_record_count; ++i) {
+        auto key = store.generate_key(batch).release_value();
+        store.put_record(batch, move(key), value_for(i), { { Key::number(bulk_record_count - i) } });
+    }
+    MUST(file->append_entry(batch.journal()));
+
+    for (u32 i = 1; i <= bulk_record_count; ++i)
+        EXPECT(store.records().find(Key::number(i)));
+
+    // The journal stays locked until its file is closed.
+    file = nullptr;
+    auto reopened_database = MUST(MUST(DatabaseFile::open(path))->load_database("bulk"_string));
+    EXPECT_EQ(reopened_database->object_store("store"sv)->records().size(), bulk_record_count);
+
+    MUST(DatabaseFile::remove(path));
+}
+
+BENCHMARK_CASE(bulk_put_random_keys)
+{
+    auto database = Database::create("bulk"_string);
+
+    WriteBatch batch;
+    auto& store = database->create_object_store(batch, "store"_string, {}, false);
+
+    u32 state = 1;
+    for (u32 i = 0; i < bulk_record_count; ++i) {
+        state = state * 1664525 + 1013904223;
+        store.put_record(batch, Key::number(state), value_for(i), {});
+    }
+
+    for (u32 i = 0; i < bulk_record_count; ++i)
+        (void)store.records().find(Key::number(i));
+}
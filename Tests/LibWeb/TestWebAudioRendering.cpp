@@ -0,0 +1,213 @@
+/*
+ * Copyright (c) 2024, the SerenityOS developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibTest/TestCase.h>
+
+#include <AK/Math.h>
+#include <LibWeb/WebAudio/DSP.h>
+#include <LibWeb/WebAudio/RenderGraph.h>
+#include <LibWeb/WebAudio/RenderNodes.h>
+
+using namespace Web::WebAudio;
+
+static constexpr float sample_rate = 44100;
+
+static NonnullRefPtr<RenderParam> create_gain_param(float value = 1)
+{
+    return RenderParam::create(value, NumericLimits<float>::lowest(), NumericLimits<float>::max(), Web::Bindings::AutomationRate::ARate);
+}
+
+static NonnullRefPtr<RenderParam> create_frequency_param(float value)
+{
+    return RenderParam::create(value, -sample_rate / 2, sample_rate / 2, Web::Bindings::AutomationRate::ARate);
+}
+
+TEST_CASE(sine_oscillator)
+{
+    Array<float, 1000> output;
+    Array<float, 1000> frequencies;
+    frequencies.fill(440);
+
+    auto phase = DSP::generate_oscillator(output, frequencies, sample_rate, 0, Web::Bindings::OscillatorType::Sine);
+
+    for (size_t i = 0; i < output.size(); ++i)
+        EXPECT_APPROXIMATE_WITH_ERROR(output[i], AK::sin(2 * AK::Pi<double> * 440 * i / sample_rate), 1e-4);
+
+    EXPECT_APPROXIMATE_WITH_ERROR(phase, 440 * 1000 / sample_rate - AK::floor(440 * 1000 / sample_rate), 1e-4);
+}
+
+TEST_CASE(mixing_kernels)
+{
+    // An odd length exercises both the vectorized loop and the scalar tail.
+    Array<float, 7> destination { 1, 2, 3, 4, 5, 6, 7 };
+    Array<float, 7> source { -1, -1, -1, -1, -1, -1, -1 };
+
+    DSP::add(destination, source);
+    EXPECT_EQ(destination, (Array<float, 7> { 0, 1, 2, 3, 4, 5, 6 }));
+
+    DSP::add_scaled(destination, source, 2);
+    EXPECT_EQ(destination, (Array<float, 7> { -2, -1, 0, 1, 2, 3, 4 }));
+
+    DSP::multiply(destination, destination, 0.5f);
+    EXPECT_EQ(destination, (Array<float, 7> { -1, -0.5f, 0, 0.5f, 1, 1.5f, 2 }));
+
+    DSP::clamp(destination, -0.5f, 1);
+    EXPECT_EQ(destination, (Array<float, 7> { -0.5f, -0.5f, 0, 0.5f, 1, 1, 1 }));
+
+    Array<float, 7> magnitudes {};
+    DSP::max_magnitude(magnitudes, destination);
+    EXPECT_EQ(magnitudes, (Array<float, 7> { 0.5f, 0.5f, 0, 0.5f, 1, 1, 1 }));
+}
+
+TEST_CASE(param_automation)
+{
+    auto param = create_gain_param(0);
+    param->insert_event({ .type = AutomationEvent::Type::SetValue, .time = 0, .value = 1 });
+    param->insert_event({ .type = AutomationEvent::Type::LinearRamp, .time = 256.0 / sample_rate, .value = 3 });
+
+    AudioBus::Channel values;
+
+    // The ramp runs from 1 to 3 over the first two render quanta, and holds its value after that.
+    param->compute_values({ .sample_rate = sample_rate, .frame = 0, .index = 0 }, values);
+    EXPECT_EQ(values[0], 1);
+    EXPECT_APPROXIMATE(values[64], 1.5f);
+
+    param->compute_values({ .sample_rate = sample_rate, .frame = 128, .index = 1 }, values);
+    EXPECT_APPROXIMATE(values[0], 2);
+    EXPECT_EQ(param->current_value(), values[0]);
+
+    EXPECT(param->compute_values({ .sample_rate = sample_rate, .frame = 256, .index = 2 }, values));
+    EXPECT_EQ(values[127], 3);
+
+    // A k-rate parameter only changes once per render quantum.
+    param->cancel_scheduled_values(0);
+    param->set_automation_rate(Web::Bindings::AutomationRate::KRate);
+    param->insert_event({ .type = AutomationEvent::Type::LinearRamp, .time = 1, .value = 0 });
+    EXPECT(param->compute_values({ .sample_rate = sample_rate, .frame = 0, .index = 3 }, values));
+}
+
+TEST_CASE(render_graph)
+{
+    auto graph = RenderGraph::create(sample_rate);
+    auto destination = AudioDestinationRenderNode::create(2);
+    graph->set_destination(destination);
+
+    // Nothing is connected yet, so the destination hears silence.
+    EXPECT(graph->render_quantum().is_silent());
+
+    auto frequency = create_frequency_param(440);
+    auto oscillator = OscillatorRenderNode::create(Web::Bindings::OscillatorType::Square, frequency);
+    auto gain = create_gain_param(0.5f);
+    auto gain_node = GainRenderNode::create(gain);
+
+    graph->connect(oscillator, gain_node, 0);
+    graph->connect(gain_node, destination, 0);
+
+    // The oscillator hasn't been started.
+    EXPECT(graph->render_quantum().is_silent());
+
+    // Start it halfway through the next render quantum, and stop it in the one after that.
+    oscillator->start(graph->current_time() + 64.0 / sample_rate);
+    oscillator->stop(graph->current_time() + 192.0 / sample_rate);
+
+    auto const& first = graph->render_quantum();
+    EXPECT(!first.is_silent());
+    EXPECT_EQ(first.channel_count(), 2u);
+    EXPECT_EQ(first.channel(0)[63], 0);
+    EXPECT_EQ(first.channel(0)[64], 0.5f);
+    EXPECT_EQ(first.channel(1)[64], 0.5f);
+    EXPECT(!oscillator->has_ended());
+
+    auto const& second = graph->render_quantum();
+    EXPECT_EQ(second.channel(0)[63], 0.5f);
+    EXPECT_EQ(second.channel(0)[64], 0);
+    EXPECT(oscillator->has_ended());
+
+    EXPECT(graph->render_quantum().is_silent());
+    EXPECT_EQ(graph->current_frame(), 5u * render_quantum_size);
+}
+
+TEST_CASE(param_modulated_by_node)
+{
+    auto graph = RenderGraph::create(sample_rate);
+    auto destination = AudioDestinationRenderNode::create(1);
+    graph->set_destination(destination);
+
+    auto carrier = OscillatorRenderNode::create(Web::Bindings::OscillatorType::Square, create_frequency_param(100));
+    auto modulator = OscillatorRenderNode::create(Web::Bindings::OscillatorType::Square, create_frequency_param(100));
+    auto gain = create_gain_param(0);
+    auto gain_node = GainRenderNode::create(gain);
+
+    graph->connect(carrier, gain_node, 0);
+    graph->connect(modulator, gain);
+    graph->connect(gain_node, destination, 0);
+
+    carrier->start(0);
+    modulator->start(0);
+
+    // The gain is 0 + the modulator's output, so the output is the square of a square wave.
+    auto const& output = graph->render_quantum();
+    for (auto sample : output.channel(0))
+        EXPECT_EQ(sample, 1);
+}
+
+TEST_CASE(dynamics_compressor)
+{
+    auto graph = RenderGraph::create(sample_rate);
+    auto destination = AudioDestinationRenderNode::create(1);
+    graph->set_destination(destination);
+
+    auto oscillator = OscillatorRenderNode::create(Web::Bindings::OscillatorType::Square, create_frequency_param(440));
+    auto compressor = DynamicsCompressorRenderNode::create({
+        .threshold = RenderParam::create(-24, -100, 0, Web::Bindings::AutomationRate::KRate),
+        .knee = RenderParam::create(0, 0, 40, Web::Bindings::AutomationRate::KRate),
+        .ratio = RenderParam::create(20, 1, 20, Web::Bindings::AutomationRate::KRate),
+        .attack = RenderParam::create(0, 0, 1, Web::Bindings::AutomationRate::KRate),
+        .release = RenderParam::create(0.25f, 0, 1, Web::Bindings::AutomationRate::KRate),
+    });
+
+    graph->connect(oscillator, compressor, 0);
+    graph->connect(compressor, destination, 0);
+    oscillator->start(0);
+
+    // With an instant attack, a full-scale square wave is reduced by 24 * (1 - 1 / 20) = 22.8 dB straight away, and
+    // made up by 60% of that.
+    auto const& output = graph->render_quantum();
+    EXPECT_APPROXIMATE_WITH_ERROR(compressor->reduction(), -22.8f, 1e-3);
+    EXPECT_APPROXIMATE_WITH_ERROR(output.channel(0)[0], AK::pow(10.0f, -22.8f * 0.4f / 20), 1e-4);
+}
+
+BENCHMARK_CASE(render_one_minute_of_oscillators)
+{
+    auto graph = RenderGraph::create(sample_rate);
+    auto destination = AudioDestinationRenderNode::create(2);
+    graph->set_destination(destination);
+
+    auto compressor = DynamicsCompressorRenderNode::create({
+        .threshold = RenderParam::create(-24, -100, 0, Web::Bindings::AutomationRate::KRate),
+        .knee = RenderParam::create(30, 0, 40, Web::Bindings::AutomationRate::KRate),
+        .ratio = RenderParam::create(12, 1, 20, Web::Bindings::AutomationRate::KRate),
+        .attack = RenderParam::create(0.003f, 0, 1, Web::Bindings::AutomationRate::KRate),
+        .release = RenderParam::create(0.25f, 0, 1, Web::Bindings::AutomationRate::KRate),
+    });
+    graph->connect(compressor, destination, 0);
+
+    for (auto type : { Web::Bindings::OscillatorType::Sine, Web::Bindings::OscillatorType::Square, Web::Bindings::OscillatorType::Sawtooth, Web::Bindings::OscillatorType::Triangle }) {
+        auto frequency = create_frequency_param(220);
+        frequency->insert_event({ .type = AutomationEvent::Type::ExponentialRamp, .time = 60, .value = 880 });
+
+        auto gain = create_gain_param(0.25f);
+        auto oscillator = OscillatorRenderNode::create(type, frequency);
+        auto gain_node = GainRenderNode::create(gain);
+
+        graph->connect(oscillator, gain_node, 0);
+        graph->connect(gain_node, compressor, 0);
+        oscillator->start(0);
+    }
+
+    while (graph->current_time() < 60)
+        (void)graph->render_quantum();
+}
@@ -0,0 +1,8 @@
+onmessage = evt => {
+    const array = new Int32Array(evt.data);
+    postMessage("waiting");
+
+    // Depending on timing, the main thread may have already stored the new value by the time we start waiting.
+    const result = Atomics.wait(array, 0, 0, 10000);
+    postMessage(`${result === "timed-out" ? "timed out" : "woken up"}, value is ${Atomics.load(array, 0)}`);
+};
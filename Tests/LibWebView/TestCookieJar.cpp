@@ -0,0 +1,90 @@
+/*
+ * Copyright (c) 2024, the SerenityOS developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibTest/TestCase.h>
+#include <LibURL/URL.h>
+#include <LibWeb/Cookie/ParsedCookie.h>
+#include <LibWebView/CookieJar.h>
+
+static void set_cookie(WebView::CookieJar& jar, StringView url, StringView cookie_string)
+{
+    auto cookie = Web::Cookie::parse_cookie(cookie_string);
+    VERIFY(cookie.has_value());
+
+    jar.set_cookie(URL::URL { url }, *cookie, Web::Cookie::Source::Http);
+}
+
+static String get_cookie(WebView::CookieJar& jar, StringView url)
+{
+    return jar.get_cookie(URL::URL { url }, Web::Cookie::Source::Http);
+}
+
+TEST_CASE(domain_matching)
+{
+    auto jar = WebView::CookieJar::create();
+
+    set_cookie(*jar, "https://www.example.com/"sv, "host=1"sv);
+    set_cookie(*jar, "https://www.example.com/"sv, "domain=1; Domain=example.com"sv);
+    set_cookie(*jar, "https://other.com/"sv, "other=1"sv);
+
+    EXPECT_EQ(get_cookie(*jar, "https://www.example.com/"sv), "host=1; domain=1"sv);
+    EXPECT_EQ(get_cookie(*jar, "https://example.com/"sv), "domain=1"sv);
+    EXPECT_EQ(get_cookie(*jar, "https://sub.www.example.com/"sv), "domain=1"sv);
+    EXPECT_EQ(get_cookie(*jar, "https://notexample.com/"sv), ""sv);
+    EXPECT_EQ(get_cookie(*jar, "https://other.com/"sv), "other=1"sv);
+}
+
+TEST_CASE(path_matching)
+{
+    auto jar = WebView::CookieJar::create();
+
+    set_cookie(*jar, "https://example.com/"sv, "root=1; Path=/"sv);
+    set_cookie(*jar, "https://example.com/"sv, "dir=1; Path=/dir"sv);
+    set_cookie(*jar, "https://example.com/"sv, "slash=1; Path=/dir/"sv);
+    set_cookie(*jar, "https://example.com/"sv, "file=1; Path=/dir/file"sv);
+
+    // Cookies with longer paths are listed first.
+    EXPECT_EQ(get_cookie(*jar, "https://example.com/dir/file"sv), "file=1; slash=1; dir=1; root=1"sv);
+    EXPECT_EQ(get_cookie(*jar, "https://example.com/dir/"sv), "slash=1; dir=1; root=1"sv);
+    EXPECT_EQ(get_cookie(*jar, "https://example.com/dir"sv), "dir=1; root=1"sv);
+    EXPECT_EQ(get_cookie(*jar, "https://example.com/directory"sv), "root=1"sv);
+}
+
+TEST_CASE(expired_cookies)
+{
+    auto jar = WebView::CookieJar::create();
+
+    set_cookie(*jar, "https://example.com/"sv, "a=1"sv);
+    set_cookie(*jar, "https://example.com/"sv, "b=1; Max-Age=3600"sv);
+    EXPECT_EQ(get_cookie(*jar, "https://example.com/"sv), "a=1; b=1"sv);
+
+    // A Max-Age of zero expires the cookie right away.
+    set_cookie(*jar, "https://example.com/"sv, "b=2; Max-Age=0"sv);
+    EXPECT_EQ(get_cookie(*jar, "https://example.com/"sv), "a=1"sv);
+
+    set_cookie(*jar, "https://example.com/"sv, "b=3"sv);
+    EXPECT_EQ(get_cookie(*jar, "https://example.com/"sv), "a=1; b=3"sv);
+}
+
+BENCHMARK_CASE(get_cookie_with_large_jar)
+{
+    auto jar = WebView::CookieJar::create();
+
+    // 50,000 cookies spread over 5,000 sites, with a handful of paths each.
+    for (size_t site = 0; site < 5'000; ++site) {
+        auto url = MUST(String::formatted("https://www.site{}.com/"sv, site));
+
+        for (size_t cookie = 0; cookie < 10; ++cookie) {
+            auto cookie_string = MUST(String::formatted("cookie{}=value; Path=/path{}", cookie, cookie % 3));
+            set_cookie(*jar, url, cookie_string);
+        }
+    }
+
+    for (size_t i = 0; i < 10'000; ++i) {
+        auto cookie = get_cookie(*jar, "https://www.site1234.com/path1/index.html"sv);
+        EXPECT(!cookie.is_empty());
+    }
+}
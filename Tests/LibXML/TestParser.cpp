@@ -41,3 +41,39 @@ TEST_CASE(predefined_character_reference)
     auto const& content = node.children[0]->content.get<XML::Node::Text>();
     EXPECT_EQ(content.builder.string_view(), "Well hello &, <, >, ', and \"!");
 }
+
+TEST_CASE(listener_events)
+{
+    struct RecordingListener final : public XML::Listener {
+        virtual void element_start(XML::Name const& name, HashMap<XML::Name, ByteString> const& attributes) override
+        {
+            events.append(ByteString::formatted("start {} {}", name, attributes.get("x"sv).value_or("-")));
+        }
+        virtual void element_end(XML::Name const& name) override { events.append(ByteString::formatted("end {}", name)); }
+        virtual void text(StringView text) override
+        {
+            if (!text.is_empty())
+                events.append(ByteString::formatted("text {}", text));
+        }
+        virtual void processing_instruction(StringView target, StringView data) override { events.append(ByteString::formatted("pi {} {}", target, data)); }
+
+        Vector<ByteString> events;
+    };
+
+    XML::Parser parser("<?target data?><a x=\"1\"><b/>hi<c x=\"2\">there</c></a>"sv);
+    RecordingListener listener;
+    MUST(parser.parse_with_listener(listener));
+
+    Vector<ByteString> expected {
+        "pi target data",
+        "start a 1",
+        "start b -",
+        "end b",
+        "text hi",
+        "start c 2",
+        "text there",
+        "end c",
+        "end a",
+    };
+    EXPECT_EQ(listener.events, expected);
+}
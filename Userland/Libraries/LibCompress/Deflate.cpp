@@ -260,6 +260,8 @@ DeflateDecompressor::~DeflateDecompressor()
 ErrorOr<Bytes> DeflateDecompressor::read_some(Bytes bytes)
 {
     size_t total_read = 0;
+    bool made_progress = false;
+
     while (total_read < bytes.size()) {
         auto slice = bytes.slice(total_read);
 
@@ -267,6 +269,12 @@ ErrorOr<Bytes> DeflateDecompressor::read_some(Bytes bytes)
             if (m_read_final_block)
                 break;
 
+            // If the input ends on a block boundary, return what we have so far. The next read will fail if the stream
+            // really is truncated.
+            if ((total_read > 0 || made_progress) && m_input_stream->is_eof())
+                break;
+
+            made_progress = true;
             m_read_final_block = TRY(m_input_stream->read_bit());
             auto const block_type = TRY(m_input_stream->read_bits(2));
 
@@ -319,6 +327,7 @@ ErrorOr<Bytes> DeflateDecompressor::read_some(Bytes bytes)
 
             m_compressed_block.~CompressedBlock();
             m_state = State::Idle;
+            made_progress = true;
 
             continue;
         }
@@ -336,6 +345,7 @@ ErrorOr<Bytes> DeflateDecompressor::read_some(Bytes bytes)
 
             m_uncompressed_block.~UncompressedBlock();
             m_state = State::Idle;
+            made_progress = true;
 
             continue;
         }
@@ -370,6 +380,27 @@ ErrorOr<ByteBuffer> DeflateDecompressor::decompress_all(ReadonlyBytes bytes)
     return deflate_stream->read_until_eof(4096);
 }
 
+ErrorOr<void> DeflateDecompressor::decompress_available_input(ByteBuffer& output)
+{
+    static constexpr size_t chunk_size = 4 * KiB;
+
+    while (m_state != State::Idle || !m_input_stream->is_eof()) {
+        // A final block is padded to a byte boundary, after which another stream sharing the same window may follow.
+        if (m_state == State::Idle && m_read_final_block) {
+            m_input_stream->align_to_byte_boundary();
+            m_read_final_block = false;
+        }
+
+        auto offset = output.size();
+        auto buffer = TRY(output.get_bytes_for_writing(chunk_size));
+        auto nread = TRY(read_some(buffer)).size();
+
+        output.resize(offset + nread);
+    }
+
+    return {};
+}
+
 ErrorOr<u32> DeflateDecompressor::decode_length(u32 symbol)
 {
     if (symbol <= 264)
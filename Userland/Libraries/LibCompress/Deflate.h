@@ -108,6 +108,12 @@ public:
 
     static ErrorOr<ByteBuffer> decompress_all(ReadonlyBytes);
 
+    // Decompresses all input that is currently available into the given buffer. The input must end on a block boundary,
+    // as is the case for streams that are flushed and fed in pieces, such as the messages of the WebSocket
+    // permessage-deflate extension (RFC 7692). The sliding window is kept between calls, and a final block does not
+    // end the stream, so that later input may still refer back to earlier data.
+    ErrorOr<void> decompress_available_input(ByteBuffer&);
+
 private:
     DeflateDecompressor(MaybeOwned<LittleEndianInputBitStream> stream, CircularBuffer buffer);
 
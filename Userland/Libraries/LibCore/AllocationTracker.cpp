@@ -0,0 +1,348 @@
+/*
+ * Copyright (c) 2024, the SerenityOS developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/Array.h>
+#include <AK/Atomic.h>
+#include <AK/HashMap.h>
+#include <AK/JsonArray.h>
+#include <AK/QuickSort.h>
+#include <AK/TemporaryChange.h>
+#include <AK/Vector.h>
+#include <LibCore/AllocationTracker.h>
+#include <LibThreading/Mutex.h>
+#include <errno.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifndef ENABLE_ALLOCATION_TRACKING
+#    define ENABLE_ALLOCATION_TRACKING 0
+#endif
+
+#if defined(__has_feature)
+#    if __has_feature(thread_sanitizer) || __has_feature(memory_sanitizer)
+#        define HAS_MALLOC_REPLACING_SANITIZER
+#    endif
+#endif
+#if defined(HAS_ADDRESS_SANITIZER) || defined(__SANITIZE_THREAD__)
+#    define HAS_MALLOC_REPLACING_SANITIZER
+#endif
+
+// Replacing malloc() affects every process that links LibCore, so it has to be asked for at build time
+// (ENABLE_ALLOCATION_TRACKING), and stays out of the way of sanitizers that replace it themselves.
+#if ENABLE_ALLOCATION_TRACKING && defined(AK_OS_LINUX) && defined(AK_LIBC_GLIBC) && !defined(HAS_MALLOC_REPLACING_SANITIZER)
+#    define ALLOCATION_TRACKER_SUPPORTED
+#    include <execinfo.h>
+#endif
+
+namespace Core::AllocationTracker {
+
+static constexpr size_t max_tag_count = 32;
+static constexpr size_t max_sample_count = 4096;
+static constexpr size_t max_frame_count = 16;
+
+// Index 0 is reserved for allocations made outside of any ScopedTag.
+static Array<StringView, max_tag_count> s_tags { "Other"sv };
+static Atomic<size_t> s_tag_count { 1 };
+static Threading::Mutex s_tags_mutex;
+
+static Atomic<bool> s_enabled { false };
+static Atomic<size_t> s_sample_interval { 0 };
+
+struct TagStatistics {
+    Atomic<u64> allocation_count { 0 };
+    Atomic<u64> allocated_bytes { 0 };
+};
+static Array<TagStatistics, max_tag_count> s_statistics;
+
+struct Sample {
+    u8 tag_index { 0 };
+    size_t frame_count { 0 };
+    Array<void*, max_frame_count> frames;
+};
+static Array<Sample, max_sample_count> s_samples;
+static size_t s_sample_count { 0 };
+static Threading::Mutex s_samples_mutex;
+
+// NOTE: These are accessed from within malloc(), so they must not need an allocation to be set up themselves.
+[[gnu::tls_model("initial-exec")]] static thread_local u8 s_current_tag_index { 0 };
+[[gnu::tls_model("initial-exec")]] static thread_local bool s_is_inside_tracker { false };
+[[gnu::tls_model("initial-exec")]] static thread_local i64 s_bytes_until_next_sample { 0 };
+
+static u8 tag_index(StringView tag)
+{
+    auto count = s_tag_count.load();
+    for (size_t i = 0; i < count; ++i) {
+        if (s_tags[i] == tag)
+            return static_cast<u8>(i);
+    }
+
+    Threading::MutexLocker locker(s_tags_mutex);
+
+    // Another thread may have registered the tag while we were waiting for the lock.
+    count = s_tag_count.load();
+    for (size_t i = 0; i < count; ++i) {
+        if (s_tags[i] == tag)
+            return static_cast<u8>(i);
+    }
+
+    if (count == max_tag_count)
+        return 0;
+
+    s_tags[count] = tag;
+    s_tag_count.store(count + 1);
+    return static_cast<u8>(count);
+}
+
+#ifdef ALLOCATION_TRACKER_SUPPORTED
+// NOTE: These are never inlined, so that the number of tracker frames at the top of every sampled stack is fixed.
+[[gnu::noinline]] static void capture_sample()
+{
+    Sample sample;
+    sample.tag_index = s_current_tag_index;
+    sample.frame_count = backtrace(sample.frames.data(), static_cast<int>(max_frame_count));
+
+    Threading::MutexLocker locker(s_samples_mutex);
+    if (s_sample_count < max_sample_count)
+        s_samples[s_sample_count++] = sample;
+}
+
+[[gnu::noinline]] static void did_allocate(size_t size)
+{
+    if (!s_enabled.load(AK::MemoryOrder::memory_order_relaxed) || s_is_inside_tracker)
+        return;
+
+    auto& statistics = s_statistics[s_current_tag_index];
+    statistics.allocation_count.fetch_add(1, AK::MemoryOrder::memory_order_relaxed);
+    statistics.allocated_bytes.fetch_add(size, AK::MemoryOrder::memory_order_relaxed);
+
+    auto sample_interval = s_sample_interval.load(AK::MemoryOrder::memory_order_relaxed);
+    if (sample_interval == 0)
+        return;
+
+    s_bytes_until_next_sample -= static_cast<i64>(size);
+    if (s_bytes_until_next_sample > 0)
+        return;
+    s_bytes_until_next_sample = static_cast<i64>(sample_interval);
+
+    // Capturing a backtrace may allocate the first time around, which must not be tracked.
+    s_is_inside_tracker = true;
+    capture_sample();
+    s_is_inside_tracker = false;
+}
+#endif
+
+bool is_supported()
+{
+#ifdef ALLOCATION_TRACKER_SUPPORTED
+    return true;
+#else
+    return false;
+#endif
+}
+
+bool is_enabled()
+{
+    return s_enabled.load(AK::MemoryOrder::memory_order_relaxed);
+}
+
+void set_enabled(bool enabled)
+{
+    s_enabled.store(enabled);
+}
+
+void set_sample_interval(size_t bytes)
+{
+    s_sample_interval.store(bytes);
+}
+
+u64 allocation_count()
+{
+    u64 count = 0;
+    for (auto const& statistics : s_statistics)
+        count += statistics.allocation_count.load();
+    return count;
+}
+
+JsonObject take_report()
+{
+    TemporaryChange is_inside_tracker { s_is_inside_tracker, true };
+
+    JsonObject tags;
+    for (size_t i = 0; i < s_tag_count.load(); ++i) {
+        auto allocation_count = s_statistics[i].allocation_count.exchange(0);
+        auto allocated_bytes = s_statistics[i].allocated_bytes.exchange(0);
+        if (allocation_count == 0)
+            continue;
+
+        JsonObject tag;
+        tag.set("allocations"sv, allocation_count);
+        tag.set("bytes"sv, allocated_bytes);
+        tags.set(s_tags[i], move(tag));
+    }
+
+    JsonObject report;
+    report.set("tags"sv, move(tags));
+
+#ifdef ALLOCATION_TRACKER_SUPPORTED
+    Vector<Sample> samples;
+    {
+        Threading::MutexLocker locker(s_samples_mutex);
+        samples.append(s_samples.data(), s_sample_count);
+        s_sample_count = 0;
+    }
+
+    // Group identical allocation sites together, and report the ones that were sampled most often first.
+    struct Site {
+        u8 tag_index { 0 };
+        Vector<void*, max_frame_count> frames;
+        size_t sample_count { 0 };
+    };
+    HashMap<u32, Site> sites;
+
+    for (auto const& sample : samples) {
+        auto frames = sample.frames.span().trim(sample.frame_count);
+
+        u32 hash = sample.tag_index;
+        for (auto* frame : frames)
+            hash = pair_int_hash(hash, ptr_hash(frame));
+
+        auto& site = sites.ensure(hash, [&] {
+            Site site { sample.tag_index, {}, 0 };
+            site.frames.append(frames.data(), frames.size());
+            return site;
+        });
+        ++site.sample_count;
+    }
+
+    Vector<Site> sorted_sites;
+    for (auto& it : sites)
+        sorted_sites.append(move(it.value));
+    quick_sort(sorted_sites, [](auto const& a, auto const& b) { return a.sample_count > b.sample_count; });
+
+    JsonArray sample_sites;
+    for (auto const& site : sorted_sites) {
+        JsonArray stack;
+        if (auto** symbols = backtrace_symbols(site.frames.data(), static_cast<int>(site.frames.size()))) {
+            // Skip the frames of the tracker itself: capture_sample(), did_allocate() and malloc().
+            for (size_t i = 3; i < site.frames.size(); ++i)
+                stack.must_append(StringView { symbols[i], strlen(symbols[i]) });
+            free(symbols);
+        }
+
+        JsonObject sample_site;
+        sample_site.set("tag"sv, s_tags[site.tag_index]);
+        sample_site.set("samples"sv, site.sample_count);
+        sample_site.set("estimated_bytes"sv, site.sample_count * s_sample_interval.load());
+        sample_site.set("stack"sv, move(stack));
+        sample_sites.must_append(move(sample_site));
+    }
+
+    report.set("sampled_allocation_sites"sv, move(sample_sites));
+#endif
+
+    return report;
+}
+
+ScopedTag::ScopedTag(StringView tag)
+{
+    if (!is_enabled())
+        return;
+
+    m_is_active = true;
+    m_previous_tag_index = exchange(s_current_tag_index, tag_index(tag));
+}
+
+ScopedTag::~ScopedTag()
+{
+    if (m_is_active)
+        s_current_tag_index = m_previous_tag_index;
+}
+
+}
+
+#ifdef ALLOCATION_TRACKER_SUPPORTED
+extern "C" {
+
+// NOTE: Every allocating entry point of glibc's allocator is replaced here. glibc's own implementations of the ones
+//       that aren't call its internal functions directly, and would otherwise bypass the tracker.
+
+void* __libc_malloc(size_t);
+void* __libc_calloc(size_t, size_t);
+void* __libc_realloc(void*, size_t);
+void* __libc_memalign(size_t, size_t);
+void* __libc_valloc(size_t);
+void* __libc_pvalloc(size_t);
+
+void* malloc(size_t size)
+{
+    Core::AllocationTracker::did_allocate(size);
+    return __libc_malloc(size);
+}
+
+void* calloc(size_t count, size_t size)
+{
+    Core::AllocationTracker::did_allocate(count * size);
+    return __libc_calloc(count, size);
+}
+
+void* realloc(void* pointer, size_t size)
+{
+    Core::AllocationTracker::did_allocate(size);
+    return __libc_realloc(pointer, size);
+}
+
+void* reallocarray(void* pointer, size_t count, size_t size)
+{
+    size_t total_size = 0;
+    if (__builtin_mul_overflow(count, size, &total_size)) {
+        errno = ENOMEM;
+        return nullptr;
+    }
+    return realloc(pointer, total_size);
+}
+
+void* memalign(size_t alignment, size_t size)
+{
+    Core::AllocationTracker::did_allocate(size);
+    return __libc_memalign(alignment, size);
+}
+
+void* aligned_alloc(size_t alignment, size_t size)
+{
+    // glibc rejects alignments that aren't a power of two here, while memalign() rounds them up.
+    if (!is_power_of_two(alignment)) {
+        errno = EINVAL;
+        return nullptr;
+    }
+    return memalign(alignment, size);
+}
+
+int posix_memalign(void** pointer, size_t alignment, size_t size)
+{
+    if (alignment % sizeof(void*) != 0 || !is_power_of_two(alignment))
+        return EINVAL;
+
+    auto* allocation = memalign(alignment, size);
+    if (!allocation && size != 0)
+        return ENOMEM;
+
+    *pointer = allocation;
+    return 0;
+}
+
+void* valloc(size_t size)
+{
+    Core::AllocationTracker::did_allocate(size);
+    return __libc_valloc(size);
+}
+
+void* pvalloc(size_t size)
+{
+    Core::AllocationTracker::did_allocate(size);
+    return __libc_pvalloc(size);
+}
+}
+#endif
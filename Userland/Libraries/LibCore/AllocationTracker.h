@@ -0,0 +1,54 @@
+/*
+ * Copyright (c) 2024, the SerenityOS developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/JsonObject.h>
+#include <AK/Noncopyable.h>
+#include <AK/StringView.h>
+
+// An opt-in, process-wide tracker that attributes heap allocations to the subsystem that made them.
+//
+// Allocations are attributed to the innermost ScopedTag on the allocating thread, or to "Other" if there is none.
+// Every allocation is counted, and a stack trace is captured for a sample of them, so that the biggest allocation
+// sites of each subsystem can be found.
+//
+// This works by interposing malloc() and the other allocation functions, which only happens in builds configured with
+// ENABLE_ALLOCATION_TRACKING, and is only possible with glibc and without sanitizers. Everywhere else, is_supported()
+// returns false and nothing is tracked.
+//
+// Tag names are not copied, and must outlive the tracker (i.e. they should be string literals).
+
+namespace Core::AllocationTracker {
+
+bool is_supported();
+
+bool is_enabled();
+void set_enabled(bool);
+
+// If non-zero, a stack trace is captured for roughly every this many bytes allocated by each thread.
+void set_sample_interval(size_t bytes);
+
+// The number of allocations made while the tracker was enabled.
+u64 allocation_count();
+
+// Removes all statistics gathered so far, and returns them as a JSON object.
+JsonObject take_report();
+
+class ScopedTag {
+    AK_MAKE_NONCOPYABLE(ScopedTag);
+    AK_MAKE_NONMOVABLE(ScopedTag);
+
+public:
+    explicit ScopedTag(StringView tag);
+    ~ScopedTag();
+
+private:
+    u8 m_previous_tag_index { 0 };
+    bool m_is_active { false };
+};
+
+}
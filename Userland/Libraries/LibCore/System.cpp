@@ -8,6 +8,7 @@
  */
 
 #include <AK/ByteString.h>
+#include <AK/Atomic.h>
 #include <AK/FixedArray.h>
 #include <AK/ScopeGuard.h>
 #include <AK/ScopedValueRollback.h>
@@ -46,6 +47,19 @@ static int memfd_create(char const* name, unsigned int flags)
 }
 #endif
 
+#if defined(AK_OS_LINUX)
+#    include <linux/futex.h>
+#    include <sys/syscall.h>
+#endif
+
+#if defined(AK_OS_MACOS) || defined(AK_OS_IOS)
+// These are the primitives libc++ and libdispatch use to implement process-shared waiting; they are not part of the SDK headers.
+extern "C" int __ulock_wait(uint32_t operation, void* address, uint64_t value, uint32_t timeout_in_microseconds);
+extern "C" int __ulock_wake(uint32_t operation, void* address, uint64_t wake_value);
+#    define UL_COMPARE_AND_WAIT_SHARED 3
+#    define ULF_WAKE_ALL 0x00000100
+#endif
+
 #if defined(AK_OS_MACOS) || defined(AK_OS_IOS)
 #    include <mach-o/dyld.h>
 #    include <sys/mman.h>
@@ -560,6 +574,60 @@ ErrorOr<int> anon_create([[maybe_unused]] size_t size, [[maybe_unused]] int opti
     return fd;
 }
 
+ErrorOr<void> futex_wait(u32 const* address, u32 expected_value, Optional<Duration> timeout)
+{
+#if defined(AK_OS_LINUX)
+    // NOTE: We don't pass FUTEX_PRIVATE_FLAG, as the word may be mapped into several processes.
+    struct timespec timeout_spec = {};
+    if (timeout.has_value())
+        timeout_spec = timeout->to_timespec();
+    auto rc = syscall(SYS_futex, address, FUTEX_WAIT, expected_value, timeout.has_value() ? &timeout_spec : nullptr, nullptr, 0);
+    if (rc < 0)
+        return Error::from_syscall("futex_wait"sv, -errno);
+    return {};
+#elif defined(AK_OS_MACOS) || defined(AK_OS_IOS)
+    u32 timeout_in_microseconds = 0;
+    if (timeout.has_value())
+        timeout_in_microseconds = static_cast<u32>(clamp(timeout->to_microseconds(), 1, NumericLimits<u32>::max()));
+    // NOTE: Unlike FUTEX_WAIT, this returns successfully if the word did not hold the expected value.
+    auto rc = __ulock_wait(UL_COMPARE_AND_WAIT_SHARED, const_cast<u32*>(address), expected_value, timeout_in_microseconds);
+    if (rc < 0)
+        return Error::from_syscall("ulock_wait"sv, -errno);
+    return {};
+#else
+    // FIXME: Use a native wait-on-address primitive on this platform instead of polling.
+    auto start = MonotonicTime::now();
+    while (AK::atomic_load(const_cast<u32*>(address)) == expected_value) {
+        if (timeout.has_value() && MonotonicTime::now() - start >= *timeout)
+            return Error::from_errno(ETIMEDOUT);
+        ::usleep(100);
+    }
+    return Error::from_errno(EAGAIN);
+#endif
+}
+
+ErrorOr<void> futex_wake([[maybe_unused]] u32 const* address, [[maybe_unused]] u32 count)
+{
+    if (count == 0)
+        return {};
+#if defined(AK_OS_LINUX)
+    auto rc = syscall(SYS_futex, address, FUTEX_WAKE, min(count, static_cast<u32>(NumericLimits<i32>::max())), nullptr, nullptr, 0);
+    if (rc < 0)
+        return Error::from_syscall("futex_wake"sv, -errno);
+    return {};
+#elif defined(AK_OS_MACOS) || defined(AK_OS_IOS)
+    auto operation = UL_COMPARE_AND_WAIT_SHARED | (count > 1 ? ULF_WAKE_ALL : 0);
+    auto rc = __ulock_wake(operation, const_cast<u32*>(address), 0);
+    // ENOENT just means that nobody was waiting.
+    if (rc < 0 && errno != ENOENT)
+        return Error::from_syscall("ulock_wake"sv, -errno);
+    return {};
+#else
+    // Waiters poll the word, so there is nothing to wake.
+    return {};
+#endif
+}
+
 ErrorOr<int> open(StringView path, int options, mode_t mode)
 {
     return openat(AT_FDCWD, path, options, mode);
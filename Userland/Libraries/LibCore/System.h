@@ -12,6 +12,7 @@
 #include <AK/Noncopyable.h>
 #include <AK/OwnPtr.h>
 #include <AK/StringView.h>
+#include <AK/Time.h>
 #include <AK/Vector.h>
 #include <dirent.h>
 #include <fcntl.h>
@@ -123,6 +124,11 @@ ErrorOr<int> fcntl(int fd, int command, ...);
 ErrorOr<void*> mmap(void* address, size_t, int protection, int flags, int fd, off_t, size_t alignment = 0, StringView name = {});
 ErrorOr<void> munmap(void* address, size_t);
 ErrorOr<int> anon_create(size_t size, int options);
+
+// Waits until the 32-bit word at address is woken by futex_wake(). Fails with EAGAIN if the word did not hold expected_value,
+// and with ETIMEDOUT if the timeout elapsed. The word may live in memory shared with other processes.
+ErrorOr<void> futex_wait(u32 const* address, u32 expected_value, Optional<Duration> timeout = {});
+ErrorOr<void> futex_wake(u32 const* address, u32 count);
 ErrorOr<int> open(StringView path, int options, mode_t mode = 0);
 ErrorOr<int> openat(int fd, StringView path, int options, mode_t mode = 0);
 ErrorOr<void> close(int fd);
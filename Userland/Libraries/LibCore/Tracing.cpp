@@ -0,0 +1,108 @@
+/*
+ * Copyright (c) 2024, the SerenityOS developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/Atomic.h>
+#include <AK/CircularQueue.h>
+#include <AK/JsonArray.h>
+#include <AK/JsonObject.h>
+#include <AK/NonnullOwnPtr.h>
+#include <AK/Vector.h>
+#include <LibCore/Tracing.h>
+#include <LibThreading/Mutex.h>
+#include <unistd.h>
+
+namespace Core::Tracing {
+
+// Enough for several seconds of a busy page load, while keeping each buffer under a megabyte.
+static constexpr size_t events_per_thread = 16384;
+
+struct ThreadBuffer {
+    explicit ThreadBuffer(u64 thread_id)
+        : thread_id(thread_id)
+    {
+    }
+
+    u64 const thread_id;
+
+    // The owning thread is the only writer, so this lock is only ever contended while the events are being taken.
+    Threading::Mutex mutex;
+    CircularQueue<Event, events_per_thread> events;
+};
+
+static Atomic<bool> s_enabled { false };
+
+static Threading::Mutex s_thread_buffers_mutex;
+static Vector<NonnullOwnPtr<ThreadBuffer>> s_thread_buffers;
+
+// NOTE: Buffers are owned by s_thread_buffers and are never freed, so events from exited threads can still be taken.
+static thread_local ThreadBuffer* s_thread_buffer = nullptr;
+
+static ThreadBuffer& thread_buffer()
+{
+    if (!s_thread_buffer) {
+        Threading::MutexLocker locker(s_thread_buffers_mutex);
+
+        auto buffer = make<ThreadBuffer>(s_thread_buffers.size() + 1);
+        s_thread_buffer = buffer.ptr();
+        s_thread_buffers.append(move(buffer));
+    }
+
+    return *s_thread_buffer;
+}
+
+bool is_enabled()
+{
+    return s_enabled.load(AK::MemoryOrder::memory_order_relaxed);
+}
+
+void set_enabled(bool enabled)
+{
+    s_enabled.store(enabled, AK::MemoryOrder::memory_order_relaxed);
+}
+
+void record_event(StringView category, StringView name, MonotonicTime start, MonotonicTime end)
+{
+    auto& buffer = thread_buffer();
+
+    Threading::MutexLocker locker(buffer.mutex);
+    buffer.events.enqueue({ category, name, start.nanoseconds(), (end - start).to_nanoseconds() });
+}
+
+ErrorOr<String> take_events_as_chrome_trace_json()
+{
+    auto process_id = getpid();
+
+    JsonArray trace_events;
+
+    Threading::MutexLocker locker(s_thread_buffers_mutex);
+
+    for (auto& buffer : s_thread_buffers) {
+        Threading::MutexLocker buffer_locker(buffer->mutex);
+
+        while (!buffer->events.is_empty()) {
+            auto event = buffer->events.dequeue();
+
+            // https://docs.google.com/document/d/1CvAClvFfyA5R-PhYUmn5OOQtYMH4h6I0nSsKchNAySU
+            JsonObject trace_event;
+            trace_event.set("name"sv, event.name);
+            trace_event.set("cat"sv, event.category);
+            trace_event.set("ph"sv, "X"sv);
+            trace_event.set("ts"sv, static_cast<double>(event.start_ns) / 1000.0);
+            trace_event.set("dur"sv, static_cast<double>(event.duration_ns) / 1000.0);
+            trace_event.set("pid"sv, process_id);
+            trace_event.set("tid"sv, buffer->thread_id);
+            TRY(trace_events.append(move(trace_event)));
+        }
+    }
+
+    JsonObject trace;
+    trace.set("traceEvents"sv, move(trace_events));
+    trace.set("displayTimeUnit"sv, "ms"sv);
+
+    return String::from_byte_string(trace.to_byte_string());
+}
+
+}
@@ -0,0 +1,67 @@
+/*
+ * Copyright (c) 2024, the SerenityOS developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/Noncopyable.h>
+#include <AK/Optional.h>
+#include <AK/String.h>
+#include <AK/StringView.h>
+#include <AK/Time.h>
+
+// A low-overhead, process-wide tracer for coarse-grained scoped events (parsing, style, layout, painting, ...).
+//
+// Events are buffered in a fixed-size ring buffer per thread, so a long-running process keeps only its most recent
+// history. The collected events can be exported in the Chrome trace event format, which can be loaded into
+// about:tracing, Perfetto, or speedscope.
+//
+// Category and event names are not copied, and must outlive the tracer (i.e. they should be string literals).
+
+namespace Core::Tracing {
+
+struct Event {
+    StringView category;
+    StringView name;
+    i64 start_ns { 0 };
+    i64 duration_ns { 0 };
+};
+
+bool is_enabled();
+void set_enabled(bool);
+
+void record_event(StringView category, StringView name, MonotonicTime start, MonotonicTime end);
+
+// Removes all events recorded so far, and returns them as a Chrome trace event JSON object.
+ErrorOr<String> take_events_as_chrome_trace_json();
+
+class ScopedEvent {
+    AK_MAKE_NONCOPYABLE(ScopedEvent);
+    AK_MAKE_NONMOVABLE(ScopedEvent);
+
+public:
+    ScopedEvent(StringView category, StringView name)
+    {
+        if (!is_enabled())
+            return;
+
+        m_category = category;
+        m_name = name;
+        m_start = MonotonicTime::now();
+    }
+
+    ~ScopedEvent()
+    {
+        if (m_start.has_value())
+            record_event(m_category, m_name, *m_start, MonotonicTime::now());
+    }
+
+private:
+    StringView m_category;
+    StringView m_name;
+    Optional<MonotonicTime> m_start;
+};
+
+}
@@ -5,7 +5,9 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <LibCore/AllocationTracker.h>
 #include <LibCore/System.h>
+#include <LibCore/Tracing.h>
 #include <LibIPC/Connection.h>
 #include <LibIPC/File.h>
 #include <LibIPC/Stub.h>
@@ -74,6 +76,9 @@ void ConnectionBase::handle_messages()
     auto messages = move(m_unprocessed_messages);
     for (auto& message : messages) {
         if (message->endpoint_magic() == m_local_endpoint_magic) {
+            auto const* message_name = message->message_name();
+            Core::Tracing::ScopedEvent trace_event { "IPC"sv, { message_name, strlen(message_name) } };
+
             auto handler_result = m_local_stub.handle(*message);
             if (handler_result.is_error()) {
                 dbgln("IPC::ConnectionBase::handle_messages: {}", handler_result.error());
@@ -162,6 +167,8 @@ ErrorOr<Vector<u8>> ConnectionBase::read_as_much_as_possible_from_socket_without
 
 ErrorOr<void> ConnectionBase::drain_messages_from_peer()
 {
+    Core::AllocationTracker::ScopedTag allocation_tag { "IPC"sv };
+
     auto bytes = TRY(read_as_much_as_possible_from_socket_without_blocking());
 
     size_t index = 0;
@@ -1065,19 +1065,48 @@ Bytecode::CodeGenerationErrorOr<Optional<ScopedOperand>> ForStatement::generate_
     return body_result;
 }
 
+// Returns true if every evaluation of the object literal creates its properties in the same order, with the same
+// attributes and in the object's shape (rather than as indexed properties), so that the objects share a single shape.
+static bool object_literal_has_predictable_shape(Vector<NonnullRefPtr<ObjectProperty>> const& properties)
+{
+    if (properties.is_empty())
+        return false;
+
+    HashTable<ByteString> property_names;
+    for (auto& property : properties) {
+        if (property->type() != ObjectProperty::Type::KeyValue || !is<StringLiteral>(property->key()))
+            return false;
+
+        auto const& property_name = static_cast<StringLiteral const&>(property->key()).value();
+        if (PropertyKey { property_name }.is_number())
+            return false;
+        if (property_names.set(property_name) != HashSetResult::InsertedNewEntry)
+            return false;
+    }
+
+    return true;
+}
+
 Bytecode::CodeGenerationErrorOr<Optional<ScopedOperand>> ObjectExpression::generate_bytecode(Bytecode::Generator& generator, [[maybe_unused]] Optional<ScopedOperand> preferred_dst) const
 {
     Bytecode::Generator::SourceLocationScope scope(generator, *this);
 
     auto object = generator.allocate_register();
 
-    generator.emit<Bytecode::Op::NewObject>(object);
+    // OPTIMIZATION: Objects created by a literal like `{ x: 1, y: 2 }` always end up with the same shape. NewObject
+    //               remembers that shape, and allocates the objects of subsequent evaluations with it directly.
+    Optional<u32> shape_cache_index;
+    if (object_literal_has_predictable_shape(m_properties))
+        shape_cache_index = generator.next_object_shape_cache();
+
+    generator.emit<Bytecode::Op::NewObject>(object, shape_cache_index);
     if (m_properties.is_empty())
         return object;
 
     generator.push_home_object(object);
 
-    for (auto& property : m_properties) {
+    for (size_t property_index = 0; property_index < m_properties.size(); ++property_index) {
+        auto& property = m_properties[property_index];
         Bytecode::Op::PropertyKind property_kind;
         switch (property->type()) {
         case ObjectProperty::Type::KeyValue:
@@ -1117,7 +1146,10 @@ Bytecode::CodeGenerationErrorOr<Optional<ScopedOperand>> ObjectExpression::gener
                 value = TRY(property->key().generate_bytecode(generator)).value();
             }
 
-            generator.emit<Bytecode::Op::PutById>(object, key_name, *value, property_kind, generator.next_property_lookup_cache());
+            if (shape_cache_index.has_value())
+                generator.emit<Bytecode::Op::InitObjectLiteralProperty>(object, key_name, *value, property_index, *shape_cache_index);
+            else
+                generator.emit<Bytecode::Op::PutById>(object, key_name, *value, property_kind, generator.next_property_lookup_cache());
         } else {
             auto property_name = TRY(property->key().generate_bytecode(generator)).value();
             Optional<ScopedOperand> value;
@@ -1130,6 +1162,9 @@ Bytecode::CodeGenerationErrorOr<Optional<ScopedOperand>> ObjectExpression::gener
         }
     }
 
+    if (shape_cache_index.has_value())
+        generator.emit<Bytecode::Op::CacheObjectShape>(object, *shape_cache_index);
+
     generator.pop_home_object();
     return object;
 }
@@ -16,6 +16,7 @@
 #include <LibJS/Runtime/GlobalEnvironment.h>
 #include <LibJS/Runtime/NativeFunction.h>
 #include <LibJS/Runtime/ObjectEnvironment.h>
+#include <LibJS/Runtime/RegExpCache.h>
 #include <LibJS/Runtime/RegExpObject.h>
 #include <LibJS/Runtime/TypedArray.h>
 #include <LibJS/Runtime/ValueInlines.h>
@@ -36,7 +37,7 @@ inline Value fast_typed_array_get_element(TypedArrayBase& typed_array, u32 index
     }
 
     auto const& array_buffer = *typed_array.viewed_array_buffer();
-    auto const* slot = reinterpret_cast<T const*>(array_buffer.buffer().offset_pointer(offset_into_array_buffer.value()));
+    auto const* slot = reinterpret_cast<T const*>(array_buffer.bytes().offset_pointer(offset_into_array_buffer.value()));
     return Value { *slot };
 }
 
@@ -54,7 +55,7 @@ inline void fast_typed_array_set_element(TypedArrayBase& typed_array, u32 index,
     }
 
     auto& array_buffer = *typed_array.viewed_array_buffer();
-    auto* slot = reinterpret_cast<T*>(array_buffer.buffer().offset_pointer(offset_into_array_buffer.value()));
+    auto* slot = reinterpret_cast<T*>(array_buffer.bytes().offset_pointer(offset_into_array_buffer.value()));
     *slot = value;
 }
 
@@ -210,6 +211,10 @@ inline ThrowCompletionOr<Value> get_by_value(VM& vm, Optional<DeprecatedFlyStrin
                     return fast_typed_array_get_element<i32>(typed_array, index);
                 case TypedArrayBase::Kind::Uint8ClampedArray:
                     return fast_typed_array_get_element<u8>(typed_array, index);
+                case TypedArrayBase::Kind::Float32Array:
+                    return fast_typed_array_get_element<float>(typed_array, index);
+                case TypedArrayBase::Kind::Float64Array:
+                    return fast_typed_array_get_element<double>(typed_array, index);
                 default:
                     // FIXME: Support more TypedArray kinds.
                     break;
@@ -244,17 +249,30 @@ inline ThrowCompletionOr<Value> get_global(Interpreter& interpreter, IdentifierT
     auto& vm = interpreter.vm();
     auto& binding_object = interpreter.global_object();
     auto& declarative_record = interpreter.global_declarative_environment();
+    auto& identifier = interpreter.current_executable().get_identifier(identifier_index);
 
-    // OPTIMIZATION: If the shape of the object hasn't changed, we can use the cached property offset.
-    auto& shape = binding_object.shape();
-    if (cache.environment_serial_number == declarative_record.environment_serial_number()
-        && &shape == cache.shape) {
-        return binding_object.get_direct(cache.property_offset.value());
+    // OPTIMIZATION: Bindings in the global declarative environment never move, so if that's where we found the variable
+    //               last time, we can read it directly as long as the binding is still there.
+    if (cache.declarative_binding_index.has_value()) {
+        if (declarative_record.has_binding_at_index(*cache.declarative_binding_index, identifier))
+            return TRY(declarative_record.get_binding_value_direct(vm, *cache.declarative_binding_index));
+        cache.declarative_binding_index = {};
     }
 
-    cache.environment_serial_number = declarative_record.environment_serial_number();
-
-    auto& identifier = interpreter.current_executable().get_identifier(identifier_index);
+    // OPTIMIZATION: If the shape of the object hasn't changed, we can use the cached property offset, as long as no
+    //               binding for the same name has been added to the global declarative environment since.
+    //               Only the bindings added since we last checked have to be looked at, so unrelated global lexical
+    //               declarations (e.g. from other scripts) don't invalidate the cache.
+    auto& shape = binding_object.shape();
+    if (&shape == cache.shape) {
+        auto binding_count = declarative_record.binding_count();
+        if (cache.checked_declarative_binding_count == binding_count
+            || !declarative_record.has_binding_since(cache.checked_declarative_binding_count, identifier)) {
+            cache.checked_declarative_binding_count = binding_count;
+            return binding_object.get_direct(cache.property_offset.value());
+        }
+        cache.shape = nullptr;
+    }
 
     if (vm.running_execution_context().script_or_module.has<NonnullGCPtr<Module>>()) {
         // NOTE: GetGlobal is used to access variables stored in the module environment and global environment.
@@ -266,8 +284,12 @@ inline ThrowCompletionOr<Value> get_global(Interpreter& interpreter, IdentifierT
         }
     }
 
-    if (TRY(declarative_record.has_binding(identifier))) {
-        // TODO: Cache offset of binding value
+    Optional<size_t> declarative_binding_index;
+    if (TRY(declarative_record.has_binding(identifier, &declarative_binding_index))) {
+        if (declarative_binding_index.has_value()) {
+            cache.declarative_binding_index = *declarative_binding_index;
+            return TRY(declarative_record.get_binding_value_direct(vm, *declarative_binding_index));
+        }
         return TRY(declarative_record.get_binding_value(vm, identifier, vm.in_strict_mode()));
     }
 
@@ -277,6 +299,7 @@ inline ThrowCompletionOr<Value> get_global(Interpreter& interpreter, IdentifierT
         if (cacheable_metadata.type == CacheablePropertyMetadata::Type::OwnProperty) {
             cache.shape = shape;
             cache.property_offset = cacheable_metadata.property_offset.value();
+            cache.checked_declarative_binding_count = declarative_record.binding_count();
         }
         return value;
     }
@@ -486,6 +509,19 @@ inline ThrowCompletionOr<void> put_by_value(VM& vm, Value base, Optional<Depreca
                 }
             }
 
+            if (value.is_number() && is_valid_integer_index(typed_array, canonical_index)) {
+                switch (typed_array.kind()) {
+                case TypedArrayBase::Kind::Float32Array:
+                    fast_typed_array_set_element<float>(typed_array, index, static_cast<float>(value.as_double()));
+                    return {};
+                case TypedArrayBase::Kind::Float64Array:
+                    fast_typed_array_set_element<double>(typed_array, index, value.as_double());
+                    return {};
+                default:
+                    break;
+                }
+            }
+
             if (typed_array.kind() == TypedArrayBase::Kind::Uint32Array && value.is_integral_number()) {
                 auto integer = value.as_double();
 
@@ -569,9 +605,18 @@ inline Value new_regexp(VM& vm, ParsedRegex const& parsed_regex, ByteString cons
 
     // 3. Return ! RegExpCreate(pattern, flags).
     auto& realm = *vm.current_realm();
-    Regex<ECMA262> regex(parsed_regex.regex, parsed_regex.pattern, parsed_regex.flags);
+
+    // OPTIMIZATION: Literals are usually evaluated many times, so we reuse bytecode that was already optimized for the
+    //               same pattern and flags instead of optimizing the parsed pattern again.
+    auto& regexp_cache = vm.regexp_cache();
+    auto regex = regexp_cache.get(pattern, flags);
+    if (!regex.has_value()) {
+        regex = Regex<ECMA262>(parsed_regex.regex, parsed_regex.pattern, parsed_regex.flags);
+        regexp_cache.set(pattern, flags, *regex);
+    }
+
     // NOTE: We bypass RegExpCreate and subsequently RegExpAlloc as an optimization to use the already parsed values.
-    auto regexp_object = RegExpObject::create(realm, move(regex), pattern, flags);
+    auto regexp_object = RegExpObject::create(realm, regex.release_value(), pattern, flags);
     // RegExpAlloc has these two steps from the 'Legacy RegExp features' proposal.
     regexp_object->set_realm(realm);
     // We don't need to check 'If SameValue(newTarget, thisRealm.[[Intrinsics]].[[%RegExp%]]) is true'
@@ -30,7 +30,17 @@ struct PropertyLookupCache {
 };
 
 struct GlobalVariableCache : public PropertyLookupCache {
-    u64 environment_serial_number { 0 };
+    // Index of the binding in the global declarative environment, if that's where the variable was found.
+    Optional<u32> declarative_binding_index;
+
+    // Number of global declarative environment bindings known not to shadow the cached global object property.
+    u32 checked_declarative_binding_count { 0 };
+};
+
+// Allocation-site feedback for object literals, see ObjectExpression::generate_bytecode().
+struct ObjectShapeCache {
+    // The shape the most recent object created by this literal ended up with.
+    WeakPtr<Shape> shape;
 };
 
 struct SourceRecord {
@@ -52,6 +62,7 @@ public:
         NonnullRefPtr<SourceCode const>,
         size_t number_of_property_lookup_caches,
         size_t number_of_global_variable_caches,
+        size_t number_of_object_shape_caches,
         size_t number_of_registers,
         bool is_strict_mode);
 
@@ -61,6 +72,7 @@ public:
     Vector<u8> bytecode;
     Vector<PropertyLookupCache> property_lookup_caches;
     Vector<GlobalVariableCache> global_variable_caches;
+    Vector<ObjectShapeCache> object_shape_caches;
     NonnullOwnPtr<StringTable> string_table;
     NonnullOwnPtr<IdentifierTable> identifier_table;
     NonnullOwnPtr<RegexTable> regex_table;
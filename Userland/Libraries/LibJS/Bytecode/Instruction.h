@@ -24,6 +24,7 @@
     O(BitwiseOr)                       \
     O(BitwiseXor)                      \
     O(BlockDeclarationInstantiation)   \
+    O(CacheObjectShape)                \
     O(Call)                            \
     O(CallWithArgumentArray)           \
     O(Catch)                           \
@@ -72,6 +73,7 @@
     O(ImportCall)                      \
     O(In)                              \
     O(Increment)                       \
+    O(InitObjectLiteralProperty)       \
     O(InitializeLexicalBinding)        \
     O(InitializeVariableBinding)       \
     O(InstanceOf)                      \
@@ -572,6 +572,7 @@ FLATTEN_ON_CLANG void Interpreter::run_bytecode(size_t entry_point)
             HANDLE_INSTRUCTION(BitwiseOr);
             HANDLE_INSTRUCTION(BitwiseXor);
             HANDLE_INSTRUCTION_WITHOUT_EXCEPTION_CHECK(BlockDeclarationInstantiation);
+            HANDLE_INSTRUCTION_WITHOUT_EXCEPTION_CHECK(CacheObjectShape);
             HANDLE_INSTRUCTION(Call);
             HANDLE_INSTRUCTION(CallWithArgumentArray);
             HANDLE_INSTRUCTION_WITHOUT_EXCEPTION_CHECK(Catch);
@@ -616,6 +617,7 @@ FLATTEN_ON_CLANG void Interpreter::run_bytecode(size_t entry_point)
             HANDLE_INSTRUCTION(ImportCall);
             HANDLE_INSTRUCTION(In);
             HANDLE_INSTRUCTION(Increment);
+            HANDLE_INSTRUCTION_WITHOUT_EXCEPTION_CHECK(InitObjectLiteralProperty);
             HANDLE_INSTRUCTION(InitializeLexicalBinding);
             HANDLE_INSTRUCTION(InitializeVariableBinding);
             HANDLE_INSTRUCTION(InstanceOf);
@@ -709,12 +711,11 @@ Interpreter::ResultAndReturnRegister Interpreter::run_executable(Executable& exe
 
     auto& running_execution_context = vm().running_execution_context();
     u32 registers_and_contants_count = executable.number_of_registers + executable.constants.size();
-    if (running_execution_context.registers_and_constants_and_locals.size() < registers_and_contants_count)
-        running_execution_context.registers_and_constants_and_locals.resize(registers_and_contants_count);
+    running_execution_context.ensure_registers_and_constants_and_locals(registers_and_contants_count);
 
     TemporaryChange restore_running_execution_context { m_running_execution_context, &running_execution_context };
-    TemporaryChange restore_arguments { m_arguments, running_execution_context.arguments.span() };
-    TemporaryChange restore_registers_and_constants_and_locals { m_registers_and_constants_and_locals, running_execution_context.registers_and_constants_and_locals.span() };
+    TemporaryChange restore_arguments { m_arguments, running_execution_context.arguments };
+    TemporaryChange restore_registers_and_constants_and_locals { m_registers_and_constants_and_locals, running_execution_context.registers_and_constants_and_locals };
 
     reg(Register::accumulator()) = initial_accumulator_value;
     reg(Register::return_value()) = {};
@@ -722,9 +723,7 @@ Interpreter::ResultAndReturnRegister Interpreter::run_executable(Executable& exe
 
     running_execution_context.executable = &executable;
 
-    for (size_t i = 0; i < executable.constants.size(); ++i) {
-        running_execution_context.registers_and_constants_and_locals[executable.number_of_registers + i] = executable.constants[i];
-    }
+    executable.constants.span().copy_to(running_execution_context.registers_and_constants_and_locals.slice(executable.number_of_registers));
 
     run_bytecode(entry_point.value_or(0));
 
@@ -1190,9 +1189,48 @@ void NewObject::execute_impl(Bytecode::Interpreter& interpreter) const
 {
     auto& vm = interpreter.vm();
     auto& realm = *vm.current_realm();
+
+    // OPTIMIZATION: If this object literal has been evaluated before, we know which shape the object is going to end up
+    //               with. Allocating the object with that shape and enough storage up front lets the following
+    //               InitObjectLiteralProperty instructions store their values directly, instead of transitioning
+    //               through a shape per property and growing the property storage as they go.
+    if (m_shape_cache_index.has_value()) {
+        auto& cache = interpreter.current_executable().object_shape_caches[*m_shape_cache_index];
+        if (auto* shape = cache.shape.ptr(); shape && shape->prototype() == realm.intrinsics().object_prototype()) {
+            interpreter.set(dst(), Object::create_with_premade_shape(*shape));
+            return;
+        }
+    }
+
     interpreter.set(dst(), Object::create(realm, realm.intrinsics().object_prototype()));
 }
 
+void InitObjectLiteralProperty::execute_impl(Bytecode::Interpreter& interpreter) const
+{
+    auto& object = interpreter.get(m_object).as_object();
+    auto value = interpreter.get(m_src);
+
+    // NOTE: An object created with the cached shape already has a slot for each property of the literal.
+    auto& cache = interpreter.current_executable().object_shape_caches[m_shape_cache_index];
+    if (cache.shape == &object.shape()) {
+        object.put_direct(m_property_offset, value);
+        return;
+    }
+
+    auto const& name = interpreter.current_executable().get_identifier(m_property);
+    object.define_direct_property(name, value, Attribute::Enumerable | Attribute::Writable | Attribute::Configurable);
+}
+
+void CacheObjectShape::execute_impl(Bytecode::Interpreter& interpreter) const
+{
+    auto& object = interpreter.get(m_object).as_object();
+    auto& cache = interpreter.current_executable().object_shape_caches[m_cache_index];
+
+    // NOTE: Dictionary shapes are unique to their object and get modified in place, so they can't be shared.
+    if (!cache.shape && !object.shape().is_dictionary())
+        cache.shape = object.shape();
+}
+
 void NewRegExp::execute_impl(Bytecode::Interpreter& interpreter) const
 {
     interpreter.set(dst(),
@@ -2040,6 +2078,20 @@ ByteString NewObject::to_byte_string_impl(Bytecode::Executable const& executable
     return ByteString::formatted("NewObject {}", format_operand("dst"sv, dst(), executable));
 }
 
+ByteString InitObjectLiteralProperty::to_byte_string_impl(Bytecode::Executable const& executable) const
+{
+    return ByteString::formatted("InitObjectLiteralProperty {}, {}, {}, offset:{}",
+        format_operand("object"sv, m_object, executable),
+        executable.identifier_table->get(m_property),
+        format_operand("src"sv, m_src, executable),
+        m_property_offset);
+}
+
+ByteString CacheObjectShape::to_byte_string_impl(Bytecode::Executable const& executable) const
+{
+    return ByteString::formatted("CacheObjectShape {}", format_operand("object"sv, m_object, executable));
+}
+
 ByteString NewRegExp::to_byte_string_impl(Bytecode::Executable const& executable) const
 {
     return ByteString::formatted("NewRegExp {}, source:{} (\"{}\") flags:{} (\"{}\")",
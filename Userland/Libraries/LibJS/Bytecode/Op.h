@@ -204,9 +204,10 @@ JS_ENUMERATE_COMMON_UNARY_OPS(JS_DECLARE_COMMON_UNARY_OP)
 
 class NewObject final : public Instruction {
 public:
-    explicit NewObject(Operand dst)
+    explicit NewObject(Operand dst, Optional<u32> shape_cache_index = {})
         : Instruction(Type::NewObject)
         , m_dst(dst)
+        , m_shape_cache_index(shape_cache_index)
     {
     }
 
@@ -218,9 +219,73 @@ public:
     }
 
     Operand dst() const { return m_dst; }
+    Optional<u32> const& shape_cache_index() const { return m_shape_cache_index; }
 
 private:
     Operand m_dst;
+    Optional<u32> m_shape_cache_index;
+};
+
+// Defines a data property of an object literal whose keys are all known up front. The property is the
+// property_offset'th one of the literal, which is also its offset in the shape cached for the literal.
+class InitObjectLiteralProperty final : public Instruction {
+public:
+    InitObjectLiteralProperty(Operand object, IdentifierTableIndex property, Operand src, u32 property_offset, u32 shape_cache_index)
+        : Instruction(Type::InitObjectLiteralProperty)
+        , m_object(object)
+        , m_property(property)
+        , m_src(src)
+        , m_property_offset(property_offset)
+        , m_shape_cache_index(shape_cache_index)
+    {
+    }
+
+    void execute_impl(Bytecode::Interpreter&) const;
+    ByteString to_byte_string_impl(Bytecode::Executable const&) const;
+    void visit_operands_impl(Function<void(Operand&)> visitor)
+    {
+        visitor(m_object);
+        visitor(m_src);
+    }
+
+    Operand object() const { return m_object; }
+    IdentifierTableIndex property() const { return m_property; }
+    Operand src() const { return m_src; }
+    u32 property_offset() const { return m_property_offset; }
+    u32 shape_cache_index() const { return m_shape_cache_index; }
+
+private:
+    Operand m_object;
+    IdentifierTableIndex m_property;
+    Operand m_src;
+    u32 m_property_offset { 0 };
+    u32 m_shape_cache_index { 0 };
+};
+
+// Remembers the shape a fully initialized object literal ended up with, so the next NewObject for the same
+// literal can create its object with that shape right away.
+class CacheObjectShape final : public Instruction {
+public:
+    CacheObjectShape(Operand object, u32 cache_index)
+        : Instruction(Type::CacheObjectShape)
+        , m_object(object)
+        , m_cache_index(cache_index)
+    {
+    }
+
+    void execute_impl(Bytecode::Interpreter&) const;
+    ByteString to_byte_string_impl(Bytecode::Executable const&) const;
+    void visit_operands_impl(Function<void(Operand&)> visitor)
+    {
+        visitor(m_object);
+    }
+
+    Operand object() const { return m_object; }
+    u32 cache_index() const { return m_cache_index; }
+
+private:
+    Operand m_object;
+    u32 m_cache_index { 0 };
 };
 
 class NewRegExp final : public Instruction {
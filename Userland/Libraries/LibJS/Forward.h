@@ -205,6 +205,7 @@ class PropertyDescriptor;
 class PropertyKey;
 class Realm;
 class Reference;
+class RegExpCache;
 class ScopeNode;
 class Script;
 class Shape;
@@ -219,6 +220,7 @@ class Utf16String;
 class VM;
 class PrototypeChainValidity;
 class Value;
+class ValueStack;
 class WeakContainer;
 class WrappedFunction;
 enum class DeclarationKind;
@@ -14,6 +14,7 @@
 #include <AK/StackInfo.h>
 #include <AK/TemporaryChange.h>
 #include <LibCore/ElapsedTimer.h>
+#include <LibCore/Tracing.h>
 #include <LibJS/Bytecode/Interpreter.h>
 #include <LibJS/Heap/CellAllocator.h>
 #include <LibJS/Heap/Handle.h>
@@ -259,11 +260,40 @@ AK::JsonObject Heap::dump_graph()
     return visitor.dump();
 }
 
+AK::JsonObject Heap::dump_cell_histogram()
+{
+    struct CellTypeStatistics {
+        size_t count { 0 };
+        size_t bytes { 0 };
+    };
+    HashMap<StringView, CellTypeStatistics> histogram;
+
+    for_each_block([&](auto& block) {
+        block.template for_each_cell_in_state<Cell::State::Live>([&](Cell* cell) {
+            auto& statistics = histogram.ensure(cell->class_name());
+            ++statistics.count;
+            statistics.bytes += block.cell_size();
+        });
+        return IterationDecision::Continue;
+    });
+
+    AK::JsonObject result;
+    for (auto& it : histogram) {
+        AK::JsonObject statistics;
+        statistics.set("count"sv, it.value.count);
+        statistics.set("bytes"sv, it.value.bytes);
+        result.set(it.key, move(statistics));
+    }
+    return result;
+}
+
 void Heap::collect_garbage(CollectionType collection_type, bool print_report)
 {
     VERIFY(!m_collecting_garbage);
     TemporaryChange change(m_collecting_garbage, true);
 
+    Core::Tracing::ScopedEvent trace_event { "GC"sv, "Heap::collect_garbage"sv };
+
 #ifdef AK_OS_SERENITY
     static size_t global_gc_counter = 0;
     perf_event(PERF_EVENT_SIGNPOST, gc_perf_string_id, global_gc_counter++);
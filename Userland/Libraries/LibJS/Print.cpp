@@ -397,7 +397,7 @@ ErrorOr<void> print_array_buffer(JS::PrintContext& print_context, JS::ArrayBuffe
     if (byte_length == 0)
         return {};
 
-    auto& buffer = array_buffer.buffer();
+    auto buffer = array_buffer.bytes();
     TRY(js_out(print_context, "\n"));
     for (size_t i = 0; i < byte_length; ++i) {
         TRY(js_out(print_context, "{:02x}", buffer[i]));
@@ -5,15 +5,16 @@
  */
 
 #include <LibJS/Runtime/Agent.h>
+#include <LibJS/Runtime/VM.h>
 
 namespace JS {
 
 // 9.7.2 AgentCanSuspend ( ), https://tc39.es/ecma262/#sec-agentcansuspend
-bool agent_can_suspend()
+bool agent_can_suspend(VM const& vm)
 {
-    // FIXME: 1. Let AR be the Agent Record of the surrounding agent.
-    // FIXME: 2. Return AR.[[CanBlock]].
-    return true;
+    // 1. Let AR be the Agent Record of the surrounding agent.
+    // 2. Return AR.[[CanBlock]].
+    return vm.agent_can_block();
 }
 
 }
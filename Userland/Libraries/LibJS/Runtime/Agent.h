@@ -6,8 +6,10 @@
 
 #pragma once
 
+#include <LibJS/Forward.h>
+
 namespace JS {
 
-bool agent_can_suspend();
+bool agent_can_suspend(VM const&);
 
 }
@@ -179,7 +179,8 @@ ThrowCompletionOr<bool> Array::set_length(PropertyDescriptor const& property_des
 }
 
 // 23.1.3.30.1 SortIndexedProperties ( obj, len, SortCompare, holes ), https://tc39.es/ecma262/#sec-sortindexedproperties
-ThrowCompletionOr<MarkedVector<Value>> sort_indexed_properties(VM& vm, Object const& object, size_t length, Function<ThrowCompletionOr<double>(Value, Value)> const& sort_compare, Holes holes)
+template<typename SortItems>
+static ThrowCompletionOr<MarkedVector<Value>> sort_indexed_properties_impl(VM& vm, Object const& object, size_t length, Holes holes, SortItems const& sort_items)
 {
     // 1. Let items be a new empty List.
     auto items = MarkedVector<Value> { vm.heap() };
@@ -220,17 +221,34 @@ ThrowCompletionOr<MarkedVector<Value>> sort_indexed_properties(VM& vm, Object co
 
     // 4. Sort items using an implementation-defined sequence of calls to SortCompare. If any such call returns an abrupt completion, stop before performing any further calls to SortCompare or steps in this algorithm and return that Completion Record.
 
-    // Perform sorting by merge sort. This isn't as efficient compared to quick sort, but
-    // quicksort can't be used in all cases because the spec requires Array.prototype.sort()
-    // to be stable. FIXME: when initially scanning through the array, maintain a flag
-    // for if an unstable sort would be indistinguishable from a stable sort (such as just
-    // just strings or numbers), and in that case use quick sort instead for better performance.
-    TRY(array_merge_sort(vm, sort_compare, items));
+    // NOTE: The spec requires Array.prototype.sort() to be stable, so we always use a (natural) merge sort.
+    TRY(sort_items(items));
 
     // 5. Return items.
     return items;
 }
 
+ThrowCompletionOr<MarkedVector<Value>> sort_indexed_properties(VM& vm, Object const& object, size_t length, Function<ThrowCompletionOr<double>(Value, Value)> const& sort_compare, Holes holes)
+{
+    return sort_indexed_properties_impl(vm, object, length, holes, [&](MarkedVector<Value>& items) {
+        return array_merge_sort(vm, sort_compare, items);
+    });
+}
+
+// 23.1.3.30.1 SortIndexedProperties ( obj, len, SortCompare, holes ), https://tc39.es/ecma262/#sec-sortindexedproperties
+// NOTE: This performs SortIndexedProperties with a SortCompare closure that returns ? CompareArrayElements(x, y, comparefn).
+ThrowCompletionOr<MarkedVector<Value>> sort_indexed_properties(VM& vm, Object const& object, size_t length, FunctionObject* comparefn, Holes holes)
+{
+    return sort_indexed_properties_impl(vm, object, length, holes, [&](MarkedVector<Value>& items) -> ThrowCompletionOr<void> {
+        // OPTIMIZATION: Without a comparefn, CompareArrayElements compares the string values of both elements. Rather
+        //               than converting elements to strings on every comparison, we convert each element only once.
+        if (!comparefn)
+            return array_merge_sort_by_string_values(vm, items);
+
+        return array_merge_sort(vm, [&](Value x, Value y) { return compare_array_elements(vm, x, y, comparefn); }, items);
+    });
+}
+
 // 23.1.3.30.2 CompareArrayElements ( x, y, comparefn ), https://tc39.es/ecma262/#sec-comparearrayelements
 ThrowCompletionOr<double> compare_array_elements(VM& vm, Value x, Value y, FunctionObject* comparefn)
 {
@@ -4,10 +4,12 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <LibCore/System.h>
 #include <LibJS/Runtime/AbstractOperations.h>
 #include <LibJS/Runtime/ArrayBuffer.h>
 #include <LibJS/Runtime/ArrayBufferConstructor.h>
 #include <LibJS/Runtime/GlobalObject.h>
+#include <sys/mman.h>
 
 namespace JS {
 
@@ -32,6 +34,13 @@ NonnullGCPtr<ArrayBuffer> ArrayBuffer::create(Realm& realm, ByteBuffer* buffer)
     return realm.heap().allocate<ArrayBuffer>(realm, buffer, realm.intrinsics().array_buffer_prototype());
 }
 
+NonnullGCPtr<ArrayBuffer> ArrayBuffer::create_shared(Realm& realm, SharedDataBlock block)
+{
+    auto array_buffer = realm.heap().allocate<ArrayBuffer>(realm, nullptr, realm.intrinsics().shared_array_buffer_prototype());
+    array_buffer->set_data_block(DataBlock { move(block), DataBlock::Shared::Yes });
+    return array_buffer;
+}
+
 ArrayBuffer::ArrayBuffer(ByteBuffer buffer, Object& prototype)
     : Object(ConstructWithPrototypeTag::Tag, prototype)
     , m_data_block(DataBlock { move(buffer), DataBlock::Shared::No })
@@ -52,6 +61,147 @@ void ArrayBuffer::visit_edges(Cell::Visitor& visitor)
     visitor.visit(m_detach_key);
 }
 
+size_t SharedDataBlock::memory_size_for(size_t size)
+{
+    return align_up_to(size, alignof(WaiterTable)) + sizeof(WaiterTable);
+}
+
+ErrorOr<NonnullRefPtr<SharedDataBlock::Memory>> SharedDataBlock::Memory::create(size_t size)
+{
+    // NOTE: Anonymous memory is zero-filled, which also leaves every waiter record free.
+    auto* data = TRY(Core::System::mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0));
+    return adopt_ref(*new Memory(static_cast<u8*>(data), size, {}));
+}
+
+NonnullRefPtr<SharedDataBlock::Memory> SharedDataBlock::Memory::create_from_buffer(Core::AnonymousBuffer buffer)
+{
+    auto* data = buffer.data<u8>();
+    auto size = buffer.size();
+    return adopt_ref(*new Memory(data, size, move(buffer)));
+}
+
+SharedDataBlock::Memory::~Memory()
+{
+    // NOTE: Memory that came with its shared buffer is mapped by that buffer.
+    if (!m_shared_buffer.has_value() || m_shared_buffer->data<u8>() != m_data)
+        MUST(Core::System::munmap(m_data, m_size));
+}
+
+ErrorOr<Core::AnonymousBuffer> SharedDataBlock::Memory::shared_buffer()
+{
+    if (m_shared_buffer.has_value())
+        return *m_shared_buffer;
+
+    // OPTIMIZATION: Most SharedArrayBuffers never leave the agent that created them, so they don't get a file descriptor until
+    //               they are first posted to another agent. The shared memory is then mapped over the private memory, so that
+    //               pointers into the block stay valid.
+    // NOTE: No other agent can access the block yet, so nothing writes to it while it is being moved.
+    auto buffer = TRY(Core::AnonymousBuffer::create_with_size(m_size));
+    memcpy(buffer.data<u8>(), m_data, m_size);
+    TRY(Core::System::mmap(m_data, m_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_FIXED, buffer.fd(), 0));
+
+    m_shared_buffer = buffer;
+    return buffer;
+}
+
+ErrorOr<SharedDataBlock> SharedDataBlock::create(size_t size)
+{
+    auto memory = TRY(Memory::create(memory_size_for(size)));
+    return SharedDataBlock { move(memory), size };
+}
+
+ErrorOr<SharedDataBlock> SharedDataBlock::create_from_buffer(Core::AnonymousBuffer buffer, size_t size)
+{
+    if (!buffer.is_valid() || buffer.size() < memory_size_for(size))
+        return AK::Error::from_string_literal("Shared memory is too small for the Shared Data Block");
+    return SharedDataBlock { Memory::create_from_buffer(move(buffer)), size };
+}
+
+ErrorOr<Core::AnonymousBuffer> SharedDataBlock::shared_buffer() const
+{
+    return m_memory->shared_buffer();
+}
+
+SharedDataBlock::WaiterTable& SharedDataBlock::waiter_table()
+{
+    return *reinterpret_cast<WaiterTable*>(m_memory->data() + align_up_to(m_size, alignof(WaiterTable)));
+}
+
+// NOTE: The lock word is 0 if unlocked, 1 if locked, and 2 if locked with agents possibly waiting for it.
+void SharedDataBlock::enter_critical_section()
+{
+    auto& lock = waiter_table().lock;
+
+    u32 expected = 0;
+    if (AK::atomic_compare_exchange_strong(&lock, expected, 1u, AK::memory_order_acquire))
+        return;
+
+    if (expected != 2)
+        expected = AK::atomic_exchange(&lock, 2u, AK::memory_order_acquire);
+    while (expected != 0) {
+        (void)Core::System::futex_wait(&lock, 2, {});
+        expected = AK::atomic_exchange(&lock, 2u, AK::memory_order_acquire);
+    }
+}
+
+void SharedDataBlock::leave_critical_section()
+{
+    auto& lock = waiter_table().lock;
+
+    if (AK::atomic_fetch_sub(&lock, 1u, AK::memory_order_release) != 1) {
+        AK::atomic_store(&lock, 0u, AK::memory_order_release);
+        (void)Core::System::futex_wake(&lock, 1);
+    }
+}
+
+SharedDataBlock::WaiterRecord* SharedDataBlock::add_waiter(size_t byte_index)
+{
+    auto& table = waiter_table();
+
+    for (auto& record : table.records) {
+        if (record.key != 0)
+            continue;
+
+        record.key = static_cast<u64>(byte_index) + 1;
+        record.order = table.next_order++;
+        AK::atomic_store(&record.state, WaiterRecord::waiting);
+        return &record;
+    }
+
+    return nullptr;
+}
+
+void SharedDataBlock::remove_waiter(WaiterRecord& record)
+{
+    record.key = 0;
+}
+
+u32 SharedDataBlock::notify_waiters(size_t byte_index, double count)
+{
+    auto& table = waiter_table();
+    auto key = static_cast<u64>(byte_index) + 1;
+
+    u32 notified = 0;
+    while (notified < count) {
+        // NOTE: Notify the waiter that was added first. The orders are compared relative to the next one so that they may wrap around.
+        WaiterRecord* first = nullptr;
+        for (auto& record : table.records) {
+            if (record.key != key || AK::atomic_load(&record.state) != WaiterRecord::waiting)
+                continue;
+            if (!first || table.next_order - record.order > table.next_order - first->order)
+                first = &record;
+        }
+        if (!first)
+            break;
+
+        AK::atomic_store(&first->state, WaiterRecord::notified);
+        (void)Core::System::futex_wake(&first->state, 1);
+        ++notified;
+    }
+
+    return notified;
+}
+
 // 6.2.9.1 CreateByteDataBlock ( size ), https://tc39.es/ecma262/#sec-createbytedatablock
 ThrowCompletionOr<DataBlock> create_byte_data_block(VM& vm, size_t size)
 {
@@ -69,12 +219,11 @@ ThrowCompletionOr<DataBlock> create_byte_data_block(VM& vm, size_t size)
     return DataBlock { data_block.release_value(), DataBlock::Shared::No };
 }
 
-// FIXME: The returned DataBlock is not shared in the sense that the standard specifies it.
 // 6.2.9.2 CreateSharedByteDataBlock ( size ), https://tc39.es/ecma262/#sec-createsharedbytedatablock
 static ThrowCompletionOr<DataBlock> create_shared_byte_data_block(VM& vm, size_t size)
 {
     // 1. Let db be a new Shared Data Block value consisting of size bytes. If it is impossible to create such a Shared Data Block, throw a RangeError exception.
-    auto data_block = ByteBuffer::create_zeroed(size);
+    auto data_block = SharedDataBlock::create(size);
     if (data_block.is_error())
         return vm.throw_completion<RangeError>(ErrorType::NotEnoughMemoryToAllocate, size);
 
@@ -88,10 +237,10 @@ static ThrowCompletionOr<DataBlock> create_shared_byte_data_block(VM& vm, size_t
 }
 
 // 6.2.9.3 CopyDataBlockBytes ( toBlock, toIndex, fromBlock, fromIndex, count ), https://tc39.es/ecma262/#sec-copydatablockbytes
-void copy_data_block_bytes(ByteBuffer& to_block, u64 to_index, ByteBuffer const& from_block, u64 from_index, u64 count)
+void copy_data_block_bytes(Bytes to_block, u64 to_index, ReadonlyBytes from_block, u64 from_index, u64 count)
 {
     // 1. Assert: fromBlock and toBlock are distinct values.
-    VERIFY(&to_block != &from_block);
+    VERIFY(to_block.is_empty() || to_block.data() != from_block.data());
 
     // 2. Let fromSize be the number of bytes in fromBlock.
     auto from_size = from_block.size();
@@ -215,10 +364,10 @@ ThrowCompletionOr<ArrayBuffer*> clone_array_buffer(VM& vm, ArrayBuffer& source_b
     auto* target_buffer = TRY(allocate_array_buffer(vm, realm.intrinsics().array_buffer_constructor(), source_length));
 
     // 3. Let srcBlock be srcBuffer.[[ArrayBufferData]].
-    auto& source_block = source_buffer.buffer();
+    auto source_block = source_buffer.bytes();
 
     // 4. Let targetBlock be targetBuffer.[[ArrayBufferData]].
-    auto& target_block = target_buffer->buffer();
+    auto target_block = target_buffer->bytes();
 
     // 5. Perform CopyDataBlockBytes(targetBlock, 0, srcBlock, srcByteOffset, srcLength).
     copy_data_block_bytes(target_block, 0, source_block, source_byte_offset, source_length);
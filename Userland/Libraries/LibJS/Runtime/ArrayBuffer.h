@@ -6,9 +6,12 @@
 
 #pragma once
 
+#include <AK/Atomic.h>
 #include <AK/ByteBuffer.h>
 #include <AK/Function.h>
+#include <AK/RefCounted.h>
 #include <AK/Variant.h>
+#include <LibCore/AnonymousBuffer.h>
 #include <LibJS/Runtime/BigInt.h>
 #include <LibJS/Runtime/Completion.h>
 #include <LibJS/Runtime/GlobalObject.h>
@@ -27,6 +30,92 @@ enum class PreserveResizability {
     PreserveResizability
 };
 
+// A Shared Data Block starts out in private memory. The first time it is posted to another agent, it moves into anonymous shared
+// memory that can be mapped into every agent of the agent cluster, even if those agents live in other processes. The memory is laid
+// out as the data bytes, followed by the waiter lists that Atomics.wait() and Atomics.notify() use to park and wake waiters.
+class SharedDataBlock {
+public:
+    // 25.4.1 Waiter Record, https://tc39.es/ecma262/#sec-waiter-record
+    struct WaiterRecord {
+        static constexpr u32 waiting = 0;
+        static constexpr u32 notified = 1;
+
+        u64 key;   // The waited-on byte index plus one, or 0 if this record is free.
+        u32 order; // Records are notified in the order in which they were added.
+        u32 state;
+    };
+    static constexpr size_t waiter_record_count = 128;
+
+    static ErrorOr<SharedDataBlock> create(size_t size);
+    static ErrorOr<SharedDataBlock> create_from_buffer(Core::AnonymousBuffer, size_t size);
+
+    Bytes bytes() { return { m_memory->data(), m_size }; }
+    ReadonlyBytes bytes() const { return { m_memory->data(), m_size }; }
+    size_t size() const { return m_size; }
+
+    // Returns the shared memory backing this block, moving the block into it if it has not been shared before.
+    ErrorOr<Core::AnonymousBuffer> shared_buffer() const;
+
+    // 25.4.1.6 EnterCriticalSection ( WL ), https://tc39.es/ecma262/#sec-entercriticalsection
+    // 25.4.1.7 LeaveCriticalSection ( WL ), https://tc39.es/ecma262/#sec-leavecriticalsection
+    // NOTE: A single critical section guards the waiter lists of every index in the block.
+    void enter_critical_section();
+    void leave_critical_section();
+
+    // 25.4.1.8 AddWaiter ( WL, waiterRecord ), https://tc39.es/ecma262/#sec-addwaiter
+    // Returns nullptr if there is no room for another waiter. The record's state is the word that the waiter should wait on.
+    WaiterRecord* add_waiter(size_t byte_index);
+
+    // 25.4.1.9 RemoveWaiter ( WL, waiterRecord ), https://tc39.es/ecma262/#sec-removewaiter
+    void remove_waiter(WaiterRecord&);
+
+    // 25.4.1.10 RemoveWaiters ( WL, c ), https://tc39.es/ecma262/#sec-removewaiters
+    // 25.4.1.13 NotifyWaiter ( WL, waiterRecord ), https://tc39.es/ecma262/#sec-notifywaiter
+    // Returns the number of waiters on the byte index that were notified.
+    u32 notify_waiters(size_t byte_index, double count);
+
+private:
+    struct WaiterTable {
+        u32 lock;
+        u32 next_order;
+        WaiterRecord records[waiter_record_count];
+    };
+
+    class Memory : public RefCounted<Memory> {
+    public:
+        static ErrorOr<NonnullRefPtr<Memory>> create(size_t size);
+        static NonnullRefPtr<Memory> create_from_buffer(Core::AnonymousBuffer);
+        ~Memory();
+
+        u8* data() const { return m_data; }
+        ErrorOr<Core::AnonymousBuffer> shared_buffer();
+
+    private:
+        Memory(u8* data, size_t size, Optional<Core::AnonymousBuffer> shared_buffer)
+            : m_data(data)
+            , m_size(size)
+            , m_shared_buffer(move(shared_buffer))
+        {
+        }
+
+        u8* m_data { nullptr };
+        size_t m_size { 0 };
+        Optional<Core::AnonymousBuffer> m_shared_buffer;
+    };
+
+    SharedDataBlock(NonnullRefPtr<Memory> memory, size_t size)
+        : m_memory(move(memory))
+        , m_size(size)
+    {
+    }
+
+    static size_t memory_size_for(size_t size);
+    WaiterTable& waiter_table();
+
+    NonnullRefPtr<Memory> m_memory;
+    size_t m_size { 0 };
+};
+
 // 6.2.9 Data Blocks, https://tc39.es/ecma262/#sec-data-blocks
 struct DataBlock {
     enum class Shared {
@@ -37,20 +126,35 @@ struct DataBlock {
     ByteBuffer& buffer()
     {
         ByteBuffer* ptr { nullptr };
-        byte_buffer.visit([&](Empty) { VERIFY_NOT_REACHED(); }, [&](auto* pointer) { ptr = pointer; }, [&](auto& value) { ptr = &value; });
+        byte_buffer.visit(
+            [&](Empty) { VERIFY_NOT_REACHED(); },
+            [&](SharedDataBlock&) { VERIFY_NOT_REACHED(); },
+            [&](ByteBuffer* pointer) { ptr = pointer; },
+            [&](ByteBuffer& value) { ptr = &value; });
         return *ptr;
     }
     ByteBuffer const& buffer() const { return const_cast<DataBlock*>(this)->buffer(); }
 
+    Bytes bytes()
+    {
+        return byte_buffer.visit(
+            [](Empty) -> Bytes { return {}; },
+            [](SharedDataBlock& block) { return block.bytes(); },
+            [](ByteBuffer* buffer) { return buffer->bytes(); },
+            [](ByteBuffer& buffer) { return buffer.bytes(); });
+    }
+    ReadonlyBytes bytes() const { return const_cast<DataBlock*>(this)->bytes(); }
+
     size_t size() const
     {
         return byte_buffer.visit(
             [](Empty) -> size_t { return 0u; },
+            [](SharedDataBlock const& block) { return block.size(); },
             [](ByteBuffer const& buffer) { return buffer.size(); },
             [](ByteBuffer const* buffer) { return buffer->size(); });
     }
 
-    Variant<Empty, ByteBuffer, ByteBuffer*> byte_buffer;
+    Variant<Empty, ByteBuffer, ByteBuffer*, SharedDataBlock> byte_buffer;
     Shared is_shared = { Shared::No };
 };
 
@@ -62,6 +166,7 @@ public:
     static ThrowCompletionOr<NonnullGCPtr<ArrayBuffer>> create(Realm&, size_t);
     static NonnullGCPtr<ArrayBuffer> create(Realm&, ByteBuffer);
     static NonnullGCPtr<ArrayBuffer> create(Realm&, ByteBuffer*);
+    static NonnullGCPtr<ArrayBuffer> create_shared(Realm&, SharedDataBlock);
 
     virtual ~ArrayBuffer() override = default;
 
@@ -71,6 +176,15 @@ public:
     ByteBuffer& buffer() { return m_data_block.buffer(); }
     ByteBuffer const& buffer() const { return m_data_block.buffer(); }
 
+    // Prefer these over buffer(), as they also work for the Shared Data Blocks of SharedArrayBuffers.
+    Bytes bytes() { return m_data_block.bytes(); }
+    ReadonlyBytes bytes() const { return m_data_block.bytes(); }
+    SharedDataBlock* shared_data_block() { return m_data_block.byte_buffer.get_pointer<SharedDataBlock>(); }
+    SharedDataBlock const* shared_data_block() const { return m_data_block.byte_buffer.get_pointer<SharedDataBlock>(); }
+
+    // Whether [[ArrayBufferData]] belongs to this ArrayBuffer, rather than to whoever created it.
+    bool owns_buffer() const { return m_data_block.byte_buffer.has<ByteBuffer>(); }
+
     // [[ArrayBufferMaxByteLength]]
     size_t max_byte_length() const { return m_max_byte_length.value(); }
     void set_max_byte_length(size_t max_byte_length) { m_max_byte_length = max_byte_length; }
@@ -146,7 +260,7 @@ private:
 };
 
 ThrowCompletionOr<DataBlock> create_byte_data_block(VM& vm, size_t size);
-void copy_data_block_bytes(ByteBuffer& to_block, u64 to_index, ByteBuffer const& from_block, u64 from_index, u64 count);
+void copy_data_block_bytes(Bytes to_block, u64 to_index, ReadonlyBytes from_block, u64 from_index, u64 count);
 ThrowCompletionOr<ArrayBuffer*> allocate_array_buffer(VM&, FunctionObject& constructor, size_t byte_length, Optional<size_t> const& max_byte_length = {});
 ThrowCompletionOr<void> detach_array_buffer(VM&, ArrayBuffer& array_buffer, Optional<Value> key = {});
 ThrowCompletionOr<Optional<size_t>> get_array_buffer_max_byte_length_option(VM&, Value options);
@@ -244,38 +358,49 @@ static Value raw_bytes_to_numeric(VM& vm, Bytes raw_value, bool is_little_endian
 
 // 25.1.3.15 GetValueFromBuffer ( arrayBuffer, byteIndex, type, isTypedArray, order [ , isLittleEndian ] ), https://tc39.es/ecma262/#sec-getvaluefrombuffer
 template<typename T>
-Value ArrayBuffer::get_value(size_t byte_index, [[maybe_unused]] bool is_typed_array, Order, bool is_little_endian)
+Value ArrayBuffer::get_value(size_t byte_index, [[maybe_unused]] bool is_typed_array, Order order, bool is_little_endian)
 {
     auto& vm = this->vm();
     // 1. Assert: IsDetachedBuffer(arrayBuffer) is false.
     VERIFY(!is_detached());
 
     // 2. Assert: There are sufficient bytes in arrayBuffer starting at byteIndex to represent a value of type.
-    VERIFY(m_data_block.buffer().bytes().slice(byte_index).size() >= sizeof(T));
+    VERIFY(m_data_block.bytes().slice(byte_index).size() >= sizeof(T));
 
     // 3. Let block be arrayBuffer.[[ArrayBufferData]].
-    auto& block = m_data_block.buffer();
+    auto block = m_data_block.bytes();
 
     // 4. Let elementSize be the Element Size value specified in Table 70 for Element Type type.
     auto element_size = sizeof(T);
 
     AK::Array<u8, sizeof(T)> raw_value {};
 
-    // FIXME: 5. If IsSharedArrayBuffer(arrayBuffer) is true, then
-    if (false) {
+    // 5. If IsSharedArrayBuffer(arrayBuffer) is true, then
+    if (is_shared_array_buffer()) {
         // FIXME: a. Let execution be the [[CandidateExecution]] field of the surrounding agent's Agent Record.
         // FIXME: b. Let eventsRecord be the Agent Events Record of execution.[[EventsRecords]] whose [[AgentSignifier]] is AgentSignifier().
         // FIXME: c. If isTypedArray is true and IsNoTearConfiguration(type, order) is true, let noTear be true; otherwise let noTear be false.
-        // FIXME: d. Let rawValue be a List of length elementSize whose elements are nondeterministically chosen byte values.
-        // FIXME: e. NOTE: In implementations, rawValue is the result of a non-atomic or atomic read instruction on the underlying hardware. The nondeterminism is a semantic prescription of the memory model to describe observable behaviour of hardware with weak consistency.
+        // d. Let rawValue be a List of length elementSize whose elements are nondeterministically chosen byte values.
+        // e. NOTE: In implementations, rawValue is the result of a non-atomic or atomic read instruction on the underlying hardware. The nondeterminism is a semantic prescription of the memory model to describe observable behaviour of hardware with weak consistency.
         // FIXME: f. Let readEvent be ReadSharedMemory { [[Order]]: order, [[NoTear]]: noTear, [[Block]]: block, [[ByteIndex]]: byteIndex, [[ElementSize]]: elementSize }.
         // FIXME: g. Append readEvent to eventsRecord.[[EventList]].
         // FIXME: h. Append Chosen Value Record { [[Event]]: readEvent, [[ChosenValue]]: rawValue } to execution.[[ChosenValues]].
+        using U = Conditional<IsSame<ClampedU8, T>, u8, T>;
+        if constexpr (IsIntegral<U>) {
+            if (order == Order::SeqCst) {
+                auto value = AK::atomic_load(reinterpret_cast<U*>(block.offset_pointer(byte_index)));
+                ReadonlyBytes { &value, sizeof(U) }.copy_to(raw_value);
+            } else {
+                block.slice(byte_index, element_size).copy_to(raw_value);
+            }
+        } else {
+            block.slice(byte_index, element_size).copy_to(raw_value);
+        }
     }
     // 6. Else,
     else {
         // a. Let rawValue be a List whose elements are bytes from block at indices in the interval from byteIndex (inclusive) to byteIndex + elementSize (exclusive).
-        block.bytes().slice(byte_index, element_size).copy_to(raw_value);
+        block.slice(byte_index, element_size).copy_to(raw_value);
     }
 
     // 7. Assert: The number of elements in rawValue is elementSize.
@@ -355,7 +480,7 @@ static void numeric_to_raw_bytes(VM& vm, Value value, bool is_little_endian, Byt
 
 // 25.1.3.17 SetValueInBuffer ( arrayBuffer, byteIndex, type, value, isTypedArray, order [ , isLittleEndian ] ), https://tc39.es/ecma262/#sec-setvalueinbuffer
 template<typename T>
-void ArrayBuffer::set_value(size_t byte_index, Value value, [[maybe_unused]] bool is_typed_array, Order, bool is_little_endian)
+void ArrayBuffer::set_value(size_t byte_index, Value value, [[maybe_unused]] bool is_typed_array, Order order, bool is_little_endian)
 {
     auto& vm = this->vm();
 
@@ -363,7 +488,7 @@ void ArrayBuffer::set_value(size_t byte_index, Value value, [[maybe_unused]] boo
     VERIFY(!is_detached());
 
     // 2. Assert: There are sufficient bytes in arrayBuffer starting at byteIndex to represent a value of type.
-    VERIFY(m_data_block.buffer().bytes().slice(byte_index).size() >= sizeof(T));
+    VERIFY(m_data_block.bytes().slice(byte_index).size() >= sizeof(T));
 
     // 3. Assert: value is a BigInt if IsBigIntElementType(type) is true; otherwise, value is a Number.
     if constexpr (IsIntegral<T> && sizeof(T) == 8)
@@ -372,7 +497,7 @@ void ArrayBuffer::set_value(size_t byte_index, Value value, [[maybe_unused]] boo
         VERIFY(value.is_number());
 
     // 4. Let block be arrayBuffer.[[ArrayBufferData]].
-    auto& block = m_data_block.buffer();
+    auto block = m_data_block.bytes();
 
     // FIXME: 5. Let elementSize be the Element Size value specified in Table 70 for Element Type type.
 
@@ -383,17 +508,30 @@ void ArrayBuffer::set_value(size_t byte_index, Value value, [[maybe_unused]] boo
     AK::Array<u8, sizeof(T)> raw_bytes;
     numeric_to_raw_bytes<T>(vm, value, is_little_endian, raw_bytes);
 
-    // FIXME 8. If IsSharedArrayBuffer(arrayBuffer) is true, then
-    if (false) {
+    // 8. If IsSharedArrayBuffer(arrayBuffer) is true, then
+    if (is_shared_array_buffer()) {
         // FIXME: a. Let execution be the [[CandidateExecution]] field of the surrounding agent's Agent Record.
         // FIXME: b. Let eventsRecord be the Agent Events Record of execution.[[EventsRecords]] whose [[AgentSignifier]] is AgentSignifier().
         // FIXME: c. If isTypedArray is true and IsNoTearConfiguration(type, order) is true, let noTear be true; otherwise let noTear be false.
         // FIXME: d. Append WriteSharedMemory { [[Order]]: order, [[NoTear]]: noTear, [[Block]]: block, [[ByteIndex]]: byteIndex, [[ElementSize]]: elementSize, [[Payload]]: rawBytes } to eventsRecord.[[EventList]].
+        // NOTE: Sequentially consistent writes (i.e. Atomics.store()) must be visible to agents in other threads and processes.
+        using U = Conditional<IsSame<ClampedU8, T>, u8, T>;
+        if constexpr (IsIntegral<U>) {
+            if (order == Order::SeqCst) {
+                U value;
+                raw_bytes.span().copy_to(Bytes { &value, sizeof(U) });
+                AK::atomic_store(reinterpret_cast<U*>(block.offset_pointer(byte_index)), value);
+            } else {
+                raw_bytes.span().copy_to(block.slice(byte_index));
+            }
+        } else {
+            raw_bytes.span().copy_to(block.slice(byte_index));
+        }
     }
     // 9. Else,
     else {
         // a. Store the individual bytes of rawBytes into block, starting at block[byteIndex].
-        raw_bytes.span().copy_to(block.span().slice(byte_index));
+        raw_bytes.span().copy_to(block.slice(byte_index));
     }
 
     // 10. Return unused.
@@ -408,12 +546,30 @@ Value ArrayBuffer::get_modify_set_value(size_t byte_index, Value value, ReadWrit
     auto raw_bytes = MUST(ByteBuffer::create_uninitialized(sizeof(T)));
     numeric_to_raw_bytes<T>(vm, value, is_little_endian, raw_bytes);
 
-    // FIXME: Check for shared buffer
-
     auto raw_bytes_read = MUST(ByteBuffer::create_uninitialized(sizeof(T)));
-    m_data_block.buffer().bytes().slice(byte_index, sizeof(T)).copy_to(raw_bytes_read);
+
+    // NOTE: Other agents may modify a shared block concurrently, so we retry the operation until it applies to an unchanged value.
+    using U = Conditional<IsSame<ClampedU8, T>, u8, T>;
+    if constexpr (IsIntegral<U>) {
+        if (is_shared_array_buffer()) {
+            auto* storage = reinterpret_cast<U*>(m_data_block.bytes().offset_pointer(byte_index));
+            auto expected = AK::atomic_load(storage);
+            while (true) {
+                ReadonlyBytes { &expected, sizeof(U) }.copy_to(raw_bytes_read);
+                auto raw_bytes_modified = operation(raw_bytes_read, raw_bytes);
+
+                U desired;
+                raw_bytes_modified.span().copy_to(Bytes { &desired, sizeof(U) });
+                if (AK::atomic_compare_exchange_strong(storage, expected, desired))
+                    break;
+            }
+            return raw_bytes_to_numeric<T>(vm, raw_bytes_read, is_little_endian);
+        }
+    }
+
+    m_data_block.bytes().slice(byte_index, sizeof(T)).copy_to(raw_bytes_read);
     auto raw_bytes_modified = operation(raw_bytes_read, raw_bytes);
-    raw_bytes_modified.span().copy_to(m_data_block.buffer().span().slice(byte_index));
+    raw_bytes_modified.span().copy_to(m_data_block.bytes().slice(byte_index));
 
     return raw_bytes_to_numeric<T>(vm, raw_bytes_read, is_little_endian);
 }
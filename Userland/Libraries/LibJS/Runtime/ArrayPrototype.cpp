@@ -1339,59 +1339,204 @@ JS_DEFINE_NATIVE_FUNCTION(ArrayPrototype::some)
     return Value(false);
 }
 
-ThrowCompletionOr<void> array_merge_sort(VM& vm, Function<ThrowCompletionOr<double>(Value, Value)> const& compare_func, MarkedVector<Value>& arr_to_sort)
+// A stable natural merge sort in the style of TimSort. Existing ascending (or strictly descending) runs are found and
+// reused as-is, short runs are extended to a minimum length with binary insertion sort, and runs are merged in an order
+// that keeps their lengths balanced. This makes already (or mostly) sorted input cost close to a single linear pass.
+//
+// We sort indices rather than the values themselves, so that every value stays rooted in its original MarkedVector
+// while arbitrary code (like a user-provided comparefn) runs. is_greater_than(a, b) must return true if and only if the
+// element at index a has to be placed after the element at index b.
+template<typename IsGreaterThan>
+static ThrowCompletionOr<void> natural_merge_sort(Vector<u32>& indices, IsGreaterThan const& is_greater_than)
 {
-    // FIXME: it would probably be better to switch to insertion sort for small arrays for
-    // better performance
-    if (arr_to_sort.size() <= 1)
+    static constexpr size_t minimum_run_length = 32;
+
+    struct Run {
+        size_t start { 0 };
+        size_t length { 0 };
+    };
+
+    auto size = indices.size();
+    if (size <= 1)
         return {};
 
-    MarkedVector<Value> left(vm.heap());
-    MarkedVector<Value> right(vm.heap());
+    Vector<Run, 64> runs;
+    Vector<u32> merge_buffer;
 
-    left.ensure_capacity(arr_to_sort.size() / 2);
-    right.ensure_capacity(arr_to_sort.size() / 2 + (arr_to_sort.size() & 1));
+    auto merge_runs_at = [&](size_t run_index) -> ThrowCompletionOr<void> {
+        auto left = runs[run_index];
+        auto right = runs[run_index + 1];
 
-    for (size_t i = 0; i < arr_to_sort.size(); ++i) {
-        if (i < arr_to_sort.size() / 2) {
-            left.append(arr_to_sort[i]);
-        } else {
-            right.append(arr_to_sort[i]);
+        runs[run_index].length += right.length;
+        runs.remove(run_index + 1);
+
+        // If the last element on the left doesn't go after the first element on the right, the runs are already in order.
+        if (!TRY(is_greater_than(indices[right.start - 1], indices[right.start])))
+            return {};
+
+        merge_buffer.clear_with_capacity();
+        merge_buffer.append(indices.data() + left.start, left.length);
+
+        size_t left_index = 0;
+        size_t right_index = right.start;
+        size_t right_end = right.start + right.length;
+        size_t output_index = left.start;
+
+        while (left_index < left.length && right_index < right_end) {
+            // Taking from the left on ties is what keeps the sort stable.
+            if (TRY(is_greater_than(merge_buffer[left_index], indices[right_index])))
+                indices[output_index++] = indices[right_index++];
+            else
+                indices[output_index++] = merge_buffer[left_index++];
         }
-    }
 
-    TRY(array_merge_sort(vm, compare_func, left));
-    TRY(array_merge_sort(vm, compare_func, right));
+        while (left_index < left.length)
+            indices[output_index++] = merge_buffer[left_index++];
 
-    arr_to_sort.clear();
+        return {};
+    };
 
-    size_t left_index = 0, right_index = 0;
+    for (size_t start = 0; start < size;) {
+        // Find the run beginning at start, reversing it if it's strictly descending.
+        auto end = start + 1;
+        if (end < size) {
+            if (TRY(is_greater_than(indices[start], indices[end]))) {
+                while (end + 1 < size && TRY(is_greater_than(indices[end], indices[end + 1])))
+                    ++end;
+                indices.span().slice(start, end + 1 - start).reverse();
+            } else {
+                while (end + 1 < size && !TRY(is_greater_than(indices[end], indices[end + 1])))
+                    ++end;
+            }
+            ++end;
+        }
 
-    while (left_index < left.size() && right_index < right.size()) {
-        auto x = left[left_index];
-        auto y = right[right_index];
+        // Extend short runs with binary insertion sort.
+        auto run_end = min(size, max(end, start + minimum_run_length));
+        for (; end < run_end; ++end) {
+            auto index = indices[end];
+
+            size_t low = start;
+            size_t high = end;
+            while (low < high) {
+                auto middle = low + (high - low) / 2;
+                if (TRY(is_greater_than(indices[middle], index)))
+                    high = middle;
+                else
+                    low = middle + 1;
+            }
+
+            for (auto i = end; i > low; --i)
+                indices[i] = indices[i - 1];
+            indices[low] = index;
+        }
 
-        double comparison_result = TRY(compare_func(x, y));
+        runs.append({ start, run_end - start });
+        start = run_end;
 
-        if (comparison_result <= 0) {
-            arr_to_sort.append(x);
-            left_index++;
-        } else {
-            arr_to_sort.append(y);
-            right_index++;
+        // Merge runs until their lengths satisfy the TimSort invariants.
+        while (runs.size() > 1) {
+            auto n = runs.size() - 2;
+
+            if ((n > 0 && runs[n - 1].length <= runs[n].length + runs[n + 1].length)
+                || (n > 1 && runs[n - 2].length <= runs[n - 1].length + runs[n].length)) {
+                if (runs[n - 1].length < runs[n + 1].length)
+                    --n;
+            } else if (runs[n].length > runs[n + 1].length) {
+                break;
+            }
+
+            TRY(merge_runs_at(n));
         }
     }
 
-    while (left_index < left.size()) {
-        arr_to_sort.append(left[left_index]);
-        left_index++;
+    while (runs.size() > 1) {
+        auto n = runs.size() - 2;
+        if (n > 0 && runs[n - 1].length < runs[n + 1].length)
+            --n;
+        TRY(merge_runs_at(n));
     }
 
-    while (right_index < right.size()) {
-        arr_to_sort.append(right[right_index]);
-        right_index++;
+    return {};
+}
+
+static Vector<u32> indices_for_sorting(size_t size)
+{
+    Vector<u32> indices;
+    indices.ensure_capacity(size);
+    for (size_t i = 0; i < size; ++i)
+        indices.unchecked_append(i);
+    return indices;
+}
+
+// Rearranges values such that they start with the values at the given indices, in order. Any remaining values are
+// filled with undefined.
+static void reorder_values_by_indices(MarkedVector<Value>& values, Vector<u32> const& indices)
+{
+    // NOTE: Nothing in here allocates, so no garbage collection can happen while values are only held by this copy.
+    Vector<Value> original_values;
+    original_values.append(values.data(), values.size());
+
+    for (size_t i = 0; i < values.size(); ++i)
+        values[i] = i < indices.size() ? original_values[indices[i]] : js_undefined();
+}
+
+ThrowCompletionOr<void> array_merge_sort(VM&, Function<ThrowCompletionOr<double>(Value, Value)> const& compare_func, MarkedVector<Value>& arr_to_sort)
+{
+    auto indices = indices_for_sorting(arr_to_sort.size());
+
+    TRY(natural_merge_sort(indices, [&](u32 a, u32 b) -> ThrowCompletionOr<bool> {
+        return TRY(compare_func(arr_to_sort[a], arr_to_sort[b])) > 0;
+    }));
+
+    reorder_values_by_indices(arr_to_sort, indices);
+    return {};
+}
+
+// NOTE: This sorts the same way as array_merge_sort() does with CompareArrayElements(x, y, undefined) as the comparison
+//       function, but converts each element to a string only once instead of on every comparison.
+ThrowCompletionOr<void> array_merge_sort_by_string_values(VM& vm, MarkedVector<Value>& arr_to_sort)
+{
+    // Steps 1-3 of CompareArrayElements: Undefined values always go last, and are never converted to a string.
+    Vector<u32> indices;
+    indices.ensure_capacity(arr_to_sort.size());
+
+    for (size_t i = 0; i < arr_to_sort.size(); ++i) {
+        if (!arr_to_sort[i].is_undefined())
+            indices.unchecked_append(i);
+    }
+
+    // NOTE: CompareArrayElements is never called if fewer than two values are left to compare, so none of them may be
+    //       converted to a string either.
+    if (indices.size() < 2) {
+        reorder_values_by_indices(arr_to_sort, indices);
+        return {};
+    }
+
+    MarkedVector<Value> strings(vm.heap());
+    strings.ensure_capacity(arr_to_sort.size());
+
+    for (size_t i = 0; i < arr_to_sort.size(); ++i) {
+        auto value = arr_to_sort[i];
+
+        if (value.is_undefined()) {
+            strings.unchecked_append(js_undefined());
+            continue;
+        }
+
+        // 5. Let xString be ? ToString(x).
+        // 6. Let yString be ? ToString(y).
+        strings.unchecked_append(TRY(value.to_primitive_string(vm)));
     }
 
+    TRY(natural_merge_sort(indices, [&](u32 a, u32 b) -> ThrowCompletionOr<bool> {
+        // 9. Let ySmaller be ! IsLessThan(yString, xString, true).
+        // 10. If ySmaller is true, return 1𝔽.
+        return MUST(is_less_than(vm, strings[b], strings[a], true)) == TriState::True;
+    }));
+
+    // Undefined values are placed after all others by reorder_values_by_indices().
+    reorder_values_by_indices(arr_to_sort, indices);
     return {};
 }
 
@@ -1410,13 +1555,9 @@ JS_DEFINE_NATIVE_FUNCTION(ArrayPrototype::sort)
     auto length = TRY(length_of_array_like(vm, object));
 
     // 4. Let SortCompare be a new Abstract Closure with parameters (x, y) that captures comparefn and performs the following steps when called:
-    Function<ThrowCompletionOr<double>(Value, Value)> sort_compare = [&](auto x, auto y) -> ThrowCompletionOr<double> {
-        // a. Return ? CompareArrayElements(x, y, comparefn).
-        return TRY(compare_array_elements(vm, x, y, comparefn.is_undefined() ? nullptr : &comparefn.as_function()));
-    };
-
+    //     a. Return ? CompareArrayElements(x, y, comparefn).
     // 5. Let sortedList be ? SortIndexedProperties(obj, len, SortCompare, skip-holes).
-    auto sorted_list = TRY(sort_indexed_properties(vm, object, length, sort_compare, Holes::SkipHoles));
+    auto sorted_list = TRY(sort_indexed_properties(vm, object, length, comparefn.is_undefined() ? nullptr : &comparefn.as_function(), Holes::SkipHoles));
 
     // 6. Let itemCount be the number of elements in sortedList.
     auto item_count = sorted_list.size();
@@ -1718,13 +1859,9 @@ JS_DEFINE_NATIVE_FUNCTION(ArrayPrototype::to_sorted)
     auto array = TRY(Array::create(realm, length));
 
     // 5. Let SortCompare be a new Abstract Closure with parameters (x, y) that captures comparefn and performs the following steps when called:
-    Function<ThrowCompletionOr<double>(Value, Value)> sort_compare = [&](auto x, auto y) -> ThrowCompletionOr<double> {
-        // a. Return ? CompareArrayElements(x, y, comparefn).
-        return TRY(compare_array_elements(vm, x, y, comparefn.is_undefined() ? nullptr : &comparefn.as_function()));
-    };
-
+    //     a. Return ? CompareArrayElements(x, y, comparefn).
     // 6. Let sortedList be ? SortIndexedProperties(obj, len, SortCompare, read-through-holes).
-    auto sorted_list = TRY(sort_indexed_properties(vm, object, length, sort_compare, Holes::ReadThroughHoles));
+    auto sorted_list = TRY(sort_indexed_properties(vm, object, length, comparefn.is_undefined() ? nullptr : &comparefn.as_function(), Holes::ReadThroughHoles));
 
     // 7. Let j be 0.
     // 8. Repeat, while j < len,
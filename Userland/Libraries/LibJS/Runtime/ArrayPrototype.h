@@ -65,5 +65,6 @@ private:
 };
 
 ThrowCompletionOr<void> array_merge_sort(VM&, Function<ThrowCompletionOr<double>(Value, Value)> const& compare_func, MarkedVector<Value>& arr_to_sort);
+ThrowCompletionOr<void> array_merge_sort_by_string_values(VM&, MarkedVector<Value>& arr_to_sort);
 
 }
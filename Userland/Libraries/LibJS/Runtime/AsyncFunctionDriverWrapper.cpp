@@ -7,7 +7,6 @@
 #include <AK/TypeCasts.h>
 #include <LibJS/Runtime/AsyncFunctionDriverWrapper.h>
 #include <LibJS/Runtime/GlobalObject.h>
-#include <LibJS/Runtime/NativeFunction.h>
 #include <LibJS/Runtime/PromiseCapability.h>
 #include <LibJS/Runtime/PromiseConstructor.h>
 #include <LibJS/Runtime/VM.h>
@@ -53,63 +52,17 @@ ThrowCompletionOr<void> AsyncFunctionDriverWrapper::await(JS::Value value)
 
     // 3. Let fulfilledClosure be a new Abstract Closure with parameters (v) that captures asyncContext and performs the
     //    following steps when called:
-    auto fulfilled_closure = [this](VM& vm) -> ThrowCompletionOr<Value> {
-        auto value = vm.argument(0);
-
-        // a. Let prevContext be the running execution context.
-        auto& prev_context = vm.running_execution_context();
-
-        // FIXME: b. Suspend prevContext.
-
-        // c. Push asyncContext onto the execution context stack; asyncContext is now the running execution context.
-        TRY(vm.push_execution_context(*m_suspended_execution_context, {}));
-
-        // d. Resume the suspended evaluation of asyncContext using NormalCompletion(v) as the result of the operation that
-        //    suspended it.
-        continue_async_execution(vm, value, true);
-
-        // e. Assert: When we reach this step, asyncContext has already been removed from the execution context stack and
-        //    prevContext is the currently running execution context.
-        VERIFY(&vm.running_execution_context() == &prev_context);
-
-        // f. Return undefined.
-        return js_undefined();
-    };
-
+    //    See resume_after_await() for "the following steps".
     // 4. Let onFulfilled be CreateBuiltinFunction(fulfilledClosure, 1, "", « »).
-    auto on_fulfilled = NativeFunction::create(realm, move(fulfilled_closure), 1, "");
-
     // 5. Let rejectedClosure be a new Abstract Closure with parameters (reason) that captures asyncContext and performs the
     //    following steps when called:
-    auto rejected_closure = [this](VM& vm) -> ThrowCompletionOr<Value> {
-        auto reason = vm.argument(0);
-
-        // a. Let prevContext be the running execution context.
-        auto& prev_context = vm.running_execution_context();
-
-        // FIXME: b. Suspend prevContext.
-
-        // c. Push asyncContext onto the execution context stack; asyncContext is now the running execution context.
-        TRY(vm.push_execution_context(*m_suspended_execution_context, {}));
-
-        // d. Resume the suspended evaluation of asyncContext using ThrowCompletion(reason) as the result of the operation that
-        //    suspended it.
-        continue_async_execution(vm, reason, false);
-
-        // e. Assert: When we reach this step, asyncContext has already been removed from the execution context stack and
-        //    prevContext is the currently running execution context.
-        VERIFY(&vm.running_execution_context() == &prev_context);
-
-        // f. Return undefined.
-        return js_undefined();
-    };
-
+    //    See resume_after_await() for "the following steps".
     // 6. Let onRejected be CreateBuiltinFunction(rejectedClosure, 1, "", « »).
-    auto on_rejected = NativeFunction::create(realm, move(rejected_closure), 1, "");
-
     // 7. Perform PerformPromiseThen(promise, onFulfilled, onRejected).
+    // NOTE: onFulfilled and onRejected are never observable, so instead of allocating them (along with their job callbacks
+    //       and promise reactions) for every await, the promise resumes us directly from its reaction job.
     m_current_promise = verify_cast<Promise>(promise_object);
-    m_current_promise->perform_then(on_fulfilled, on_rejected, {});
+    m_current_promise->perform_then_for_await(*this);
 
     // 8. Remove asyncContext from the execution context stack and restore the execution context that is at the top of the
     //    execution context stack as the running execution context.
@@ -123,6 +76,32 @@ ThrowCompletionOr<void> AsyncFunctionDriverWrapper::await(JS::Value value)
     return {};
 }
 
+// 27.7.5.3 Await ( value ), https://tc39.es/ecma262/#await
+// NOTE: These are the steps of both fulfilledClosure and rejectedClosure, as run by the promise reaction job.
+ThrowCompletionOr<Value> AsyncFunctionDriverWrapper::resume_after_await(Value value, bool is_successful)
+{
+    auto& vm = this->vm();
+
+    // a. Let prevContext be the running execution context.
+    auto& prev_context = vm.running_execution_context();
+
+    // FIXME: b. Suspend prevContext.
+
+    // c. Push asyncContext onto the execution context stack; asyncContext is now the running execution context.
+    TRY(vm.push_execution_context(*m_suspended_execution_context, {}));
+
+    // d. Resume the suspended evaluation of asyncContext using NormalCompletion(v) (or ThrowCompletion(reason)) as the
+    //    result of the operation that suspended it.
+    continue_async_execution(vm, value, is_successful);
+
+    // e. Assert: When we reach this step, asyncContext has already been removed from the execution context stack and
+    //    prevContext is the currently running execution context.
+    VERIFY(&vm.running_execution_context() == &prev_context);
+
+    // f. Return undefined.
+    return js_undefined();
+}
+
 void AsyncFunctionDriverWrapper::continue_async_execution(VM& vm, Value value, bool is_successful, IsInitialExecution is_initial_execution)
 {
     auto generator_result = is_successful
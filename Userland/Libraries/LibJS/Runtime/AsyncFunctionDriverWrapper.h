@@ -30,6 +30,9 @@ public:
     void visit_edges(Cell::Visitor&) override;
 
     void continue_async_execution(VM&, Value, bool is_successful, IsInitialExecution is_initial_execution = IsInitialExecution::No);
+    ThrowCompletionOr<Value> resume_after_await(Value, bool is_successful);
+
+    Realm& suspended_realm() const { return *m_suspended_execution_context->realm; }
 
 private:
     AsyncFunctionDriverWrapper(Realm&, NonnullGCPtr<GeneratorObject>, NonnullGCPtr<Promise> top_level_promise);
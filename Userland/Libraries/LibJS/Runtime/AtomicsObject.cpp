@@ -15,7 +15,9 @@
 #include <AK/Atomic.h>
 #include <AK/ByteBuffer.h>
 #include <AK/Endian.h>
+#include <AK/Time.h>
 #include <AK/TypeCasts.h>
+#include <LibCore/System.h>
 #include <LibJS/Runtime/Agent.h>
 #include <LibJS/Runtime/AtomicsObject.h>
 #include <LibJS/Runtime/GlobalObject.h>
@@ -186,15 +188,136 @@ static ThrowCompletionOr<Value> do_wait(VM& vm, WaitMode mode, TypedArrayBase& t
         timeout = max(timeout_number.as_double(), 0.0);
 
     // 10. If mode is sync and AgentCanSuspend() is false, throw a TypeError exception.
-    if (mode == WaitMode::Sync && !agent_can_suspend())
+    if (mode == WaitMode::Sync && !agent_can_suspend(vm))
         return vm.throw_completion<TypeError>(ErrorType::AgentCannotSuspend);
 
-    // FIXME: Implement the remaining steps when we support SharedArrayBuffer.
-    (void)index;
-    (void)value;
-    (void)timeout;
+    auto& realm = *vm.current_realm();
 
-    return vm.throw_completion<InternalError>(ErrorType::NotImplemented, "SharedArrayBuffer"sv);
+    // 11. Let block be buffer.[[ArrayBufferData]].
+    auto& block = *buffer->shared_data_block();
+
+    // 12. Let offset be typedArray.[[ByteOffset]].
+    // 13. Let byteIndexInBuffer be (i × 4) + offset.
+    //     NOTE: ValidateAtomicAccess() already returned the byte index.
+    auto byte_index_in_buffer = index;
+
+    // 14. Let WL be GetWaiterList(block, byteIndexInBuffer).
+    //     NOTE: The waiter lists live in the block's shared memory, so that agents in other processes can see them as well.
+
+    // 15. If mode is sync, then
+    //     a. Let promiseCapability be blocking.
+    //     b. Let resultObject be undefined.
+    // 16. Else,
+    //     a. Let promiseCapability be ! NewPromiseCapability(%Promise%).
+    //     b. Let resultObject be OrdinaryObjectCreate(%Object.prototype%).
+    GCPtr<Object> result_object;
+    if (mode == WaitMode::Async)
+        result_object = Object::create(realm, realm.intrinsics().object_prototype());
+
+    // 17. Perform EnterCriticalSection(WL).
+    block.enter_critical_section();
+
+    // 18. Let elementType be TypedArrayElementType(typedArray).
+    // 19. Let w be GetValueFromBuffer(buffer, byteIndexInBuffer, elementType, true, SeqCst).
+    auto w = typed_array.get_value_from_buffer(byte_index_in_buffer, ArrayBuffer::Order::SeqCst);
+
+    // 20. If v ≠ w, then
+    auto w_value = w.is_bigint() ? MUST(w.to_bigint_int64(vm)) : MUST(w.to_i32(vm));
+    if (value != w_value) {
+        // a. Perform LeaveCriticalSection(WL).
+        block.leave_critical_section();
+
+        // b. If mode is sync, return "not-equal".
+        if (mode == WaitMode::Sync)
+            return PrimitiveString::create(vm, "not-equal"_string);
+
+        // c. Perform ! CreateDataPropertyOrThrow(resultObject, "async", false).
+        MUST(result_object->create_data_property_or_throw(vm.names.async, Value(false)));
+
+        // d. Perform ! CreateDataPropertyOrThrow(resultObject, "value", "not-equal").
+        MUST(result_object->create_data_property_or_throw(vm.names.value, PrimitiveString::create(vm, "not-equal"_string)));
+
+        // e. Return resultObject.
+        return result_object;
+    }
+
+    // 21. If t is 0 and mode is async, then
+    if (timeout == 0 && mode == WaitMode::Async) {
+        // a. NOTE: There is no special handling of synchronous immediate timeouts. Asynchronous immediate timeouts have special handling in order to fail fast and avoid unnecessary Promise jobs.
+
+        // b. Perform LeaveCriticalSection(WL).
+        block.leave_critical_section();
+
+        // c. Perform ! CreateDataPropertyOrThrow(resultObject, "async", false).
+        MUST(result_object->create_data_property_or_throw(vm.names.async, Value(false)));
+
+        // d. Perform ! CreateDataPropertyOrThrow(resultObject, "value", "timed-out").
+        MUST(result_object->create_data_property_or_throw(vm.names.value, PrimitiveString::create(vm, "timed-out"_string)));
+
+        // e. Return resultObject.
+        return result_object;
+    }
+
+    // FIXME: Implement the asynchronous wait, which requires resolving the promise from the event loop of this agent.
+    if (mode == WaitMode::Async) {
+        block.leave_critical_section();
+        return vm.throw_completion<InternalError>(ErrorType::NotImplemented, "Suspending Atomics.waitAsync"sv);
+    }
+
+    // 22. Let thisAgent be AgentSignifier().
+    // 23. Let now be the time value (UTC) identifying the current time.
+    // 24. Let additionalTimeout be an implementation-defined non-negative mathematical value.
+    // 25. Let timeoutTime be ℝ(now) + t + additionalTimeout.
+    // 26. NOTE: When t is +∞, timeoutTime is also +∞.
+    Optional<MonotonicTime> timeout_time;
+    if (isfinite(timeout))
+        timeout_time = MonotonicTime::now() + Duration::from_nanoseconds(static_cast<i64>(min(timeout * 1'000'000.0, static_cast<double>(NumericLimits<i64>::max()))));
+
+    // 27. Let waiterRecord be a new Waiter Record { [[AgentSignifier]]: thisAgent, [[PromiseCapability]]: promiseCapability, [[TimeoutTime]]: timeoutTime, [[Result]]: "ok" }.
+    // 28. Perform AddWaiter(WL, waiterRecord).
+    auto* waiter_record = block.add_waiter(byte_index_in_buffer);
+    if (!waiter_record) {
+        block.leave_critical_section();
+        return vm.throw_completion<InternalError>(ErrorType::OutOfMemory);
+    }
+
+    // 29. If mode is sync, then
+    //     a. Perform SuspendThisAgent(WL, waiterRecord).
+    //     NOTE: We leave the critical section while suspended, and Atomics.notify() marks the record as notified before waking us.
+    auto result = "ok"_string;
+    while (true) {
+        block.leave_critical_section();
+
+        Optional<Duration> remaining;
+        bool timed_out = false;
+        if (timeout_time.has_value()) {
+            remaining = *timeout_time - MonotonicTime::now();
+            timed_out = *remaining <= Duration::zero();
+        }
+        if (!timed_out) {
+            auto wait_result = Core::System::futex_wait(&waiter_record->state, SharedDataBlock::WaiterRecord::waiting, remaining);
+            timed_out = wait_result.is_error() && wait_result.error().code() == ETIMEDOUT;
+        }
+
+        block.enter_critical_section();
+
+        // NOTE: The wait may also have been interrupted, or ended because the record was already notified.
+        if (AK::atomic_load(&waiter_record->state) == SharedDataBlock::WaiterRecord::notified)
+            break;
+
+        if (timed_out) {
+            // RemoveWaiter(WL, waiterRecord) and set waiterRecord.[[Result]] to "timed-out", as if by the timeout job.
+            result = "timed-out"_string;
+            break;
+        }
+    }
+    block.remove_waiter(*waiter_record);
+
+    // 31. Perform LeaveCriticalSection(WL).
+    block.leave_critical_section();
+
+    // 32. If mode is sync, return waiterRecord.[[Result]].
+    return PrimitiveString::create(vm, move(result));
 }
 
 template<typename T, typename AtomicFunction>
@@ -293,7 +416,7 @@ static ThrowCompletionOr<Value> atomic_compare_exchange_impl(VM& vm, TypedArrayB
     auto* buffer = typed_array.viewed_array_buffer();
 
     // 3. Let block be buffer.[[ArrayBufferData]].
-    auto& block = buffer->buffer();
+    //    NOTE: The block is accessed after the revalidation below, as a resizable buffer may have reallocated it in the meantime.
 
     Value expected;
     Value replacement;
@@ -332,30 +455,26 @@ static ThrowCompletionOr<Value> atomic_compare_exchange_impl(VM& vm, TypedArrayB
     auto replacement_bytes = MUST(ByteBuffer::create_uninitialized(sizeof(T)));
     numeric_to_raw_bytes<T>(vm, replacement, is_little_endian, replacement_bytes);
 
-    // FIXME: Implement SharedArrayBuffer case.
     // 12. If IsSharedArrayBuffer(buffer) is true, then
     //     a. Let rawBytesRead be AtomicCompareExchangeInSharedBlock(block, byteIndexInBuffer, elementSize, expectedBytes, replacementBytes).
     // 13. Else,
-
-    // a. Let rawBytesRead be a List of length elementSize whose elements are the sequence of elementSize bytes starting with block[byteIndexInBuffer].
-    // FIXME: Propagate errors.
-    auto raw_bytes_read = MUST(block.slice(byte_index_in_buffer, sizeof(T)));
-
-    // b. If ByteListEqual(rawBytesRead, expectedBytes) is true, then
-    //    i. Store the individual bytes of replacementBytes into block, starting at block[byteIndexInBuffer].
+    //     a. Let rawBytesRead be a List of length elementSize whose elements are the sequence of elementSize bytes starting with block[byteIndexInBuffer].
+    //     b. If ByteListEqual(rawBytesRead, expectedBytes) is true, then
+    //        i. Store the individual bytes of replacementBytes into block, starting at block[byteIndexInBuffer].
+    // NOTE: Both cases are a single atomic compare-exchange, which leaves the bytes it read in expectedBytes.
     if constexpr (IsFloatingPoint<T>) {
         VERIFY_NOT_REACHED();
     } else {
         using U = Conditional<IsSame<ClampedU8, T>, u8, T>;
 
-        auto* v = reinterpret_cast<U*>(block.span().slice(byte_index_in_buffer).data());
+        auto* v = reinterpret_cast<U*>(buffer->bytes().offset_pointer(byte_index_in_buffer));
         auto* e = reinterpret_cast<U*>(expected_bytes.data());
         auto* r = reinterpret_cast<U*>(replacement_bytes.data());
         (void)AK::atomic_compare_exchange_strong(v, *e, *r);
     }
 
     // 14. Return RawBytesToNumeric(elementType, rawBytesRead, isLittleEndian).
-    return raw_bytes_to_numeric<T>(vm, raw_bytes_read, is_little_endian);
+    return raw_bytes_to_numeric<T>(vm, expected_bytes, is_little_endian);
 }
 
 // 25.4.6 Atomics.compareExchange ( typedArray, index, expectedValue, replacementValue ), https://tc39.es/ecma262/#sec-atomics.compareexchange
@@ -537,19 +656,29 @@ JS_DEFINE_NATIVE_FUNCTION(AtomicsObject::notify)
     // 4. Let buffer be typedArray.[[ViewedArrayBuffer]].
     auto* buffer = typed_array->viewed_array_buffer();
 
-    // 5. Let block be buffer.[[ArrayBufferData]].
-    auto& block = buffer->buffer();
-
     // 6. If IsSharedArrayBuffer(buffer) is false, return +0𝔽.
     if (!buffer->is_shared_array_buffer())
         return Value { 0 };
 
-    // FIXME: Implement the remaining steps when we support SharedArrayBuffer.
-    (void)byte_index_in_buffer;
-    (void)count;
-    (void)block;
+    // 5. Let block be buffer.[[ArrayBufferData]].
+    auto& block = *buffer->shared_data_block();
+
+    // 7. Let WL be GetWaiterList(block, byteIndexInBuffer).
+
+    // 8. Perform EnterCriticalSection(WL).
+    block.enter_critical_section();
+
+    // 9. Let S be RemoveWaiters(WL, c).
+    // 10. For each element W of S, do
+    //     a. Perform NotifyWaiter(WL, W).
+    auto n = block.notify_waiters(byte_index_in_buffer, count);
+
+    // 11. Perform LeaveCriticalSection(WL).
+    block.leave_critical_section();
 
-    return vm.throw_completion<InternalError>(ErrorType::NotImplemented, "SharedArrayBuffer"sv);
+    // 12. Let n be the number of elements in S.
+    // 13. Return 𝔽(n).
+    return Value { n };
 }
 
 // 25.4.16 Atomics.xor ( typedArray, index, value ), https://tc39.es/ecma262/#sec-atomics.xor
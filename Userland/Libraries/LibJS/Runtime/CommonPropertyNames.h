@@ -78,6 +78,7 @@ namespace JS {
     P(asinh)                                 \
     P(assert)                                \
     P(assign)                                \
+    P(async)                                 \
     P(at)                                    \
     P(atan)                                  \
     P(atan2)                                 \
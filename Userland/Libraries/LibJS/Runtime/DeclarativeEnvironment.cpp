@@ -78,8 +78,6 @@ ThrowCompletionOr<void> DeclarativeEnvironment::create_mutable_binding(VM&, Depr
         .initialized = false,
     });
 
-    ++m_environment_serial_number;
-
     // 3. Return unused.
     return {};
 }
@@ -100,8 +98,6 @@ ThrowCompletionOr<void> DeclarativeEnvironment::create_immutable_binding(VM&, De
         .initialized = false,
     });
 
-    ++m_environment_serial_number;
-
     // 3. Return unused.
     return {};
 }
@@ -210,12 +206,19 @@ ThrowCompletionOr<bool> DeclarativeEnvironment::delete_binding(VM&, DeprecatedFl
     // NOTE: We keep the entries in m_bindings to avoid disturbing indices.
     binding_and_index->binding() = {};
 
-    ++m_environment_serial_number;
-
     // 4. Return true.
     return true;
 }
 
+bool DeclarativeEnvironment::has_binding_since(size_t start_index, DeprecatedFlyString const& name) const
+{
+    for (size_t i = start_index; i < m_bindings.size(); ++i) {
+        if (m_bindings[i].name == name)
+            return true;
+    }
+    return false;
+}
+
 ThrowCompletionOr<void> DeclarativeEnvironment::initialize_or_set_mutable_binding(VM& vm, DeprecatedFlyString const& name, Value value)
 {
     auto binding_and_index = find_binding_and_index(name);
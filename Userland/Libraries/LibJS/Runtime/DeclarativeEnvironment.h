@@ -67,7 +67,11 @@ public:
         m_bindings.ensure_capacity(needed_capacity);
     }
 
-    [[nodiscard]] u64 environment_serial_number() const { return m_environment_serial_number; }
+    // NOTE: Bindings are only ever appended (deleted ones are kept as empty entries), so these let caches tell whether a
+    //       binding they've looked up is still where they found it, and which bindings were added since.
+    [[nodiscard]] size_t binding_count() const { return m_bindings.size(); }
+    [[nodiscard]] bool has_binding_at_index(size_t index, DeprecatedFlyString const& name) const { return index < m_bindings.size() && m_bindings[index].name == name; }
+    [[nodiscard]] bool has_binding_since(size_t start_index, DeprecatedFlyString const& name) const;
 
 private:
     ThrowCompletionOr<Value> get_binding_value_direct(VM&, Binding const&) const;
@@ -128,8 +132,6 @@ protected:
 private:
     Vector<Binding> m_bindings;
     Vector<DisposableResource> m_disposable_resource_stack;
-
-    u64 m_environment_serial_number { 0 };
 };
 
 inline ThrowCompletionOr<Value> DeclarativeEnvironment::get_binding_value_direct(VM& vm, size_t index) const
@@ -382,17 +382,12 @@ ThrowCompletionOr<Value> ECMAScriptFunctionObject::internal_call(Value this_argu
     // 1. Let callerContext be the running execution context.
     // NOTE: No-op, kept by the VM in its execution context stack.
 
-    auto callee_context = ExecutionContext::create();
+    auto callee_context = ExecutionContext::create(vm.value_stack());
 
     // Non-standard
-    callee_context->arguments.ensure_capacity(max(arguments_list.size(), m_formal_parameters.size()));
-    callee_context->arguments.append(arguments_list.data(), arguments_list.size());
+    callee_context->set_arguments(arguments_list, m_formal_parameters.size());
     callee_context->program_counter = vm.bytecode_interpreter().program_counter();
     callee_context->passed_argument_count = arguments_list.size();
-    if (arguments_list.size() < m_formal_parameters.size()) {
-        for (size_t i = arguments_list.size(); i < m_formal_parameters.size(); ++i)
-            callee_context->arguments.append(js_undefined());
-    }
 
     // 2. Let calleeContext be PrepareForOrdinaryCall(F, undefined).
     // NOTE: We throw if the end of the native stack is reached, so unlike in the spec this _does_ need an exception check.
@@ -438,6 +433,16 @@ ThrowCompletionOr<Value> ECMAScriptFunctionObject::internal_call(Value this_argu
     return js_undefined();
 }
 
+// Non-standard, feeds the storage reservation in [[Construct]] below.
+void ECMAScriptFunctionObject::record_expected_instance_property_count(FunctionObject const& new_target, Object const& instance)
+{
+    // NOTE: Only the outermost constructor sees the instance with all of its properties. Base class constructors
+    //       return before the derived class constructors had the chance to add theirs.
+    if (&new_target != this || instance.shape().is_dictionary())
+        return;
+    m_expected_instance_property_count = instance.shape().property_count();
+}
+
 // 10.2.2 [[Construct]] ( argumentsList, newTarget ), https://tc39.es/ecma262/#sec-ecmascript-function-objects-construct-argumentslist-newtarget
 ThrowCompletionOr<NonnullGCPtr<Object>> ECMAScriptFunctionObject::internal_construct(ReadonlySpan<Value> arguments_list, FunctionObject& new_target)
 {
@@ -455,19 +460,19 @@ ThrowCompletionOr<NonnullGCPtr<Object>> ECMAScriptFunctionObject::internal_const
     if (kind == ConstructorKind::Base) {
         // a. Let thisArgument be ? OrdinaryCreateFromConstructor(newTarget, "%Object.prototype%").
         this_argument = TRY(ordinary_create_from_constructor<Object>(vm, new_target, &Intrinsics::object_prototype, ConstructWithPrototypeTag::Tag));
+
+        // OPTIMIZATION: Instances of the same class usually end up with the same properties. Reserve storage for as many
+        //               as the previous instance had, so that fields and `this.foo = ...` don't grow it one by one.
+        if (is<ECMAScriptFunctionObject>(new_target))
+            this_argument->ensure_property_storage_capacity(static_cast<ECMAScriptFunctionObject const&>(new_target).m_expected_instance_property_count);
     }
 
-    auto callee_context = ExecutionContext::create();
+    auto callee_context = ExecutionContext::create(vm.value_stack());
 
     // Non-standard
-    callee_context->arguments.ensure_capacity(max(arguments_list.size(), m_formal_parameters.size()));
-    callee_context->arguments.append(arguments_list.data(), arguments_list.size());
+    callee_context->set_arguments(arguments_list, m_formal_parameters.size());
     callee_context->program_counter = vm.bytecode_interpreter().program_counter();
     callee_context->passed_argument_count = arguments_list.size();
-    if (arguments_list.size() < m_formal_parameters.size()) {
-        for (size_t i = arguments_list.size(); i < m_formal_parameters.size(); ++i)
-            callee_context->arguments.append(js_undefined());
-    }
 
     // 4. Let calleeContext be PrepareForOrdinaryCall(F, newTarget).
     // NOTE: We throw if the end of the native stack is reached, so unlike in the spec this _does_ need an exception check.
@@ -511,8 +516,10 @@ ThrowCompletionOr<NonnullGCPtr<Object>> ECMAScriptFunctionObject::internal_const
             return result.value()->as_object();
 
         // b. If kind is base, return thisArgument.
-        if (kind == ConstructorKind::Base)
+        if (kind == ConstructorKind::Base) {
+            record_expected_instance_property_count(new_target, *this_argument);
             return *this_argument;
+        }
 
         // c. If result.[[Value]] is not undefined, throw a TypeError exception.
         if (!result.value()->is_undefined())
@@ -530,6 +537,8 @@ ThrowCompletionOr<NonnullGCPtr<Object>> ECMAScriptFunctionObject::internal_const
     // 13. Assert: Type(thisBinding) is Object.
     VERIFY(this_binding.is_object());
 
+    record_expected_instance_property_count(new_target, this_binding.as_object());
+
     // 14. Return thisBinding.
     return this_binding.as_object();
 }
@@ -834,7 +843,7 @@ Completion ECMAScriptFunctionObject::ordinary_call_evaluate_body()
         m_bytecode_executable = m_ecmascript_code->bytecode_executable();
     }
 
-    vm.running_execution_context().registers_and_constants_and_locals.resize(m_local_variables_names.size() + m_bytecode_executable->number_of_registers + m_bytecode_executable->constants.size());
+    vm.running_execution_context().ensure_registers_and_constants_and_locals(m_local_variables_names.size() + m_bytecode_executable->number_of_registers + m_bytecode_executable->constants.size());
 
     auto result_and_frame = vm.bytecode_interpreter().run_executable(*m_bytecode_executable, {});
 
@@ -116,6 +116,7 @@ private:
 
     ThrowCompletionOr<void> prepare_for_ordinary_call(ExecutionContext& callee_context, Object* new_target);
     void ordinary_call_bind_this(ExecutionContext&, Value this_argument);
+    void record_expected_instance_property_count(FunctionObject const& new_target, Object const& instance);
 
     DeprecatedFlyString m_name;
     GCPtr<PrimitiveString> m_name_string;
@@ -171,6 +172,9 @@ private:
     size_t m_function_environment_bindings_count { 0 };
     size_t m_var_environment_bindings_count { 0 };
     size_t m_lex_environment_bindings_count { 0 };
+
+    // Number of named properties the most recent object constructed with this function as newTarget ended up with.
+    size_t m_expected_instance_property_count { 0 };
 };
 
 template<>
@@ -10,6 +10,7 @@
 #include <LibJS/Heap/Heap.h>
 #include <LibJS/Runtime/ExecutionContext.h>
 #include <LibJS/Runtime/FunctionObject.h>
+#include <LibJS/Runtime/ValueStack.h>
 
 namespace JS {
 
@@ -38,6 +39,15 @@ NonnullOwnPtr<ExecutionContext> ExecutionContext::create()
     return s_execution_context_allocator->allocate();
 }
 
+NonnullOwnPtr<ExecutionContext> ExecutionContext::create(ValueStack& value_stack)
+{
+    auto execution_context = s_execution_context_allocator->allocate();
+    execution_context->m_value_stack = &value_stack;
+    execution_context->m_value_stack_frame_base = value_stack.top();
+    execution_context->m_value_stack_frame_end = value_stack.top();
+    return execution_context;
+}
+
 void ExecutionContext::operator delete(void* ptr)
 {
     s_execution_context_allocator->deallocate(ptr);
@@ -49,6 +59,60 @@ ExecutionContext::ExecutionContext()
 
 ExecutionContext::~ExecutionContext()
 {
+    if (m_value_stack && m_value_stack_frame_end != m_value_stack_frame_base) {
+        VERIFY(m_value_stack->top() == m_value_stack_frame_end);
+        m_value_stack->release_to(m_value_stack_frame_base);
+    }
+}
+
+Span<Value> ExecutionContext::allocate_values(size_t count, Vector<Value>& fallback_storage)
+{
+    // Values can only be carved out of the value stack while nothing was allocated on top of this execution context.
+    if (m_value_stack && m_value_stack->top() == m_value_stack_frame_end) {
+        if (auto* values = m_value_stack->allocate(count)) {
+            m_value_stack_frame_end = values + count;
+            return { values, count };
+        }
+    }
+
+    fallback_storage.resize(count);
+    return fallback_storage.span();
+}
+
+void ExecutionContext::set_arguments(ReadonlySpan<Value> values, size_t count)
+{
+    VERIFY(arguments.is_empty());
+
+    arguments = allocate_values(max(values.size(), count), m_owned_arguments);
+    values.copy_to(arguments);
+    for (size_t i = values.size(); i < arguments.size(); ++i)
+        arguments[i] = js_undefined();
+}
+
+void ExecutionContext::ensure_registers_and_constants_and_locals(size_t count)
+{
+    if (registers_and_constants_and_locals.size() >= count)
+        return;
+
+    // If the current values are at the very top of the value stack, they can simply grow in place.
+    auto* current_end = registers_and_constants_and_locals.data() + registers_and_constants_and_locals.size();
+    if (m_value_stack && !registers_and_constants_and_locals.is_empty() && current_end == m_value_stack_frame_end && current_end == m_value_stack->top()) {
+        if (m_value_stack->allocate(count - registers_and_constants_and_locals.size())) {
+            m_value_stack_frame_end = registers_and_constants_and_locals.data() + count;
+            registers_and_constants_and_locals = { registers_and_constants_and_locals.data(), count };
+            return;
+        }
+    }
+
+    auto previous_values = registers_and_constants_and_locals;
+    if (!previous_values.is_empty() && previous_values.data() == m_owned_registers_and_constants_and_locals.data()) {
+        m_owned_registers_and_constants_and_locals.resize(count);
+        registers_and_constants_and_locals = m_owned_registers_and_constants_and_locals.span();
+        return;
+    }
+
+    registers_and_constants_and_locals = allocate_values(count, m_owned_registers_and_constants_and_locals);
+    previous_values.copy_to(registers_and_constants_and_locals);
 }
 
 NonnullOwnPtr<ExecutionContext> ExecutionContext::copy() const
@@ -65,9 +129,10 @@ NonnullOwnPtr<ExecutionContext> ExecutionContext::copy() const
     copy->this_value = this_value;
     copy->is_strict_mode = is_strict_mode;
     copy->executable = executable;
-    copy->arguments = arguments;
+    copy->set_arguments(arguments);
     copy->passed_argument_count = passed_argument_count;
-    copy->registers_and_constants_and_locals = registers_and_constants_and_locals;
+    copy->ensure_registers_and_constants_and_locals(registers_and_constants_and_locals.size());
+    registers_and_constants_and_locals.copy_to(copy->registers_and_constants_and_locals);
     copy->unwind_contexts = unwind_contexts;
     copy->saved_lexical_environments = saved_lexical_environments;
     copy->previously_scheduled_jumps = previously_scheduled_jumps;
@@ -24,6 +24,12 @@ using ScriptOrModule = Variant<Empty, NonnullGCPtr<Script>, NonnullGCPtr<Module>
 // 9.4 Execution Contexts, https://tc39.es/ecma262/#sec-execution-contexts
 struct ExecutionContext {
     static NonnullOwnPtr<ExecutionContext> create();
+
+    // Creates an execution context that carves its values out of the given value stack where possible. It must be
+    // destroyed before any execution context that was created on the same value stack before it.
+    static NonnullOwnPtr<ExecutionContext> create(ValueStack&);
+
+    // The copy always owns its values, so that it can outlive the function call it was made in.
     [[nodiscard]] NonnullOwnPtr<ExecutionContext> copy() const;
 
     ~ExecutionContext();
@@ -70,14 +76,32 @@ public:
         return registers_and_constants_and_locals[index];
     }
 
+    // Sets the arguments to the given values, followed by as many undefined values as needed to reach the given count.
+    void set_arguments(ReadonlySpan<Value> values, size_t count = 0);
+
+    // Makes room for at least the given number of registers, constants and locals. New values start out empty.
+    void ensure_registers_and_constants_and_locals(size_t count);
+
     u32 passed_argument_count { 0 };
     bool is_strict_mode { false };
 
-    Vector<Value> arguments;
-    Vector<Value> registers_and_constants_and_locals;
+    Span<Value> arguments;
+    Span<Value> registers_and_constants_and_locals;
     Vector<Bytecode::UnwindInfo> unwind_contexts;
     Vector<Optional<size_t>> previously_scheduled_jumps;
     Vector<GCPtr<Environment>> saved_lexical_environments;
+
+private:
+    Span<Value> allocate_values(size_t count, Vector<Value>& fallback_storage);
+
+    // The values of this execution context live between these two pointers on the value stack, if it has one.
+    ValueStack* m_value_stack { nullptr };
+    Value* m_value_stack_frame_base { nullptr };
+    Value* m_value_stack_frame_end { nullptr };
+
+    // Otherwise, or if the value stack ran out of room, the values are owned by the execution context itself.
+    Vector<Value> m_owned_arguments;
+    Vector<Value> m_owned_registers_and_constants_and_locals;
 };
 
 struct StackTraceElement {
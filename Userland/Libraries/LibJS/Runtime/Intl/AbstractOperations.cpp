@@ -12,9 +12,12 @@
 #include <AK/QuickSort.h>
 #include <AK/TypeCasts.h>
 #include <LibJS/Runtime/Array.h>
+#include <LibJS/Runtime/Date.h>
 #include <LibJS/Runtime/GlobalObject.h>
 #include <LibJS/Runtime/Intl/AbstractOperations.h>
 #include <LibJS/Runtime/Intl/Locale.h>
+#include <LibJS/Runtime/Intrinsics.h>
+#include <LibJS/Runtime/Realm.h>
 #include <LibJS/Runtime/ValueInlines.h>
 #include <LibLocale/Locale.h>
 
@@ -728,4 +731,42 @@ Vector<PatternPartition> partition_pattern(StringView pattern)
     return result;
 }
 
+Optional<String> formatter_cache_key(StringView formatter_type, Value locales, Value options)
+{
+    // Formatter constructors read each option through Get(), which is observable for any user-provided options object.
+    // Undefined options are coerced to an empty null-prototype object though, which is safe to skip.
+    if (!options.is_undefined())
+        return {};
+
+    // Likewise, only undefined locales and locales given as a single string are converted without side effects.
+    StringView locale;
+    if (locales.is_string())
+        locale = locales.as_string().utf8_string_view();
+    else if (!locales.is_undefined())
+        return {};
+
+    // NOTE: DateTimeFormat resolves the system time zone when it is constructed, which may change between calls.
+    return MUST(String::formatted("{}:{}:{}", formatter_type, locale, system_time_zone_identifier()));
+}
+
+GCPtr<Object> find_cached_formatter(VM& vm, String const& cache_key)
+{
+    auto& cache = vm.current_realm()->intrinsics().intl_formatter_cache();
+    if (auto formatter = cache.get(cache_key); formatter.has_value())
+        return *formatter;
+    return nullptr;
+}
+
+void cache_formatter(VM& vm, String cache_key, Object& formatter)
+{
+    // Locales are chosen by script, so keep the cache from growing without bound.
+    static constexpr size_t max_cached_formatters = 64;
+
+    auto& cache = vm.current_realm()->intrinsics().intl_formatter_cache();
+    if (cache.size() >= max_cached_formatters)
+        cache.clear();
+
+    cache.set(move(cache_key), formatter);
+}
+
 }
@@ -96,6 +96,27 @@ ThrowCompletionOr<Optional<int>> default_number_option(VM&, Value value, int min
 ThrowCompletionOr<Optional<int>> get_number_option(VM&, Object const& options, PropertyKey const& property, int minimum, int maximum, Optional<int> fallback);
 Vector<PatternPartition> partition_pattern(StringView pattern);
 
+Optional<String> formatter_cache_key(StringView formatter_type, Value locales, Value options);
+GCPtr<Object> find_cached_formatter(VM&, String const& cache_key);
+void cache_formatter(VM&, String cache_key, Object& formatter);
+
+// Locale-sensitive methods of other built-ins (e.g. Number.prototype.toLocaleString) construct a new formatter on every
+// call. Where doing so is unobservable, the formatter is instead created once per realm and reused.
+template<typename FormatterType, typename Callback>
+ThrowCompletionOr<NonnullGCPtr<FormatterType>> cached_formatter(VM& vm, StringView formatter_type, Value locales, Value options, Callback&& create_formatter)
+{
+    auto cache_key = formatter_cache_key(formatter_type, locales, options);
+    if (!cache_key.has_value())
+        return create_formatter();
+
+    if (auto formatter = find_cached_formatter(vm, *cache_key))
+        return static_cast<FormatterType&>(*formatter);
+
+    NonnullGCPtr<FormatterType> formatter = TRY(create_formatter());
+    cache_formatter(vm, cache_key.release_value(), formatter);
+    return formatter;
+}
+
 template<size_t Size>
 ThrowCompletionOr<StringOrBoolean> get_boolean_or_string_number_format_option(VM& vm, Object const& options, PropertyKey const& property, StringView const (&string_values)[Size], StringOrBoolean fallback)
 {
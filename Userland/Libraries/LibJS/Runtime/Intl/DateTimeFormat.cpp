@@ -39,6 +39,24 @@ void DateTimeFormat::visit_edges(Cell::Visitor& visitor)
     Base::visit_edges(visitor);
     if (m_bound_format)
         visitor.visit(m_bound_format);
+    visitor.visit(m_number_format);
+    visitor.visit(m_two_digit_number_format);
+    visitor.visit(m_fractional_second_number_format);
+}
+
+Vector<PatternPartition> const& DateTimeFormat::pattern_parts()
+{
+    // NOTE: [[Pattern]] does not change once the DateTimeFormat has been created, so it only needs to be partitioned once.
+    if (!m_pattern_parts.has_value())
+        m_pattern_parts = partition_pattern(pattern());
+    return *m_pattern_parts;
+}
+
+void DateTimeFormat::set_number_formats(NumberFormat& number_format, NumberFormat& two_digit_number_format, NumberFormat* fractional_second_number_format)
+{
+    m_number_format = number_format;
+    m_two_digit_number_format = two_digit_number_format;
+    m_fractional_second_number_format = fractional_second_number_format;
 }
 
 DateTimeFormat::Style DateTimeFormat::style_from_string(StringView style)
@@ -452,7 +470,7 @@ static Optional<StringView> resolve_day_period(StringView locale, StringView cal
 }
 
 // 11.5.5 FormatDateTimePattern ( dateTimeFormat, patternParts, x, rangeFormatOptions ), https://tc39.es/ecma402/#sec-formatdatetimepattern
-ThrowCompletionOr<Vector<PatternPartition>> format_date_time_pattern(VM& vm, DateTimeFormat& date_time_format, Vector<PatternPartition> pattern_parts, double time, ::Locale::CalendarPattern const* range_format_options)
+ThrowCompletionOr<Vector<PatternPartition>> format_date_time_pattern(VM& vm, DateTimeFormat& date_time_format, ReadonlySpan<PatternPartition> pattern_parts, double time, ::Locale::CalendarPattern const* range_format_options)
 {
     auto& realm = *vm.current_realm();
 
@@ -467,53 +485,63 @@ ThrowCompletionOr<Vector<PatternPartition>> format_date_time_pattern(VM& vm, Dat
     auto const& locale = date_time_format.locale();
     auto const& data_locale = date_time_format.data_locale();
 
-    auto construct_number_format = [&](auto& options) -> ThrowCompletionOr<NumberFormat*> {
-        auto number_format = TRY(construct(vm, realm.intrinsics().intl_number_format_constructor(), PrimitiveString::create(vm, locale), options));
-        return static_cast<NumberFormat*>(number_format.ptr());
-    };
+    // NOTE: The NumberFormats constructed in steps 4 through 12 only depend on the locale and fractional second digits
+    //       of the DateTimeFormat, and constructing them is unobservable. So they are only created the first time this
+    //       DateTimeFormat formats a date, and then reused.
+    auto* number_format = date_time_format.number_format();
+    auto* number_format2 = date_time_format.two_digit_number_format();
+    auto* number_format3 = date_time_format.fractional_second_number_format();
+
+    if (!number_format) {
+        auto construct_number_format = [&](auto& options) -> ThrowCompletionOr<NumberFormat*> {
+            auto number_format = TRY(construct(vm, realm.intrinsics().intl_number_format_constructor(), PrimitiveString::create(vm, locale), options));
+            return static_cast<NumberFormat*>(number_format.ptr());
+        };
 
-    // 4. Let nfOptions be OrdinaryObjectCreate(null).
-    auto number_format_options = Object::create(realm, nullptr);
+        // 4. Let nfOptions be OrdinaryObjectCreate(null).
+        auto number_format_options = Object::create(realm, nullptr);
 
-    // 5. Perform ! CreateDataPropertyOrThrow(nfOptions, "useGrouping", false).
-    MUST(number_format_options->create_data_property_or_throw(vm.names.useGrouping, Value(false)));
+        // 5. Perform ! CreateDataPropertyOrThrow(nfOptions, "useGrouping", false).
+        MUST(number_format_options->create_data_property_or_throw(vm.names.useGrouping, Value(false)));
 
-    // 6. Let nf be ? Construct(%NumberFormat%, « locale, nfOptions »).
-    auto* number_format = TRY(construct_number_format(number_format_options));
+        // 6. Let nf be ? Construct(%NumberFormat%, « locale, nfOptions »).
+        number_format = TRY(construct_number_format(number_format_options));
 
-    // 7. Let nf2Options be OrdinaryObjectCreate(null).
-    auto number_format_options2 = Object::create(realm, nullptr);
+        // 7. Let nf2Options be OrdinaryObjectCreate(null).
+        auto number_format_options2 = Object::create(realm, nullptr);
 
-    // 8. Perform ! CreateDataPropertyOrThrow(nf2Options, "minimumIntegerDigits", 2).
-    MUST(number_format_options2->create_data_property_or_throw(vm.names.minimumIntegerDigits, Value(2)));
+        // 8. Perform ! CreateDataPropertyOrThrow(nf2Options, "minimumIntegerDigits", 2).
+        MUST(number_format_options2->create_data_property_or_throw(vm.names.minimumIntegerDigits, Value(2)));
 
-    // 9. Perform ! CreateDataPropertyOrThrow(nf2Options, "useGrouping", false).
-    MUST(number_format_options2->create_data_property_or_throw(vm.names.useGrouping, Value(false)));
+        // 9. Perform ! CreateDataPropertyOrThrow(nf2Options, "useGrouping", false).
+        MUST(number_format_options2->create_data_property_or_throw(vm.names.useGrouping, Value(false)));
 
-    // 10. Let nf2 be ? Construct(%NumberFormat%, « locale, nf2Options »).
-    auto* number_format2 = TRY(construct_number_format(number_format_options2));
+        // 10. Let nf2 be ? Construct(%NumberFormat%, « locale, nf2Options »).
+        number_format2 = TRY(construct_number_format(number_format_options2));
 
-    // 11. Let fractionalSecondDigits be dateTimeFormat.[[FractionalSecondDigits]].
-    Optional<u8> fractional_second_digits;
-    NumberFormat* number_format3 = nullptr;
-
-    // 12. If fractionalSecondDigits is not undefined, then
-    if (date_time_format.has_fractional_second_digits()) {
-        fractional_second_digits = date_time_format.fractional_second_digits();
+        // 12. If fractionalSecondDigits is not undefined, then
+        if (date_time_format.has_fractional_second_digits()) {
+            // a. Let nf3Options be OrdinaryObjectCreate(null).
+            auto number_format_options3 = Object::create(realm, nullptr);
 
-        // a. Let nf3Options be OrdinaryObjectCreate(null).
-        auto number_format_options3 = Object::create(realm, nullptr);
+            // b. Perform ! CreateDataPropertyOrThrow(nf3Options, "minimumIntegerDigits", fractionalSecondDigits).
+            MUST(number_format_options3->create_data_property_or_throw(vm.names.minimumIntegerDigits, Value(date_time_format.fractional_second_digits())));
 
-        // b. Perform ! CreateDataPropertyOrThrow(nf3Options, "minimumIntegerDigits", fractionalSecondDigits).
-        MUST(number_format_options3->create_data_property_or_throw(vm.names.minimumIntegerDigits, Value(*fractional_second_digits)));
+            // c. Perform ! CreateDataPropertyOrThrow(nf3Options, "useGrouping", false).
+            MUST(number_format_options3->create_data_property_or_throw(vm.names.useGrouping, Value(false)));
 
-        // c. Perform ! CreateDataPropertyOrThrow(nf3Options, "useGrouping", false).
-        MUST(number_format_options3->create_data_property_or_throw(vm.names.useGrouping, Value(false)));
+            // d. Let nf3 be ? Construct(%NumberFormat%, « locale, nf3Options »).
+            number_format3 = TRY(construct_number_format(number_format_options3));
+        }
 
-        // d. Let nf3 be ? Construct(%NumberFormat%, « locale, nf3Options »).
-        number_format3 = TRY(construct_number_format(number_format_options3));
+        date_time_format.set_number_formats(*number_format, *number_format2, number_format3);
     }
 
+    // 11. Let fractionalSecondDigits be dateTimeFormat.[[FractionalSecondDigits]].
+    Optional<u8> fractional_second_digits;
+    if (date_time_format.has_fractional_second_digits())
+        fractional_second_digits = date_time_format.fractional_second_digits();
+
     // 13. Let tm be ToLocalTime(ℤ(ℝ(x) × 10^6), dateTimeFormat.[[Calendar]], dateTimeFormat.[[TimeZone]]).
     auto time_bigint = Crypto::SignedBigInteger { time }.multiplied_by(s_one_million_bigint);
     auto local_time = TRY(to_local_time(vm, time_bigint, date_time_format.calendar(), date_time_format.time_zone()));
@@ -522,14 +550,14 @@ ThrowCompletionOr<Vector<PatternPartition>> format_date_time_pattern(VM& vm, Dat
     Vector<PatternPartition> result;
 
     // 15. For each Record { [[Type]], [[Value]] } patternPart in patternParts, do
-    for (auto& pattern_part : pattern_parts) {
+    for (auto const& pattern_part : pattern_parts) {
         // a. Let p be patternPart.[[Type]].
         auto part = pattern_part.type;
 
         // b. If p is "literal", then
         if (part == "literal"sv) {
             // i. Append a new Record { [[Type]]: "literal", [[Value]]: patternPart.[[Value]] } as the last element of the list result.
-            result.append({ "literal"sv, move(pattern_part.value) });
+            result.append({ "literal"sv, pattern_part.value });
         }
 
         // c. Else if p is equal to "fractionalSecondDigits", then
@@ -744,10 +772,10 @@ ThrowCompletionOr<Vector<PatternPartition>> format_date_time_pattern(VM& vm, Dat
 ThrowCompletionOr<Vector<PatternPartition>> partition_date_time_pattern(VM& vm, DateTimeFormat& date_time_format, double time)
 {
     // 1. Let patternParts be PartitionPattern(dateTimeFormat.[[Pattern]]).
-    auto pattern_parts = partition_pattern(date_time_format.pattern());
+    auto const& pattern_parts = date_time_format.pattern_parts();
 
     // 2. Let result be ? FormatDateTimePattern(dateTimeFormat, patternParts, x, undefined).
-    auto result = TRY(format_date_time_pattern(vm, date_time_format, move(pattern_parts), time, nullptr));
+    auto result = TRY(format_date_time_pattern(vm, date_time_format, pattern_parts, time, nullptr));
 
     // 3. Return result.
     return result;
@@ -994,7 +1022,7 @@ ThrowCompletionOr<Vector<PatternPartitionWithSource>> partition_date_time_range_
         auto pattern_parts = partition_pattern(pattern);
 
         // c. Let result be ? FormatDateTimePattern(dateTimeFormat, patternParts, x, undefined).
-        auto raw_result = TRY(format_date_time_pattern(vm, date_time_format, move(pattern_parts), start, nullptr));
+        auto raw_result = TRY(format_date_time_pattern(vm, date_time_format, pattern_parts, start, nullptr));
         auto result = PatternPartitionWithSource::create_from_parent_list(move(raw_result));
 
         // d. For each Record { [[Type]], [[Value]] } r in result, do
@@ -1051,7 +1079,7 @@ ThrowCompletionOr<Vector<PatternPartitionWithSource>> partition_date_time_range_
         auto pattern_parts = partition_pattern(pattern);
 
         // f. Let partResult be ? FormatDateTimePattern(dateTimeFormat, patternParts, z, rangePattern).
-        auto raw_part_result = TRY(format_date_time_pattern(vm, date_time_format, move(pattern_parts), time, &range_pattern.value()));
+        auto raw_part_result = TRY(format_date_time_pattern(vm, date_time_format, pattern_parts, time, &range_pattern.value()));
         auto part_result = PatternPartitionWithSource::create_from_parent_list(move(raw_part_result));
 
         // g. For each Record { [[Type]], [[Value]] } r in partResult, do
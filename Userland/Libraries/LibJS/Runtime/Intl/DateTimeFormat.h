@@ -127,6 +127,13 @@ public:
     NativeFunction* bound_format() const { return m_bound_format; }
     void set_bound_format(NativeFunction* bound_format) { m_bound_format = bound_format; }
 
+    Vector<PatternPartition> const& pattern_parts();
+
+    NumberFormat* number_format() const { return m_number_format; }
+    NumberFormat* two_digit_number_format() const { return m_two_digit_number_format; }
+    NumberFormat* fractional_second_number_format() const { return m_fractional_second_number_format; }
+    void set_number_formats(NumberFormat& number_format, NumberFormat& two_digit_number_format, NumberFormat* fractional_second_number_format);
+
 private:
     DateTimeFormat(Object& prototype);
 
@@ -146,6 +153,12 @@ private:
     GCPtr<NativeFunction> m_bound_format;                    // [[BoundFormat]]
 
     String m_data_locale;
+
+    // Cached state used by FormatDateTimePattern, created the first time a date is formatted.
+    Optional<Vector<PatternPartition>> m_pattern_parts;
+    GCPtr<NumberFormat> m_number_format;
+    GCPtr<NumberFormat> m_two_digit_number_format;
+    GCPtr<NumberFormat> m_fractional_second_number_format;
 };
 
 // Table 8: Record returned by ToLocalTime, https://tc39.es/ecma402/#table-datetimeformat-tolocaltime-record
@@ -172,7 +185,7 @@ struct LocalTime {
 Optional<::Locale::CalendarPattern> date_time_style_format(StringView data_locale, DateTimeFormat& date_time_format);
 Optional<::Locale::CalendarPattern> basic_format_matcher(::Locale::CalendarPattern const& options, Vector<::Locale::CalendarPattern> formats);
 Optional<::Locale::CalendarPattern> best_fit_format_matcher(::Locale::CalendarPattern const& options, Vector<::Locale::CalendarPattern> formats);
-ThrowCompletionOr<Vector<PatternPartition>> format_date_time_pattern(VM&, DateTimeFormat&, Vector<PatternPartition> pattern_parts, double time, ::Locale::CalendarPattern const* range_format_options);
+ThrowCompletionOr<Vector<PatternPartition>> format_date_time_pattern(VM&, DateTimeFormat&, ReadonlySpan<PatternPartition> pattern_parts, double time, ::Locale::CalendarPattern const* range_format_options);
 ThrowCompletionOr<Vector<PatternPartition>> partition_date_time_pattern(VM&, DateTimeFormat&, double time);
 ThrowCompletionOr<String> format_date_time(VM&, DateTimeFormat&, double time);
 ThrowCompletionOr<NonnullGCPtr<Array>> format_date_time_to_parts(VM&, DateTimeFormat&, double time);
@@ -108,22 +108,22 @@ static Optional<size_t> find_previous_boundary_index(Utf16View const& string, si
     VERIFY_NOT_REACHED();
 }
 
-static Optional<size_t> find_next_boundary_index(Utf16View const& string, size_t index, Segmenter::SegmenterGranularity granularity)
+static Optional<size_t> find_next_boundary_index(Utf16View const& string, size_t index, size_t known_boundary, Segmenter::SegmenterGranularity granularity)
 {
     switch (granularity) {
     case Segmenter::SegmenterGranularity::Grapheme:
-        return Unicode::next_grapheme_segmentation_boundary(string, index);
+        return Unicode::next_grapheme_segmentation_boundary(string, index, known_boundary);
     case Segmenter::SegmenterGranularity::Word:
-        return Unicode::next_word_segmentation_boundary(string, index);
+        return Unicode::next_word_segmentation_boundary(string, index, known_boundary);
     case Segmenter::SegmenterGranularity::Sentence:
-        return Unicode::next_sentence_segmentation_boundary(string, index);
+        return Unicode::next_sentence_segmentation_boundary(string, index, known_boundary);
     }
 
     VERIFY_NOT_REACHED();
 }
 
 // 18.8.1 FindBoundary ( segmenter, string, startIndex, direction ), https://tc39.es/ecma402/#sec-findboundary
-double find_boundary(Segmenter const& segmenter, Utf16View const& string, double start_index, Direction direction)
+double find_boundary(Segmenter const& segmenter, Utf16View const& string, double start_index, Direction direction, size_t known_boundary)
 {
     // 1. Let locale be segmenter.[[Locale]].
     // FIXME: Support locale-sensitive boundaries
@@ -160,7 +160,7 @@ double find_boundary(Segmenter const& segmenter, Utf16View const& string, double
         return INFINITY;
 
     // 7. Search string for the first segmentation boundary that follows the code unit at index startIndex, using locale locale and text element granularity granularity.
-    auto boundary_index = find_next_boundary_index(string, static_cast<size_t>(start_index), granularity);
+    auto boundary_index = find_next_boundary_index(string, static_cast<size_t>(start_index), known_boundary, granularity);
 
     // 8. If a boundary is found, return the count of code units in string preceding it.
     if (boundary_index.has_value())
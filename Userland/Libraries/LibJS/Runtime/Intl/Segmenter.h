@@ -45,6 +45,9 @@ enum class Direction {
     Before,
     After,
 };
-double find_boundary(Segmenter const&, Utf16View const&, double start_index, Direction);
+
+// NOTE: known_boundary is a segmentation boundary at or before start_index that the caller has already found. It allows
+//       searching forward from that boundary instead of from the beginning of the string.
+double find_boundary(Segmenter const&, Utf16View const&, double start_index, Direction, size_t known_boundary = 0);
 
 }
@@ -57,7 +57,7 @@ JS_DEFINE_NATIVE_FUNCTION(SegmentsPrototype::containing)
     auto start_index = find_boundary(segmenter, string, n, Direction::Before);
 
     // 9. Let endIndex be ! FindBoundary(segmenter, string, n, after).
-    auto end_index = find_boundary(segmenter, string, n, Direction::After);
+    auto end_index = find_boundary(segmenter, string, n, Direction::After, static_cast<size_t>(start_index));
 
     // 10. Return ! CreateSegmentDataObject(segmenter, string, startIndex, endIndex).
     return TRY(create_segment_data_object(vm, segmenter, string, start_index, end_index));
@@ -202,29 +202,14 @@ ThrowCompletionOr<void> Intrinsics::initialize_intrinsics(Realm& realm)
     m_function_prototype->initialize(realm);
     m_object_prototype->initialize(realm);
 
-#define __JS_ENUMERATE(ClassName, snake_name) \
-    VERIFY(!m_##snake_name##_prototype);      \
-    m_##snake_name##_prototype = heap().allocate<ClassName##Prototype>(realm, realm);
-    JS_ENUMERATE_ITERATOR_PROTOTYPES
-#undef __JS_ENUMERATE
-
-    // These must be initialized separately as they have no companion constructor
-    m_async_from_sync_iterator_prototype = heap().allocate<AsyncFromSyncIteratorPrototype>(realm, realm);
+    // NOTE: Most other intrinsics are only created once they're first accessed, as many realms (e.g. those of
+    //       iframes) never use most of them. These ones are linked to each other in ways that require them to
+    //       be created up front.
     m_async_generator_prototype = heap().allocate<AsyncGeneratorPrototype>(realm, realm);
     m_generator_prototype = heap().allocate<GeneratorPrototype>(realm, realm);
-    m_intl_segments_prototype = heap().allocate<Intl::SegmentsPrototype>(realm, realm);
-    m_wrap_for_valid_iterator_prototype = heap().allocate<WrapForValidIteratorPrototype>(realm, realm);
-
-    // These must be initialized before allocating...
-    // - AggregateErrorPrototype, which uses ErrorPrototype as its prototype
-    // - AggregateErrorConstructor, which uses ErrorConstructor as its prototype
-    // - AsyncFunctionConstructor, which uses FunctionConstructor as its prototype
-    m_error_prototype = heap().allocate<ErrorPrototype>(realm, realm);
-    m_error_constructor = heap().allocate<ErrorConstructor>(realm, realm);
-    m_function_constructor = heap().allocate<FunctionConstructor>(realm, realm);
 
-    // Not included in JS_ENUMERATE_NATIVE_OBJECTS due to missing distinct prototype
-    m_proxy_constructor = heap().allocate<ProxyConstructor>(realm, realm);
+    // FunctionPrototype is created above, so FunctionConstructor can't be created by its generated initializer.
+    m_function_constructor = heap().allocate<FunctionConstructor>(realm, realm);
 
     // Global object functions
     m_eval_function = NativeFunction::create(realm, GlobalObject::eval, 1, vm.names.eval, &realm);
@@ -251,10 +236,8 @@ ThrowCompletionOr<void> Intrinsics::initialize_intrinsics(Realm& realm)
     m_throw_type_error_function->define_direct_property(vm.names.name, PrimitiveString::create(vm, String {}), 0);
     MUST(m_throw_type_error_function->internal_prevent_extensions());
 
-    initialize_constructor(vm, vm.names.Error, *m_error_constructor, m_error_prototype);
     initialize_constructor(vm, vm.names.Function, *m_function_constructor, m_function_prototype);
     initialize_constructor(vm, vm.names.Object, *m_object_constructor, m_object_prototype);
-    initialize_constructor(vm, vm.names.Proxy, *m_proxy_constructor, nullptr);
 
     initialize_constructor(vm, vm.names.GeneratorFunction, *generator_function_constructor(), generator_function_prototype(), Attribute::Configurable);
     initialize_constructor(vm, vm.names.AsyncGeneratorFunction, *async_generator_function_constructor(), async_generator_function_prototype(), Attribute::Configurable);
@@ -266,10 +249,6 @@ ThrowCompletionOr<void> Intrinsics::initialize_intrinsics(Realm& realm)
     // 27.6.1.1 AsyncGenerator.prototype.constructor, https://tc39.es/ecma262/#sec-asyncgenerator-prototype-constructor
     m_async_generator_prototype->define_direct_property(vm.names.constructor, m_async_generator_function_prototype, Attribute::Configurable);
 
-    m_array_prototype_values_function = &array_prototype()->get_without_side_effects(vm.names.values).as_function();
-    m_date_constructor_now_function = &date_constructor()->get_without_side_effects(vm.names.now).as_function();
-    m_json_parse_function = &json_object()->get_without_side_effects(vm.names.parse).as_function();
-    m_json_stringify_function = &json_object()->get_without_side_effects(vm.names.stringify).as_function();
     m_object_prototype_to_string_function = &object_prototype()->get_without_side_effects(vm.names.toString).as_function();
 
     return {};
@@ -316,6 +295,11 @@ JS_ENUMERATE_TYPED_ARRAYS
             initialize_constructor(vm, vm.names.Symbol, *m_##snake_namespace##snake_name##_constructor, m_##snake_namespace##snake_name##_prototype);    \
         else                                                                                                                                             \
             initialize_constructor(vm, vm.names.ClassName, *m_##snake_namespace##snake_name##_constructor, m_##snake_namespace##snake_name##_prototype); \
+                                                                                                                                                         \
+        if constexpr (IsSame<Namespace::ConstructorName, ArrayConstructor>)                                                                              \
+            m_array_prototype_values_function = &m_array_prototype->get_without_side_effects(vm.names.values).as_function();                             \
+        else if constexpr (IsSame<Namespace::ConstructorName, DateConstructor>)                                                                          \
+            m_date_constructor_now_function = &m_date_constructor->get_without_side_effects(vm.names.now).as_function();                                 \
     }                                                                                                                                                    \
                                                                                                                                                          \
     NonnullGCPtr<Namespace::ConstructorName> Intrinsics::snake_namespace##snake_name##_constructor()                                                     \
@@ -349,16 +333,86 @@ JS_ENUMERATE_TEMPORAL_OBJECTS
 
 #undef __JS_ENUMERATE_INNER
 
-#define __JS_ENUMERATE(ClassName, snake_name)                                       \
-    NonnullGCPtr<ClassName> Intrinsics::snake_name##_object()                       \
-    {                                                                               \
-        if (!m_##snake_name##_object)                                               \
-            m_##snake_name##_object = heap().allocate<ClassName>(m_realm, m_realm); \
-        return *m_##snake_name##_object;                                            \
+#define __JS_ENUMERATE(ClassName, snake_name)                                                                         \
+    NonnullGCPtr<ClassName> Intrinsics::snake_name##_object()                                                         \
+    {                                                                                                                 \
+        if (!m_##snake_name##_object) {                                                                               \
+            m_##snake_name##_object = heap().allocate<ClassName>(m_realm, m_realm);                                   \
+                                                                                                                      \
+            if constexpr (IsSame<ClassName, JSONObject>) {                                                            \
+                m_json_parse_function = &m_json_object->get_without_side_effects(vm().names.parse).as_function();     \
+                m_json_stringify_function = &m_json_object->get_without_side_effects(vm().names.stringify).as_function(); \
+            }                                                                                                         \
+        }                                                                                                             \
+        return *m_##snake_name##_object;                                                                              \
     }
 JS_ENUMERATE_BUILTIN_NAMESPACE_OBJECTS
 #undef __JS_ENUMERATE
 
+#define __JS_ENUMERATE(ClassName, snake_name)                                                   \
+    NonnullGCPtr<Object> Intrinsics::snake_name##_prototype()                                   \
+    {                                                                                           \
+        if (!m_##snake_name##_prototype)                                                        \
+            m_##snake_name##_prototype = heap().allocate<ClassName##Prototype>(m_realm, m_realm); \
+        return *m_##snake_name##_prototype;                                                     \
+    }
+JS_ENUMERATE_ITERATOR_PROTOTYPES
+#undef __JS_ENUMERATE
+
+NonnullGCPtr<ProxyConstructor> Intrinsics::proxy_constructor()
+{
+    if (!m_proxy_constructor) {
+        m_proxy_constructor = heap().allocate<ProxyConstructor>(m_realm, m_realm);
+        initialize_constructor(vm(), vm().names.Proxy, *m_proxy_constructor, nullptr);
+    }
+    return *m_proxy_constructor;
+}
+
+NonnullGCPtr<Object> Intrinsics::async_from_sync_iterator_prototype()
+{
+    if (!m_async_from_sync_iterator_prototype)
+        m_async_from_sync_iterator_prototype = heap().allocate<AsyncFromSyncIteratorPrototype>(m_realm, m_realm);
+    return *m_async_from_sync_iterator_prototype;
+}
+
+NonnullGCPtr<Object> Intrinsics::wrap_for_valid_iterator_prototype()
+{
+    if (!m_wrap_for_valid_iterator_prototype)
+        m_wrap_for_valid_iterator_prototype = heap().allocate<WrapForValidIteratorPrototype>(m_realm, m_realm);
+    return *m_wrap_for_valid_iterator_prototype;
+}
+
+NonnullGCPtr<Object> Intrinsics::intl_segments_prototype()
+{
+    if (!m_intl_segments_prototype)
+        m_intl_segments_prototype = heap().allocate<Intl::SegmentsPrototype>(m_realm, m_realm);
+    return *m_intl_segments_prototype;
+}
+
+NonnullGCPtr<FunctionObject> Intrinsics::array_prototype_values_function()
+{
+    (void)array_prototype();
+    return *m_array_prototype_values_function;
+}
+
+NonnullGCPtr<FunctionObject> Intrinsics::date_constructor_now_function()
+{
+    (void)date_constructor();
+    return *m_date_constructor_now_function;
+}
+
+NonnullGCPtr<FunctionObject> Intrinsics::json_parse_function()
+{
+    (void)json_object();
+    return *m_json_parse_function;
+}
+
+NonnullGCPtr<FunctionObject> Intrinsics::json_stringify_function()
+{
+    (void)json_object();
+    return *m_json_stringify_function;
+}
+
 void Intrinsics::visit_edges(Visitor& visitor)
 {
     Base::visit_edges(visitor);
@@ -391,6 +445,9 @@ void Intrinsics::visit_edges(Visitor& visitor)
     visitor.visit(m_object_prototype_to_string_function);
     visitor.visit(m_throw_type_error_function);
 
+    for (auto& it : m_intl_formatter_cache)
+        visitor.visit(it.value);
+
 #define __JS_ENUMERATE(ClassName, snake_name, PrototypeName, ConstructorName, ArrayType) \
     visitor.visit(m_##snake_name##_constructor);                                         \
     visitor.visit(m_##snake_name##_prototype);
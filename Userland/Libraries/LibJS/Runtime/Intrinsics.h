@@ -6,6 +6,8 @@
 
 #pragma once
 
+#include <AK/HashMap.h>
+#include <AK/String.h>
 #include <LibJS/Forward.h>
 #include <LibJS/Heap/Cell.h>
 
@@ -27,13 +29,13 @@ public:
     [[nodiscard]] u32 iterator_result_object_done_offset() { return m_iterator_result_object_done_offset; }
 
     // Not included in JS_ENUMERATE_NATIVE_OBJECTS due to missing distinct prototype
-    NonnullGCPtr<ProxyConstructor> proxy_constructor() { return *m_proxy_constructor; }
+    NonnullGCPtr<ProxyConstructor> proxy_constructor();
 
     // Not included in JS_ENUMERATE_NATIVE_OBJECTS due to missing distinct constructor
-    NonnullGCPtr<Object> async_from_sync_iterator_prototype() { return *m_async_from_sync_iterator_prototype; }
+    NonnullGCPtr<Object> async_from_sync_iterator_prototype();
     NonnullGCPtr<Object> async_generator_prototype() { return *m_async_generator_prototype; }
     NonnullGCPtr<Object> generator_prototype() { return *m_generator_prototype; }
-    NonnullGCPtr<Object> wrap_for_valid_iterator_prototype() { return *m_wrap_for_valid_iterator_prototype; }
+    NonnullGCPtr<Object> wrap_for_valid_iterator_prototype();
 
     // Alias for the AsyncGenerator Prototype Object used by the spec (%AsyncGeneratorFunction.prototype.prototype%)
     NonnullGCPtr<Object> async_generator_function_prototype_prototype() { return *m_async_generator_prototype; }
@@ -41,7 +43,7 @@ public:
     NonnullGCPtr<Object> generator_function_prototype_prototype() { return *m_generator_prototype; }
 
     // Not included in JS_ENUMERATE_INTL_OBJECTS due to missing distinct constructor
-    NonnullGCPtr<Object> intl_segments_prototype() { return *m_intl_segments_prototype; }
+    NonnullGCPtr<Object> intl_segments_prototype();
 
     // Global object functions
     NonnullGCPtr<FunctionObject> eval_function() const { return *m_eval_function; }
@@ -57,13 +59,17 @@ public:
     NonnullGCPtr<FunctionObject> unescape_function() const { return *m_unescape_function; }
 
     // Namespace/constructor object functions
-    NonnullGCPtr<FunctionObject> array_prototype_values_function() const { return *m_array_prototype_values_function; }
-    NonnullGCPtr<FunctionObject> date_constructor_now_function() const { return *m_date_constructor_now_function; }
-    NonnullGCPtr<FunctionObject> json_parse_function() const { return *m_json_parse_function; }
-    NonnullGCPtr<FunctionObject> json_stringify_function() const { return *m_json_stringify_function; }
+    // NOTE: Most of these are captured when their owning object is created, so that scripts can't replace them.
+    NonnullGCPtr<FunctionObject> array_prototype_values_function();
+    NonnullGCPtr<FunctionObject> date_constructor_now_function();
+    NonnullGCPtr<FunctionObject> json_parse_function();
+    NonnullGCPtr<FunctionObject> json_stringify_function();
     NonnullGCPtr<FunctionObject> object_prototype_to_string_function() const { return *m_object_prototype_to_string_function; }
     NonnullGCPtr<FunctionObject> throw_type_error_function() const { return *m_throw_type_error_function; }
 
+    // Formatters reused by locale-sensitive methods such as Number.prototype.toLocaleString, see Intl::cached_formatter().
+    HashMap<String, NonnullGCPtr<Object>>& intl_formatter_cache() { return m_intl_formatter_cache; }
+
 #define __JS_ENUMERATE(ClassName, snake_name, PrototypeName, ConstructorName, ArrayType) \
     NonnullGCPtr<ConstructorName> snake_name##_constructor();                            \
     NonnullGCPtr<Object> snake_name##_prototype();
@@ -87,11 +93,8 @@ public:
     JS_ENUMERATE_BUILTIN_NAMESPACE_OBJECTS
 #undef __JS_ENUMERATE
 
-#define __JS_ENUMERATE(ClassName, snake_name)     \
-    NonnullGCPtr<Object> snake_name##_prototype() \
-    {                                             \
-        return *m_##snake_name##_prototype;       \
-    }
+#define __JS_ENUMERATE(ClassName, snake_name) \
+    NonnullGCPtr<Object> snake_name##_prototype();
     JS_ENUMERATE_ITERATOR_PROTOTYPES
 #undef __JS_ENUMERATE
 
@@ -162,6 +165,8 @@ private:
     GCPtr<FunctionObject> m_object_prototype_to_string_function;
     GCPtr<FunctionObject> m_throw_type_error_function;
 
+    HashMap<String, NonnullGCPtr<Object>> m_intl_formatter_cache;
+
 #define __JS_ENUMERATE(ClassName, snake_name, PrototypeName, ConstructorName, ArrayType) \
     GCPtr<ConstructorName> m_##snake_name##_constructor;                                 \
     GCPtr<Object> m_##snake_name##_prototype;
@@ -20,74 +20,223 @@ Map::Map(Object& prototype)
 {
 }
 
+Map::~Map()
+{
+    // NOTE: Iterators may outlive us if they are swept in the same garbage collection (e.g. the one held by a MapIterator).
+    for (auto* iterator = m_iterators; iterator;) {
+        auto* next_iterator = iterator->m_next_iterator;
+        iterator->m_map = nullptr;
+        iterator->m_previous_iterator = nullptr;
+        iterator->m_next_iterator = nullptr;
+        iterator = next_iterator;
+    }
+}
+
 // 24.1.3.1 Map.prototype.clear ( ), https://tc39.es/ecma262/#sec-map.prototype.clear
 void Map::map_clear()
 {
-    m_keys.clear();
     m_entries.clear();
+    m_buckets.clear();
+    m_removed_entry_count = 0;
+
+    // NOTE: Entries that are added after clearing the map must still be visited by existing iterators.
+    for (auto* iterator = m_iterators; iterator; iterator = iterator->m_next_iterator) {
+        iterator->m_index = 0;
+        iterator->m_skip_next_increment = true;
+    }
 }
 
 // 24.1.3.3 Map.prototype.delete ( key ), https://tc39.es/ecma262/#sec-map.prototype.delete
 bool Map::map_remove(Value const& key)
 {
-    Optional<size_t> index;
-
-    for (auto it = m_keys.begin(); !it.is_end(); ++it) {
-        if (ValueTraits::equals(*it, key)) {
-            index = it.key();
-            break;
-        }
-    }
-
+    auto index = find_entry(key, ValueTraits::hash(key));
     if (!index.has_value())
         return false;
 
-    m_keys.remove(*index);
-    m_entries.remove(key);
+    // NOTE: The entry stays in place (and in its bucket chain) as a tombstone, so that live iterators are not disturbed.
+    auto& entry = m_entries[*index];
+    entry.key = {};
+    entry.value = {};
+    ++m_removed_entry_count;
+
+    if (m_buckets.size() > minimum_bucket_count && map_size() < m_entries.size() / 4)
+        rehash(map_size());
     return true;
 }
 
 // 24.1.3.6 Map.prototype.get ( key ), https://tc39.es/ecma262/#sec-map.prototype.get
 Optional<Value> Map::map_get(Value const& key) const
 {
-    if (auto it = m_entries.find(key); it != m_entries.end())
-        return it->value;
+    if (auto index = find_entry(key, ValueTraits::hash(key)); index.has_value())
+        return m_entries[*index].value;
     return {};
 }
 
 // 24.1.3.7 Map.prototype.has ( key ), https://tc39.es/ecma262/#sec-map.prototype.has
 bool Map::map_has(Value const& key) const
 {
-    return m_entries.contains(key);
+    return find_entry(key, ValueTraits::hash(key)).has_value();
 }
 
 // 24.1.3.9 Map.prototype.set ( key, value ), https://tc39.es/ecma262/#sec-map.prototype.set
 void Map::map_set(Value const& key, Value value)
 {
-    auto it = m_entries.find(key);
-    if (it != m_entries.end()) {
-        it->value = value;
-    } else {
-        auto index = m_next_insertion_id++;
-        m_keys.insert(index, key);
-        m_entries.set(key, value);
+    auto hash = ValueTraits::hash(key);
+
+    if (auto index = find_entry(key, hash); index.has_value()) {
+        m_entries[*index].value = value;
+        return;
     }
+
+    if (m_entries.size() == m_buckets.size() * 2)
+        rehash(map_size() + 1);
+
+    auto bucket = hash & (m_buckets.size() - 1);
+    m_entries.append({ key, value, hash, m_buckets[bucket] });
+    m_buckets[bucket] = m_entries.size() - 1;
 }
 
 size_t Map::map_size() const
 {
-    return m_keys.size();
+    return m_entries.size() - m_removed_entry_count;
+}
+
+NonnullGCPtr<Map> Map::copy() const
+{
+    auto& realm = *vm().current_realm();
+    auto result = Map::create(realm);
+    result->m_entries = m_entries;
+    result->m_buckets = m_buckets;
+    result->m_removed_entry_count = m_removed_entry_count;
+    return result;
+}
+
+Optional<size_t> Map::find_entry(Value const& key, u32 hash) const
+{
+    if (m_buckets.is_empty())
+        return {};
+
+    for (auto index = m_buckets[hash & (m_buckets.size() - 1)]; index != end_of_bucket; index = m_entries[index].next_in_bucket) {
+        auto const& entry = m_entries[index];
+        if (entry.hash == hash && !entry.key.is_empty() && ValueTraits::equals(entry.key, key))
+            return index;
+    }
+
+    return {};
+}
+
+void Map::rehash(size_t minimum_capacity)
+{
+    size_t bucket_count = minimum_bucket_count;
+    while (bucket_count * 2 < minimum_capacity)
+        bucket_count *= 2;
+
+    if (m_removed_entry_count > 0) {
+        // Rebase all live iterators onto the compacted entries, i.e. onto the number of live entries before them.
+        if (m_iterators) {
+            Vector<u32> compacted_indices;
+            compacted_indices.ensure_capacity(m_entries.size() + 1);
+
+            u32 live_entry_count = 0;
+            for (auto const& entry : m_entries) {
+                compacted_indices.unchecked_append(live_entry_count);
+                if (!entry.key.is_empty())
+                    ++live_entry_count;
+            }
+            compacted_indices.unchecked_append(live_entry_count);
+
+            for (auto* iterator = m_iterators; iterator; iterator = iterator->m_next_iterator) {
+                auto index = min(iterator->m_index, m_entries.size());
+                if (index < m_entries.size() && m_entries[index].key.is_empty())
+                    iterator->m_skip_next_increment = true;
+                iterator->m_index = compacted_indices[index];
+            }
+        }
+
+        m_entries.remove_all_matching([](auto const& entry) { return entry.key.is_empty(); });
+        m_removed_entry_count = 0;
+    }
+
+    m_entries.ensure_capacity(bucket_count * 2);
+
+    m_buckets.resize_and_keep_capacity(bucket_count);
+    m_buckets.span().fill(end_of_bucket);
+
+    for (size_t index = 0; index < m_entries.size(); ++index) {
+        auto& entry = m_entries[index];
+        auto bucket = entry.hash & (bucket_count - 1);
+        entry.next_in_bucket = m_buckets[bucket];
+        m_buckets[bucket] = index;
+    }
 }
 
 void Map::visit_edges(Cell::Visitor& visitor)
 {
     Base::visit_edges(visitor);
-    for (auto& value : m_entries) {
-        visitor.visit(value.key);
-        visitor.visit(value.value);
+    for (auto const& entry : m_entries) {
+        visitor.visit(entry.key);
+        visitor.visit(entry.value);
     }
-    // NOTE: The entries in m_keys are already visited by the walk over m_entries above.
-    visitor.ignore(m_keys);
+}
+
+Map::IteratorBase::IteratorBase(Map const& map)
+    : m_map(&map)
+{
+    link();
+}
+
+Map::IteratorBase::IteratorBase(IteratorBase const& other)
+    : m_map(other.m_map)
+    , m_index(other.m_index)
+    , m_skip_next_increment(other.m_skip_next_increment)
+{
+    link();
+}
+
+Map::IteratorBase& Map::IteratorBase::operator=(IteratorBase const& other)
+{
+    if (this == &other)
+        return *this;
+
+    unlink();
+    m_map = other.m_map;
+    m_index = other.m_index;
+    m_skip_next_increment = other.m_skip_next_increment;
+    link();
+    return *this;
+}
+
+Map::IteratorBase::~IteratorBase()
+{
+    unlink();
+}
+
+void Map::IteratorBase::link()
+{
+    if (!m_map)
+        return;
+
+    m_previous_iterator = nullptr;
+    m_next_iterator = m_map->m_iterators;
+    if (m_next_iterator)
+        m_next_iterator->m_previous_iterator = this;
+    m_map->m_iterators = this;
+}
+
+void Map::IteratorBase::unlink()
+{
+    if (!m_map)
+        return;
+
+    if (m_previous_iterator)
+        m_previous_iterator->m_next_iterator = m_next_iterator;
+    else
+        m_map->m_iterators = m_next_iterator;
+    if (m_next_iterator)
+        m_next_iterator->m_previous_iterator = m_previous_iterator;
+
+    m_previous_iterator = nullptr;
+    m_next_iterator = nullptr;
 }
 
 }
@@ -6,8 +6,8 @@
 
 #pragma once
 
-#include <AK/HashMap.h>
-#include <AK/RedBlackTree.h>
+#include <AK/NumericLimits.h>
+#include <AK/Vector.h>
 #include <LibJS/Runtime/GlobalObject.h>
 #include <LibJS/Runtime/Object.h>
 #include <LibJS/Runtime/Value.h>
@@ -22,7 +22,7 @@ class Map : public Object {
 public:
     static NonnullGCPtr<Map> create(Realm&);
 
-    virtual ~Map() override = default;
+    virtual ~Map() override;
 
     void map_clear();
     bool map_remove(Value const&);
@@ -31,72 +31,99 @@ public:
     void map_set(Value const&, Value);
     size_t map_size() const;
 
+    NonnullGCPtr<Map> copy() const;
+
+    // Entries are stored contiguously in insertion order, and chained into hash buckets through their indices (i.e. a
+    // "close table", as described in https://wiki.mozilla.org/User:Jorend/Deterministic_hash_tables). Removed entries
+    // are left behind as tombstones with an empty key, which are compacted away the next time the table is rehashed.
+    struct Entry {
+        Value key;
+        Value value;
+        u32 hash { 0 };
+        u32 next_in_bucket { 0 };
+    };
+
     struct EndIterator {
     };
 
-    template<bool IsConst>
-    struct IteratorImpl {
+    // Every live iterator is linked into its map, so that it can be rebased when the entries are compacted or cleared.
+    class IteratorBase {
+    protected:
+        explicit IteratorBase(Map const&);
+        IteratorBase(IteratorBase const&);
+        IteratorBase& operator=(IteratorBase const&);
+        ~IteratorBase();
+
         bool is_end() const
         {
-            return m_map->m_keys.begin_from(m_index).is_end()
-                && m_map->m_keys.find_smallest_not_below_iterator(m_index).is_end();
+            skip_removed_entries();
+            return m_index >= m_map->m_entries.size();
         }
 
-        IteratorImpl& operator++()
+        void skip_removed_entries() const
         {
-            ++m_index;
-            return *this;
+            m_skip_next_increment = false;
+
+            auto const& entries = m_map->m_entries;
+            while (m_index < entries.size() && entries[m_index].key.is_empty())
+                ++m_index;
         }
 
-        decltype(auto) operator*()
+        Map::Entry& entry() const
         {
-            ensure_next_element();
-            return *m_map->m_entries.find(*m_map->m_keys.begin_from(m_index));
+            skip_removed_entries();
+            return const_cast<Map&>(*m_map).m_entries[m_index];
         }
 
-        decltype(auto) operator*() const
+    private:
+        friend class Map;
+
+        void link();
+        void unlink();
+
+        Map const* m_map { nullptr };
+        mutable size_t m_index { 0 };
+
+        // Set when the current entry was compacted or cleared away, leaving m_index at the entry that follows it.
+        mutable bool m_skip_next_increment { false };
+
+        IteratorBase* m_previous_iterator { nullptr };
+        IteratorBase* m_next_iterator { nullptr };
+    };
+
+    template<bool IsConst>
+    struct IteratorImpl : public IteratorBase {
+        using IteratorBase::is_end;
+
+        IteratorImpl& operator++()
         {
-            ensure_next_element();
-            return *m_map->m_entries.find(*m_map->m_keys.begin_from(m_index));
+            if (m_skip_next_increment)
+                m_skip_next_increment = false;
+            else
+                ++m_index;
+            return *this;
         }
 
-        bool operator==(IteratorImpl const& other) const { return m_index == other.m_index && &m_map == &other.m_map; }
+        Conditional<IsConst, Entry const&, Entry&> operator*() { return entry(); }
+        Entry const& operator*() const { return entry(); }
+
+        bool operator==(IteratorImpl const& other) const { return m_index == other.m_index && m_map == other.m_map; }
         bool operator==(EndIterator const&) const { return is_end(); }
 
     private:
         friend class Map;
+
         IteratorImpl(Map const& map)
         requires(IsConst)
-            : m_map(map)
+            : IteratorBase(map)
         {
-            ensure_index();
         }
 
         IteratorImpl(Map& map)
         requires(!IsConst)
-            : m_map(map)
-        {
-            ensure_index();
-        }
-
-        void ensure_index() const
+            : IteratorBase(map)
         {
-            if (m_map->m_keys.is_empty())
-                m_index = m_map->m_next_insertion_id;
-            else
-                m_index = m_map->m_keys.begin().key();
-        }
-
-        void ensure_next_element() const
-        {
-            if (auto it = m_map->m_keys.find_smallest_not_below_iterator(m_index); it.is_end())
-                m_index = m_map->m_next_insertion_id;
-            else
-                m_index = it.key();
         }
-
-        Conditional<IsConst, NonnullGCPtr<Map const>, NonnullGCPtr<Map>> m_map;
-        mutable size_t m_index { 0 };
     };
 
     using Iterator = IteratorImpl<false>;
@@ -110,9 +137,16 @@ private:
     explicit Map(Object& prototype);
     virtual void visit_edges(Visitor& visitor) override;
 
-    size_t m_next_insertion_id { 0 };
-    RedBlackTree<size_t, Value> m_keys;
-    HashMap<Value, Value, ValueTraits> m_entries;
+    Optional<size_t> find_entry(Value const&, u32 hash) const;
+    void rehash(size_t minimum_capacity);
+
+    static constexpr size_t minimum_bucket_count = 4;
+    static constexpr u32 end_of_bucket = NumericLimits<u32>::max();
+
+    Vector<Entry> m_entries;
+    Vector<u32> m_buckets;
+    size_t m_removed_entry_count { 0 };
+    mutable IteratorBase* m_iterators { nullptr };
 };
 
 }
@@ -121,7 +121,7 @@ ThrowCompletionOr<Value> NativeFunction::internal_call(Value this_argument, Read
     // NOTE: We don't support this concept yet.
 
     // 3. Let calleeContext be a new execution context.
-    auto callee_context = ExecutionContext::create();
+    auto callee_context = ExecutionContext::create(vm.value_stack());
 
     // 4. Set the Function of calleeContext to F.
     callee_context->function = this;
@@ -146,7 +146,7 @@ ThrowCompletionOr<Value> NativeFunction::internal_call(Value this_argument, Read
 
     // 8. Perform any necessary implementation-defined initialization of calleeContext.
     callee_context->this_value = this_argument;
-    callee_context->arguments.append(arguments_list.data(), arguments_list.size());
+    callee_context->set_arguments(arguments_list);
     callee_context->program_counter = vm.bytecode_interpreter().program_counter();
 
     callee_context->lexical_environment = caller_context.lexical_environment;
@@ -185,7 +185,7 @@ ThrowCompletionOr<NonnullGCPtr<Object>> NativeFunction::internal_construct(Reado
     // NOTE: We don't support this concept yet.
 
     // 3. Let calleeContext be a new execution context.
-    auto callee_context = ExecutionContext::create();
+    auto callee_context = ExecutionContext::create(vm.value_stack());
 
     // 4. Set the Function of calleeContext to F.
     callee_context->function = this;
@@ -209,7 +209,7 @@ ThrowCompletionOr<NonnullGCPtr<Object>> NativeFunction::internal_construct(Reado
     // Note: This is already the default value.
 
     // 8. Perform any necessary implementation-defined initialization of calleeContext.
-    callee_context->arguments.append(arguments_list.data(), arguments_list.size());
+    callee_context->set_arguments(arguments_list);
     callee_context->program_counter = vm.bytecode_interpreter().program_counter();
 
     callee_context->lexical_environment = caller_context.lexical_environment;
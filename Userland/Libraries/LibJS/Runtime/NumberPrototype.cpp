@@ -272,7 +272,9 @@ JS_DEFINE_NATIVE_FUNCTION(NumberPrototype::to_locale_string)
     auto number_value = TRY(this_number_value(vm, vm.this_value()));
 
     // 2. Let numberFormat be ? Construct(%NumberFormat%, « locales, options »).
-    auto* number_format = static_cast<Intl::NumberFormat*>(TRY(construct(vm, realm.intrinsics().intl_number_format_constructor(), locales, options)).ptr());
+    auto number_format = TRY(Intl::cached_formatter<Intl::NumberFormat>(vm, "NumberFormat"sv, locales, options, [&]() -> ThrowCompletionOr<NonnullGCPtr<Intl::NumberFormat>> {
+        return static_cast<Intl::NumberFormat&>(*TRY(construct(vm, realm.intrinsics().intl_number_format_constructor(), locales, options)));
+    }));
 
     // 3. Return ? FormatNumeric(numberFormat, x).
     auto formatted = Intl::format_numeric(vm, *number_format, number_value);
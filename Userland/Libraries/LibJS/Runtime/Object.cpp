@@ -1414,7 +1414,7 @@ void Object::visit_edges(Cell::Visitor& visitor)
 {
     Base::visit_edges(visitor);
     visitor.visit(m_shape);
-    visitor.visit(m_storage);
+    visitor.visit(m_storage.span());
 
     m_indexed_properties.for_each_value([&visitor](auto& value) {
         visitor.visit(value);
@@ -199,6 +199,7 @@ public:
     virtual bool is_ecmascript_function_object() const { return false; }
     virtual bool is_iterator_record() const { return false; }
     virtual bool is_array_iterator() const { return false; }
+    virtual bool is_regexp_object() const { return false; }
 
     // B.3.7 The [[IsHTMLDDA]] Internal Slot, https://tc39.es/ecma262/#sec-IsHTMLDDA-internal-slot
     virtual bool is_htmldda() const { return false; }
@@ -211,6 +212,9 @@ public:
     Value get_direct(size_t index) const { return m_storage[index]; }
     void put_direct(size_t index, Value value) { m_storage[index] = value; }
 
+    // Makes room for the given number of named properties, so adding them doesn't need to grow the storage repeatedly.
+    void ensure_property_storage_capacity(size_t capacity) { m_storage.ensure_capacity(capacity); }
+
     IndexedProperties const& indexed_properties() const { return m_indexed_properties; }
     IndexedProperties& indexed_properties() { return m_indexed_properties; }
     void set_indexed_property_elements(Vector<Value>&& values) { m_indexed_properties = IndexedProperties(move(values)); }
@@ -263,8 +267,12 @@ private:
     // True if this object has lazily allocated intrinsic properties.
     bool m_has_intrinsic_accessors { false };
 
+    // Named property values, indexed by the offsets in m_shape. Most objects only have a handful of properties,
+    // which are stored inline so that they don't need a separate allocation.
+    static constexpr size_t inline_property_storage_capacity = 4;
+
     GCPtr<Shape> m_shape;
-    Vector<Value> m_storage;
+    Vector<Value, inline_property_storage_capacity> m_storage;
     IndexedProperties m_indexed_properties;
     OwnPtr<Vector<PrivateElement>> m_private_elements; // [[PrivateElements]]
 };
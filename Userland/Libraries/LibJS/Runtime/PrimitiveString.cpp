@@ -275,8 +275,10 @@ void PrimitiveString::resolve_rope_if_needed(EncodingPreference preference) cons
         // into a UTF-16 code unit buffer and create a Utf16String from it.
 
         Utf16Data code_units;
-        for (auto const* current : pieces)
-            code_units.extend(current->utf16_string().string());
+        for (auto const* current : pieces) {
+            auto view = current->utf16_string_view();
+            code_units.append(view.data(), view.length_in_code_units());
+        }
 
         m_utf16_string = Utf16String::create(move(code_units));
         m_is_rope = false;
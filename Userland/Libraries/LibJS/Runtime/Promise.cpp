@@ -8,6 +8,7 @@
 #include <AK/Function.h>
 #include <AK/Optional.h>
 #include <AK/TypeCasts.h>
+#include <LibJS/Runtime/AsyncFunctionDriverWrapper.h>
 #include <LibJS/Runtime/Error.h>
 #include <LibJS/Runtime/GlobalObject.h>
 #include <LibJS/Runtime/JobCallback.h>
@@ -220,8 +221,7 @@ void Promise::fulfill(Value value)
 
     // 7. Perform TriggerPromiseReactions(reactions, value).
     trigger_reactions();
-    m_fulfill_reactions.clear();
-    m_reject_reactions.clear();
+    m_reactions.clear();
 
     // 8. Return unused.
 }
@@ -255,8 +255,7 @@ void Promise::reject(Value reason)
 
     // 8. Perform TriggerPromiseReactions(reactions, reason).
     trigger_reactions();
-    m_fulfill_reactions.clear();
-    m_reject_reactions.clear();
+    m_reactions.clear();
 
     // 9. Return unused.
 }
@@ -266,15 +265,20 @@ void Promise::trigger_reactions() const
 {
     VERIFY(is_settled());
     auto& vm = this->vm();
-    auto& reactions = m_state == State::Fulfilled
-        ? m_fulfill_reactions
-        : m_reject_reactions;
+    auto is_fulfilled = m_state == State::Fulfilled;
 
     // 1. For each element reaction of reactions, do
-    for (auto& reaction : reactions) {
+    for (auto const& reaction : m_reactions) {
         // a. Let job be NewPromiseReactionJob(reaction, argument).
-        dbgln_if(PROMISE_DEBUG, "[Promise @ {} / trigger_reactions()]: Creating PromiseJob for PromiseReaction @ {} with argument {}", this, &reaction, m_result);
-        auto [job, realm] = create_promise_reaction_job(vm, *reaction, m_result);
+        // NOTE: An async function awaiting this promise is resumed by an equivalent job, see perform_then_for_await().
+        auto [job, realm] = [&] {
+            if (reaction.awaiting_async_function)
+                return create_async_function_await_job(vm, *reaction.awaiting_async_function, is_fulfilled, m_result);
+
+            auto& promise_reaction = is_fulfilled ? *reaction.fulfill_reaction : *reaction.reject_reaction;
+            dbgln_if(PROMISE_DEBUG, "[Promise @ {} / trigger_reactions()]: Creating PromiseJob for PromiseReaction @ {} with argument {}", this, &promise_reaction, m_result);
+            return create_promise_reaction_job(vm, promise_reaction, m_result);
+        }();
 
         // b. Perform HostEnqueuePromiseJob(job.[[Job]], job.[[Realm]]).
         dbgln_if(PROMISE_DEBUG, "[Promise @ {} / trigger_reactions()]: Enqueuing job @ {} in realm {}", this, &job, realm.ptr());
@@ -282,7 +286,7 @@ void Promise::trigger_reactions() const
     }
 
     if constexpr (PROMISE_DEBUG) {
-        if (reactions.is_empty())
+        if (m_reactions.is_empty())
             dbgln("[Promise @ {} / trigger_reactions()]: No reactions!", this);
     }
 
@@ -332,10 +336,8 @@ Value Promise::perform_then(Value on_fulfilled, Value on_rejected, GCPtr<Promise
         dbgln_if(PROMISE_DEBUG, "[Promise @ {} / perform_then()]: state is State::Pending, adding fulfill/reject reactions", this);
 
         // a. Append fulfillReaction as the last element of the List that is promise.[[PromiseFulfillReactions]].
-        m_fulfill_reactions.append(fulfill_reaction);
-
         // b. Append rejectReaction as the last element of the List that is promise.[[PromiseRejectReactions]].
-        m_reject_reactions.append(reject_reaction);
+        m_reactions.append({ fulfill_reaction, reject_reaction, nullptr });
         break;
     // 10. Else if promise.[[PromiseState]] is fulfilled, then
     case Promise::State::Fulfilled: {
@@ -391,12 +393,52 @@ Value Promise::perform_then(Value on_fulfilled, Value on_rejected, GCPtr<Promise
     return result_capability->promise();
 }
 
+// 27.2.5.4.1 PerformPromiseThen ( promise, onFulfilled, onRejected [ , resultCapability ] ), https://tc39.es/ecma262/#sec-performpromisethen
+// NOTE: This performs PerformPromiseThen(promise, onFulfilled, onRejected) as done by step 7 of Await(), where onFulfilled and
+//       onRejected are built-in functions that resume the awaiting async function. As these functions are never exposed
+//       to script, we resume the async function from the reaction job directly, without creating them or any reactions.
+void Promise::perform_then_for_await(AsyncFunctionDriverWrapper& async_function)
+{
+    auto& vm = this->vm();
+
+    switch (m_state) {
+    // 9. If promise.[[PromiseState]] is pending, then
+    case Promise::State::Pending:
+        m_reactions.append({ nullptr, nullptr, async_function });
+        break;
+    // 10. Else if promise.[[PromiseState]] is fulfilled, then
+    case Promise::State::Fulfilled: {
+        auto [fulfill_job, realm] = create_async_function_await_job(vm, async_function, true, m_result);
+        vm.host_enqueue_promise_job(move(fulfill_job), realm);
+        break;
+    }
+    // 11. Else,
+    case Promise::State::Rejected: {
+        // c. If promise.[[PromiseIsHandled]] is false, perform HostPromiseRejectionTracker(promise, "handle").
+        if (!m_is_handled)
+            vm.host_promise_rejection_tracker(*this, RejectionOperation::Handle);
+
+        auto [reject_job, realm] = create_async_function_await_job(vm, async_function, false, m_result);
+        vm.host_enqueue_promise_job(move(reject_job), realm);
+        break;
+    }
+    default:
+        VERIFY_NOT_REACHED();
+    }
+
+    // 12. Set promise.[[PromiseIsHandled]] to true.
+    m_is_handled = true;
+}
+
 void Promise::visit_edges(Cell::Visitor& visitor)
 {
     Base::visit_edges(visitor);
     visitor.visit(m_result);
-    visitor.visit(m_fulfill_reactions);
-    visitor.visit(m_reject_reactions);
+    for (auto const& reaction : m_reactions) {
+        visitor.visit(reaction.fulfill_reaction);
+        visitor.visit(reaction.reject_reaction);
+        visitor.visit(reaction.awaiting_async_function);
+    }
 }
 
 }
@@ -11,6 +11,8 @@
 
 namespace JS {
 
+class AsyncFunctionDriverWrapper;
+
 ThrowCompletionOr<Object*> promise_resolve(VM&, Object& constructor, Value);
 
 class Promise : public Object {
@@ -44,6 +46,7 @@ public:
     void fulfill(Value value);
     void reject(Value reason);
     Value perform_then(Value on_fulfilled, Value on_rejected, GCPtr<PromiseCapability> result_capability);
+    void perform_then_for_await(AsyncFunctionDriverWrapper&);
 
     bool is_handled() const { return m_is_handled; }
     void set_is_handled() { m_is_handled = true; }
@@ -58,12 +61,20 @@ private:
 
     void trigger_reactions() const;
 
+    // NOTE: PerformPromiseThen always appends to [[PromiseFulfillReactions]] and [[PromiseRejectReactions]] together,
+    //       so we keep both lists in one, with each entry holding a pair of reactions. An entry may instead hold an
+    //       async function that awaits this promise, which stands in for the pair of reactions created by Await().
+    struct Reaction {
+        GCPtr<PromiseReaction> fulfill_reaction;
+        GCPtr<PromiseReaction> reject_reaction;
+        GCPtr<AsyncFunctionDriverWrapper> awaiting_async_function;
+    };
+
     // 27.2.6 Properties of Promise Instances, https://tc39.es/ecma262/#sec-properties-of-promise-instances
-    State m_state { State::Pending };                   // [[PromiseState]]
-    Value m_result;                                     // [[PromiseResult]]
-    Vector<GCPtr<PromiseReaction>> m_fulfill_reactions; // [[PromiseFulfillReactions]]
-    Vector<GCPtr<PromiseReaction>> m_reject_reactions;  // [[PromiseRejectReactions]]
-    bool m_is_handled { false };                        // [[PromiseIsHandled]]
+    State m_state { State::Pending }; // [[PromiseState]]
+    Value m_result;                   // [[PromiseResult]]
+    Vector<Reaction> m_reactions;     // [[PromiseFulfillReactions]] and [[PromiseRejectReactions]]
+    bool m_is_handled { false };      // [[PromiseIsHandled]]
 };
 
 }
@@ -7,6 +7,7 @@
 
 #include <AK/Debug.h>
 #include <LibJS/Runtime/AbstractOperations.h>
+#include <LibJS/Runtime/AsyncFunctionDriverWrapper.h>
 #include <LibJS/Runtime/GlobalObject.h>
 #include <LibJS/Runtime/JobCallback.h>
 #include <LibJS/Runtime/Promise.h>
@@ -172,4 +173,25 @@ PromiseJob create_promise_resolve_thenable_job(VM& vm, Promise& promise_to_resol
     return { job, then_realm };
 }
 
+// 27.2.2.1 NewPromiseReactionJob ( reaction, argument ), https://tc39.es/ecma262/#sec-newpromisereactionjob
+// NOTE: This is NewPromiseReactionJob for a reaction whose handler is one of the built-in functions created by Await().
+//       As those functions have no observable behavior besides resuming the async function, we do that directly.
+PromiseJob create_async_function_await_job(VM& vm, AsyncFunctionDriverWrapper& async_function, bool is_fulfilled, Value argument)
+{
+    // 3. If reaction.[[Handler]] is not empty, then
+    //     a. Let getHandlerRealmResult be Completion(GetFunctionRealm(reaction.[[Handler]].[[Callback]])).
+    //     b. If getHandlerRealmResult is a normal completion, set handlerRealm to getHandlerRealmResult.[[Value]].
+    // NOTE: The built-in functions are created in the current realm at the time of the await.
+    auto& handler_realm = async_function.suspended_realm();
+
+    // 1. Let job be a new Job Abstract Closure with parameters () that captures reaction and argument and performs the following steps when called:
+    //    See AsyncFunctionDriverWrapper::resume_after_await() for "the following steps".
+    auto job = create_heap_function(vm.heap(), [&async_function, is_fulfilled, argument]() {
+        return async_function.resume_after_await(argument, is_fulfilled);
+    });
+
+    // 4. Return the Record { [[Job]]: job, [[Realm]]: handlerRealm }.
+    return { job, &handler_realm };
+}
+
 }
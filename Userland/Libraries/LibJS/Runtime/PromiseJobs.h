@@ -22,5 +22,6 @@ struct PromiseJob {
 // NOTE: These return a PromiseJob to prevent awkward casting at call sites.
 PromiseJob create_promise_reaction_job(VM&, PromiseReaction&, Value argument);
 PromiseJob create_promise_resolve_thenable_job(VM&, Promise&, Value thenable, JS::NonnullGCPtr<JobCallback> then);
+PromiseJob create_async_function_await_job(VM&, AsyncFunctionDriverWrapper&, bool is_fulfilled, Value argument);
 
 }
@@ -0,0 +1,41 @@
+/*
+ * Copyright (c) 2024, the SerenityOS developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibJS/Runtime/RegExpCache.h>
+
+namespace JS {
+
+Optional<Regex<ECMA262>> RegExpCache::get(ByteString const& pattern, ByteString const& flags)
+{
+    auto it = m_entries.find(Key { pattern, flags });
+    if (it == m_entries.end())
+        return {};
+
+    it->value.last_use = ++m_use_counter;
+    return it->value.regex.clone();
+}
+
+void RegExpCache::set(ByteString const& pattern, ByteString const& flags, Regex<ECMA262> const& regex)
+{
+    Key key { pattern, flags };
+    if (m_entries.contains(key))
+        return;
+
+    if (m_entries.size() >= capacity) {
+        // Evict the least recently used pattern. The cache is small enough for a linear scan to be cheaper than
+        // maintaining a separate usage order.
+        auto least_recently_used = m_entries.begin();
+        for (auto it = m_entries.begin(); it != m_entries.end(); ++it) {
+            if (it->value.last_use < least_recently_used->value.last_use)
+                least_recently_used = it;
+        }
+        m_entries.remove(least_recently_used);
+    }
+
+    m_entries.set(move(key), Entry { regex.clone(), ++m_use_counter });
+}
+
+}
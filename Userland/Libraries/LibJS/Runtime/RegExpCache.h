@@ -0,0 +1,55 @@
+/*
+ * Copyright (c) 2024, the SerenityOS developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/ByteString.h>
+#include <AK/HashMap.h>
+#include <AK/Noncopyable.h>
+#include <AK/Optional.h>
+#include <LibRegex/Regex.h>
+
+namespace JS {
+
+// Parsing and optimizing a pattern into LibRegex bytecode is expensive, so RegExp objects created with the same source
+// and flags reuse previously compiled bytecode. The cache belongs to the VM, which makes it shared by all realms, and
+// only holds on to the most recently used patterns.
+class RegExpCache {
+    AK_MAKE_NONCOPYABLE(RegExpCache);
+    AK_MAKE_NONMOVABLE(RegExpCache);
+
+public:
+    static constexpr size_t capacity = 64;
+
+    RegExpCache() = default;
+
+    Optional<Regex<ECMA262>> get(ByteString const& pattern, ByteString const& flags);
+    void set(ByteString const& pattern, ByteString const& flags, Regex<ECMA262> const&);
+
+    size_t size() const { return m_entries.size(); }
+
+private:
+    struct Key {
+        ByteString pattern;
+        ByteString flags;
+
+        bool operator==(Key const&) const = default;
+    };
+
+    struct KeyTraits : public DefaultTraits<Key> {
+        static unsigned hash(Key const& key) { return pair_int_hash(key.pattern.hash(), key.flags.hash()); }
+    };
+
+    struct Entry {
+        Regex<ECMA262> regex;
+        u64 last_use { 0 };
+    };
+
+    HashMap<Key, Entry, KeyTraits> m_entries;
+    u64 m_use_counter { 0 };
+};
+
+}
@@ -8,8 +8,10 @@
 #include <LibJS/Runtime/AbstractOperations.h>
 #include <LibJS/Runtime/GlobalObject.h>
 #include <LibJS/Runtime/PrimitiveString.h>
+#include <LibJS/Runtime/RegExpCache.h>
 #include <LibJS/Runtime/RegExpConstructor.h>
 #include <LibJS/Runtime/RegExpObject.h>
+#include <LibJS/Runtime/RegExpPrototype.h>
 #include <LibJS/Runtime/StringPrototype.h>
 #include <LibJS/Runtime/Value.h>
 #include <LibJS/Token.h>
@@ -175,23 +177,16 @@ void RegExpObject::initialize(Realm& realm)
     Base::initialize(realm);
 
     define_direct_property(vm.names.lastIndex, Value(0), Attribute::Writable);
+
+    // NOTE: All RegExp objects with the same prototype start out with this shape, which allows the RegExp built-ins to
+    //       recognize objects that are still in their initial state.
+    if (auto* prototype = shape().prototype(); prototype && is<RegExpPrototype>(*prototype))
+        static_cast<RegExpPrototype&>(*prototype).set_initial_instance_shape(shape());
 }
 
-// 22.2.3.3 RegExpInitialize ( obj, pattern, flags ), https://tc39.es/ecma262/#sec-regexpinitialize
-ThrowCompletionOr<NonnullGCPtr<RegExpObject>> RegExpObject::regexp_initialize(VM& vm, Value pattern_value, Value flags_value)
+// Steps 5-15 of RegExpInitialize, see below.
+static ThrowCompletionOr<Regex<ECMA262>> compile_regexp(VM& vm, ByteString const& pattern, ByteString const& flags)
 {
-    // 1. If pattern is undefined, let P be the empty String.
-    // 2. Else, let P be ? ToString(pattern).
-    auto pattern = pattern_value.is_undefined()
-        ? ByteString::empty()
-        : TRY(pattern_value.to_byte_string(vm));
-
-    // 3. If flags is undefined, let F be the empty String.
-    // 4. Else, let F be ? ToString(flags).
-    auto flags = flags_value.is_undefined()
-        ? ByteString::empty()
-        : TRY(flags_value.to_byte_string(vm));
-
     // 5. If F contains any code unit other than "d", "g", "i", "m", "s", "u", "v", or "y", or if F contains any code unit more than once, throw a SyntaxError exception.
     // 6. If F contains "i", let i be true; else let i be false.
     // 7. If F contains "m", let m be true; else let m be false.
@@ -224,6 +219,33 @@ ThrowCompletionOr<NonnullGCPtr<RegExpObject>> RegExpObject::regexp_initialize(VM
     // 15. Assert: parseResult is a Pattern Parse Node.
     VERIFY(regex.parser_result.error == regex::Error::NoError);
 
+    return regex;
+}
+
+// 22.2.3.3 RegExpInitialize ( obj, pattern, flags ), https://tc39.es/ecma262/#sec-regexpinitialize
+ThrowCompletionOr<NonnullGCPtr<RegExpObject>> RegExpObject::regexp_initialize(VM& vm, Value pattern_value, Value flags_value)
+{
+    // 1. If pattern is undefined, let P be the empty String.
+    // 2. Else, let P be ? ToString(pattern).
+    auto pattern = pattern_value.is_undefined()
+        ? ByteString::empty()
+        : TRY(pattern_value.to_byte_string(vm));
+
+    // 3. If flags is undefined, let F be the empty String.
+    // 4. Else, let F be ? ToString(flags).
+    auto flags = flags_value.is_undefined()
+        ? ByteString::empty()
+        : TRY(flags_value.to_byte_string(vm));
+
+    // OPTIMIZATION: Steps 5 through 15 only depend on P and F, and compiling the same pattern again is unobservable.
+    //               If this VM has compiled this pattern with these flags before, we reuse the compiled bytecode.
+    auto& regexp_cache = vm.regexp_cache();
+    auto regex = regexp_cache.get(pattern, flags);
+    if (!regex.has_value()) {
+        regex = TRY(compile_regexp(vm, pattern, flags));
+        regexp_cache.set(pattern, flags, *regex);
+    }
+
     // 16. Set obj.[[OriginalSource]] to P.
     m_pattern = move(pattern);
 
@@ -234,7 +256,7 @@ ThrowCompletionOr<NonnullGCPtr<RegExpObject>> RegExpObject::regexp_initialize(VM
     // 19. Let rer be the RegExp Record { [[IgnoreCase]]: i, [[Multiline]]: m, [[DotAll]]: s, [[Unicode]]: u, [[CapturingGroupsCount]]: capturingGroupsCount }.
     // 20. Set obj.[[RegExpRecord]] to rer.
     // 21. Set obj.[[RegExpMatcher]] to CompilePattern of parseResult with argument rer.
-    m_regex = move(regex);
+    m_regex = regex.release_value();
 
     // 22. Perform ? Set(obj, "lastIndex", +0𝔽, true).
     TRY(set(vm.names.lastIndex, Value(0), Object::ShouldThrowExceptions::Yes));
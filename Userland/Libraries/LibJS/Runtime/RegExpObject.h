@@ -60,6 +60,7 @@ private:
     RegExpObject(Object& prototype);
     RegExpObject(Regex<ECMA262> regex, ByteString pattern, ByteString flags, Object& prototype);
 
+    virtual bool is_regexp_object() const final { return true; }
     virtual void visit_edges(Visitor&) override;
 
     ByteString m_pattern;
@@ -70,4 +71,7 @@ private:
     Optional<Regex<ECMA262>> m_regex;
 };
 
+template<>
+inline bool Object::fast_is<RegExpObject>() const { return is_regexp_object(); }
+
 }
@@ -10,6 +10,7 @@
 #include <AK/Function.h>
 #include <AK/Utf16View.h>
 #include <LibJS/Runtime/AbstractOperations.h>
+#include <LibJS/Runtime/Accessor.h>
 #include <LibJS/Runtime/Array.h>
 #include <LibJS/Runtime/Error.h>
 #include <LibJS/Runtime/ErrorTypes.h>
@@ -54,20 +55,160 @@ void RegExpPrototype::initialize(Realm& realm)
     define_native_accessor(realm, vm.names.flagName, flag_name, {}, Attribute::Configurable);
     JS_ENUMERATE_REGEXP_FLAGS
 #undef __JS_ENUMERATE
+
+    // Remember the built-in functions, so that fast paths can tell whether they have been replaced.
+    auto remember_builtin_property = [&](PropertyKey const& property_key, bool is_accessor) {
+        auto value = storage_get(property_key)->value;
+        auto* function = is_accessor ? value.as_accessor().getter() : &value.as_function();
+        m_builtin_properties.append(BuiltinProperty { property_key, function, is_accessor, {} });
+    };
+
+    remember_builtin_property(vm.names.exec, false);
+    remember_builtin_property(vm.names.flags, true);
+#define __JS_ENUMERATE(flagName, flag_name, flag_char) \
+    remember_builtin_property(vm.names.flagName, true);
+    JS_ENUMERATE_REGEXP_FLAGS
+#undef __JS_ENUMERATE
+}
+
+void RegExpPrototype::visit_edges(Visitor& visitor)
+{
+    Base::visit_edges(visitor);
+    visitor.visit(m_initial_instance_shape);
+    visitor.visit(m_builtin_property_offsets_shape);
+    for (auto& property : m_builtin_properties)
+        visitor.visit(property.function);
+}
+
+void RegExpPrototype::set_initial_instance_shape(Shape& shape)
+{
+    if (m_initial_instance_shape)
+        return;
+
+    auto last_index = shape.lookup(vm().names.lastIndex.to_string_or_symbol());
+    VERIFY(last_index.has_value());
+    VERIFY(last_index->attributes.is_writable());
+
+    m_initial_instance_shape = &shape;
+    m_initial_instance_last_index_offset = last_index->offset;
+}
+
+bool RegExpPrototype::has_builtin_property(BuiltinProperty& property)
+{
+    // NOTE: Property offsets only change along with the shape, unless this object has become a dictionary, whose shape
+    //       is modified in place.
+    if (&shape() != m_builtin_property_offsets_shape || shape().is_dictionary()) {
+        for (auto& builtin_property : m_builtin_properties) {
+            auto metadata = shape().lookup(builtin_property.key.to_string_or_symbol());
+            builtin_property.offset = metadata.has_value() ? metadata->offset : Optional<u32> {};
+        }
+        m_builtin_property_offsets_shape = &shape();
+    }
+
+    if (!property.offset.has_value())
+        return false;
+
+    auto value = get_direct(*property.offset);
+    if (property.is_accessor)
+        return value.is_accessor() && value.as_accessor().getter() == property.function;
+    return value.is_object() && &value.as_object() == property.function;
+}
+
+bool RegExpPrototype::has_builtin_exec()
+{
+    return has_builtin_property(m_builtin_properties[0]);
+}
+
+bool RegExpPrototype::has_builtin_flags()
+{
+    for (size_t i = 1; i < m_builtin_properties.size(); ++i) {
+        if (!has_builtin_property(m_builtin_properties[i]))
+            return false;
+    }
+    return true;
+}
+
+// OPTIMIZATION: Every RegExp object has an own "lastIndex" data property, so getting or setting it never has side
+//               effects. While a RegExp object still has its initial shape, that property is also writable and stored
+//               at a known offset, so we can access it without looking it up.
+static RegExpPrototype* prototype_if_initial_instance_shape(Object& object)
+{
+    if (!is<RegExpObject>(object))
+        return nullptr;
+
+    auto* prototype = object.shape().prototype();
+    if (!prototype || !is<RegExpPrototype>(*prototype))
+        return nullptr;
+
+    auto& regexp_prototype = static_cast<RegExpPrototype&>(*prototype);
+    if (!regexp_prototype.has_initial_instance_shape(object))
+        return nullptr;
+
+    return &regexp_prototype;
+}
+
+static ThrowCompletionOr<Value> get_last_index(VM& vm, Object& regexp_object)
+{
+    if (auto* prototype = prototype_if_initial_instance_shape(regexp_object))
+        return regexp_object.get_direct(prototype->initial_instance_last_index_offset());
+    return TRY(regexp_object.get(vm.names.lastIndex));
+}
+
+static ThrowCompletionOr<void> set_last_index(VM& vm, Object& regexp_object, Value last_index)
+{
+    if (auto* prototype = prototype_if_initial_instance_shape(regexp_object)) {
+        regexp_object.put_direct(prototype->initial_instance_last_index_offset(), last_index);
+        return {};
+    }
+    TRY(regexp_object.set(vm.names.lastIndex, last_index, Object::ShouldThrowExceptions::Yes));
+    return {};
+}
+
+// OPTIMIZATION: A RegExp object of the current realm that still has its initial shape inherits everything from
+//               %RegExp.prototype%. If the properties we would look up there are also still the built-in ones, the
+//               lookups (and the calls to the built-in functions they find) can be skipped.
+static RegExpPrototype* prototype_if_unmodified_regexp_object(VM& vm, Object& object)
+{
+    auto* prototype = prototype_if_initial_instance_shape(object);
+    if (!prototype || prototype != vm.current_realm()->intrinsics().regexp_prototype().ptr())
+        return nullptr;
+    return prototype;
+}
+
+// Non-standard abstraction around ToString(? Get(R, "flags")), which is used by multiple prototypes.
+static ThrowCompletionOr<ByteString> regexp_flags(VM& vm, Object& regexp_object)
+{
+    // OPTIMIZATION: The built-in flags getter only calls the built-in getters for each flag, which in turn only look at
+    //               R.[[OriginalFlags]]. So if none of them have been replaced, we can skip straight to the result.
+    if (auto* prototype = prototype_if_unmodified_regexp_object(vm, regexp_object); prototype && prototype->has_builtin_flags()) {
+        auto const& original_flags = static_cast<RegExpObject&>(regexp_object).flags();
+
+        StringBuilder builder(8);
+#define __JS_ENUMERATE(flagName, flag_name, flag_char) \
+    if (original_flags.contains(#flag_char##sv))        \
+        builder.append(#flag_char##sv);
+        JS_ENUMERATE_REGEXP_FLAGS
+#undef __JS_ENUMERATE
+
+        return builder.to_byte_string();
+    }
+
+    auto flags_value = TRY(regexp_object.get(vm.names.flags));
+    return TRY(flags_value.to_byte_string(vm));
 }
 
 // Non-standard abstraction around steps used by multiple prototypes.
 static ThrowCompletionOr<void> increment_last_index(VM& vm, Object& regexp_object, Utf16View const& string, bool unicode)
 {
     // Let thisIndex be ℝ(? ToLength(? Get(rx, "lastIndex"))).
-    auto last_index_value = TRY(regexp_object.get(vm.names.lastIndex));
+    auto last_index_value = TRY(get_last_index(vm, regexp_object));
     auto last_index = TRY(last_index_value.to_length(vm));
 
     // Let nextIndex be AdvanceStringIndex(S, thisIndex, fullUnicode).
     last_index = advance_string_index(string, last_index, unicode);
 
     // Perform ? Set(rx, "lastIndex", 𝔽(nextIndex), true).
-    TRY(regexp_object.set(vm.names.lastIndex, Value(last_index), Object::ShouldThrowExceptions::Yes));
+    TRY(set_last_index(vm, regexp_object, Value(last_index)));
     return {};
 }
 
@@ -167,6 +308,16 @@ static Value make_match_indices_index_pair_array(VM& vm, Utf16View const& string
     return array;
 }
 
+// NOTE: The views in a regex::Match point into the string that was matched against, so we can share its code units.
+static Utf16String substring_of_match(Utf16String const& string, Utf16View const& match)
+{
+    auto string_view = string.view();
+    if (match.is_empty() || match.data() < string_view.data() || match.data() + match.length_in_code_units() > string_view.data() + string_view.length_in_code_units())
+        return Utf16String::create(match);
+
+    return string.substring(match.data() - string_view.data(), match.length_in_code_units());
+}
+
 // 22.2.7.2 RegExpBuiltinExec ( R, S ), https://tc39.es/ecma262/#sec-regexpbuiltinexec
 // 22.2.7.2 RegExpBuiltInExec ( R, S ), https://github.com/tc39/proposal-regexp-legacy-features#regexpbuiltinexec--r-s-
 static ThrowCompletionOr<Value> regexp_builtin_exec(VM& vm, RegExpObject& regexp_object, Utf16String string)
@@ -175,7 +326,7 @@ static ThrowCompletionOr<Value> regexp_builtin_exec(VM& vm, RegExpObject& regexp
 
     // 1. Let length be the length of S.
     // 2. Let lastIndex be ℝ(? ToLength(? Get(R, "lastIndex"))).
-    auto last_index_value = TRY(regexp_object.get(vm.names.lastIndex));
+    auto last_index_value = TRY(get_last_index(vm, regexp_object));
     auto last_index = TRY(last_index_value.to_length(vm));
 
     auto const& regex = regexp_object.regex();
@@ -227,7 +378,7 @@ static ThrowCompletionOr<Value> regexp_builtin_exec(VM& vm, RegExpObject& regexp
     if (!result.success) {
         // 13.d.i, 13.a.i
         if (sticky || global)
-            TRY(regexp_object.set(vm.names.lastIndex, Value(0), Object::ShouldThrowExceptions::Yes));
+            TRY(set_last_index(vm, regexp_object, Value(0)));
 
         // 13.a.ii, 13.d.i.2
         return js_null();
@@ -249,7 +400,7 @@ static ThrowCompletionOr<Value> regexp_builtin_exec(VM& vm, RegExpObject& regexp
     // 16. If global is true or sticky is true, then
     if (global || sticky) {
         // a. Perform ? Set(R, "lastIndex", 𝔽(e), true).
-        TRY(regexp_object.set(vm.names.lastIndex, Value(end_index), Object::ShouldThrowExceptions::Yes));
+        TRY(set_last_index(vm, regexp_object, Value(end_index)));
     }
 
     // 17. Let n be the number of elements in r's captures List. (This is the same value as 22.2.2.1's NcapturingParens.)
@@ -280,7 +431,7 @@ static ThrowCompletionOr<Value> regexp_builtin_exec(VM& vm, RegExpObject& regexp
 
     // 28. Let matchedValue be ! GetMatchString(S, match).
     // 29. Perform ! CreateDataPropertyOrThrow(A, "0", matchedValue).
-    MUST(array->create_data_property_or_throw(0, PrimitiveString::create(vm, Utf16String::create(match.view.u16_view()))));
+    MUST(array->create_data_property_or_throw(0, PrimitiveString::create(vm, substring_of_match(string, match.view.u16_view()))));
 
     // 30. If R contains any GroupName, then
     //     a. Let groups be OrdinaryObjectCreate(null).
@@ -316,7 +467,7 @@ static ThrowCompletionOr<Value> regexp_builtin_exec(VM& vm, RegExpObject& regexp
             //     2. Set captureEnd to ! GetStringIndex(S, Input, captureEnd).
             // iv. Let capture be the Match { [[StartIndex]]: captureStart, [[EndIndex]: captureEnd }.
             // v. Let capturedValue be ! GetMatchString(S, capture).
-            auto capture_as_utf16_string = Utf16String::create(capture.view.u16_view());
+            auto capture_as_utf16_string = substring_of_match(string, capture.view.u16_view());
             captured_value = PrimitiveString::create(vm, capture_as_utf16_string);
             // vi. Append capture to indices.
             indices.append(Match::create(capture));
@@ -388,6 +539,11 @@ static ThrowCompletionOr<Value> regexp_builtin_exec(VM& vm, RegExpObject& regexp
 // 22.2.7.1 RegExpExec ( R, S ), https://tc39.es/ecma262/#sec-regexpexec
 ThrowCompletionOr<Value> regexp_exec(VM& vm, Object& regexp_object, Utf16String string)
 {
+    // OPTIMIZATION: If the lookup below would find the built-in exec function, calling it is equivalent to performing
+    //               RegExpBuiltinExec directly.
+    if (auto* prototype = prototype_if_unmodified_regexp_object(vm, regexp_object); prototype && prototype->has_builtin_exec())
+        return regexp_builtin_exec(vm, static_cast<RegExpObject&>(regexp_object), move(string));
+
     // 1. Let exec be ? Get(R, "exec").
     auto exec = TRY(regexp_object.get(vm.names.exec));
 
@@ -529,8 +685,7 @@ JS_DEFINE_NATIVE_FUNCTION(RegExpPrototype::symbol_match)
     auto string = TRY(vm.argument(0).to_utf16_string(vm));
 
     // 4. Let flags be ? ToString(? Get(rx, "flags")).
-    auto flags_value = TRY(regexp_object->get(vm.names.flags));
-    auto flags = TRY(flags_value.to_byte_string(vm));
+    auto flags = TRY(regexp_flags(vm, regexp_object));
 
     // 5. If flags does not contain "g", then
     if (!flags.contains('g')) {
@@ -543,7 +698,7 @@ JS_DEFINE_NATIVE_FUNCTION(RegExpPrototype::symbol_match)
     bool full_unicode = flags.contains('u') || flags.contains('v');
 
     // b. Perform ? Set(rx, "lastIndex", +0𝔽, true).
-    TRY(regexp_object->set(vm.names.lastIndex, Value(0), Object::ShouldThrowExceptions::Yes));
+    TRY(set_last_index(vm, *regexp_object, Value(0)));
 
     // c. Let A be ! ArrayCreate(0).
     auto array = MUST(Array::create(realm, 0));
@@ -605,8 +760,7 @@ JS_DEFINE_NATIVE_FUNCTION(RegExpPrototype::symbol_match_all)
     auto* constructor = TRY(species_constructor(vm, regexp_object, realm.intrinsics().regexp_constructor()));
 
     // 5. Let flags be ? ToString(? Get(R, "flags")).
-    auto flags_value = TRY(regexp_object->get(vm.names.flags));
-    auto flags = TRY(flags_value.to_byte_string(vm));
+    auto flags = TRY(regexp_flags(vm, regexp_object));
 
     // Steps 9-12 are performed early so that flags can be moved.
 
@@ -622,11 +776,11 @@ JS_DEFINE_NATIVE_FUNCTION(RegExpPrototype::symbol_match_all)
     auto matcher = TRY(construct(vm, *constructor, regexp_object, PrimitiveString::create(vm, move(flags))));
 
     // 7. Let lastIndex be ? ToLength(? Get(R, "lastIndex")).
-    auto last_index_value = TRY(regexp_object->get(vm.names.lastIndex));
+    auto last_index_value = TRY(get_last_index(vm, *regexp_object));
     auto last_index = TRY(last_index_value.to_length(vm));
 
     // 8. Perform ? Set(matcher, "lastIndex", lastIndex, true).
-    TRY(matcher->set(vm.names.lastIndex, Value(last_index), Object::ShouldThrowExceptions::Yes));
+    TRY(set_last_index(vm, *matcher, Value(last_index)));
 
     // 13. Return CreateRegExpStringIterator(matcher, S, global, fullUnicode).
     return RegExpStringIterator::create(realm, matcher, move(string), global, full_unicode);
@@ -656,8 +810,7 @@ JS_DEFINE_NATIVE_FUNCTION(RegExpPrototype::symbol_replace)
     }
 
     // 7. Let flags be ? ToString(? Get(rx, "flags")).
-    auto flags_value = TRY(regexp_object->get(vm.names.flags));
-    auto flags = TRY(flags_value.to_byte_string(vm));
+    auto flags = TRY(regexp_flags(vm, regexp_object));
 
     // 8. If flags contains "g", let global be true. Otherwise, let global be false.
     bool global = flags.contains('g');
@@ -665,7 +818,7 @@ JS_DEFINE_NATIVE_FUNCTION(RegExpPrototype::symbol_replace)
     // 9. If global is true, then
     if (global) {
         // a. Perform ? Set(rx, "lastIndex", +0𝔽, true).
-        TRY(regexp_object->set(vm.names.lastIndex, Value(0), Object::ShouldThrowExceptions::Yes));
+        TRY(set_last_index(vm, *regexp_object, Value(0)));
     }
 
     // 10. Let results be a new empty List.
@@ -830,24 +983,24 @@ JS_DEFINE_NATIVE_FUNCTION(RegExpPrototype::symbol_search)
     auto string = TRY(vm.argument(0).to_utf16_string(vm));
 
     // 4. Let previousLastIndex be ? Get(rx, "lastIndex").
-    auto previous_last_index = TRY(regexp_object->get(vm.names.lastIndex));
+    auto previous_last_index = TRY(get_last_index(vm, *regexp_object));
 
     // 5. If SameValue(previousLastIndex, +0𝔽) is false, then
     if (!same_value(previous_last_index, Value(0))) {
         // a. Perform ? Set(rx, "lastIndex", +0𝔽, true).
-        TRY(regexp_object->set(vm.names.lastIndex, Value(0), Object::ShouldThrowExceptions::Yes));
+        TRY(set_last_index(vm, *regexp_object, Value(0)));
     }
 
     // 6. Let result be ? RegExpExec(rx, S).
     auto result = TRY(regexp_exec(vm, regexp_object, move(string)));
 
     // 7. Let currentLastIndex be ? Get(rx, "lastIndex").
-    auto current_last_index = TRY(regexp_object->get(vm.names.lastIndex));
+    auto current_last_index = TRY(get_last_index(vm, *regexp_object));
 
     // 8. If SameValue(currentLastIndex, previousLastIndex) is false, then
     if (!same_value(current_last_index, previous_last_index)) {
         // a. Perform ? Set(rx, "lastIndex", previousLastIndex, true).
-        TRY(regexp_object->set(vm.names.lastIndex, previous_last_index, Object::ShouldThrowExceptions::Yes));
+        TRY(set_last_index(vm, *regexp_object, previous_last_index));
     }
 
     // 9. If result is null, return -1𝔽.
@@ -900,8 +1053,7 @@ JS_DEFINE_NATIVE_FUNCTION(RegExpPrototype::symbol_split)
     auto* constructor = TRY(species_constructor(vm, regexp_object, realm.intrinsics().regexp_constructor()));
 
     // 5. Let flags be ? ToString(? Get(rx, "flags")).
-    auto flags_value = TRY(regexp_object->get(vm.names.flags));
-    auto flags = TRY(flags_value.to_byte_string(vm));
+    auto flags = TRY(regexp_flags(vm, regexp_object));
 
     // 6. If flags contains "u" or flags contains "v", let unicodeMatching be true.
     // 7. Else, let unicodeMatching be false.
@@ -956,7 +1108,7 @@ JS_DEFINE_NATIVE_FUNCTION(RegExpPrototype::symbol_split)
     // 19. Repeat, while q < size,
     while (next_search_from < string.length_in_code_units()) {
         // a. Perform ? Set(splitter, "lastIndex", 𝔽(q), SplitBehavior::KeepEmpty).
-        TRY(splitter->set(vm.names.lastIndex, Value(next_search_from), Object::ShouldThrowExceptions::Yes));
+        TRY(set_last_index(vm, *splitter, Value(next_search_from)));
 
         // b. Let z be ? RegExpExec(splitter, S).
         auto result = TRY(regexp_exec(vm, splitter, string));
@@ -970,7 +1122,7 @@ JS_DEFINE_NATIVE_FUNCTION(RegExpPrototype::symbol_split)
         // d. Else,
 
         // i. Let e be ℝ(? ToLength(? Get(splitter, "lastIndex"))).
-        auto last_index_value = TRY(splitter->get(vm.names.lastIndex));
+        auto last_index_value = TRY(get_last_index(vm, *splitter));
         auto last_index = TRY(last_index_value.to_length(vm));
 
         // ii. Set e to min(e, size).
@@ -985,10 +1137,10 @@ JS_DEFINE_NATIVE_FUNCTION(RegExpPrototype::symbol_split)
         // iv. Else,
 
         // 1. Let T be the substring of S from p to q.
-        auto substring = string.substring_view(last_match_end, next_search_from - last_match_end);
+        auto substring = string.substring(last_match_end, next_search_from - last_match_end);
 
         // 2. Perform ! CreateDataPropertyOrThrow(A, ! ToString(𝔽(lengthA)), T).
-        MUST(array->create_data_property_or_throw(array_length, PrimitiveString::create(vm, Utf16String::create(substring))));
+        MUST(array->create_data_property_or_throw(array_length, PrimitiveString::create(vm, move(substring))));
 
         // 3. Set lengthA to lengthA + 1.
         ++array_length;
@@ -1031,10 +1183,10 @@ JS_DEFINE_NATIVE_FUNCTION(RegExpPrototype::symbol_split)
     }
 
     // 20. Let T be the substring of S from p to size.
-    auto substring = string.substring_view(last_match_end);
+    auto substring = string.substring(last_match_end);
 
     // 21. Perform ! CreateDataPropertyOrThrow(A, ! ToString(𝔽(lengthA)), T).
-    MUST(array->create_data_property_or_throw(array_length, PrimitiveString::create(vm, Utf16String::create(substring))));
+    MUST(array->create_data_property_or_throw(array_length, PrimitiveString::create(vm, move(substring))));
 
     // 22. Return A.
     return array;
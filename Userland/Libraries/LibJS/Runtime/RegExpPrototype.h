@@ -23,9 +23,37 @@ public:
     virtual void initialize(Realm&) override;
     virtual ~RegExpPrototype() override = default;
 
+    // Every RegExp object inheriting from this prototype starts out with the same shape, in which "lastIndex" is its
+    // only own property. As long as an object keeps that shape, it has not shadowed any of our properties.
+    // NOTE: This is called for each new RegExp object, only the first call records the shape.
+    void set_initial_instance_shape(Shape&);
+    bool has_initial_instance_shape(Object const& object) const { return &object.shape() == m_initial_instance_shape; }
+    u32 initial_instance_last_index_offset() const { return m_initial_instance_last_index_offset; }
+
+    // These tell whether looking up the given properties on this prototype would still find the built-in functions.
+    bool has_builtin_exec();
+    bool has_builtin_flags();
+
 private:
     explicit RegExpPrototype(Realm&);
 
+    virtual void visit_edges(Visitor&) override;
+
+    struct BuiltinProperty {
+        PropertyKey key;
+        GCPtr<FunctionObject> function;
+        bool is_accessor { false };
+        Optional<u32> offset;
+    };
+    bool has_builtin_property(BuiltinProperty&);
+
+    GCPtr<Shape> m_initial_instance_shape;
+    u32 m_initial_instance_last_index_offset { 0 };
+
+    // NOTE: The first entry is "exec", followed by the "flags" accessor and the accessors for each individual flag.
+    Vector<BuiltinProperty> m_builtin_properties;
+    GCPtr<Shape> m_builtin_property_offsets_shape;
+
     JS_DECLARE_NATIVE_FUNCTION(exec);
     JS_DECLARE_NATIVE_FUNCTION(flags);
     JS_DECLARE_NATIVE_FUNCTION(symbol_match);
@@ -114,7 +114,7 @@ JS_DEFINE_NATIVE_FUNCTION(SharedArrayBufferPrototype::slice)
         return vm.throw_completion<TypeError>(ErrorType::NotASharedArrayBuffer);
 
     // 18. If new.[[ArrayBufferData]] is O.[[ArrayBufferData]], throw a TypeError exception.
-    if (new_array_buffer == array_buffer_object)
+    if (new_array_buffer_object->bytes().data() == array_buffer_object->bytes().data())
         return vm.throw_completion<TypeError>(ErrorType::SpeciesConstructorReturned, "same ArrayBuffer instance");
 
     // 19. If new.[[ArrayBufferByteLength]] < newLen, throw a TypeError exception.
@@ -122,10 +122,10 @@ JS_DEFINE_NATIVE_FUNCTION(SharedArrayBufferPrototype::slice)
         return vm.throw_completion<TypeError>(ErrorType::SpeciesConstructorReturned, "an ArrayBuffer smaller than requested");
 
     // 20. Let fromBuf be O.[[ArrayBufferData]].
-    auto& from_buf = array_buffer_object->buffer();
+    auto from_buf = array_buffer_object->bytes();
 
     // 21. Let toBuf be new.[[ArrayBufferData]].
-    auto& to_buf = new_array_buffer_object->buffer();
+    auto to_buf = new_array_buffer_object->bytes();
 
     // 22. Perform CopyDataBlockBytes(toBuf, 0, fromBuf, first, newLen).
     copy_data_block_bytes(to_buf, 0, from_buf, first, new_length);
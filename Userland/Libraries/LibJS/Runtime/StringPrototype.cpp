@@ -562,11 +562,16 @@ JS_DEFINE_NATIVE_FUNCTION(StringPrototype::locale_compare)
     // 3. Let thatValue be ? ToString(that).
     auto that_value = TRY(vm.argument(0).to_string(vm));
 
+    auto locales = vm.argument(1);
+    auto options = vm.argument(2);
+
     // 4. Let collator be ? Construct(%Collator%, « locales, options »).
-    auto collator = TRY(construct(vm, realm.intrinsics().intl_collator_constructor(), vm.argument(1), vm.argument(2)));
+    auto collator = TRY(Intl::cached_formatter<Intl::Collator>(vm, "Collator"sv, locales, options, [&]() -> ThrowCompletionOr<NonnullGCPtr<Intl::Collator>> {
+        return static_cast<Intl::Collator&>(*TRY(construct(vm, realm.intrinsics().intl_collator_constructor(), locales, options)));
+    }));
 
     // 5. Return CompareStrings(collator, S, thatValue).
-    return Intl::compare_strings(static_cast<Intl::Collator&>(*collator), string.code_points(), that_value.code_points());
+    return Intl::compare_strings(collator, string.code_points(), that_value.code_points());
 }
 
 // 22.1.3.13 String.prototype.match ( regexp ), https://tc39.es/ecma262/#sec-string.prototype.match
@@ -1056,7 +1061,7 @@ JS_DEFINE_NATIVE_FUNCTION(StringPrototype::slice)
         return PrimitiveString::create(vm, String {});
 
     // 13. Return the substring of S from from to to.
-    return PrimitiveString::create(vm, Utf16String::create(string.substring_view(int_start, int_end - int_start)));
+    return PrimitiveString::create(vm, string.substring(int_start, int_end - int_start));
 }
 
 // 22.1.3.23 String.prototype.split ( separator, limit ), https://tc39.es/ecma262/#sec-string.prototype.split
@@ -1134,10 +1139,10 @@ JS_DEFINE_NATIVE_FUNCTION(StringPrototype::split)
             ++position;
             continue;
         }
-        auto segment = string.substring_view(start, position - start);
+        auto segment = string.substring(start, position - start);
 
         // b. Append T to substrings.
-        MUST(array->create_data_property_or_throw(array_length, PrimitiveString::create(vm, Utf16String::create(segment))));
+        MUST(array->create_data_property_or_throw(array_length, PrimitiveString::create(vm, move(segment))));
         ++array_length;
 
         // c. If the number of elements in substrings is lim, return CreateArrayFromList(substrings).
@@ -1152,10 +1157,10 @@ JS_DEFINE_NATIVE_FUNCTION(StringPrototype::split)
     }
 
     // 15. Let T be the substring of S from i.
-    auto rest = string.substring_view(start);
+    auto rest = string.substring(start);
 
     // 16. Append T to substrings.
-    MUST(array->create_data_property_or_throw(array_length, PrimitiveString::create(vm, Utf16String::create(rest))));
+    MUST(array->create_data_property_or_throw(array_length, PrimitiveString::create(vm, move(rest))));
 
     // 17. Return CreateArrayFromList(substrings).
     return array;
@@ -1247,7 +1252,7 @@ JS_DEFINE_NATIVE_FUNCTION(StringPrototype::substring)
     size_t to = max(final_start, final_end);
 
     // 10. Return the substring of S from from to to.
-    return PrimitiveString::create(vm, Utf16String::create(string.substring_view(from, to - from)));
+    return PrimitiveString::create(vm, string.substring(from, to - from));
 }
 
 enum class TargetCase {
@@ -1429,7 +1434,16 @@ ThrowCompletionOr<String> trim_string(VM& vm, Value input_value, TrimMode where)
     auto trimmed_string = Utf8View(string).trim(whitespace_characters, where).as_string();
 
     // 6. Return T.
-    return MUST(String::from_utf8(trimmed_string));
+    // OPTIMIZATION: T only differs from S by the white space removed from its ends, so we share S's bytes instead of copying
+    //               them, as long as that does not keep a much larger S alive.
+    auto string_bytes = string.bytes_as_string_view();
+    if (trimmed_string.length() == string_bytes.length())
+        return string;
+    if (!should_share_superstring(string_bytes.length(), trimmed_string.length()))
+        return MUST(String::from_utf8(trimmed_string));
+
+    auto offset = static_cast<size_t>(trimmed_string.characters_without_null_termination() - string_bytes.characters_without_null_termination());
+    return MUST(string.substring_from_byte_offset_with_shared_superstring(offset, trimmed_string.length()));
 }
 
 // 22.1.3.32 String.prototype.trim ( ), https://tc39.es/ecma262/#sec-string.prototype.trim
@@ -1516,7 +1530,7 @@ JS_DEFINE_NATIVE_FUNCTION(StringPrototype::substr)
         return PrimitiveString::create(vm, String {});
 
     // 11. Return the substring of S from intStart to intEnd.
-    return PrimitiveString::create(vm, Utf16String::create(string.substring_view(int_start, int_end - int_start)));
+    return PrimitiveString::create(vm, string.substring(int_start, int_end - int_start));
 }
 
 // B.2.2.2.1 CreateHTML ( string, tag, attribute, value ), https://tc39.es/ecma262/#sec-createhtml
@@ -459,7 +459,7 @@ public:
         }
 
         auto length = typed_array_length(typed_array_record);
-        return { reinterpret_cast<UnderlyingBufferDataType const*>(m_viewed_array_buffer->buffer().data() + m_byte_offset), length };
+        return { reinterpret_cast<UnderlyingBufferDataType const*>(m_viewed_array_buffer->bytes().data() + m_byte_offset), length };
     }
 
     Span<UnderlyingBufferDataType> data()
@@ -472,7 +472,7 @@ public:
         }
 
         auto length = typed_array_length(typed_array_record);
-        return { reinterpret_cast<UnderlyingBufferDataType*>(m_viewed_array_buffer->buffer().data() + m_byte_offset), length };
+        return { reinterpret_cast<UnderlyingBufferDataType*>(m_viewed_array_buffer->bytes().data() + m_byte_offset), length };
     }
 
     bool is_unclamped_integer_element_type() const override
@@ -6,6 +6,8 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/BitCast.h>
+#include <AK/QuickSort.h>
 #include <AK/TypeCasts.h>
 #include <LibJS/Runtime/AbstractOperations.h>
 #include <LibJS/Runtime/Array.h>
@@ -358,15 +360,17 @@ JS_DEFINE_NATIVE_FUNCTION(TypedArrayPrototype::copy_within)
             return typed_array;
         }
 
-        i8 direction;
+        // OPTIMIZATION: Steps l. through n. copy one byte at a time, in whichever direction handles overlapping ranges
+        //               correctly, and stop as soon as either index reaches bufferByteLimit. We determine how many bytes
+        //               that loop would copy up front, and copy them all at once with memmove().
+        size_t bytes_to_copy = 0;
 
         // l. If fromByteIndex < toByteIndex and toByteIndex < fromByteIndex + countBytes, then
         if (from_byte_index < to_byte_index && to_byte_index < from_plus_count.value()) {
             // i. Let direction be -1.
-            direction = -1;
             // ii. Set fromByteIndex to fromByteIndex + countBytes - 1.
-            from_byte_index = from_plus_count.value() - 1;
-
+            // iii. Set toByteIndex to toByteIndex + countBytes - 1.
+            // NOTE: As we're copying backwards from the last byte, either every byte is copied, or none are.
             Checked<size_t> to_plus_count = to_byte_index;
             to_plus_count += count_bytes;
             if (to_plus_count.has_overflow()) {
@@ -374,39 +378,28 @@ JS_DEFINE_NATIVE_FUNCTION(TypedArrayPrototype::copy_within)
                 return typed_array;
             }
 
-            // iii. Set toByteIndex to toByteIndex + countBytes - 1.
-            to_byte_index = to_plus_count.value() - 1;
+            if (from_plus_count.value() <= buffer_byte_limit && to_plus_count.value() <= buffer_byte_limit)
+                bytes_to_copy = count_bytes;
         }
         // m. Else,
         else {
             // i. Let direction be 1.
-            direction = 1;
+            if (from_byte_index < buffer_byte_limit && to_byte_index < buffer_byte_limit)
+                bytes_to_copy = min(count_bytes, min(buffer_byte_limit - from_byte_index, buffer_byte_limit - to_byte_index));
         }
 
         // n. Repeat, while countBytes > 0,
-        while (count_bytes > 0) {
-            // i. If fromByteIndex < bufferByteLimit and toByteIndex < bufferByteLimit, then
-            if (from_byte_index < buffer_byte_limit && to_byte_index < buffer_byte_limit) {
-                // 1. Let value be GetValueFromBuffer(buffer, fromByteIndex, uint8, true, unordered).
-                auto value = buffer->get_value<u8>(from_byte_index, true, ArrayBuffer::Order::Unordered);
-
-                // 2. Perform SetValueInBuffer(buffer, toByteIndex, uint8, value, true, unordered).
-                buffer->set_value<u8>(to_byte_index, value, true, ArrayBuffer::Order::Unordered);
-
-                // 3. Set fromByteIndex to fromByteIndex + direction.
-                from_byte_index += direction;
-
-                // 4. Set toByteIndex to toByteIndex + direction.
-                to_byte_index += direction;
-
-                // 5. Set countBytes to countBytes - 1.
-                --count_bytes;
-            }
-            // ii. Else,
-            else {
-                // 1. Set countBytes to 0.
-                count_bytes = 0;
-            }
+        //     i. If fromByteIndex < bufferByteLimit and toByteIndex < bufferByteLimit, then
+        //         1. Let value be GetValueFromBuffer(buffer, fromByteIndex, uint8, true, unordered).
+        //         2. Perform SetValueInBuffer(buffer, toByteIndex, uint8, value, true, unordered).
+        //         3. Set fromByteIndex to fromByteIndex + direction.
+        //         4. Set toByteIndex to toByteIndex + direction.
+        //         5. Set countBytes to countBytes - 1.
+        //     ii. Else,
+        //         1. Set countBytes to 0.
+        if (bytes_to_copy > 0) {
+            auto bytes = buffer->bytes();
+            memmove(bytes.offset_pointer(to_byte_index), bytes.offset_pointer(from_byte_index), bytes_to_copy);
         }
     }
 
@@ -469,32 +462,33 @@ JS_DEFINE_NATIVE_FUNCTION(TypedArrayPrototype::every)
     return true;
 }
 
-// NOTE: This function assumes that the index is valid within the TypedArray,
-//       and that the TypedArray is not detached.
-template<typename T>
-inline void fast_typed_array_fill(TypedArrayBase& typed_array, u32 begin, u32 end, T value)
+// NOTE: This function assumes that the range is valid within the TypedArray, that the TypedArray is not detached,
+//       and that the element at index begin has already been set to the fill value.
+static void fast_typed_array_fill_from_first_element(TypedArrayBase& typed_array, u32 begin, u32 end)
 {
+    auto element_size = typed_array.element_size();
+
     Checked<size_t> computed_begin = begin;
-    computed_begin *= sizeof(T);
+    computed_begin *= element_size;
     computed_begin += typed_array.byte_offset();
 
     Checked<size_t> computed_end = end;
-    computed_end *= sizeof(T);
+    computed_end *= element_size;
     computed_end += typed_array.byte_offset();
 
     if (computed_begin.has_overflow() || computed_end.has_overflow()) [[unlikely]] {
         return;
     }
 
-    if (computed_begin.value() >= typed_array.viewed_array_buffer()->byte_length()
-        || computed_end.value() > typed_array.viewed_array_buffer()->byte_length()) [[unlikely]] {
+    auto bytes = typed_array.viewed_array_buffer()->bytes();
+    if (computed_begin.value() >= bytes.size() || computed_end.value() > bytes.size()) [[unlikely]] {
         return;
     }
 
-    auto& array_buffer = *typed_array.viewed_array_buffer();
-    auto* slot = reinterpret_cast<T*>(array_buffer.buffer().offset_pointer(computed_begin.value()));
-    for (auto i = begin; i < end; ++i)
-        *(slot++) = value;
+    // Keep doubling the filled region by copying it into the rest of the range.
+    auto range = bytes.slice(computed_begin.value(), computed_end.value() - computed_begin.value());
+    for (size_t filled = element_size; filled < range.size(); filled *= 2)
+        range.slice(0, min(filled, range.size() - filled)).copy_to(range.slice(filled));
 }
 
 // 23.2.3.9 %TypedArray%.prototype.fill ( value [ , start [ , end ] ] ), https://tc39.es/ecma262/#sec-%typedarray%.prototype.fill
@@ -565,39 +559,13 @@ JS_DEFINE_NATIVE_FUNCTION(TypedArrayPrototype::fill)
     // 17. Set final to min(final, len).
     final = min(final, length);
 
-    if (value.is_int32()) {
-        switch (typed_array->kind()) {
-        case TypedArrayBase::Kind::Uint8Array:
-            fast_typed_array_fill<u8>(*typed_array, k, final, static_cast<u8>(value.as_i32()));
-            return typed_array;
-        case TypedArrayBase::Kind::Uint16Array:
-            fast_typed_array_fill<u16>(*typed_array, k, final, static_cast<u16>(value.as_i32()));
-            return typed_array;
-        case TypedArrayBase::Kind::Uint32Array:
-            fast_typed_array_fill<u32>(*typed_array, k, final, static_cast<u32>(value.as_i32()));
-            return typed_array;
-        case TypedArrayBase::Kind::Int8Array:
-            fast_typed_array_fill<i8>(*typed_array, k, final, static_cast<i8>(value.as_i32()));
-            return typed_array;
-        case TypedArrayBase::Kind::Int16Array:
-            fast_typed_array_fill<i16>(*typed_array, k, final, static_cast<i16>(value.as_i32()));
-            return typed_array;
-        case TypedArrayBase::Kind::Int32Array:
-            fast_typed_array_fill<i32>(*typed_array, k, final, value.as_i32());
-            return typed_array;
-        case TypedArrayBase::Kind::Uint8ClampedArray:
-            fast_typed_array_fill<u8>(*typed_array, k, final, clamp(value.as_i32(), 0, 255));
-            return typed_array;
-        default:
-            // FIXME: Support more TypedArray kinds.
-            break;
-        }
-    }
-
     // 18. Repeat, while k < final,
-    while (k < final) {
-        // a. Let Pk be ! ToString(𝔽(k)).
-        // b. Perform ! Set(O, Pk, value, true).
+    //     a. Let Pk be ! ToString(𝔽(k)).
+    //     b. Perform ! Set(O, Pk, value, true).
+    //     c. Set k to k + 1.
+    // OPTIMIZATION: Every element gets the same bit pattern, so we only set the first element (which converts the
+    //               value to the element type), and then copy the resulting bytes into the rest of the range.
+    if (k < final) {
         CanonicalIndex canonical_index { CanonicalIndex::Type::Index, k };
         switch (typed_array->kind()) {
 #define __JS_ENUMERATE(ClassName, snake_name, PrototypeName, ConstructorName, Type) \
@@ -608,8 +576,7 @@ JS_DEFINE_NATIVE_FUNCTION(TypedArrayPrototype::fill)
 #undef __JS_ENUMERATE
         }
 
-        // c. Set k to k + 1.
-        ++k;
+        fast_typed_array_fill_from_first_element(*typed_array, k, final);
     }
 
     // 19. Return O.
@@ -934,6 +901,79 @@ JS_DEFINE_NATIVE_FUNCTION(TypedArrayPrototype::includes)
     return Value { false };
 }
 
+template<typename T>
+static Value fast_typed_array_index_of(ReadonlyBytes bytes, T search_element, u32 k, u32 length)
+{
+    auto const* elements = reinterpret_cast<T const*>(bytes.data());
+
+    for (; k < length; ++k) {
+        if (elements[k] == search_element)
+            return Value { k };
+    }
+
+    return Value { -1 };
+}
+
+// NOTE: Returns an empty Optional if the fast path does not apply, in which case the caller must perform the generic steps.
+static Optional<Value> fast_typed_array_index_of(TypedArrayBase& typed_array, Value search_element, u32 k, u32 length)
+{
+    if (typed_array.content_type() != TypedArrayBase::ContentType::Number)
+        return {};
+
+    // Elements that are no longer present are skipped by the generic steps, so take into account any changes to the
+    // underlying buffer made while converting fromIndex.
+    auto typed_array_record = make_typed_array_with_buffer_witness_record(typed_array, ArrayBuffer::Order::SeqCst);
+    if (is_typed_array_out_of_bounds(typed_array_record))
+        return Value { -1 };
+
+    length = min(length, typed_array_length(typed_array_record));
+    if (k >= length)
+        return Value { -1 };
+
+    // IsStrictlyEqual() is false for anything that isn't a Number, and for NaN.
+    if (!search_element.is_number() || search_element.is_nan())
+        return Value { -1 };
+
+    auto search_number = search_element.as_double();
+    auto bytes = typed_array.viewed_array_buffer()->bytes().slice(typed_array.byte_offset());
+
+    // Only look for values that are representable by the element type, as no element can be equal to anything else.
+    auto search_as = [&]<typename T>() -> Value {
+        if constexpr (IsFloatingPoint<T>) {
+            auto value = static_cast<T>(search_number);
+            if (static_cast<double>(value) != search_number)
+                return Value { -1 };
+            return fast_typed_array_index_of<T>(bytes, value, k, length);
+        } else {
+            if (!AK::is_within_range<T>(search_number) || trunc(search_number) != search_number)
+                return Value { -1 };
+            return fast_typed_array_index_of<T>(bytes, static_cast<T>(search_number), k, length);
+        }
+    };
+
+    switch (typed_array.kind()) {
+    case TypedArrayBase::Kind::Uint8Array:
+    case TypedArrayBase::Kind::Uint8ClampedArray:
+        return search_as.operator()<u8>();
+    case TypedArrayBase::Kind::Uint16Array:
+        return search_as.operator()<u16>();
+    case TypedArrayBase::Kind::Uint32Array:
+        return search_as.operator()<u32>();
+    case TypedArrayBase::Kind::Int8Array:
+        return search_as.operator()<i8>();
+    case TypedArrayBase::Kind::Int16Array:
+        return search_as.operator()<i16>();
+    case TypedArrayBase::Kind::Int32Array:
+        return search_as.operator()<i32>();
+    case TypedArrayBase::Kind::Float32Array:
+        return search_as.operator()<float>();
+    case TypedArrayBase::Kind::Float64Array:
+        return search_as.operator()<double>();
+    default:
+        return {};
+    }
+}
+
 // 23.2.3.17 %TypedArray%.prototype.indexOf ( searchElement [ , fromIndex ] ), https://tc39.es/ecma262/#sec-%typedarray%.prototype.indexof
 JS_DEFINE_NATIVE_FUNCTION(TypedArrayPrototype::index_of)
 {
@@ -986,6 +1026,11 @@ JS_DEFINE_NATIVE_FUNCTION(TypedArrayPrototype::index_of)
         k = relative_k;
     }
 
+    // OPTIMIZATION: Neither HasProperty nor Get have side effects on a TypedArray, so for numeric element types we can
+    //               scan the underlying buffer directly instead.
+    if (auto result = fast_typed_array_index_of(*typed_array, search_element, k, length); result.has_value())
+        return *result;
+
     // 11. Repeat, while k < len,
     while (k < length) {
         // a. Let kPresent be ! HasProperty(O, ! ToString(𝔽(k))).
@@ -1444,13 +1489,17 @@ static ThrowCompletionOr<void> set_typed_array_from_typed_array(VM& vm, TypedArr
     auto same_shared_array_buffer = false;
 
     // 18. If IsSharedArrayBuffer(srcBuffer) is true, IsSharedArrayBuffer(targetBuffer) is true, and srcBuffer.[[ArrayBufferData]] is targetBuffer.[[ArrayBufferData]], let sameSharedArrayBuffer be true; otherwise, let sameSharedArrayBuffer be false.
-    if (source_buffer->is_shared_array_buffer() && target_buffer->is_shared_array_buffer() && (&source_buffer->buffer() == &target_buffer->buffer()))
+    if (source_buffer->is_shared_array_buffer() && target_buffer->is_shared_array_buffer() && (source_buffer->bytes().data() == target_buffer->bytes().data()))
         same_shared_array_buffer = true;
 
     size_t source_byte_index = 0;
 
+    // OPTIMIZATION: When both element types are the same, the data is transferred byte for byte in step 23, which uses
+    //               memmove() and thus handles overlapping ranges correctly without cloning the source buffer first.
+    auto element_types_match = source.element_name() == target.element_name();
+
     // 19. If SameValue(srcBuffer, targetBuffer) is true or sameSharedArrayBuffer is true, then
-    if (same_shared_array_buffer || same_value(source_buffer, target_buffer)) {
+    if (!element_types_match && (same_shared_array_buffer || same_value(source_buffer, target_buffer))) {
         // a. Let srcByteLength be TypedArrayByteLength(srcRecord).
         auto source_byte_length = typed_array_byte_length(source_record);
 
@@ -1483,14 +1532,14 @@ static ThrowCompletionOr<void> set_typed_array_from_typed_array(VM& vm, TypedArr
     auto limit = checked_limit.value();
 
     // 23. If srcType is targetType, then
-    if (source.element_name() == target.element_name()) {
+    if (element_types_match) {
         // a. NOTE: The transfer must be performed in a manner that preserves the bit-level encoding of the source data.
         // b. Repeat, while targetByteIndex < limit,
         //     i. Let value be GetValueFromBuffer(srcBuffer, srcByteIndex, Uint8, true, Unordered).
         //     ii. Perform SetValueInBuffer(targetBuffer, targetByteIndex, Uint8, value, true, Unordered).
         //     iii. Set srcByteIndex to srcByteIndex + 1.
         //     iv. Set targetByteIndex to targetByteIndex + 1.
-        target_buffer->buffer().overwrite(target_byte_index, source_buffer->buffer().data() + source_byte_index, limit - target_byte_index);
+        source_buffer->bytes().slice(source_byte_index, limit - target_byte_index).copy_to(target_buffer->bytes().slice(target_byte_index));
     }
     // 24. Else,
     else {
@@ -1806,6 +1855,97 @@ JS_DEFINE_NATIVE_FUNCTION(TypedArrayPrototype::some)
     return false;
 }
 
+// Sorts numeric elements in the order of CompareTypedArrayElements(x, y, undefined): ascending, with -0 before +0, and NaN last.
+// The elements are mapped to unsigned keys whose natural order matches that, which are then sorted with an LSD radix sort.
+template<typename T>
+static void sort_typed_array_elements(Span<T> elements)
+{
+    using Key = Conditional<sizeof(T) == 1, u8, Conditional<sizeof(T) == 2, u16, Conditional<sizeof(T) == 4, u32, u64>>>;
+    static constexpr Key sign_bit = static_cast<Key>(1) << (sizeof(Key) * 8 - 1);
+
+    auto to_key = [](T value) -> Key {
+        if constexpr (IsFloatingPoint<T>) {
+            // All NaNs are equal (and go last), so make sure they all have the same positive bit pattern.
+            if (isnan(value))
+                value = static_cast<T>(NAN);
+
+            auto bits = bit_cast<Key>(value);
+            return (bits & sign_bit) ? ~bits : (bits | sign_bit);
+        } else if constexpr (IsSigned<T>) {
+            return bit_cast<Key>(value) ^ sign_bit;
+        } else {
+            return value;
+        }
+    };
+
+    auto from_key = [](Key key) -> T {
+        if constexpr (IsFloatingPoint<T>)
+            return bit_cast<T>((key & sign_bit) ? (key & ~sign_bit) : ~key);
+        else if constexpr (IsSigned<T>)
+            return bit_cast<T>(static_cast<Key>(key ^ sign_bit));
+        else
+            return key;
+    };
+
+    Vector<Key> keys;
+    keys.ensure_capacity(elements.size());
+    for (auto element : elements)
+        keys.unchecked_append(to_key(element));
+
+    // For short arrays, the fixed cost of the radix sort passes isn't worth it.
+    static constexpr size_t radix_sort_threshold = 256;
+
+    if (keys.size() < radix_sort_threshold) {
+        quick_sort(keys);
+    } else {
+        Vector<Key> scratch;
+        scratch.resize(keys.size());
+
+        for (size_t shift = 0; shift < sizeof(Key) * 8; shift += 8) {
+            AK::Array<size_t, 256> counts {};
+            for (auto key : keys)
+                ++counts[(key >> shift) & 0xff];
+
+            // Skip passes where every key has the same byte, they wouldn't change the order.
+            if (counts[(keys[0] >> shift) & 0xff] == keys.size())
+                continue;
+
+            size_t offset = 0;
+            for (auto& count : counts) {
+                auto bucket_size = count;
+                count = offset;
+                offset += bucket_size;
+            }
+
+            for (auto key : keys)
+                scratch[counts[(key >> shift) & 0xff]++] = key;
+
+            swap(keys, scratch);
+        }
+    }
+
+    for (size_t i = 0; i < elements.size(); ++i)
+        elements[i] = from_key(keys[i]);
+}
+
+// NOTE: This function assumes that the first length elements are valid within the TypedArray, and that the TypedArray
+//       is not detached.
+static void sort_typed_array_with_default_comparator(TypedArrayBase& typed_array, u32 length)
+{
+    auto* data = typed_array.viewed_array_buffer()->bytes().offset_pointer(typed_array.byte_offset());
+
+    switch (typed_array.kind()) {
+#define __JS_ENUMERATE(ClassName, snake_name, PrototypeName, ConstructorName, Type)                    \
+    case TypedArrayBase::Kind::ClassName: {                                                            \
+        using ElementType = Conditional<IsSame<Type, ClampedU8>, u8, Type>;                            \
+        sort_typed_array_elements(Span<ElementType> { reinterpret_cast<ElementType*>(data), length }); \
+        break;                                                                                         \
+    }                                                                                                  \
+        JS_ENUMERATE_TYPED_ARRAYS
+#undef __JS_ENUMERATE
+    }
+}
+
 // 23.2.3.29 %TypedArray%.prototype.sort ( comparefn ), https://tc39.es/ecma262/#sec-%typedarray%.prototype.sort
 JS_DEFINE_NATIVE_FUNCTION(TypedArrayPrototype::sort)
 {
@@ -1824,6 +1964,13 @@ JS_DEFINE_NATIVE_FUNCTION(TypedArrayPrototype::sort)
     // 4. Let len be TypedArrayLength(taRecord).
     auto length = typed_array_length(typed_array_record);
 
+    // OPTIMIZATION: Without a comparefn, no user code can run while sorting, and the elements are compared numerically.
+    //               As equal elements are indistinguishable from each other, we can sort the buffer directly.
+    if (compare_function.is_undefined()) {
+        sort_typed_array_with_default_comparator(*typed_array, length);
+        return typed_array;
+    }
+
     // 5. NOTE: The following closure performs a numeric comparison rather than the string comparison used in 23.1.3.30.
     // 6. Let SortCompare be a new Abstract Closure with parameters (x, y) that captures comparefn and performs the following steps when called:
     Function<ThrowCompletionOr<double>(Value, Value)> sort_compare = [&](auto x, auto y) -> ThrowCompletionOr<double> {
@@ -2062,6 +2209,15 @@ JS_DEFINE_NATIVE_FUNCTION(TypedArrayPrototype::to_sorted)
     arguments.empend(length);
     auto* array = TRY(typed_array_create_same_type(vm, *typed_array, move(arguments)));
 
+    // OPTIMIZATION: Without a comparefn, no user code can run while sorting, and the elements are compared numerically.
+    //               As equal elements are indistinguishable from each other, we can copy them to A and sort that directly.
+    if (compare_function.is_undefined()) {
+        auto byte_length = length * typed_array->element_size();
+        typed_array->viewed_array_buffer()->bytes().slice(typed_array->byte_offset(), byte_length).copy_to(array->viewed_array_buffer()->bytes().slice(array->byte_offset(), byte_length));
+        sort_typed_array_with_default_comparator(*array, length);
+        return array;
+    }
+
     // 6. NOTE: The following closure performs a numeric comparison rather than the string comparison used in 23.1.3.34.
     Function<ThrowCompletionOr<double>(Value, Value)> sort_compare = [&](auto x, auto y) -> ThrowCompletionOr<double> {
         // a. Return ? CompareTypedArrayElements(x, y, comparefn).
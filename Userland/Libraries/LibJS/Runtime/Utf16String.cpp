@@ -45,13 +45,23 @@ NonnullRefPtr<Utf16StringImpl> Utf16StringImpl::create(Utf16View const& view)
     return create(move(string));
 }
 
-Utf16Data const& Utf16StringImpl::string() const
+Utf16StringImpl::Utf16StringImpl(NonnullRefPtr<Utf16StringImpl> superstring, size_t code_unit_offset, size_t code_unit_length)
+    : m_superstring(move(superstring))
+    , m_code_unit_offset(code_unit_offset)
+    , m_code_unit_length(code_unit_length)
 {
-    return m_string;
+    VERIFY(!m_superstring->is_substring());
+}
+
+NonnullRefPtr<Utf16StringImpl> Utf16StringImpl::create_substring(NonnullRefPtr<Utf16StringImpl> superstring, size_t code_unit_offset, size_t code_unit_length)
+{
+    return adopt_ref(*new Utf16StringImpl(move(superstring), code_unit_offset, code_unit_length));
 }
 
 Utf16View Utf16StringImpl::view() const
 {
+    if (m_superstring)
+        return m_superstring->view().substring_view(m_code_unit_offset, m_code_unit_length);
     return Utf16View { m_string };
 }
 
@@ -82,11 +92,6 @@ Utf16String::Utf16String(NonnullRefPtr<Detail::Utf16StringImpl> string)
 {
 }
 
-Utf16Data const& Utf16String::string() const
-{
-    return m_string->string();
-}
-
 Utf16View Utf16String::view() const
 {
     return m_string->view();
@@ -102,6 +107,50 @@ Utf16View Utf16String::substring_view(size_t code_unit_offset) const
     return view().substring_view(code_unit_offset);
 }
 
+// Substrings shorter than this are copied, as that is about as cheap as allocating a substring that shares code units.
+static constexpr size_t minimum_shared_substring_length = 16;
+
+// A shared substring keeps its entire superstring alive. To avoid holding on to huge strings through tiny slices of
+// them, we only share code units if the superstring is at most this many times as long as the substring...
+static constexpr size_t maximum_shared_superstring_ratio = 64;
+
+// ...or if the superstring is short enough for it not to matter.
+static constexpr size_t maximum_unconditionally_shared_superstring_length = 64 * KiB;
+
+bool should_share_superstring(size_t superstring_length, size_t substring_length)
+{
+    return substring_length >= minimum_shared_substring_length
+        && (superstring_length <= maximum_unconditionally_shared_superstring_length
+            || superstring_length / substring_length <= maximum_shared_superstring_ratio);
+}
+
+Utf16String Utf16String::substring(size_t code_unit_offset, size_t code_unit_length) const
+{
+    auto length = length_in_code_units();
+    VERIFY(code_unit_offset + code_unit_length <= length);
+
+    if (code_unit_offset == 0 && code_unit_length == length)
+        return *this;
+    if (code_unit_length == 0)
+        return create();
+
+    auto superstring = m_string->superstring();
+    auto superstring_length = superstring->view().length_in_code_units();
+
+    if (!should_share_superstring(superstring_length, code_unit_length))
+        return create(substring_view(code_unit_offset, code_unit_length));
+
+    // NOTE: Substrings of substrings view the original superstring directly, so that no chains are formed.
+    code_unit_offset += m_string->code_unit_offset_in_superstring();
+
+    return Utf16String { Detail::Utf16StringImpl::create_substring(move(superstring), code_unit_offset, code_unit_length) };
+}
+
+Utf16String Utf16String::substring(size_t code_unit_offset) const
+{
+    return substring(code_unit_offset, length_in_code_units() - code_unit_offset);
+}
+
 String Utf16String::to_utf8() const
 {
     return MUST(view().to_utf8(Utf16View::AllowInvalidCodeUnits::Yes));
@@ -25,15 +25,26 @@ public:
     [[nodiscard]] static NonnullRefPtr<Utf16StringImpl> create(Utf16Data);
     [[nodiscard]] static NonnullRefPtr<Utf16StringImpl> create(StringView);
     [[nodiscard]] static NonnullRefPtr<Utf16StringImpl> create(Utf16View const&);
+    [[nodiscard]] static NonnullRefPtr<Utf16StringImpl> create_substring(NonnullRefPtr<Utf16StringImpl>, size_t code_unit_offset, size_t code_unit_length);
 
-    Utf16Data const& string() const;
     Utf16View view() const;
 
+    bool is_substring() const { return m_superstring; }
+    NonnullRefPtr<Utf16StringImpl> superstring() { return m_superstring ? *m_superstring : *this; }
+    size_t code_unit_offset_in_superstring() const { return m_code_unit_offset; }
+
 private:
     Utf16StringImpl() = default;
     explicit Utf16StringImpl(Utf16Data string);
+    Utf16StringImpl(NonnullRefPtr<Utf16StringImpl> superstring, size_t code_unit_offset, size_t code_unit_length);
 
     Utf16Data m_string;
+
+    // NOTE: A substring does not own any code units, it views a range of its superstring's code units instead.
+    //       The superstring is never a substring itself.
+    RefPtr<Utf16StringImpl> m_superstring;
+    size_t m_code_unit_offset { 0 };
+    size_t m_code_unit_length { 0 };
 };
 
 }
@@ -45,11 +56,14 @@ public:
     [[nodiscard]] static Utf16String create(StringView);
     [[nodiscard]] static Utf16String create(Utf16View const&);
 
-    Utf16Data const& string() const;
     Utf16View view() const;
     Utf16View substring_view(size_t code_unit_offset, size_t code_unit_length) const;
     Utf16View substring_view(size_t code_unit_offset) const;
 
+    // Returns the given range of this string. Long enough substrings share this string's code units rather than copying them.
+    [[nodiscard]] Utf16String substring(size_t code_unit_offset, size_t code_unit_length) const;
+    [[nodiscard]] Utf16String substring(size_t code_unit_offset) const;
+
     [[nodiscard]] String to_utf8() const;
     [[nodiscard]] ByteString to_byte_string() const;
     u16 code_unit_at(size_t index) const;
@@ -63,4 +77,8 @@ private:
     NonnullRefPtr<Detail::Utf16StringImpl> m_string;
 };
 
+// Returns whether a substring of the given length should share the storage of its superstring rather than copy it. Both
+// lengths must be given in the same unit, e.g. UTF-16 code units or UTF-8 bytes.
+bool should_share_superstring(size_t superstring_length, size_t substring_length);
+
 }
@@ -28,6 +28,7 @@
 #include <LibJS/Runtime/NativeFunction.h>
 #include <LibJS/Runtime/PromiseCapability.h>
 #include <LibJS/Runtime/Reference.h>
+#include <LibJS/Runtime/RegExpCache.h>
 #include <LibJS/Runtime/Symbol.h>
 #include <LibJS/Runtime/VM.h>
 #include <LibJS/SourceTextModule.h>
@@ -62,7 +63,8 @@ static constexpr auto make_single_ascii_character_strings(IndexSequence<code_poi
 static constexpr auto single_ascii_character_strings = make_single_ascii_character_strings(MakeIndexSequence<128>());
 
 VM::VM(OwnPtr<CustomData> custom_data, ErrorMessages error_messages)
-    : m_heap(*this)
+    : m_regexp_cache(make<RegExpCache>())
+    , m_heap(*this)
     , m_error_messages(move(error_messages))
     , m_custom_data(move(custom_data))
 {
@@ -215,7 +217,13 @@ void VM::gather_roots(HashMap<Cell*, HeapRoot>& roots)
     for (auto& saved_stack : m_saved_execution_context_stacks)
         gather_roots_from_execution_context_stack(saved_stack);
 
-    for (auto& job : m_promise_jobs)
+    // This also covers the values of execution contexts that have been created, but not pushed yet.
+    for (auto value : m_value_stack.values_in_use()) {
+        if (value.is_cell())
+            roots.set(&value.as_cell(), HeapRoot { .type = HeapRoot::Type::VM });
+    }
+
+    for (auto& job : m_promise_jobs.span().slice(m_next_promise_job_index))
         roots.set(job, HeapRoot { .type = HeapRoot::Type::VM });
 }
 
@@ -366,12 +374,17 @@ void VM::run_queued_promise_jobs()
 {
     dbgln_if(PROMISE_DEBUG, "Running queued promise jobs");
 
-    while (!m_promise_jobs.is_empty()) {
-        auto job = m_promise_jobs.take_first();
+    // NOTE: Jobs may enqueue further jobs (or even run this function again), so we must re-check the queue size every
+    //       iteration, and take a copy of the job before running it.
+    while (m_next_promise_job_index < m_promise_jobs.size()) {
+        auto job = m_promise_jobs[m_next_promise_job_index++];
         dbgln_if(PROMISE_DEBUG, "Calling promise job function");
 
         [[maybe_unused]] auto result = job->function()();
     }
+
+    m_promise_jobs.clear_with_capacity();
+    m_next_promise_job_index = 0;
 }
 
 // 9.5.4 HostEnqueuePromiseJob ( job, realm ), https://tc39.es/ecma262/#sec-hostenqueuepromisejob
@@ -26,6 +26,7 @@
 #include <LibJS/Runtime/ExecutionContext.h>
 #include <LibJS/Runtime/Promise.h>
 #include <LibJS/Runtime/Value.h>
+#include <LibJS/Runtime/ValueStack.h>
 
 namespace JS {
 
@@ -75,6 +76,8 @@ public:
         return m_byte_string_cache;
     }
 
+    RegExpCache& regexp_cache() { return *m_regexp_cache; }
+
     PrimitiveString& empty_string() { return *m_empty_string; }
 
     PrimitiveString& single_ascii_character_string(u8 character)
@@ -138,6 +141,8 @@ public:
     Vector<ExecutionContext*> const& execution_context_stack() const { return m_execution_context_stack; }
     Vector<ExecutionContext*>& execution_context_stack() { return m_execution_context_stack; }
 
+    ValueStack& value_stack() { return m_value_stack; }
+
     Environment const* lexical_environment() const { return running_execution_context().lexical_environment; }
     Environment* lexical_environment() { return running_execution_context().lexical_environment; }
 
@@ -249,6 +254,10 @@ public:
 
     void set_dynamic_imports_allowed(bool value) { m_dynamic_imports_allowed = value; }
 
+    // The [[CanBlock]] field of the surrounding agent's Agent Record.
+    bool agent_can_block() const { return m_agent_can_block; }
+    void set_agent_can_block(bool value) { m_agent_can_block = value; }
+
     Function<void(Promise&, Promise::RejectionOperation)> host_promise_rejection_tracker;
     Function<ThrowCompletionOr<Value>(JobCallback&, Value, ReadonlySpan<Value>)> host_call_job_callback;
     Function<void(FinalizationRegistry&)> host_enqueue_finalization_registry_cleanup_job;
@@ -279,10 +288,12 @@ private:
 
     HashMap<String, GCPtr<PrimitiveString>> m_string_cache;
     HashMap<ByteString, GCPtr<PrimitiveString>> m_byte_string_cache;
+    NonnullOwnPtr<RegExpCache> m_regexp_cache;
 
     Heap m_heap;
 
     Vector<ExecutionContext*> m_execution_context_stack;
+    ValueStack m_value_stack;
 
     Vector<Vector<ExecutionContext*>> m_saved_execution_context_stacks;
 
@@ -291,7 +302,10 @@ private:
     // GlobalSymbolRegistry, https://tc39.es/ecma262/#table-globalsymbolregistry-record-fields
     HashMap<String, NonnullGCPtr<Symbol>> m_global_symbol_registry;
 
+    // NOTE: Jobs are consumed from m_next_promise_job_index onwards, and the whole queue is cleared once it has been drained.
+    //       This keeps dequeuing O(1), instead of shifting the remaining jobs down for every job we run.
     Vector<NonnullGCPtr<HeapFunction<ThrowCompletionOr<Value>()>>> m_promise_jobs;
+    size_t m_next_promise_job_index { 0 };
 
     Vector<GCPtr<FinalizationRegistry>> m_finalization_registry_cleanup_jobs;
 
@@ -320,6 +334,7 @@ private:
     OwnPtr<Bytecode::Interpreter> m_bytecode_interpreter;
 
     bool m_dynamic_imports_allowed { false };
+    bool m_agent_can_block { true };
 };
 
 template<typename GlobalObjectType, typename... Args>
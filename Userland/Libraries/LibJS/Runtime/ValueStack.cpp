@@ -0,0 +1,28 @@
+/*
+ * Copyright (c) 2024, the SerenityOS developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/kmalloc.h>
+#include <LibJS/Runtime/ValueStack.h>
+
+namespace JS {
+
+// The memory is only touched as frames are carved out of it, so most of it never needs to be backed by actual pages.
+static constexpr size_t value_stack_capacity = 256 * KiB;
+
+ValueStack::ValueStack()
+{
+    m_base = static_cast<Value*>(kmalloc(value_stack_capacity * sizeof(Value)));
+    VERIFY(m_base);
+    m_top = m_base;
+    m_end = m_base + value_stack_capacity;
+}
+
+ValueStack::~ValueStack()
+{
+    kfree_sized(m_base, value_stack_capacity * sizeof(Value));
+}
+
+}
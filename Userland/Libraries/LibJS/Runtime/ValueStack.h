@@ -0,0 +1,55 @@
+/*
+ * Copyright (c) 2024, the SerenityOS developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/Noncopyable.h>
+#include <AK/Span.h>
+#include <LibJS/Runtime/Value.h>
+
+namespace JS {
+
+// A contiguous stack of values owned by the VM. Function calls carve the arguments, registers, constants and locals of
+// their execution context out of it by bumping a pointer, and give them back in the reverse order.
+class ValueStack {
+    AK_MAKE_NONCOPYABLE(ValueStack);
+    AK_MAKE_NONMOVABLE(ValueStack);
+
+public:
+    ValueStack();
+    ~ValueStack();
+
+    Value* top() const { return m_top; }
+
+    // Returns null if there is not enough room left, in which case the caller has to find another home for its values.
+    Value* allocate(size_t count)
+    {
+        if (count > static_cast<size_t>(m_end - m_top)) [[unlikely]]
+            return nullptr;
+
+        auto* values = m_top;
+        for (size_t i = 0; i < count; ++i)
+            new (&values[i]) Value();
+
+        m_top += count;
+        return values;
+    }
+
+    void release_to(Value* top)
+    {
+        VERIFY(top >= m_base && top <= m_top);
+        m_top = top;
+    }
+
+    ReadonlySpan<Value> values_in_use() const { return { m_base, static_cast<size_t>(m_top - m_base) }; }
+
+private:
+    Value* m_base { nullptr };
+    Value* m_top { nullptr };
+    Value* m_end { nullptr };
+};
+
+}
@@ -201,4 +201,78 @@ describe("Array.prototype.sort", () => {
         );
         Array.prototype.sort.call(obj);
     });
+
+    test("that it converts each element to a string only once with the default comparator", () => {
+        let conversions = 0;
+        const values = [];
+        for (let i = 0; i < 100; ++i) {
+            const value = (i * 37) % 100;
+            values.push({
+                value,
+                toString() {
+                    ++conversions;
+                    return String(value).padStart(3, "0");
+                },
+            });
+        }
+
+        values.sort();
+        expect(conversions).toBe(100);
+        for (let i = 0; i < 100; ++i) expect(values[i].value).toBe(i);
+    });
+
+    test("that it does not convert elements to strings if there is nothing to compare", () => {
+        expect([Symbol.iterator].sort()).toEqual([Symbol.iterator]);
+        expect([undefined, Symbol.iterator, undefined].sort()).toEqual([
+            Symbol.iterator,
+            undefined,
+            undefined,
+        ]);
+
+        let calls = 0;
+        const object = {
+            toString() {
+                ++calls;
+                return "";
+            },
+        };
+        expect([object].sort()).toEqual([object]);
+        expect(calls).toBe(0);
+    });
+
+    test("that it is stable for large arrays", () => {
+        const values = [];
+        for (let i = 0; i < 5000; ++i) values.push({ key: (i * 7919) % 13, index: i });
+
+        values.sort((a, b) => a.key - b.key);
+        for (let i = 1; i < values.length; ++i) {
+            const previous = values[i - 1];
+            const current = values[i];
+            expect(
+                previous.key < current.key ||
+                    (previous.key === current.key && previous.index < current.index)
+            ).toBeTrue();
+        }
+
+        const strings = values.map(value => `${value.index % 97}`).sort();
+        for (let i = 1; i < strings.length; ++i) expect(strings[i - 1] <= strings[i]).toBeTrue();
+    });
+
+    test("that it handles pre-sorted runs", () => {
+        const ascending = Array.from({ length: 1000 }, (_, i) => i);
+        let calls = 0;
+        ascending.sort((a, b) => {
+            ++calls;
+            return a - b;
+        });
+        expect(calls).toBe(999);
+
+        const descending = Array.from({ length: 1000 }, (_, i) => 1000 - i);
+        descending.sort((a, b) => a - b);
+        for (let i = 0; i < 1000; ++i) expect(descending[i]).toBe(i + 1);
+
+        const sawtooth = Array.from({ length: 1000 }, (_, i) => i % 100);
+        sawtooth.sort((a, b) => a - b);
+        for (let i = 0; i < 1000; ++i) expect(sawtooth[i]).toBe(Math.floor(i / 10));
+    });
 });
@@ -56,4 +56,12 @@ test("basic functionality", () => {
         const waiters = Atomics.notify(typedArray, 0, 0);
         expect(waiters).toBe(0);
     });
+
+    test("no waiters", () => {
+        const buffer = new SharedArrayBuffer(4 * Int32Array.BYTES_PER_ELEMENT);
+        const typedArray = new Int32Array(buffer);
+
+        expect(Atomics.notify(typedArray, 0)).toBe(0);
+        expect(Atomics.notify(typedArray, 3, 1)).toBe(0);
+    });
 });
@@ -73,4 +73,31 @@ test("basic functionality", () => {
     test("invariants", () => {
         expect(Atomics.wait).toHaveLength(4);
     });
+
+    test("value is not equal", () => {
+        const buffer = new SharedArrayBuffer(4 * Int32Array.BYTES_PER_ELEMENT);
+        const typedArray = new Int32Array(buffer);
+        typedArray[1] = 42;
+
+        expect(Atomics.wait(typedArray, 1, 0, 0)).toBe("not-equal");
+        expect(Atomics.wait(typedArray, 1, 0)).toBe("not-equal");
+    });
+
+    test("timeout", () => {
+        const buffer = new SharedArrayBuffer(4 * Int32Array.BYTES_PER_ELEMENT);
+        const typedArray = new Int32Array(buffer);
+
+        expect(Atomics.wait(typedArray, 0, 0, 0)).toBe("timed-out");
+        expect(Atomics.wait(typedArray, 0, 0, -Infinity)).toBe("timed-out");
+        expect(Atomics.wait(typedArray, 0, 0, 10)).toBe("timed-out");
+    });
+
+    test("BigInt64Array", () => {
+        const buffer = new SharedArrayBuffer(4 * BigInt64Array.BYTES_PER_ELEMENT);
+        const typedArray = new BigInt64Array(buffer);
+        typedArray[2] = -1n;
+
+        expect(Atomics.wait(typedArray, 2, 0n, 0)).toBe("not-equal");
+        expect(Atomics.wait(typedArray, 2, -1n, 0)).toBe("timed-out");
+    });
 });
@@ -17,3 +17,18 @@ test("basic functionality", () => {
     expect(it.next()).toEqual({ value: undefined, done: true });
     expect(it.next()).toEqual({ value: undefined, done: true });
 });
+
+test("iterators survive removal of many entries", () => {
+    const map = new Map();
+    for (let i = 0; i < 1000; ++i) map.set(i, i);
+
+    const it = map.keys();
+    expect(it.next()).toEqual({ value: 0, done: false });
+    for (let i = 1; i < 999; ++i) map.delete(i);
+    map.set("after", 1);
+
+    expect(it.next()).toEqual({ value: 999, done: false });
+    expect(it.next()).toEqual({ value: "after", done: false });
+    expect(it.next()).toEqual({ value: undefined, done: true });
+    expect(Array.from(map.keys())).toEqual([0, 999, "after"]);
+});
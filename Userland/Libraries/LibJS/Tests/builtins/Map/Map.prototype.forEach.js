@@ -54,3 +54,66 @@ describe("normal behavior", () => {
         });
     });
 });
+
+describe("modification during iteration", () => {
+    test("entries removed before being visited are skipped", () => {
+        const map = new Map([
+            ["a", 0],
+            ["b", 1],
+            ["c", 2],
+        ]);
+        const visited = [];
+        map.forEach((value, key) => {
+            visited.push(key);
+            if (key === "a") map.delete("b");
+        });
+        expect(visited).toEqual(["a", "c"]);
+    });
+
+    test("removing the current entry does not skip the next one", () => {
+        const map = new Map();
+        for (let i = 0; i < 100; ++i) map.set(i, i);
+
+        const visited = [];
+        map.forEach((value, key) => {
+            visited.push(key);
+            map.delete(key);
+        });
+        expect(visited).toHaveLength(100);
+        expect(map.size).toBe(0);
+    });
+
+    test("entries added during iteration are visited after compaction", () => {
+        const map = new Map();
+        for (let i = 0; i < 64; ++i) map.set(i, i);
+
+        const visited = [];
+        map.forEach((value, key) => {
+            visited.push(key);
+            if (key < 64) {
+                map.delete(key);
+                map.set(key + 1000, key);
+            }
+        });
+        expect(visited).toHaveLength(128);
+        expect(visited[64]).toBe(1000);
+        expect(visited[127]).toBe(1063);
+        expect(map.size).toBe(64);
+    });
+
+    test("entries added after clearing are visited", () => {
+        const map = new Map([
+            ["a", 0],
+            ["b", 1],
+        ]);
+        const visited = [];
+        map.forEach((value, key) => {
+            visited.push(key);
+            if (key === "a") {
+                map.clear();
+                map.set("c", 2);
+            }
+        });
+        expect(visited).toEqual(["a", "c"]);
+    });
+});
@@ -76,3 +76,27 @@ describe("styles", () => {
         ).toBe("\u0661\u066b\u0662\u0663 كيلومتر في الساعة");
     });
 });
+
+describe("repeated calls", () => {
+    test("formatters for different locales are not mixed up", () => {
+        for (let i = 0; i < 3; ++i) {
+            expect((12).toLocaleString("en")).toBe("12");
+            expect((12).toLocaleString("ar")).toBe("١٢");
+            expect((12).toLocaleString()).toBe("12");
+        }
+    });
+
+    test("options are read on every call", () => {
+        let getterCalls = 0;
+        const options = {
+            get style() {
+                ++getterCalls;
+                return "percent";
+            },
+        };
+
+        expect((0.234).toLocaleString("en", options)).toBe("23%");
+        expect((0.234).toLocaleString("en", options)).toBe("23%");
+        expect(getterCalls).toBe(2);
+    });
+});
@@ -66,3 +66,20 @@ test("Incorrectly escaped code units not converted to invalid patterns", () => {
     expect(re.test("⫀")).toBeTrue();
     expect(re.test("\\u2abe")).toBeFalse(); // ⫀ is \u2abe
 });
+
+test("regexps with the same source and flags are independent", () => {
+    const first = new RegExp("a+", "g");
+    const second = new RegExp("a+", "g");
+    expect(first).not.toBe(second);
+
+    expect(first.exec("aa aaa")[0]).toBe("aa");
+    expect(first.lastIndex).toBe(2);
+    expect(second.lastIndex).toBe(0);
+    expect(second.exec("aaa")[0]).toBe("aaa");
+
+    first.compile("b+", "g");
+    expect(first.test("bb")).toBeTrue();
+    expect(new RegExp("a+", "g").test("bb")).toBeFalse();
+
+    for (let i = 0; i < 2; ++i) expect(() => new RegExp("(", "g")).toThrow(SyntaxError);
+});
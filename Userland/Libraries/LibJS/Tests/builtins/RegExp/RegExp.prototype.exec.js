@@ -212,3 +212,47 @@ test("string coercion", () => {
     expect(result[0]).toBe("1");
     expect(result.index).toBe(0);
 });
+
+test("long matches and captures", () => {
+    const value = "a fairly long captured value";
+    const text = `${"padding ".repeat(100)}key=${value};`;
+
+    let result = /key=([^;]+);/.exec(text);
+    expect(result[0]).toBe(`key=${value};`);
+    expect(result[1]).toBe(value);
+    expect(result[1].slice(2, 14)).toBe("fairly long ");
+    expect(result.index).toBe(800);
+
+    result = /key=(?<value>[^;]+);/u.exec(`😀${text}`);
+    expect(result.groups.value).toBe(value);
+    expect(result.index).toBe(802);
+});
+
+test("overridden exec is honored by other builtins", () => {
+    const originalExec = RegExp.prototype.exec;
+    let calls = 0;
+    RegExp.prototype.exec = function (string) {
+        ++calls;
+        return originalExec.call(this, string);
+    };
+
+    try {
+        expect("abc".replace(/b/, "x")).toBe("axc");
+        expect("abc".match(/c/)[0]).toBe("c");
+        expect(/a/.test("a")).toBeTrue();
+        expect(calls).toBe(3);
+    } finally {
+        RegExp.prototype.exec = originalExec;
+    }
+
+    const re = /a/g;
+    re.exec = () => null;
+    expect("aaa".replace(re, "b")).toBe("aaa");
+});
+
+test("non-writable lastIndex", () => {
+    const re = /a/g;
+    Object.defineProperty(re, "lastIndex", { value: 0, writable: false });
+    expect(() => re.exec("b")).toThrowWithMessage(TypeError, "Cannot write to non-writable property 'lastIndex'");
+    expect(() => re.exec("a")).toThrow(TypeError);
+});
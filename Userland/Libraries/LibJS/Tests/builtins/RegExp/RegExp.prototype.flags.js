@@ -13,3 +13,23 @@ test("basic functionality", () => {
     // prettier-ignore
     expect(/foo/dgimsvy.flags).toBe("dgimsvy");
 });
+
+test("overridden flag getters are honored by other builtins", () => {
+    const descriptor = Object.getOwnPropertyDescriptor(RegExp.prototype, "global");
+    Object.defineProperty(RegExp.prototype, "global", {
+        get() {
+            return true;
+        },
+        configurable: true,
+    });
+
+    try {
+        expect(/a/.flags).toBe("g");
+        expect("aaa".replace(/a/, "b")).toBe("bbb");
+        expect("aaa".match(/a/).length).toBe(3);
+    } finally {
+        Object.defineProperty(RegExp.prototype, "global", descriptor);
+    }
+
+    expect("aaa".replace(/a/, "b")).toBe("baa");
+});
@@ -25,3 +25,22 @@ test("UTF-16", () => {
     expect(s.slice(0, 1)).toBe("\ud83d");
     expect(s.slice(0, 2)).toBe("😀");
 });
+
+test("slices of long strings", () => {
+    const line = "0123456789abcdefghijklmnopqrstuvwxyz";
+    const text = line.repeat(1000);
+
+    const slice = text.slice(36, 72);
+    expect(slice).toBe(line);
+    expect(slice.slice(10, 20)).toBe("abcdefghij");
+    expect(slice.slice(10)).toBe(line.slice(10));
+    expect((slice + slice).slice(30, 42)).toBe("uvwxyz012345");
+
+    const emoji = "😀".repeat(100);
+    expect(emoji.slice(1, 41)).toBe("\ude00" + "😀".repeat(19) + "\ud83d");
+    expect(emoji.slice(2, 42).slice(2, 22)).toBe("😀".repeat(10));
+
+    const huge = "x".repeat(1_000_000) + line;
+    expect(huge.slice(-36)).toBe(line);
+    expect(huge.slice(-36).slice(10, 36)).toBe(line.slice(10));
+});
@@ -80,3 +80,22 @@ test("UTF-16", () => {
     expect(s.split(/\ud83d/)).toEqual(["", "\ude00", "\ude00", "\ude00"]);
     expect(s.split(/\ude00/)).toEqual(["\ud83d", "\ud83d", "\ud83d", ""]);
 });
+
+test("long strings", () => {
+    const row = "some value,another longer value,3.14159265358979,";
+    const csv = row.repeat(500);
+
+    const fields = csv.split(",");
+    expect(fields).toHaveLength(1501);
+    for (let i = 0; i < 1500; i += 3) {
+        expect(fields[i]).toBe("some value");
+        expect(fields[i + 1]).toBe("another longer value");
+        expect(fields[i + 2]).toBe("3.14159265358979");
+    }
+    expect(fields[1500]).toBe("");
+
+    const lines = csv.split(/,(?=some)/);
+    expect(lines).toHaveLength(500);
+    expect(lines[0]).toBe(row.slice(0, -1));
+    expect(lines[499]).toBe(row);
+});
@@ -66,3 +66,15 @@ test("multi-byte code point", () => {
     expect("😀".trim()).toBe("😀");
     expect("😀_".trim()).toBe("😀_");
 });
+
+test("long strings", () => {
+    const text = "hello friends ".repeat(100).trimEnd();
+    const padded = " \t\n" + text + "\r\n ";
+
+    expect(padded.trim()).toBe(text);
+    expect(padded.trimStart()).toBe(text + "\r\n ");
+    expect(padded.trimEnd()).toBe(" \t\n" + text);
+    expect(padded.trim().trim()).toBe(text);
+    expect(text.trim()).toBe(text);
+    expect(" ".repeat(100).trim()).toBe("");
+});
@@ -119,3 +119,33 @@ describe("normal behavior", () => {
         });
     });
 });
+
+test("overlapping ranges", () => {
+    const forwards = new Float64Array([1.5, 2.5, 3.5, 4.5, 5.5]);
+    forwards.copyWithin(0, 1);
+    expect(forwards).toEqual([2.5, 3.5, 4.5, 5.5, 5.5]);
+
+    const backwards = new Float64Array([1.5, 2.5, 3.5, 4.5, 5.5]);
+    backwards.copyWithin(1, 0);
+    expect(backwards).toEqual([1.5, 1.5, 2.5, 3.5, 4.5]);
+
+    const subarray = new Uint16Array([1, 2, 3, 4, 5, 6]).subarray(1, 5);
+    subarray.copyWithin(1, 0, 3);
+    expect(subarray).toEqual([2, 2, 3, 4]);
+    expect(new Uint16Array(subarray.buffer)).toEqual([1, 2, 2, 3, 4, 6]);
+});
+
+test("argument coercion shrinking the underlying buffer", () => {
+    let arrayBuffer = new ArrayBuffer(8, { maxByteLength: 16 });
+    let typedArray = new Uint8Array(arrayBuffer);
+    typedArray.set([1, 2, 3, 4, 5, 6, 7, 8]);
+
+    const end = {
+        valueOf() {
+            arrayBuffer.resize(6);
+            return 8;
+        },
+    };
+    typedArray.copyWithin(0, 3, end);
+    expect(typedArray).toEqual([4, 5, 6, 4, 5, 6]);
+});
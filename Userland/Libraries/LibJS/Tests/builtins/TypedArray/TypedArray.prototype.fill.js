@@ -75,3 +75,18 @@ test("basic functionality", () => {
         expect(typedArray[2]).toBe(0n);
     });
 });
+
+test("fill with values converted to the element type", () => {
+    expect(Array.from(new Float32Array(5).fill(0.1, 1, 4))).toEqual([0, Math.fround(0.1), Math.fround(0.1), Math.fround(0.1), 0]);
+    expect(Array.from(new Float64Array(3).fill(-0.5))).toEqual([-0.5, -0.5, -0.5]);
+    expect(Array.from(new Uint8ClampedArray(3).fill(300.7))).toEqual([255, 255, 255]);
+    expect(Array.from(new Int16Array(3).fill(65537))).toEqual([1, 1, 1]);
+    expect(Array.from(new BigInt64Array(3).fill(-1n))).toEqual([-1n, -1n, -1n]);
+
+    const large = new Uint32Array(1000).fill(0xdeadbeef, 3, 997);
+    expect(large[2]).toBe(0);
+    expect(large[3]).toBe(0xdeadbeef);
+    expect(large[996]).toBe(0xdeadbeef);
+    expect(large[997]).toBe(0);
+    expect(large.filter(value => value === 0xdeadbeef)).toHaveLength(994);
+});
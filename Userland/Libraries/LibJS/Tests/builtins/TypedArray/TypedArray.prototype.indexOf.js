@@ -62,3 +62,32 @@ test("basic functionality", () => {
         expect(typedArray.indexOf(2n, -2)).toBe(1);
     });
 });
+
+test("values not representable by the element type", () => {
+    expect(new Uint8Array([0, 1, 255]).indexOf(256)).toBe(-1);
+    expect(new Uint8Array([0, 1, 255]).indexOf(-1)).toBe(-1);
+    expect(new Uint8Array([0, 1, 255]).indexOf(1.5)).toBe(-1);
+    expect(new Uint8Array([0, 1, 255]).indexOf("1")).toBe(-1);
+    expect(new Int8Array([0, -1, 1]).indexOf(-1)).toBe(1);
+    expect(new Int32Array([5, 0]).indexOf(-0)).toBe(1);
+
+    expect(new Float32Array([0.1, 0.5]).indexOf(0.1)).toBe(-1);
+    expect(new Float32Array([0.1, 0.5]).indexOf(0.5)).toBe(1);
+    expect(new Float64Array([0.1, 0.5]).indexOf(0.1)).toBe(0);
+    expect(new Float64Array([NaN, 1]).indexOf(NaN)).toBe(-1);
+    expect(new Float64Array([1, -0]).indexOf(0)).toBe(1);
+});
+
+test("fromIndex coercion shrinking the underlying buffer", () => {
+    let arrayBuffer = new ArrayBuffer(8, { maxByteLength: 16 });
+    let typedArray = new Uint8Array(arrayBuffer);
+    typedArray[6] = 42;
+
+    const fromIndex = {
+        valueOf() {
+            arrayBuffer.resize(4);
+            return 0;
+        },
+    };
+    expect(typedArray.indexOf(42, fromIndex)).toBe(-1);
+});
@@ -145,3 +145,19 @@ test("detached buffer", () => {
         expect(typedArray.length).toBe(0);
     });
 });
+
+test("overlapping views of the same buffer", () => {
+    const buffer = new ArrayBuffer(8 * 6);
+    const values = new Float64Array(buffer);
+    values.set([1, 2, 3, 4, 5, 6]);
+
+    values.set(new Float64Array(buffer, 0, 4), 2);
+    expect(values).toEqual([1, 2, 1, 2, 3, 4]);
+
+    values.set(new Float64Array(buffer, 8 * 2, 4), 0);
+    expect(values).toEqual([1, 2, 3, 4, 3, 4]);
+
+    const bytes = new Uint8Array([1, 2, 3, 4]);
+    new Int8Array(bytes.buffer, 1, 3).set(bytes.subarray(0, 3));
+    expect(bytes).toEqual([1, 1, 2, 3]);
+});
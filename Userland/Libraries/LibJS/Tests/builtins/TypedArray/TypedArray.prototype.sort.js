@@ -89,3 +89,32 @@ test("detached buffer", () => {
         expect(typedArray[2]).toBeUndefined();
     });
 });
+
+test("default comparator orders -0 before +0 and NaN last", () => {
+    [Float32Array, Float64Array].forEach(T => {
+        const typedArray = new T([NaN, 1, -0, Infinity, 0, -Infinity, NaN, -1.5, 0, -0]);
+        typedArray.sort();
+        expect(Array.from(typedArray)).toEqual([-Infinity, -1.5, -0, -0, 0, 0, 1, Infinity, NaN, NaN]);
+        expect(Object.is(typedArray[2], -0)).toBeTrue();
+        expect(Object.is(typedArray[3], -0)).toBeTrue();
+        expect(Object.is(typedArray[4], 0)).toBeTrue();
+    });
+});
+
+test("default comparator with large arrays", () => {
+    TYPED_ARRAYS.forEach(T => {
+        const typedArray = new T(2000);
+        for (let i = 0; i < typedArray.length; ++i) typedArray[i] = (i * 7919) % 251;
+        typedArray.sort();
+        for (let i = 1; i < typedArray.length; ++i)
+            expect(typedArray[i - 1] <= typedArray[i]).toBeTrue();
+    });
+
+    const signed = new Int32Array([5, -3, 2147483647, -2147483648, 0, -1]);
+    signed.sort();
+    expect(Array.from(signed)).toEqual([-2147483648, -3, -1, 0, 5, 2147483647]);
+
+    const bigints = new BigInt64Array([5n, -3n, 9223372036854775807n, -9223372036854775808n, 0n]);
+    bigints.sort();
+    expect(Array.from(bigints)).toEqual([-9223372036854775808n, -3n, 0n, 5n, 9223372036854775807n]);
+});
@@ -72,3 +72,31 @@ test("can call constructor without parentheses", () => {
     // prettier-ignore
     expect(new A).toBeInstanceOf(A);
 });
+
+test("repeatedly constructed instances with many properties", () => {
+    class Base {
+        a = 1;
+        constructor() {
+            this.b = 2;
+            this.c = 3;
+        }
+    }
+
+    class Derived extends Base {
+        d = 4;
+        constructor(value) {
+            super();
+            this.e = value;
+            this.f = value * 2;
+        }
+    }
+
+    for (let i = 0; i < 3; ++i) {
+        const instance = new Derived(i);
+        expect(Object.keys(instance)).toEqual(["a", "b", "c", "d", "e", "f"]);
+        expect(instance.f).toBe(i * 2);
+
+        const base = new Base();
+        expect(Object.keys(base)).toEqual(["a", "b", "c"]);
+    }
+});
@@ -130,6 +130,72 @@ describe("correct behavior", () => {
         }
         expect(go("foo")).toEqual({ f: "foo" });
     });
+
+    test("repeatedly evaluated object expression", () => {
+        const objects = [];
+        for (let i = 0; i < 5; ++i) objects.push({ x: i, y: i * 2, z: "z" + i, w: [i] });
+
+        for (let i = 0; i < 5; ++i) {
+            expect(Object.keys(objects[i])).toEqual(["x", "y", "z", "w"]);
+            expect(objects[i].x).toBe(i);
+            expect(objects[i].y).toBe(i * 2);
+            expect(objects[i].z).toBe("z" + i);
+            expect(objects[i].w).toEqual([i]);
+        }
+
+        objects[0].extra = 1;
+        delete objects[1].y;
+        Object.defineProperty(objects[2], "x", { writable: false });
+        expect(objects[3]).toEqual({ x: 3, y: 6, z: "z3", w: [3] });
+        expect(Object.getOwnPropertyDescriptor(objects[3], "x").writable).toBeTrue();
+    });
+
+    test("object expression evaluated recursively", () => {
+        function makeTree(depth) {
+            return {
+                depth,
+                left: depth ? makeTree(depth - 1) : null,
+                right: depth ? makeTree(depth - 1) : null,
+            };
+        }
+
+        for (let i = 0; i < 2; ++i) {
+            const tree = makeTree(3);
+            expect(Object.keys(tree)).toEqual(["depth", "left", "right"]);
+            expect(tree.depth).toBe(3);
+            expect(tree.left.left.left.depth).toBe(0);
+            expect(tree.right.right.depth).toBe(1);
+        }
+    });
+
+    test("object expression interrupted by an exception", () => {
+        function make(shouldThrow) {
+            return {
+                a: 1,
+                b: (() => {
+                    if (shouldThrow) throw new Error();
+                    return 2;
+                })(),
+                c: 3,
+            };
+        }
+
+        expect(make(false)).toEqual({ a: 1, b: 2, c: 3 });
+        expect(() => make(true)).toThrow(Error);
+        expect(make(false)).toEqual({ a: 1, b: 2, c: 3 });
+    });
+
+    test("object expression with many properties", () => {
+        const source = Array.from({ length: 100 }, (_, i) => `p${i}: ${i}`).join(", ");
+        const make = new Function(`return { ${source} };`);
+
+        for (let i = 0; i < 2; ++i) {
+            const object = make();
+            expect(Object.keys(object)).toHaveLength(100);
+            expect(object.p0).toBe(0);
+            expect(object.p99).toBe(99);
+        }
+    });
 });
 
 describe("side effects", () => {
@@ -292,3 +292,55 @@ describe("await observably looks up constructor of Promise objects", () => {
     runQueuedPromiseJobs();
     expect(calls).toBe(4);
 });
+
+describe("await resumes in the same order as promise reactions", () => {
+    test("await and then() on a pending promise", () => {
+        const order = [];
+        let resolvePromise;
+        const promise = new Promise(resolve => {
+            resolvePromise = resolve;
+        });
+
+        promise.then(value => order.push(`then 1: ${value}`));
+        (async () => {
+            order.push(`await: ${await promise}`);
+        })();
+        promise.then(value => order.push(`then 2: ${value}`));
+
+        resolvePromise("a");
+        runQueuedPromiseJobs();
+        expect(order).toEqual(["then 1: a", "await: a", "then 2: a"]);
+    });
+
+    test("await on a rejected promise", () => {
+        const order = [];
+        const promise = Promise.reject("b");
+
+        (async () => {
+            try {
+                await promise;
+            } catch (e) {
+                order.push(`await: ${e}`);
+            }
+        })();
+        promise.catch(e => order.push(`catch: ${e}`));
+
+        runQueuedPromiseJobs();
+        expect(order).toEqual(["await: b", "catch: b"]);
+    });
+
+    test("interleaved async functions", () => {
+        const order = [];
+        async function worker(name) {
+            for (let i = 0; i < 3; ++i) {
+                await i;
+                order.push(`${name}${i}`);
+            }
+        }
+
+        worker("a");
+        worker("b");
+        runQueuedPromiseJobs();
+        expect(order).toEqual(["a0", "b0", "a1", "b1", "a2", "b2"]);
+    });
+});
@@ -77,6 +77,17 @@ Regex<Parser>& Regex<Parser>::operator=(Regex&& regex)
     return *this;
 }
 
+template<class Parser>
+Regex<Parser> Regex<Parser>::clone() const
+{
+    Regex regex;
+    regex.pattern_value = pattern_value;
+    regex.parser_result = regex::Parser::Result(parser_result);
+    if (matcher)
+        regex.matcher = make<Matcher<Parser>>(&regex, matcher->options());
+    return regex;
+}
+
 template<class Parser>
 typename ParserTraits<Parser>::OptionsType Regex<Parser>::options() const
 {
@@ -95,6 +95,9 @@ public:
     Regex(Regex&&);
     Regex& operator=(Regex&&);
 
+    // Creates an independent copy of this regex that reuses its already parsed and optimized bytecode.
+    Regex clone() const;
+
     typename ParserTraits<Parser>::OptionsType options() const;
     ByteString error_string(Optional<ByteString> message = {}) const;
 
@@ -229,6 +232,8 @@ public:
     static BasicBlockList split_basic_blocks(ByteCode const&);
 
 private:
+    Regex() = default;
+
     void run_optimization_passes();
     void attempt_rewrite_loops_as_atomic_groups(BasicBlockList const&);
     bool attempt_rewrite_entire_match_as_substring_search(BasicBlockList const&);
@@ -0,0 +1,288 @@
+/*
+ * Copyright (c) 2024, the SerenityOS developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/JsonArray.h>
+#include <AK/JsonObject.h>
+#include <AK/JsonValue.h>
+#include <AK/QuickSort.h>
+#include <AK/Time.h>
+#include <LibCore/AllocationTracker.h>
+#include <LibCore/File.h>
+#include <LibTest/Benchmark.h>
+#include <LibTest/Macros.h>
+#include <math.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+#if defined(AK_OS_LINUX)
+#    include <linux/perf_event.h>
+#    include <sys/ioctl.h>
+#    include <sys/syscall.h>
+#endif
+
+namespace Test {
+
+// Hardware cycle and instruction counters for the calling thread. These are only available on Linux, and even there
+// perf_event_paranoid or a container may deny access, in which case nothing is counted.
+class PerformanceCounters {
+public:
+    PerformanceCounters()
+    {
+#if defined(AK_OS_LINUX)
+        m_cycles_fd = open_counter(PERF_COUNT_HW_CPU_CYCLES);
+        m_instructions_fd = open_counter(PERF_COUNT_HW_INSTRUCTIONS);
+#endif
+    }
+
+    ~PerformanceCounters()
+    {
+        if (m_cycles_fd >= 0)
+            close(m_cycles_fd);
+        if (m_instructions_fd >= 0)
+            close(m_instructions_fd);
+    }
+
+    void start()
+    {
+#if defined(AK_OS_LINUX)
+        for (auto fd : { m_cycles_fd, m_instructions_fd }) {
+            if (fd < 0)
+                continue;
+            ioctl(fd, PERF_EVENT_IOC_RESET, 0);
+            ioctl(fd, PERF_EVENT_IOC_ENABLE, 0);
+        }
+#endif
+    }
+
+    void stop()
+    {
+#if defined(AK_OS_LINUX)
+        for (auto fd : { m_cycles_fd, m_instructions_fd }) {
+            if (fd >= 0)
+                ioctl(fd, PERF_EVENT_IOC_DISABLE, 0);
+        }
+#endif
+    }
+
+    Optional<u64> cycles() const { return read_counter(m_cycles_fd); }
+    Optional<u64> instructions() const { return read_counter(m_instructions_fd); }
+
+private:
+#if defined(AK_OS_LINUX)
+    static int open_counter(u64 config)
+    {
+        perf_event_attr attributes {};
+        attributes.type = PERF_TYPE_HARDWARE;
+        attributes.size = sizeof(attributes);
+        attributes.config = config;
+        attributes.disabled = 1;
+        attributes.exclude_kernel = 1;
+        attributes.exclude_hv = 1;
+
+        return static_cast<int>(syscall(SYS_perf_event_open, &attributes, 0, -1, -1, 0));
+    }
+#endif
+
+    static Optional<u64> read_counter(int fd)
+    {
+        if (fd < 0)
+            return {};
+
+        u64 value = 0;
+        if (read(fd, &value, sizeof(value)) != sizeof(value))
+            return {};
+        return value;
+    }
+
+    int m_cycles_fd { -1 };
+    int m_instructions_fd { -1 };
+};
+
+static double percentile(Vector<double> const& sorted_values, double percent)
+{
+    VERIFY(!sorted_values.is_empty());
+
+    auto rank = percent / 100.0 * static_cast<double>(sorted_values.size() - 1);
+    auto lower = static_cast<size_t>(floor(rank));
+    auto upper = static_cast<size_t>(ceil(rank));
+
+    return sorted_values[lower] + (sorted_values[upper] - sorted_values[lower]) * (rank - static_cast<double>(lower));
+}
+
+static bool current_run_failed()
+{
+    auto result = current_test_result();
+    return result != TestResult::NotRun && result != TestResult::Passed;
+}
+
+BenchmarkResult run_benchmark(TestCase const& test_case, BenchmarkOptions const& options)
+{
+    BenchmarkResult result;
+    result.name = test_case.name();
+
+    auto benchmark_start = MonotonicTime::now();
+
+    auto run_iterations = [&](u64 iterations) {
+        auto start = MonotonicTime::now();
+        for (u64 i = 0; i < iterations && !current_run_failed(); ++i)
+            test_case.func()();
+        return (MonotonicTime::now() - start).to_nanoseconds();
+    };
+
+    (void)run_iterations(options.warmup_iterations);
+
+    // Keep doubling the number of iterations per sample until a sample takes long enough to be measured accurately.
+    static constexpr u64 max_iterations_per_sample = 1 << 20;
+    auto min_sample_time_ns = static_cast<i64>(options.min_sample_time_ms) * 1'000'000;
+
+    u64 iterations = 1;
+    if (min_sample_time_ns > 0) {
+        while (!current_run_failed() && iterations < max_iterations_per_sample && run_iterations(iterations) < min_sample_time_ns)
+            iterations *= 2;
+    }
+
+    result.iterations_per_sample = iterations;
+
+    PerformanceCounters counters;
+    u64 total_cycles = 0;
+    u64 total_instructions = 0;
+    bool has_cycles = true;
+    bool has_instructions = true;
+
+    auto allocation_count_before = Core::AllocationTracker::allocation_count();
+
+    for (u64 sample = 0; sample < options.samples && !current_run_failed(); ++sample) {
+        Core::AllocationTracker::set_enabled(true);
+        counters.start();
+
+        auto elapsed_ns = run_iterations(iterations);
+
+        counters.stop();
+        Core::AllocationTracker::set_enabled(false);
+
+        result.sample_times_ns.append(static_cast<double>(elapsed_ns) / static_cast<double>(iterations));
+
+        if (auto cycles = counters.cycles(); cycles.has_value())
+            total_cycles += *cycles;
+        else
+            has_cycles = false;
+
+        if (auto instructions = counters.instructions(); instructions.has_value())
+            total_instructions += *instructions;
+        else
+            has_instructions = false;
+    }
+
+    result.total_time_ms = (MonotonicTime::now() - benchmark_start).to_milliseconds();
+
+    if (result.sample_times_ns.is_empty())
+        return result;
+
+    auto total_iterations = static_cast<double>(result.sample_times_ns.size() * iterations);
+    if (has_cycles)
+        result.cycles = static_cast<double>(total_cycles) / total_iterations;
+    if (has_instructions)
+        result.instructions = static_cast<double>(total_instructions) / total_iterations;
+    if (Core::AllocationTracker::is_supported())
+        result.allocations = static_cast<double>(Core::AllocationTracker::allocation_count() - allocation_count_before) / total_iterations;
+
+    auto sorted_times = result.sample_times_ns;
+    quick_sort(sorted_times);
+
+    result.min_ns = sorted_times.first();
+    result.median_ns = percentile(sorted_times, 50);
+    result.p95_ns = percentile(sorted_times, 95);
+
+    double sum = 0;
+    for (auto time : sorted_times)
+        sum += time;
+    result.mean_ns = sum / static_cast<double>(sorted_times.size());
+
+    if (sorted_times.size() > 1) {
+        double sum_of_squared_deviations = 0;
+        for (auto time : sorted_times)
+            sum_of_squared_deviations += (time - result.mean_ns) * (time - result.mean_ns);
+        result.standard_deviation_ns = sqrt(sum_of_squared_deviations / static_cast<double>(sorted_times.size() - 1));
+    }
+
+    return result;
+}
+
+ByteString format_benchmark_time(double nanoseconds)
+{
+    if (nanoseconds >= 1'000'000'000)
+        return ByteString::formatted("{:.2f}s", nanoseconds / 1'000'000'000);
+    if (nanoseconds >= 1'000'000)
+        return ByteString::formatted("{:.2f}ms", nanoseconds / 1'000'000);
+    if (nanoseconds >= 1'000)
+        return ByteString::formatted("{:.2f}us", nanoseconds / 1'000);
+    return ByteString::formatted("{:.1f}ns", nanoseconds);
+}
+
+ErrorOr<void> write_benchmark_results(StringView path, StringView suite_name, Vector<BenchmarkResult> const& results)
+{
+    JsonArray benchmarks;
+
+    for (auto const& result : results) {
+        JsonObject benchmark;
+        benchmark.set("name"sv, result.name);
+        benchmark.set("samples"sv, result.sample_times_ns.size());
+        benchmark.set("iterations_per_sample"sv, result.iterations_per_sample);
+        benchmark.set("min_ns"sv, result.min_ns);
+        benchmark.set("median_ns"sv, result.median_ns);
+        benchmark.set("p95_ns"sv, result.p95_ns);
+        benchmark.set("mean_ns"sv, result.mean_ns);
+        benchmark.set("stddev_ns"sv, result.standard_deviation_ns);
+        if (result.cycles.has_value())
+            benchmark.set("cycles"sv, *result.cycles);
+        if (result.instructions.has_value())
+            benchmark.set("instructions"sv, *result.instructions);
+        if (result.allocations.has_value())
+            benchmark.set("allocations"sv, *result.allocations);
+        TRY(benchmarks.append(move(benchmark)));
+    }
+
+    JsonObject json;
+    json.set("suite"sv, suite_name);
+    json.set("benchmarks"sv, move(benchmarks));
+
+    auto file = TRY(Core::File::open(path, Core::File::OpenMode::Write));
+    TRY(file->write_until_depleted(json.to_byte_string()));
+
+    return {};
+}
+
+ErrorOr<HashMap<ByteString, double>> load_benchmark_baseline(StringView path)
+{
+    auto file = TRY(Core::File::open(path, Core::File::OpenMode::Read));
+    auto json = TRY(JsonValue::from_string(TRY(file->read_until_eof())));
+
+    if (!json.is_object())
+        return Error::from_string_literal("Benchmark baseline is not a JSON object");
+
+    auto benchmarks = json.as_object().get_array("benchmarks"sv);
+    if (!benchmarks.has_value())
+        return Error::from_string_literal("Benchmark baseline has no benchmarks array");
+
+    HashMap<ByteString, double> baseline;
+
+    TRY(benchmarks->try_for_each([&](JsonValue const& value) -> ErrorOr<void> {
+        if (!value.is_object())
+            return Error::from_string_literal("Benchmark baseline entry is not a JSON object");
+
+        auto name = value.as_object().get_byte_string("name"sv);
+        auto median = value.as_object().get_double_with_precision_loss("median_ns"sv);
+        if (!name.has_value() || !median.has_value())
+            return Error::from_string_literal("Benchmark baseline entry is missing its name or median");
+
+        TRY(baseline.try_set(name.release_value(), *median));
+        return {};
+    }));
+
+    return baseline;
+}
+
+}
@@ -0,0 +1,60 @@
+/*
+ * Copyright (c) 2024, the SerenityOS developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/ByteString.h>
+#include <AK/Error.h>
+#include <AK/HashMap.h>
+#include <AK/Optional.h>
+#include <AK/Vector.h>
+#include <LibTest/TestCase.h>
+
+namespace Test {
+
+struct BenchmarkOptions {
+    // Runs of the benchmark body before any measurement is taken.
+    u64 warmup_iterations { 0 };
+
+    // Number of samples to take. Every sample runs the benchmark body a fixed number of iterations.
+    u64 samples { 1 };
+
+    // If non-zero, the number of iterations per sample is raised until a sample takes at least this long, so that
+    // very short benchmark bodies can still be measured accurately.
+    u64 min_sample_time_ms { 0 };
+};
+
+struct BenchmarkResult {
+    ByteString name;
+    u64 iterations_per_sample { 1 };
+
+    // All times are per iteration of the benchmark body, in nanoseconds.
+    Vector<double> sample_times_ns;
+    double min_ns { 0 };
+    double median_ns { 0 };
+    double p95_ns { 0 };
+    double mean_ns { 0 };
+    double standard_deviation_ns { 0 };
+
+    // Averaged per iteration of the benchmark body, when the platform is able to count them.
+    Optional<double> cycles;
+    Optional<double> instructions;
+    Optional<double> allocations;
+
+    u64 total_time_ms { 0 };
+};
+
+// Runs the benchmark body according to the options, stopping early if the body fails.
+BenchmarkResult run_benchmark(TestCase const&, BenchmarkOptions const&);
+
+ByteString format_benchmark_time(double nanoseconds);
+
+ErrorOr<void> write_benchmark_results(StringView path, StringView suite_name, Vector<BenchmarkResult> const&);
+
+// Returns the median time (in nanoseconds) of each benchmark in a file previously written by write_benchmark_results().
+ErrorOr<HashMap<ByteString, double>> load_benchmark_baseline(StringView path);
+
+}
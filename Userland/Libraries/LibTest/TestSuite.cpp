@@ -6,11 +6,11 @@
  */
 
 #include <AK/Function.h>
+#include <AK/LexicalPath.h>
 #include <LibCore/ArgsParser.h>
 #include <LibTest/Macros.h>
 #include <LibTest/TestResult.h>
 #include <LibTest/TestSuite.h>
-#include <math.h>
 #include <stdlib.h>
 #include <sys/time.h>
 
@@ -127,15 +127,39 @@ int TestSuite::main(ByteString const& suite_name, Span<StringView> arguments)
     bool do_benchmarks_only = false;
     bool do_list_cases = false;
     StringView search_string = "*"sv;
+    Optional<u64> benchmark_samples;
+    Optional<u64> benchmark_warmup_iterations;
+    Optional<u64> benchmark_min_sample_time_ms;
+    StringView benchmark_json_path;
+    StringView benchmark_baseline_path;
 
     args_parser.add_option(do_tests_only, "Only run tests.", "tests");
     args_parser.add_option(do_benchmarks_only, "Only run benchmarks.", "bench");
-    args_parser.add_option(m_benchmark_repetitions, "Number of times to repeat each benchmark (default 1)", "benchmark_repetitions", 0, "N");
+    args_parser.add_option(benchmark_samples, "Number of samples to take of each benchmark (default 1, or 10 with --bench)", "benchmark_repetitions", 0, "N");
+    args_parser.add_option(benchmark_warmup_iterations, "Number of warm-up runs of each benchmark (default 0, or 1 with --bench)", "benchmark_warmup", 0, "N");
+    args_parser.add_option(benchmark_min_sample_time_ms, "Repeat short benchmarks until a sample takes at least this long (default 0, or 10 with --bench)", "benchmark_min_time", 0, "MS");
+    args_parser.add_option(benchmark_json_path, "Write benchmark results as JSON to the given path", "benchmark_json", 0, "PATH");
+    args_parser.add_option(benchmark_baseline_path, "Compare benchmark results against a JSON file written by --benchmark_json", "benchmark_baseline", 0, "PATH");
+    args_parser.add_option(m_benchmark_regression_threshold, "Fail benchmarks whose median regressed by more than this percentage against the baseline (default 10)", "benchmark_threshold", 0, "PERCENT");
     args_parser.add_option(m_randomized_runs, "Number of times to run each RANDOMIZED_TEST_CASE (default 100)", "randomized_runs", 0, "RUNS");
     args_parser.add_option(do_list_cases, "List available test cases.", "list");
     args_parser.add_positional_argument(search_string, "Only run matching cases.", "pattern", Core::ArgsParser::Required::No);
     args_parser.parse(arguments);
 
+    // Benchmarks also run alongside the tests by default, so they are only run once unless we were asked to benchmark.
+    m_benchmark_options.samples = max(benchmark_samples.value_or(do_benchmarks_only ? 10 : 1), 1u);
+    m_benchmark_options.warmup_iterations = benchmark_warmup_iterations.value_or(do_benchmarks_only ? 1 : 0);
+    m_benchmark_options.min_sample_time_ms = benchmark_min_sample_time_ms.value_or(do_benchmarks_only ? 10 : 0);
+
+    if (!benchmark_baseline_path.is_empty()) {
+        auto baseline = load_benchmark_baseline(benchmark_baseline_path);
+        if (baseline.is_error()) {
+            warnln("Unable to load benchmark baseline {}: {}", benchmark_baseline_path, baseline.error());
+            return 1;
+        }
+        m_benchmark_baseline = baseline.release_value();
+    }
+
     if (m_setup)
         m_setup();
 
@@ -151,7 +175,16 @@ int TestSuite::main(ByteString const& suite_name, Span<StringView> arguments)
 
     outln("Running {} cases out of {}.", matching_tests.size(), m_cases.size());
 
-    return run(matching_tests);
+    auto failed_count = run(matching_tests);
+
+    if (!benchmark_json_path.is_empty() && !m_benchmark_results.is_empty()) {
+        if (auto result = write_benchmark_results(benchmark_json_path, LexicalPath::basename(suite_name), m_benchmark_results); result.is_error()) {
+            warnln("Unable to write benchmark results to {}: {}", benchmark_json_path, result.error());
+            return failed_count + 1;
+        }
+    }
+
+    return failed_count;
 }
 
 Vector<NonnullRefPtr<TestCase>> TestSuite::find_cases(ByteString const& search, bool find_tests, bool find_benchmarks)
@@ -174,6 +207,45 @@ Vector<NonnullRefPtr<TestCase>> TestSuite::find_cases(ByteString const& search,
     return matches;
 }
 
+void TestSuite::report_benchmark_result(BenchmarkResult const& result)
+{
+    if (m_current_test_result != TestResult::Passed || result.sample_times_ns.is_empty()) {
+        dbgln("{} benchmark '{}' in {}ms", test_result_to_string(m_current_test_result), result.name, result.total_time_ms);
+        return;
+    }
+
+    if (result.sample_times_ns.size() == 1) {
+        dbgln("Completed benchmark '{}' in {}", result.name, format_benchmark_time(result.median_ns));
+    } else {
+        dbgln("Completed benchmark '{}' with a median of {} (min={}, p95={}, stddev={}, {} samples of {} iterations)",
+            result.name, format_benchmark_time(result.median_ns), format_benchmark_time(result.min_ns), format_benchmark_time(result.p95_ns),
+            format_benchmark_time(result.standard_deviation_ns), result.sample_times_ns.size(), result.iterations_per_sample);
+    }
+
+    if (result.cycles.has_value() || result.instructions.has_value() || result.allocations.has_value()) {
+        StringBuilder builder;
+        if (result.cycles.has_value())
+            builder.appendff(" cycles={:.0f}", *result.cycles);
+        if (result.instructions.has_value())
+            builder.appendff(" instructions={:.0f}", *result.instructions);
+        if (result.allocations.has_value())
+            builder.appendff(" allocations={:.1f}", *result.allocations);
+        dbgln("    Per iteration:{}", builder.string_view());
+    }
+
+    auto baseline = m_benchmark_baseline.get(result.name);
+    if (!baseline.has_value() || *baseline <= 0)
+        return;
+
+    auto change = (result.median_ns - *baseline) / *baseline * 100;
+    if (change > m_benchmark_regression_threshold) {
+        dbgln("    Regressed by {:.1f}% against the baseline of {}", change, format_benchmark_time(*baseline));
+        m_current_test_result = TestResult::Failed;
+    } else {
+        dbgln("    Changed by {:.1f}% against the baseline of {}", change, format_benchmark_time(*baseline));
+    }
+}
+
 int TestSuite::run(Vector<NonnullRefPtr<TestCase>> const& tests)
 {
     size_t test_count = 0;
@@ -186,40 +258,31 @@ int TestSuite::run(Vector<NonnullRefPtr<TestCase>> const& tests)
 
     for (auto const& t : tests) {
         auto const test_type = t->is_benchmark() ? "benchmark" : "test";
-        auto const repetitions = t->is_benchmark() ? m_benchmark_repetitions : 1;
 
         warnln("Running {} '{}'.", test_type, t->name());
         m_current_test_result = TestResult::NotRun;
         enable_reporting();
 
         u64 total_time = 0;
-        u64 sum_of_squared_times = 0;
-        u64 min_time = NumericLimits<u64>::max();
-        u64 max_time = 0;
 
-        for (u64 i = 0; i < repetitions; ++i) {
-            TestElapsedTimer timer;
-            t->func()();
-            auto const iteration_time = timer.elapsed_milliseconds();
-            total_time += iteration_time;
-            sum_of_squared_times += iteration_time * iteration_time;
-            min_time = min(min_time, iteration_time);
-            max_time = max(max_time, iteration_time);
+        if (t->is_benchmark()) {
+            auto result = run_benchmark(*t, m_benchmark_options);
+            total_time = result.total_time_ms;
 
             // Non-randomized tests don't touch the test result when passing.
             if (m_current_test_result == TestResult::NotRun)
                 m_current_test_result = TestResult::Passed;
-        }
 
-        if (repetitions != 1) {
-            double average = total_time / double(repetitions);
-            double average_squared = average * average;
-            double standard_deviation = sqrt((sum_of_squared_times + repetitions * average_squared - 2 * total_time * average) / (repetitions - 1));
-
-            dbgln("{} {} '{}' on average in {:.1f}±{:.1f}ms (min={}ms, max={}ms, total={}ms)",
-                test_result_to_string(m_current_test_result), test_type, t->name(),
-                average, standard_deviation, min_time, max_time, total_time);
+            report_benchmark_result(result);
+            m_benchmark_results.append(move(result));
         } else {
+            TestElapsedTimer timer;
+            t->func()();
+            total_time = timer.elapsed_milliseconds();
+
+            if (m_current_test_result == TestResult::NotRun)
+                m_current_test_result = TestResult::Passed;
+
             dbgln("{} {} '{}' in {}ms", test_result_to_string(m_current_test_result), test_type, t->name(), total_time);
         }
 
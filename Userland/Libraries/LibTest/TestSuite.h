@@ -9,7 +9,9 @@
 
 #include <AK/ByteString.h>
 #include <AK/Function.h>
+#include <AK/HashMap.h>
 #include <AK/Vector.h>
+#include <LibTest/Benchmark.h>
 #include <LibTest/Macros.h>
 #include <LibTest/Randomized/RandomnessSource.h>
 #include <LibTest/TestCase.h>
@@ -63,12 +65,17 @@ public:
     u64 randomized_runs() { return m_randomized_runs; }
 
 private:
+    void report_benchmark_result(BenchmarkResult const&);
+
     static TestSuite* s_global;
     Vector<NonnullRefPtr<TestCase>> m_cases;
     u64 m_testtime = 0;
     u64 m_benchtime = 0;
     ByteString m_suite_name;
-    u64 m_benchmark_repetitions = 1;
+    BenchmarkOptions m_benchmark_options;
+    Vector<BenchmarkResult> m_benchmark_results;
+    HashMap<ByteString, double> m_benchmark_baseline;
+    double m_benchmark_regression_threshold = 10;
     u64 m_randomized_runs = 100;
     Function<void()> m_setup;
     TestResult m_current_test_result = TestResult::NotRun;
@@ -37,6 +37,8 @@ public:
     }
 
     void lock();
+    // Returns false instead of waiting if the mutex is held by another thread.
+    [[nodiscard]] bool try_lock();
     void unlock();
 
 private:
@@ -75,6 +77,14 @@ ALWAYS_INLINE void Mutex::lock()
     m_lock_count++;
 }
 
+ALWAYS_INLINE bool Mutex::try_lock()
+{
+    if (pthread_mutex_trylock(&m_mutex) != 0)
+        return false;
+    m_lock_count++;
+    return true;
+}
+
 ALWAYS_INLINE void Mutex::unlock()
 {
     VERIFY(m_lock_count > 0);
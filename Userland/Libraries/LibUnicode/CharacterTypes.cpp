@@ -224,6 +224,10 @@ Optional<Script> __attribute__((weak)) script_from_string(StringView) { return {
 bool __attribute__((weak)) code_point_has_script(u32, Script) { return {}; }
 bool __attribute__((weak)) code_point_has_script_extension(u32, Script) { return {}; }
 
+Optional<GraphemeBreakProperty> __attribute__((weak)) grapheme_break_property(u32) { return {}; }
+Optional<WordBreakProperty> __attribute__((weak)) word_break_property(u32) { return {}; }
+Optional<SentenceBreakProperty> __attribute__((weak)) sentence_break_property(u32) { return {}; }
+
 bool __attribute__((weak)) code_point_has_grapheme_break_property(u32, GraphemeBreakProperty) { return {}; }
 bool __attribute__((weak)) code_point_has_word_break_property(u32, WordBreakProperty) { return {}; }
 bool __attribute__((weak)) code_point_has_sentence_break_property(u32, SentenceBreakProperty) { return {}; }
@@ -65,6 +65,10 @@ Optional<Script> script_from_string(StringView);
 bool code_point_has_script(u32 code_point, Script script);
 bool code_point_has_script_extension(u32 code_point, Script script);
 
+Optional<GraphemeBreakProperty> grapheme_break_property(u32 code_point);
+Optional<WordBreakProperty> word_break_property(u32 code_point);
+Optional<SentenceBreakProperty> sentence_break_property(u32 code_point);
+
 bool code_point_has_grapheme_break_property(u32 code_point, GraphemeBreakProperty property);
 bool code_point_has_word_break_property(u32 code_point, WordBreakProperty property);
 bool code_point_has_sentence_break_property(u32 code_point, SentenceBreakProperty property);
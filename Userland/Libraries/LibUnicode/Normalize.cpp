@@ -4,6 +4,7 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/CharacterTypes.h>
 #include <AK/Find.h>
 #include <AK/QuickSort.h>
 #include <AK/Utf8View.h>
@@ -21,6 +22,7 @@ namespace Unicode {
 
 Optional<CodePointDecomposition const> __attribute__((weak)) code_point_decomposition(u32) { return {}; }
 Optional<u32> __attribute__((weak)) code_point_composition(u32, u32) { return {}; }
+QuickCheckResult __attribute__((weak)) normalization_quick_check(u32, NormalizationForm) { return QuickCheckResult::Maybe; }
 
 NormalizationForm normalization_form_from_string(StringView form)
 {
@@ -297,8 +299,42 @@ static Vector<u32> normalize_implementation(Utf8View string, NormalizationForm f
     VERIFY_NOT_REACHED();
 }
 
+// https://www.unicode.org/reports/tr15/#Detecting_Normalization_Forms
+QuickCheckResult normalization_quick_check(StringView string, NormalizationForm form)
+{
+    auto result = QuickCheckResult::Yes;
+    u32 last_canonical_class = 0;
+
+    for (auto code_point : Utf8View { string }) {
+        // ASCII code points are starters that are unaffected by every normalization form.
+        if (is_ascii(code_point)) {
+            last_canonical_class = 0;
+            continue;
+        }
+
+        auto canonical_class = canonical_combining_class(code_point);
+        if (last_canonical_class > canonical_class && canonical_class != 0)
+            return QuickCheckResult::No;
+
+        auto check = normalization_quick_check(code_point, form);
+        if (check == QuickCheckResult::No)
+            return QuickCheckResult::No;
+        if (check == QuickCheckResult::Maybe)
+            result = QuickCheckResult::Maybe;
+
+        last_canonical_class = canonical_class;
+    }
+
+    return result;
+}
+
 String normalize(StringView string, NormalizationForm form)
 {
+    // Most text is already normalized, in which case we can skip decomposing and recomposing it entirely. Invalid UTF-8
+    // must still go through the full algorithm, which replaces invalid sequences with U+FFFD.
+    if (Utf8View { string }.validate() && normalization_quick_check(string, form) == QuickCheckResult::Yes)
+        return String::from_utf8_without_validation(string.bytes());
+
     auto const code_points = normalize_implementation(Utf8View { string }, form);
 
     StringBuilder builder;
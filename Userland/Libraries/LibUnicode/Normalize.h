@@ -29,6 +29,16 @@ enum class NormalizationForm {
 NormalizationForm normalization_form_from_string(StringView form);
 StringView normalization_form_to_string(NormalizationForm form);
 
+// https://www.unicode.org/reports/tr15/#Detecting_Normalization_Forms
+enum class QuickCheckResult {
+    Yes,
+    No,
+    Maybe,
+};
+
+QuickCheckResult normalization_quick_check(u32 code_point, NormalizationForm form);
+QuickCheckResult normalization_quick_check(StringView string, NormalizationForm form);
+
 String normalize(StringView string, NormalizationForm form);
 
 }
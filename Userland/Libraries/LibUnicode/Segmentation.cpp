@@ -53,8 +53,9 @@ static void for_each_grapheme_segmentation_boundary_impl([[maybe_unused]] ViewTy
     if (view.is_empty())
         return;
 
-    auto has_any_gbp = [](u32 code_point, auto&&... properties) {
-        return (code_point_has_grapheme_break_property(code_point, properties) || ...);
+    // The Grapheme_Cluster_Break property is single-valued, so each code point's property is looked up only once.
+    auto has_any_gbp = [](Optional<GBP> property, auto&&... properties) {
+        return property.has_value() && ((*property == properties) || ...);
     };
 
     auto skip_incb_extend_linker_sequence = [&](auto& it) {
@@ -80,11 +81,14 @@ static void for_each_grapheme_segmentation_boundary_impl([[maybe_unused]] ViewTy
     if (code_unit_length(view) > 1) {
         auto it = view.begin();
         auto code_point = *it;
+        auto code_point_gbp = grapheme_break_property(code_point);
         u32 next_code_point = 0;
+        Optional<GBP> next_code_point_gbp;
         auto current_ri_chain = 0;
 
-        for (++it; it != view.end(); ++it, code_point = next_code_point) {
+        for (++it; it != view.end(); ++it, code_point = next_code_point, code_point_gbp = next_code_point_gbp) {
             next_code_point = *it;
+            next_code_point_gbp = grapheme_break_property(next_code_point);
 
             // GB9c
             if (code_point_has_property(code_point, Property::InCB_Consonant)) {
@@ -97,6 +101,7 @@ static void for_each_grapheme_segmentation_boundary_impl([[maybe_unused]] ViewTy
 
                     if (it_copy != view.end() && code_point_has_property(*it_copy, Property::InCB_Consonant)) {
                         next_code_point = *it_copy;
+                        next_code_point_gbp = grapheme_break_property(next_code_point);
                         it = it_copy;
                         continue;
                     }
@@ -104,64 +109,65 @@ static void for_each_grapheme_segmentation_boundary_impl([[maybe_unused]] ViewTy
             }
 
             // GB11
-            if (code_point_has_property(code_point, Property::Extended_Pictographic) && has_any_gbp(next_code_point, GBP::Extend, GBP::ZWJ)) {
+            if (has_any_gbp(next_code_point_gbp, GBP::Extend, GBP::ZWJ) && code_point_has_property(code_point, Property::Extended_Pictographic)) {
                 auto it_copy = it;
 
-                while (it_copy != view.end() && has_any_gbp(*it_copy, GBP::Extend))
+                while (it_copy != view.end() && has_any_gbp(grapheme_break_property(*it_copy), GBP::Extend))
                     ++it_copy;
 
-                if (it_copy != view.end() && has_any_gbp(*it_copy, GBP::ZWJ)) {
+                if (it_copy != view.end() && has_any_gbp(grapheme_break_property(*it_copy), GBP::ZWJ)) {
                     ++it_copy;
 
                     if (it_copy != view.end() && code_point_has_property(*it_copy, Property::Extended_Pictographic)) {
                         next_code_point = *it_copy;
+                        next_code_point_gbp = grapheme_break_property(next_code_point);
                         it = it_copy;
                         continue;
                     }
                 }
             }
 
-            auto code_point_is_cr = has_any_gbp(code_point, GBP::CR);
-            auto next_code_point_is_lf = has_any_gbp(next_code_point, GBP::LF);
+            auto code_point_is_cr = has_any_gbp(code_point_gbp, GBP::CR);
+            auto next_code_point_is_lf = has_any_gbp(next_code_point_gbp, GBP::LF);
 
             // GB3
             if (code_point_is_cr && next_code_point_is_lf)
                 continue;
             // GB4, GB5
-            if (code_point_is_cr || next_code_point_is_lf || has_any_gbp(next_code_point, GBP::CR, GBP::Control) || has_any_gbp(code_point, GBP::LF, GBP::Control)) {
+            if (code_point_is_cr || next_code_point_is_lf || has_any_gbp(next_code_point_gbp, GBP::CR, GBP::Control) || has_any_gbp(code_point_gbp, GBP::LF, GBP::Control)) {
                 if (callback(code_unit_offset_of(view, it)) == IterationDecision::Break)
                     return;
                 continue;
             }
 
-            auto next_code_point_is_v = has_any_gbp(next_code_point, GBP::V);
-            auto next_code_point_is_t = has_any_gbp(next_code_point, GBP::T);
+            auto next_code_point_is_v = has_any_gbp(next_code_point_gbp, GBP::V);
+            auto next_code_point_is_t = has_any_gbp(next_code_point_gbp, GBP::T);
 
             // GB6
-            if (has_any_gbp(code_point, GBP::L) && (next_code_point_is_v || has_any_gbp(next_code_point, GBP::L, GBP::LV, GBP::LVT)))
+            if (has_any_gbp(code_point_gbp, GBP::L) && (next_code_point_is_v || has_any_gbp(next_code_point_gbp, GBP::L, GBP::LV, GBP::LVT)))
                 continue;
             // GB7
-            if ((next_code_point_is_v || next_code_point_is_t) && has_any_gbp(code_point, GBP::LV, GBP::V))
+            if ((next_code_point_is_v || next_code_point_is_t) && has_any_gbp(code_point_gbp, GBP::LV, GBP::V))
                 continue;
             // GB8
-            if (next_code_point_is_t && has_any_gbp(code_point, GBP::LVT, GBP::T))
+            if (next_code_point_is_t && has_any_gbp(code_point_gbp, GBP::LVT, GBP::T))
                 continue;
 
             // GB9
-            if (has_any_gbp(next_code_point, GBP::Extend, GBP::ZWJ))
+            if (has_any_gbp(next_code_point_gbp, GBP::Extend, GBP::ZWJ))
                 continue;
             // GB9a
-            if (has_any_gbp(next_code_point, GBP::SpacingMark))
+            if (has_any_gbp(next_code_point_gbp, GBP::SpacingMark))
                 continue;
             // GB9b
-            if (has_any_gbp(code_point, GBP::Prepend))
+            if (has_any_gbp(code_point_gbp, GBP::Prepend))
                 continue;
 
-            auto code_point_is_ri = has_any_gbp(code_point, GBP::Regional_Indicator);
+            auto code_point_is_ri = has_any_gbp(code_point_gbp, GBP::Regional_Indicator);
             current_ri_chain = code_point_is_ri ? current_ri_chain + 1 : 0;
 
             // GB12, GB13
-            if (code_point_is_ri && has_any_gbp(next_code_point, GBP::Regional_Indicator) && current_ri_chain % 2 == 1)
+            if (code_point_is_ri && has_any_gbp(next_code_point_gbp, GBP::Regional_Indicator) && current_ri_chain % 2 == 1)
                 continue;
 
             // GB999
@@ -200,8 +206,9 @@ static void for_each_word_segmentation_boundary_impl([[maybe_unused]] ViewType c
     if (view.is_empty())
         return;
 
-    auto has_any_wbp = [](u32 code_point, auto&&... properties) {
-        return (code_point_has_word_break_property(code_point, properties) || ...);
+    // The Word_Break property is single-valued, so each code point's property is looked up only once.
+    auto has_any_wbp = [](Optional<WBP> property, auto&&... properties) {
+        return property.has_value() && ((*property == properties) || ...);
     };
 
     // WB1
@@ -210,81 +217,83 @@ static void for_each_word_segmentation_boundary_impl([[maybe_unused]] ViewType c
 
     if (code_unit_length(view) > 1) {
         auto it = view.begin();
-        auto code_point = *it;
+        auto code_point_wbp = word_break_property(*it);
         u32 next_code_point;
-        Optional<u32> previous_code_point;
+        Optional<WBP> next_code_point_wbp;
+        Optional<WBP> previous_code_point_wbp;
         auto current_ri_chain = 0;
 
-        for (++it; it != view.end(); ++it, previous_code_point = code_point, code_point = next_code_point) {
+        for (++it; it != view.end(); ++it, previous_code_point_wbp = code_point_wbp, code_point_wbp = next_code_point_wbp) {
             next_code_point = *it;
+            next_code_point_wbp = word_break_property(next_code_point);
 
-            auto code_point_is_cr = has_any_wbp(code_point, WBP::CR);
-            auto next_code_point_is_lf = has_any_wbp(next_code_point, WBP::LF);
+            auto code_point_is_cr = has_any_wbp(code_point_wbp, WBP::CR);
+            auto next_code_point_is_lf = has_any_wbp(next_code_point_wbp, WBP::LF);
 
             // WB3
             if (code_point_is_cr && next_code_point_is_lf)
                 continue;
             // WB3a, WB3b
-            if (code_point_is_cr || next_code_point_is_lf || has_any_wbp(next_code_point, WBP::CR, WBP::Newline) || has_any_wbp(code_point, WBP::LF, WBP::Newline)) {
+            if (code_point_is_cr || next_code_point_is_lf || has_any_wbp(next_code_point_wbp, WBP::CR, WBP::Newline) || has_any_wbp(code_point_wbp, WBP::LF, WBP::Newline)) {
                 if (callback(code_unit_offset_of(view, it)) == IterationDecision::Break)
                     return;
                 continue;
             }
             // WB3c
-            if (has_any_wbp(code_point, WBP::ZWJ) && code_point_has_property(next_code_point, Property::Extended_Pictographic))
+            if (has_any_wbp(code_point_wbp, WBP::ZWJ) && code_point_has_property(next_code_point, Property::Extended_Pictographic))
                 continue;
             // WB3d
-            if (has_any_wbp(code_point, WBP::WSegSpace) && has_any_wbp(next_code_point, WBP::WSegSpace))
+            if (has_any_wbp(code_point_wbp, WBP::WSegSpace) && has_any_wbp(next_code_point_wbp, WBP::WSegSpace))
                 continue;
 
             // WB4
-            if (has_any_wbp(next_code_point, WBP::Format, WBP::Extend, WBP::ZWJ))
+            if (has_any_wbp(next_code_point_wbp, WBP::Format, WBP::Extend, WBP::ZWJ))
                 continue;
 
-            auto code_point_is_hebrew_letter = has_any_wbp(code_point, WBP::Hebrew_Letter);
-            auto code_point_is_ah_letter = code_point_is_hebrew_letter || has_any_wbp(code_point, WBP::ALetter);
-            auto next_code_point_is_hebrew_letter = has_any_wbp(next_code_point, WBP::Hebrew_Letter);
-            auto next_code_point_is_ah_letter = next_code_point_is_hebrew_letter || has_any_wbp(next_code_point, WBP::ALetter);
+            auto code_point_is_hebrew_letter = has_any_wbp(code_point_wbp, WBP::Hebrew_Letter);
+            auto code_point_is_ah_letter = code_point_is_hebrew_letter || has_any_wbp(code_point_wbp, WBP::ALetter);
+            auto next_code_point_is_hebrew_letter = has_any_wbp(next_code_point_wbp, WBP::Hebrew_Letter);
+            auto next_code_point_is_ah_letter = next_code_point_is_hebrew_letter || has_any_wbp(next_code_point_wbp, WBP::ALetter);
 
             // WB5
             if (code_point_is_ah_letter && next_code_point_is_ah_letter)
                 continue;
 
-            Optional<u32> next_next_code_point;
+            Optional<WBP> next_next_code_point_wbp;
             if (it != view.end()) {
                 auto it_copy = it;
                 ++it_copy;
                 if (it_copy != view.end())
-                    next_next_code_point = *it_copy;
+                    next_next_code_point_wbp = word_break_property(*it_copy);
             }
-            bool next_next_code_point_is_hebrew_letter = next_next_code_point.has_value() && has_any_wbp(*next_next_code_point, WBP::Hebrew_Letter);
-            bool next_next_code_point_is_ah_letter = next_next_code_point_is_hebrew_letter || (next_next_code_point.has_value() && has_any_wbp(*next_next_code_point, WBP::ALetter));
+            bool next_next_code_point_is_hebrew_letter = has_any_wbp(next_next_code_point_wbp, WBP::Hebrew_Letter);
+            bool next_next_code_point_is_ah_letter = next_next_code_point_is_hebrew_letter || has_any_wbp(next_next_code_point_wbp, WBP::ALetter);
 
-            auto next_code_point_is_mid_num_let_q = has_any_wbp(next_code_point, WBP::MidNumLet, WBP::Single_Quote);
+            auto next_code_point_is_mid_num_let_q = has_any_wbp(next_code_point_wbp, WBP::MidNumLet, WBP::Single_Quote);
 
             // WB6
-            if (code_point_is_ah_letter && next_next_code_point_is_ah_letter && (next_code_point_is_mid_num_let_q || has_any_wbp(next_code_point, WBP::MidLetter)))
+            if (code_point_is_ah_letter && next_next_code_point_is_ah_letter && (next_code_point_is_mid_num_let_q || has_any_wbp(next_code_point_wbp, WBP::MidLetter)))
                 continue;
 
-            auto code_point_is_mid_num_let_q = has_any_wbp(code_point, WBP::MidNumLet, WBP::Single_Quote);
-            auto previous_code_point_is_hebrew_letter = previous_code_point.has_value() && has_any_wbp(*previous_code_point, WBP::Hebrew_Letter);
-            auto previous_code_point_is_ah_letter = previous_code_point_is_hebrew_letter || (previous_code_point.has_value() && has_any_wbp(*previous_code_point, WBP::ALetter));
+            auto code_point_is_mid_num_let_q = has_any_wbp(code_point_wbp, WBP::MidNumLet, WBP::Single_Quote);
+            auto previous_code_point_is_hebrew_letter = has_any_wbp(previous_code_point_wbp, WBP::Hebrew_Letter);
+            auto previous_code_point_is_ah_letter = previous_code_point_is_hebrew_letter || has_any_wbp(previous_code_point_wbp, WBP::ALetter);
 
             // WB7
-            if (previous_code_point_is_ah_letter && next_code_point_is_ah_letter && (code_point_is_mid_num_let_q || has_any_wbp(code_point, WBP::MidLetter)))
+            if (previous_code_point_is_ah_letter && next_code_point_is_ah_letter && (code_point_is_mid_num_let_q || has_any_wbp(code_point_wbp, WBP::MidLetter)))
                 continue;
             // WB7a
-            if (code_point_is_hebrew_letter && has_any_wbp(next_code_point, WBP::Single_Quote))
+            if (code_point_is_hebrew_letter && has_any_wbp(next_code_point_wbp, WBP::Single_Quote))
                 continue;
             // WB7b
-            if (code_point_is_hebrew_letter && next_next_code_point_is_hebrew_letter && has_any_wbp(next_code_point, WBP::Double_Quote))
+            if (code_point_is_hebrew_letter && next_next_code_point_is_hebrew_letter && has_any_wbp(next_code_point_wbp, WBP::Double_Quote))
                 continue;
             // WB7c
-            if (previous_code_point_is_hebrew_letter && next_code_point_is_hebrew_letter && has_any_wbp(code_point, WBP::Double_Quote))
+            if (previous_code_point_is_hebrew_letter && next_code_point_is_hebrew_letter && has_any_wbp(code_point_wbp, WBP::Double_Quote))
                 continue;
 
-            auto code_point_is_numeric = has_any_wbp(code_point, WBP::Numeric);
-            auto next_code_point_is_numeric = has_any_wbp(next_code_point, WBP::Numeric);
+            auto code_point_is_numeric = has_any_wbp(code_point_wbp, WBP::Numeric);
+            auto next_code_point_is_numeric = has_any_wbp(next_code_point_wbp, WBP::Numeric);
 
             // WB8
             if (code_point_is_numeric && next_code_point_is_numeric)
@@ -296,39 +305,39 @@ static void for_each_word_segmentation_boundary_impl([[maybe_unused]] ViewType c
             if (code_point_is_numeric && next_code_point_is_ah_letter)
                 continue;
 
-            auto previous_code_point_is_numeric = previous_code_point.has_value() && has_any_wbp(*previous_code_point, WBP::Numeric);
+            auto previous_code_point_is_numeric = has_any_wbp(previous_code_point_wbp, WBP::Numeric);
 
             // WB11
-            if (previous_code_point_is_numeric && next_code_point_is_numeric && (code_point_is_mid_num_let_q || has_any_wbp(code_point, WBP::MidNum)))
+            if (previous_code_point_is_numeric && next_code_point_is_numeric && (code_point_is_mid_num_let_q || has_any_wbp(code_point_wbp, WBP::MidNum)))
                 continue;
 
-            bool next_next_code_point_is_numeric = next_next_code_point.has_value() && has_any_wbp(*next_next_code_point, WBP::Numeric);
+            bool next_next_code_point_is_numeric = has_any_wbp(next_next_code_point_wbp, WBP::Numeric);
 
             // WB12
-            if (code_point_is_numeric && next_next_code_point_is_numeric && (next_code_point_is_mid_num_let_q || has_any_wbp(next_code_point, WBP::MidNum)))
+            if (code_point_is_numeric && next_next_code_point_is_numeric && (next_code_point_is_mid_num_let_q || has_any_wbp(next_code_point_wbp, WBP::MidNum)))
                 continue;
 
-            auto code_point_is_katakana = has_any_wbp(code_point, WBP::Katakana);
-            auto next_code_point_is_katakana = has_any_wbp(next_code_point, WBP::Katakana);
+            auto code_point_is_katakana = has_any_wbp(code_point_wbp, WBP::Katakana);
+            auto next_code_point_is_katakana = has_any_wbp(next_code_point_wbp, WBP::Katakana);
 
             // WB13
             if (code_point_is_katakana && next_code_point_is_katakana)
                 continue;
 
-            auto code_point_is_extend_num_let = has_any_wbp(code_point, WBP::ExtendNumLet);
+            auto code_point_is_extend_num_let = has_any_wbp(code_point_wbp, WBP::ExtendNumLet);
 
             // WB13a
-            if ((code_point_is_ah_letter || code_point_is_numeric || code_point_is_katakana || code_point_is_extend_num_let) && has_any_wbp(next_code_point, WBP::ExtendNumLet))
+            if ((code_point_is_ah_letter || code_point_is_numeric || code_point_is_katakana || code_point_is_extend_num_let) && has_any_wbp(next_code_point_wbp, WBP::ExtendNumLet))
                 continue;
             // WB13b
             if (code_point_is_extend_num_let && (next_code_point_is_ah_letter || next_code_point_is_numeric || next_code_point_is_katakana))
                 continue;
 
-            auto code_point_is_ri = has_any_wbp(code_point, WBP::Regional_Indicator);
+            auto code_point_is_ri = has_any_wbp(code_point_wbp, WBP::Regional_Indicator);
             current_ri_chain = code_point_is_ri ? current_ri_chain + 1 : 0;
 
             // WB15, WB16
-            if (code_point_is_ri && has_any_wbp(next_code_point, WBP::Regional_Indicator) && current_ri_chain % 2 == 1)
+            if (code_point_is_ri && has_any_wbp(next_code_point_wbp, WBP::Regional_Indicator) && current_ri_chain % 2 == 1)
                 continue;
 
             // WB999
@@ -367,8 +376,9 @@ static void for_each_sentence_segmentation_boundary_impl([[maybe_unused]] ViewTy
     if (view.is_empty())
         return;
 
-    auto has_any_sbp = [](u32 code_point, auto&&... properties) {
-        return (code_point_has_sentence_break_property(code_point, properties) || ...);
+    // The Sentence_Break property is single-valued, so each code point's property is looked up only once.
+    auto has_any_sbp = [](Optional<SBP> property, auto&&... properties) {
+        return property.has_value() && ((*property == properties) || ...);
     };
 
     // SB1
@@ -377,9 +387,9 @@ static void for_each_sentence_segmentation_boundary_impl([[maybe_unused]] ViewTy
 
     if (code_unit_length(view) > 1) {
         auto it = view.begin();
-        auto code_point = *it;
-        u32 next_code_point;
-        Optional<u32> previous_code_point;
+        auto code_point_sbp = sentence_break_property(*it);
+        Optional<SBP> next_code_point_sbp;
+        Optional<SBP> previous_code_point_sbp;
         enum class TerminatorSequenceState {
             None,
             Term,
@@ -388,17 +398,17 @@ static void for_each_sentence_segmentation_boundary_impl([[maybe_unused]] ViewTy
         } terminator_sequence_state { TerminatorSequenceState::None };
         auto term_was_a_term = false;
 
-        for (++it; it != view.end(); ++it, previous_code_point = code_point, code_point = next_code_point) {
-            next_code_point = *it;
+        for (++it; it != view.end(); ++it, previous_code_point_sbp = code_point_sbp, code_point_sbp = next_code_point_sbp) {
+            next_code_point_sbp = sentence_break_property(*it);
 
-            auto code_point_is_cr = has_any_sbp(code_point, SBP::CR);
-            auto next_code_point_is_lf = has_any_sbp(next_code_point, SBP::LF);
+            auto code_point_is_cr = has_any_sbp(code_point_sbp, SBP::CR);
+            auto next_code_point_is_lf = has_any_sbp(next_code_point_sbp, SBP::LF);
 
             // SB3
             if (code_point_is_cr && next_code_point_is_lf)
                 continue;
 
-            auto code_point_is_para_sep = code_point_is_cr || has_any_sbp(code_point, SBP::LF, SBP::Sep);
+            auto code_point_is_para_sep = code_point_is_cr || has_any_sbp(code_point_sbp, SBP::LF, SBP::Sep);
 
             // SB4
             if (code_point_is_para_sep) {
@@ -408,24 +418,24 @@ static void for_each_sentence_segmentation_boundary_impl([[maybe_unused]] ViewTy
             }
 
             // SB5
-            if (has_any_sbp(next_code_point, SBP::Format, SBP::Extend))
+            if (has_any_sbp(next_code_point_sbp, SBP::Format, SBP::Extend))
                 continue;
 
-            auto code_point_is_a_term = has_any_sbp(code_point, SBP::ATerm);
+            auto code_point_is_a_term = has_any_sbp(code_point_sbp, SBP::ATerm);
 
             // SB6
-            if (code_point_is_a_term && has_any_sbp(next_code_point, SBP::Numeric))
+            if (code_point_is_a_term && has_any_sbp(next_code_point_sbp, SBP::Numeric))
                 continue;
             // SB7
-            if (code_point_is_a_term && previous_code_point.has_value() && has_any_sbp(*previous_code_point, SBP::Upper, SBP::Lower) && has_any_sbp(next_code_point, SBP::Upper))
+            if (code_point_is_a_term && has_any_sbp(previous_code_point_sbp, SBP::Upper, SBP::Lower) && has_any_sbp(next_code_point_sbp, SBP::Upper))
                 continue;
 
-            if (code_point_is_a_term || has_any_sbp(code_point, SBP::STerm)) {
+            if (code_point_is_a_term || has_any_sbp(code_point_sbp, SBP::STerm)) {
                 terminator_sequence_state = TerminatorSequenceState::Term;
                 term_was_a_term = code_point_is_a_term;
-            } else if (terminator_sequence_state >= TerminatorSequenceState::Term && terminator_sequence_state <= TerminatorSequenceState::Close && has_any_sbp(code_point, SBP::Close)) {
+            } else if (terminator_sequence_state >= TerminatorSequenceState::Term && terminator_sequence_state <= TerminatorSequenceState::Close && has_any_sbp(code_point_sbp, SBP::Close)) {
                 terminator_sequence_state = TerminatorSequenceState::Close;
-            } else if (terminator_sequence_state >= TerminatorSequenceState::Term && has_any_sbp(code_point, SBP::Sp)) {
+            } else if (terminator_sequence_state >= TerminatorSequenceState::Term && has_any_sbp(code_point_sbp, SBP::Sp)) {
                 terminator_sequence_state = TerminatorSequenceState::Sp;
             } else {
                 terminator_sequence_state = TerminatorSequenceState::None;
@@ -435,24 +445,24 @@ static void for_each_sentence_segmentation_boundary_impl([[maybe_unused]] ViewTy
             if (terminator_sequence_state >= TerminatorSequenceState::Term && term_was_a_term) {
                 auto it_copy = it;
                 bool illegal_sequence = false;
-                for (auto sequence_code_point = *it_copy; it_copy != view.end(); ++it_copy) {
-                    if (has_any_sbp(sequence_code_point, SBP::Close, SBP::SContinue, SBP::Numeric, SBP::Sp, SBP::Format, SBP::Extend))
+                for (auto sequence_code_point_sbp = sentence_break_property(*it_copy); it_copy != view.end(); ++it_copy) {
+                    if (has_any_sbp(sequence_code_point_sbp, SBP::Close, SBP::SContinue, SBP::Numeric, SBP::Sp, SBP::Format, SBP::Extend))
                         continue;
-                    illegal_sequence = has_any_sbp(sequence_code_point, SBP::Lower);
+                    illegal_sequence = has_any_sbp(sequence_code_point_sbp, SBP::Lower);
                 }
                 if (illegal_sequence)
                     continue;
             }
 
             // SB8a
-            if (terminator_sequence_state >= TerminatorSequenceState::Term && (has_any_sbp(next_code_point, SBP::SContinue, SBP::STerm, SBP::ATerm)))
+            if (terminator_sequence_state >= TerminatorSequenceState::Term && (has_any_sbp(next_code_point_sbp, SBP::SContinue, SBP::STerm, SBP::ATerm)))
                 continue;
 
-            auto next_code_point_is_sp = has_any_sbp(next_code_point, SBP::Sp);
-            auto next_code_point_is_para_sep = has_any_sbp(next_code_point, SBP::Sep, SBP::CR, SBP::LF);
+            auto next_code_point_is_sp = has_any_sbp(next_code_point_sbp, SBP::Sp);
+            auto next_code_point_is_para_sep = has_any_sbp(next_code_point_sbp, SBP::Sep, SBP::CR, SBP::LF);
 
             // SB9
-            if (terminator_sequence_state >= TerminatorSequenceState::Term && terminator_sequence_state <= TerminatorSequenceState::Close && (next_code_point_is_sp || next_code_point_is_para_sep || has_any_sbp(next_code_point, SBP::Close)))
+            if (terminator_sequence_state >= TerminatorSequenceState::Term && terminator_sequence_state <= TerminatorSequenceState::Close && (next_code_point_is_sp || next_code_point_is_para_sep || has_any_sbp(next_code_point_sbp, SBP::Close)))
                 continue;
 
             // SB10
@@ -17,16 +17,23 @@ namespace Unicode {
 
 using SegmentationCallback = Function<IterationDecision(size_t)>;
 
+// The next_*_segmentation_boundary helpers accept an optional boundary at or before the index that is already known
+// to the caller. Boundaries do not depend on the text preceding another boundary, so the search starts there rather
+// than re-scanning the view from its beginning. This lets callers stream over a view one segment at a time.
+
 void for_each_grapheme_segmentation_boundary(Utf8View const&, SegmentationCallback);
 void for_each_grapheme_segmentation_boundary(Utf16View const&, SegmentationCallback);
 void for_each_grapheme_segmentation_boundary(Utf32View const&, SegmentationCallback);
 
 template<typename ViewType>
-Optional<size_t> next_grapheme_segmentation_boundary(ViewType const& view, size_t index)
+Optional<size_t> next_grapheme_segmentation_boundary(ViewType const& view, size_t index, size_t known_boundary = 0)
 {
+    VERIFY(known_boundary <= index);
     Optional<size_t> result;
 
-    for_each_grapheme_segmentation_boundary(view, [&](auto boundary) {
+    for_each_grapheme_segmentation_boundary(view.substring_view(known_boundary), [&](auto boundary) {
+        boundary += known_boundary;
+
         if (boundary > index) {
             result = boundary;
             return IterationDecision::Break;
@@ -60,11 +67,14 @@ void for_each_word_segmentation_boundary(Utf16View const&, SegmentationCallback)
 void for_each_word_segmentation_boundary(Utf32View const&, SegmentationCallback);
 
 template<typename ViewType>
-Optional<size_t> next_word_segmentation_boundary(ViewType const& view, size_t index)
+Optional<size_t> next_word_segmentation_boundary(ViewType const& view, size_t index, size_t known_boundary = 0)
 {
+    VERIFY(known_boundary <= index);
     Optional<size_t> result;
 
-    for_each_word_segmentation_boundary(view, [&](auto boundary) {
+    for_each_word_segmentation_boundary(view.substring_view(known_boundary), [&](auto boundary) {
+        boundary += known_boundary;
+
         if (boundary > index) {
             result = boundary;
             return IterationDecision::Break;
@@ -98,11 +108,14 @@ void for_each_sentence_segmentation_boundary(Utf16View const&, SegmentationCallb
 void for_each_sentence_segmentation_boundary(Utf32View const&, SegmentationCallback);
 
 template<typename ViewType>
-Optional<size_t> next_sentence_segmentation_boundary(ViewType const& view, size_t index)
+Optional<size_t> next_sentence_segmentation_boundary(ViewType const& view, size_t index, size_t known_boundary = 0)
 {
+    VERIFY(known_boundary <= index);
     Optional<size_t> result;
 
-    for_each_sentence_segmentation_boundary(view, [&](auto boundary) {
+    for_each_sentence_segmentation_boundary(view.substring_view(known_boundary), [&](auto boundary) {
+        boundary += known_boundary;
+
         if (boundary > index) {
             result = boundary;
             return IterationDecision::Break;
@@ -86,6 +86,10 @@ ErrorOr<void> initialize_main_thread_vm()
     //       This avoids doing an exhaustive garbage collection on process exit.
     s_main_thread_vm->ref();
 
+    // NOTE: The main thread VM hosts a similar-origin window agent, whose [[CanBlock]] is false. Worker processes flip this
+    //       once they set up their dedicated worker agent.
+    s_main_thread_vm->set_agent_can_block(false);
+
     auto& custom_data = verify_cast<WebEngineCustomData>(*s_main_thread_vm->custom_data());
     custom_data.event_loop = s_main_thread_vm->heap().allocate_without_realm<HTML::EventLoop>();
 
@@ -21,7 +21,7 @@ public:
     // https://html.spec.whatwg.org/multipage/structured-data.html#serialization-steps
     virtual WebIDL::ExceptionOr<void> serialization_steps(HTML::SerializationRecord&, bool for_storage, HTML::SerializationMemory&) = 0;
     // https://html.spec.whatwg.org/multipage/structured-data.html#deserialization-steps
-    virtual WebIDL::ExceptionOr<void> deserialization_steps(ReadonlySpan<u32> const&, size_t& position, HTML::DeserializationMemory&) = 0;
+    virtual WebIDL::ExceptionOr<void> deserialization_steps(ReadonlySpan<u8> const&, size_t& position, HTML::DeserializationMemory&) = 0;
 };
 
 }
@@ -16,6 +16,7 @@
 #include <AK/Math.h>
 #include <AK/QuickSort.h>
 #include <AK/TemporaryChange.h>
+#include <LibCore/AllocationTracker.h>
 #include <LibGfx/Font/Font.h>
 #include <LibGfx/Font/FontDatabase.h>
 #include <LibGfx/Font/FontStyleMapping.h>
@@ -165,6 +166,8 @@ void FontLoader::start_loading_next_url()
 
 ErrorOr<NonnullRefPtr<Gfx::VectorFont>> FontLoader::try_load_font()
 {
+    Core::AllocationTracker::ScopedTag allocation_tag { "Fonts"sv };
+
     // FIXME: This could maybe use the format() provided in @font-face as well, since often the mime type is just application/octet-stream and we have to try every format
     auto const& mime_type = resource()->mime_type();
     if (mime_type == "font/ttf"sv || mime_type == "application/x-font-ttf"sv) {
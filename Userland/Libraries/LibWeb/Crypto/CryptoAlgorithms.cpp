@@ -51,7 +51,7 @@ static ::Crypto::UnsignedBigInteger big_integer_from_api_big_integer(JS::GCPtr<J
     // (that is, at most 7 leading zero bits, except the value 0 which shall have length 8 bits).
     // The API SHALL accept values with any number of leading zero bits, including the empty array, which represents zero.
 
-    auto const& buffer = big_integer->viewed_array_buffer()->buffer();
+    auto buffer = big_integer->viewed_array_buffer()->bytes();
 
     ::Crypto::UnsignedBigInteger result(0);
     if (buffer.size() > 0) {
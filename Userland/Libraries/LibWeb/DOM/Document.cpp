@@ -14,7 +14,10 @@
 #include <AK/InsertionSort.h>
 #include <AK/StringBuilder.h>
 #include <AK/Utf8View.h>
+#include <LibCore/AllocationTracker.h>
+#include <LibCore/ElapsedTimer.h>
 #include <LibCore/Timer.h>
+#include <LibCore/Tracing.h>
 #include <LibJS/Runtime/Array.h>
 #include <LibJS/Runtime/FunctionObject.h>
 #include <LibJS/Runtime/NativeFunction.h>
@@ -1090,6 +1093,16 @@ void Document::update_layout()
     if (!navigable)
         return;
 
+    Core::Tracing::ScopedEvent trace_event { "Layout"sv, "Document::update_layout"sv };
+    Core::AllocationTracker::ScopedTag allocation_tag { "Layout"sv };
+
+    auto timer = Core::ElapsedTimer::start_new(Core::TimerType::Precise);
+    ScopeGuard record_layout_time = [&] {
+        auto& statistics = page().rendering_statistics();
+        statistics.layout_time += timer.elapsed_time();
+        ++statistics.layout_count;
+    };
+
     auto* document_element = this->document_element();
     auto viewport_rect = this->viewport_rect();
 
@@ -1219,6 +1232,16 @@ void Document::update_style()
     if (m_created_for_appropriate_template_contents)
         return;
 
+    Core::Tracing::ScopedEvent trace_event { "Style"sv, "Document::update_style"sv };
+    Core::AllocationTracker::ScopedTag allocation_tag { "Style"sv };
+
+    auto timer = Core::ElapsedTimer::start_new(Core::TimerType::Precise);
+    ScopeGuard record_style_update_time = [&] {
+        auto& statistics = page().rendering_statistics();
+        statistics.style_update_time += timer.elapsed_time();
+        ++statistics.style_update_count;
+    };
+
     // Fetch the viewport rect once, instead of repeatedly, during style computation.
     style_computer().set_viewport_rect({}, viewport_rect());
 
@@ -53,7 +53,7 @@ JS::NonnullGCPtr<JS::Uint8Array> TextEncoder::encode(String const& input) const
 // https://encoding.spec.whatwg.org/#dom-textencoder-encodeinto
 TextEncoderEncodeIntoResult TextEncoder::encode_into(String const& source, JS::Handle<WebIDL::BufferSource> const& destination) const
 {
-    auto& data = destination->viewed_array_buffer()->buffer();
+    auto data = destination->viewed_array_buffer()->bytes();
 
     // 1. Let read be 0.
     WebIDL::UnsignedLongLong read = 0;
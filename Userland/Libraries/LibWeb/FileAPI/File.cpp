@@ -110,7 +110,7 @@ WebIDL::ExceptionOr<void> File::serialization_steps(HTML::SerializationRecord& r
     return {};
 }
 
-WebIDL::ExceptionOr<void> File::deserialization_steps(ReadonlySpan<u32> const& record, size_t& position, HTML::DeserializationMemory&)
+WebIDL::ExceptionOr<void> File::deserialization_steps(ReadonlySpan<u8> const& record, size_t& position, HTML::DeserializationMemory&)
 {
     auto& vm = this->vm();
 
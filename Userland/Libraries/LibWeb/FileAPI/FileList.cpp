@@ -83,7 +83,7 @@ WebIDL::ExceptionOr<void> FileList::serialization_steps(HTML::SerializationRecor
     return {};
 }
 
-WebIDL::ExceptionOr<void> FileList::deserialization_steps(ReadonlySpan<u32> const& serialized, size_t& position, HTML::DeserializationMemory& memory)
+WebIDL::ExceptionOr<void> FileList::deserialization_steps(ReadonlySpan<u8> const& serialized, size_t& position, HTML::DeserializationMemory& memory)
 {
     auto& vm = this->vm();
     auto& realm = *vm.current_realm();
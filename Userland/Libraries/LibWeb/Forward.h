@@ -346,6 +346,7 @@ class CustomElementRegistry;
 class DecodedImageData;
 class DocumentState;
 class DOMParser;
+class DOMStringList;
 class DOMStringMap;
 class ErrorEvent;
 class EventHandler;
@@ -503,9 +504,22 @@ class Performance;
 }
 
 namespace Web::IndexedDB {
+class Database;
+class DatabaseState;
+class IDBCursor;
+class IDBCursorWithValue;
+class IDBDatabase;
 class IDBFactory;
+class IDBIndex;
+class IDBKeyRange;
+class IDBObjectStore;
 class IDBOpenDBRequest;
 class IDBRequest;
+class IDBTransaction;
+class IDBVersionChangeEvent;
+class Index;
+class ObjectStore;
+class WriteBatch;
 }
 
 namespace Web::Internals {
@@ -696,6 +710,7 @@ class Table;
 namespace Web::WebAudio {
 class AudioBuffer;
 class AudioContext;
+class AudioDestinationNode;
 class AudioNode;
 class AudioParam;
 class AudioScheduledSourceNode;
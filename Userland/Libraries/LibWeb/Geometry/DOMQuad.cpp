@@ -116,7 +116,7 @@ WebIDL::ExceptionOr<void> DOMQuad::serialization_steps(HTML::SerializationRecord
 }
 
 // https://drafts.fxtf.org/geometry/#structured-serialization
-WebIDL::ExceptionOr<void> DOMQuad::deserialization_steps(ReadonlySpan<u32> const& serialized, size_t& position, HTML::DeserializationMemory& memory)
+WebIDL::ExceptionOr<void> DOMQuad::deserialization_steps(ReadonlySpan<u8> const& serialized, size_t& position, HTML::DeserializationMemory& memory)
 {
     auto& realm = this->realm();
     // 1. Set value’s point 1 to the sub-deserialization of serialized.[[P1]].
@@ -0,0 +1,70 @@
+/*
+ * Copyright (c) 2024, the SerenityOS developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibJS/Runtime/PrimitiveString.h>
+#include <LibWeb/Bindings/DOMStringListPrototype.h>
+#include <LibWeb/Bindings/Intrinsics.h>
+#include <LibWeb/HTML/DOMStringList.h>
+#include <LibWeb/WebIDL/ExceptionOr.h>
+
+namespace Web::HTML {
+
+JS_DEFINE_ALLOCATOR(DOMStringList);
+
+JS::NonnullGCPtr<DOMStringList> DOMStringList::create(JS::Realm& realm, Vector<String> strings)
+{
+    return realm.heap().allocate<DOMStringList>(realm, realm, move(strings));
+}
+
+DOMStringList::DOMStringList(JS::Realm& realm, Vector<String> strings)
+    : Bindings::PlatformObject(realm)
+    , m_strings(move(strings))
+{
+    m_legacy_platform_object_flags = LegacyPlatformObjectFlags { .supports_indexed_properties = 1 };
+}
+
+DOMStringList::~DOMStringList() = default;
+
+void DOMStringList::initialize(JS::Realm& realm)
+{
+    Base::initialize(realm);
+    WEB_SET_PROTOTYPE_FOR_INTERFACE(DOMStringList);
+}
+
+// https://html.spec.whatwg.org/multipage/common-dom-interfaces.html#dom-domstringlist-item
+Optional<String> DOMStringList::item(WebIDL::UnsignedLong index) const
+{
+    // The item(index) method steps are to return the indexth item in this's associated list, or null if index plus
+    // one is greater than this's associated list's size.
+    if (index >= m_strings.size())
+        return {};
+    return m_strings[index];
+}
+
+// https://html.spec.whatwg.org/multipage/common-dom-interfaces.html#dom-domstringlist-contains
+bool DOMStringList::contains(String const& string) const
+{
+    // The contains(string) method steps are to return true if this's associated list contains string, and false
+    // otherwise.
+    return m_strings.contains_slow(string);
+}
+
+// https://html.spec.whatwg.org/multipage/common-dom-interfaces.html#the-domstringlist-interface
+bool DOMStringList::is_supported_property_index(u32 index) const
+{
+    // The supported property indices of a DOMStringList object are the numbers zero to the associated list's size
+    // minus one.
+    return index < m_strings.size();
+}
+
+WebIDL::ExceptionOr<JS::Value> DOMStringList::item_value(size_t index) const
+{
+    if (index >= m_strings.size())
+        return JS::js_undefined();
+    return JS::PrimitiveString::create(vm(), m_strings[index]);
+}
+
+}
@@ -0,0 +1,41 @@
+/*
+ * Copyright (c) 2024, the SerenityOS developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/String.h>
+#include <AK/Vector.h>
+#include <LibWeb/Bindings/PlatformObject.h>
+#include <LibWeb/WebIDL/Types.h>
+
+namespace Web::HTML {
+
+// https://html.spec.whatwg.org/multipage/common-dom-interfaces.html#the-domstringlist-interface
+class DOMStringList final : public Bindings::PlatformObject {
+    WEB_PLATFORM_OBJECT(DOMStringList, Bindings::PlatformObject);
+    JS_DECLARE_ALLOCATOR(DOMStringList);
+
+public:
+    [[nodiscard]] static JS::NonnullGCPtr<DOMStringList> create(JS::Realm&, Vector<String>);
+
+    virtual ~DOMStringList() override;
+
+    WebIDL::UnsignedLong length() const { return m_strings.size(); }
+    Optional<String> item(WebIDL::UnsignedLong index) const;
+    bool contains(String const&) const;
+
+    virtual bool is_supported_property_index(u32 index) const override;
+    virtual WebIDL::ExceptionOr<JS::Value> item_value(size_t index) const override;
+
+private:
+    DOMStringList(JS::Realm&, Vector<String>);
+
+    virtual void initialize(JS::Realm&) override;
+
+    Vector<String> m_strings;
+};
+
+}
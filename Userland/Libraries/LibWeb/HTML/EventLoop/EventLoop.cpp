@@ -15,6 +15,7 @@
 #include <LibWeb/HTML/Window.h>
 #include <LibWeb/HighResolutionTime/Performance.h>
 #include <LibWeb/HighResolutionTime/TimeOrigin.h>
+#include <LibWeb/IndexedDB/Internal/Algorithms.h>
 #include <LibWeb/Page/Page.h>
 #include <LibWeb/Platform/EventLoopPlugin.h>
 #include <LibWeb/Platform/Timer.h>
@@ -470,7 +471,8 @@ void EventLoop::perform_a_microtask_checkpoint()
     for (auto& environment_settings_object : m_related_environment_settings_objects)
         environment_settings_object->notify_about_rejected_promises({});
 
-    // FIXME: 5. Cleanup Indexed Database transactions.
+    // 5. Cleanup Indexed Database transactions.
+    IndexedDB::cleanup_indexed_database_transactions(*this);
 
     // 6. Perform ClearKeptObjects().
     vm().finish_execution_generation();
@@ -23,7 +23,29 @@ void TaskQueue::visit_edges(Visitor& visitor)
 {
     Base::visit_edges(visitor);
     visitor.visit(m_event_loop);
-    visitor.visit(m_tasks);
+    for (auto& task : tasks())
+        visitor.visit(task);
+}
+
+JS::NonnullGCPtr<Task> TaskQueue::take_first()
+{
+    VERIFY(!is_empty());
+    auto task = m_tasks[m_first_task_index++];
+
+    if (m_first_task_index == m_tasks.size()) {
+        m_tasks.clear_with_capacity();
+        m_first_task_index = 0;
+    } else if (m_first_task_index * 2 >= m_tasks.size()) {
+        compact();
+    }
+
+    return task;
+}
+
+void TaskQueue::compact()
+{
+    m_tasks.remove(0, m_first_task_index);
+    m_first_task_index = 0;
 }
 
 void TaskQueue::add(JS::NonnullGCPtr<Task> task)
@@ -37,9 +59,12 @@ JS::GCPtr<Task> TaskQueue::take_first_runnable()
     if (m_event_loop->execution_paused())
         return nullptr;
 
-    for (size_t i = 0; i < m_tasks.size(); ++i) {
-        if (m_tasks[i]->is_runnable())
-            return m_tasks.take(i);
+    for (size_t i = m_first_task_index; i < m_tasks.size(); ++i) {
+        if (!m_tasks[i]->is_runnable())
+            continue;
+        if (i == m_first_task_index)
+            return take_first();
+        return m_tasks.take(i);
     }
     return nullptr;
 }
@@ -49,7 +74,7 @@ bool TaskQueue::has_runnable_tasks() const
     if (m_event_loop->execution_paused())
         return false;
 
-    for (auto& task : m_tasks) {
+    for (auto& task : tasks()) {
         if (task->is_runnable())
             return true;
     }
@@ -58,6 +83,7 @@ bool TaskQueue::has_runnable_tasks() const
 
 void TaskQueue::remove_tasks_matching(Function<bool(HTML::Task const&)> filter)
 {
+    compact();
     m_tasks.remove_all_matching([&](auto& task) {
         return filter(*task);
     });
@@ -66,6 +92,7 @@ void TaskQueue::remove_tasks_matching(Function<bool(HTML::Task const&)> filter)
 JS::MarkedVector<JS::NonnullGCPtr<Task>> TaskQueue::take_tasks_matching(Function<bool(HTML::Task const&)> filter)
 {
     JS::MarkedVector<JS::NonnullGCPtr<Task>> matching_tasks(heap());
+    compact();
 
     for (size_t i = 0; i < m_tasks.size();) {
         auto& task = m_tasks.at(i);
@@ -83,7 +110,7 @@ JS::MarkedVector<JS::NonnullGCPtr<Task>> TaskQueue::take_tasks_matching(Function
 
 Task const* TaskQueue::last_added_task() const
 {
-    if (m_tasks.is_empty())
+    if (is_empty())
         return nullptr;
     return m_tasks.last();
 }
@@ -20,7 +20,7 @@ public:
     explicit TaskQueue(HTML::EventLoop&);
     virtual ~TaskQueue() override;
 
-    bool is_empty() const { return m_tasks.is_empty(); }
+    bool is_empty() const { return m_first_task_index == m_tasks.size(); }
 
     bool has_runnable_tasks() const;
 
@@ -30,9 +30,9 @@ public:
     void enqueue(JS::NonnullGCPtr<HTML::Task> task) { add(task); }
     JS::GCPtr<HTML::Task> dequeue()
     {
-        if (m_tasks.is_empty())
+        if (is_empty())
             return {};
-        return m_tasks.take_first();
+        return take_first();
     }
 
     void remove_tasks_matching(Function<bool(HTML::Task const&)>);
@@ -43,9 +43,16 @@ public:
 private:
     virtual void visit_edges(Visitor&) override;
 
+    JS::NonnullGCPtr<HTML::Task> take_first();
+    ReadonlySpan<JS::NonnullGCPtr<HTML::Task>> tasks() const { return m_tasks.span().slice(m_first_task_index); }
+    void compact();
+
     JS::NonnullGCPtr<HTML::EventLoop> m_event_loop;
 
+    // NOTE: Tasks before m_first_task_index have already been taken from the queue. We only shift the remaining tasks
+    //       down once they are outnumbered by taken ones, so taking the first task is amortized O(1).
     Vector<JS::NonnullGCPtr<HTML::Task>> m_tasks;
+    size_t m_first_task_index { 0 };
 };
 
 }
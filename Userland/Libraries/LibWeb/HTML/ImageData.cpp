@@ -10,6 +10,7 @@
 #include <LibWeb/Bindings/ImageDataPrototype.h>
 #include <LibWeb/Bindings/Intrinsics.h>
 #include <LibWeb/HTML/ImageData.h>
+#include <LibWeb/HTML/StructuredSerialize.h>
 #include <LibWeb/WebIDL/Buffers.h>
 #include <LibWeb/WebIDL/DOMException.h>
 #include <LibWeb/WebIDL/ExceptionOr.h>
@@ -18,6 +19,11 @@ namespace Web::HTML {
 
 JS_DEFINE_ALLOCATOR(ImageData);
 
+JS::NonnullGCPtr<ImageData> ImageData::create(JS::Realm& realm)
+{
+    return realm.heap().allocate<ImageData>(realm, realm);
+}
+
 // https://html.spec.whatwg.org/multipage/canvas.html#dom-imagedata
 WebIDL::ExceptionOr<JS::NonnullGCPtr<ImageData>> ImageData::create(JS::Realm& realm, u32 sw, u32 sh, Optional<ImageDataSettings> const&)
 {
@@ -84,6 +90,11 @@ WebIDL::ExceptionOr<JS::NonnullGCPtr<ImageData>> ImageData::construct_impl(JS::R
     return ImageData::create(realm, data, sw, move(sh), settings);
 }
 
+ImageData::ImageData(JS::Realm& realm)
+    : PlatformObject(realm)
+{
+}
+
 ImageData::ImageData(JS::Realm& realm, NonnullRefPtr<Gfx::Bitmap> bitmap, JS::NonnullGCPtr<JS::Uint8ClampedArray> data)
     : PlatformObject(realm)
     , m_bitmap(move(bitmap))
@@ -125,4 +136,50 @@ const JS::Uint8ClampedArray* ImageData::data() const
     return m_data;
 }
 
+// https://html.spec.whatwg.org/multipage/canvas.html#imagedata
+WebIDL::ExceptionOr<void> ImageData::serialization_steps(HTML::SerializationRecord& serialized, bool for_storage, HTML::SerializationMemory& memory)
+{
+    auto& vm = this->vm();
+
+    // 1. Set serialized.[[Data]] to the sub-serialization of the value of value's data attribute.
+    serialized.extend(TRY(HTML::structured_serialize_internal(vm, m_data, for_storage, memory)));
+
+    // 2. Set serialized.[[Width]] to the value of value's width attribute.
+    HTML::serialize_primitive_type(serialized, width());
+
+    // 3. Set serialized.[[Height]] to the value of value's height attribute.
+    HTML::serialize_primitive_type(serialized, height());
+
+    // FIXME: 4. Set serialized.[[ColorSpace]] to the value of value's colorSpace attribute.
+
+    return {};
+}
+
+// https://html.spec.whatwg.org/multipage/canvas.html#imagedata
+WebIDL::ExceptionOr<void> ImageData::deserialization_steps(ReadonlySpan<u8> const& serialized, size_t& position, HTML::DeserializationMemory& memory)
+{
+    auto& vm = this->vm();
+    auto& realm = this->realm();
+
+    // 1. Initialize value's data attribute to the sub-deserialization of serialized.[[Data]].
+    auto deserialized_record = TRY(HTML::structured_deserialize_internal(vm, serialized, realm, memory, position));
+    if (deserialized_record.value.has_value() && deserialized_record.value->is_object() && is<JS::Uint8ClampedArray>(deserialized_record.value->as_object()))
+        m_data = static_cast<JS::Uint8ClampedArray&>(deserialized_record.value->as_object());
+    position = deserialized_record.position;
+
+    // 2. Initialize value's width attribute to serialized.[[Width]].
+    auto width = HTML::deserialize_primitive_type<unsigned>(serialized, position);
+
+    // 3. Initialize value's height attribute to serialized.[[Height]].
+    auto height = HTML::deserialize_primitive_type<unsigned>(serialized, position);
+
+    // FIXME: 4. Initialize value's colorSpace attribute to serialized.[[ColorSpace]].
+
+    if (!m_data || m_data->data().size() != static_cast<size_t>(width) * height * 4)
+        return WebIDL::DataCloneError::create(realm, "Invalid ImageData"_fly_string);
+
+    m_bitmap = TRY_OR_THROW_OOM(vm, Gfx::Bitmap::create_wrapper(Gfx::BitmapFormat::RGBA8888, Gfx::IntSize(width, height), width * sizeof(u32), m_data->data().data()));
+    return {};
+}
+
 }
@@ -10,6 +10,7 @@
 #include <LibGfx/Forward.h>
 #include <LibWeb/Bindings/ImageDataPrototype.h>
 #include <LibWeb/Bindings/PlatformObject.h>
+#include <LibWeb/Bindings/Serializable.h>
 
 namespace Web::HTML {
 
@@ -17,11 +18,14 @@ struct ImageDataSettings {
     Bindings::PredefinedColorSpace color_space;
 };
 
-class ImageData final : public Bindings::PlatformObject {
+class ImageData final
+    : public Bindings::PlatformObject
+    , public Bindings::Serializable {
     WEB_PLATFORM_OBJECT(ImageData, Bindings::PlatformObject);
     JS_DECLARE_ALLOCATOR(ImageData);
 
 public:
+    [[nodiscard]] static JS::NonnullGCPtr<ImageData> create(JS::Realm&);
     [[nodiscard]] static WebIDL::ExceptionOr<JS::NonnullGCPtr<ImageData>> create(JS::Realm&, u32 sw, u32 sh, Optional<ImageDataSettings> const& settings = {});
     [[nodiscard]] static WebIDL::ExceptionOr<JS::NonnullGCPtr<ImageData>> create(JS::Realm&, JS::Handle<WebIDL::BufferSource> const& data, u32 sw, Optional<u32> sh = {}, Optional<ImageDataSettings> const& settings = {});
 
@@ -33,20 +37,26 @@ public:
     unsigned width() const;
     unsigned height() const;
 
-    Gfx::Bitmap& bitmap() { return m_bitmap; }
-    Gfx::Bitmap const& bitmap() const { return m_bitmap; }
+    Gfx::Bitmap& bitmap() { return *m_bitmap; }
+    Gfx::Bitmap const& bitmap() const { return *m_bitmap; }
 
     JS::Uint8ClampedArray* data();
     const JS::Uint8ClampedArray* data() const;
 
+    virtual StringView interface_name() const override { return "ImageData"sv; }
+    virtual WebIDL::ExceptionOr<void> serialization_steps(HTML::SerializationRecord&, bool for_storage, HTML::SerializationMemory&) override;
+    virtual WebIDL::ExceptionOr<void> deserialization_steps(ReadonlySpan<u8> const&, size_t& position, HTML::DeserializationMemory&) override;
+
 private:
+    explicit ImageData(JS::Realm&);
     ImageData(JS::Realm&, NonnullRefPtr<Gfx::Bitmap>, JS::NonnullGCPtr<JS::Uint8ClampedArray>);
 
     virtual void initialize(JS::Realm&) override;
     virtual void visit_edges(Cell::Visitor&) override;
 
-    NonnullRefPtr<Gfx::Bitmap> m_bitmap;
-    JS::NonnullGCPtr<JS::Uint8ClampedArray> m_data;
+    // NOTE: These are only null while an ImageData is being deserialized.
+    RefPtr<Gfx::Bitmap> m_bitmap;
+    JS::GCPtr<JS::Uint8ClampedArray> m_data;
 };
 
 }
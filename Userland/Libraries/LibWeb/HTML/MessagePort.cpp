@@ -224,7 +224,8 @@ WebIDL::ExceptionOr<void> MessagePort::message_port_post_message_steps(JS::GCPtr
     }
 
     // 5. Let serializeWithTransferResult be StructuredSerializeWithTransfer(message, transfer). Rethrow any exceptions.
-    auto serialize_with_transfer_result = TRY(structured_serialize_with_transfer(vm, message, transfer));
+    // NOTE: The message is always sent over IPC, even if the target port is in this process.
+    auto serialize_with_transfer_result = TRY(structured_serialize_with_transfer(vm, message, transfer, SerializationDestination::OtherProcess));
 
     // 6. If targetPort is null, or if doomed is true, then return.
     // IMPLEMENTATION DEFINED: Actually check the socket here, not the target port.
@@ -5,7 +5,9 @@
  */
 
 #include <AK/Debug.h>
+#include <LibCore/AllocationTracker.h>
 #include <LibCore/ElapsedTimer.h>
+#include <LibCore/Tracing.h>
 #include <LibJS/Bytecode/Interpreter.h>
 #include <LibWeb/Bindings/ExceptionOrUtils.h>
 #include <LibWeb/HTML/Scripting/ClassicScript.h>
@@ -83,6 +85,9 @@ JS::Completion ClassicScript::run(RethrowErrors rethrow_errors, JS::GCPtr<JS::En
     if (settings.can_run_script() == RunScriptDecision::DoNotRun)
         return JS::normal_completion({});
 
+    Core::Tracing::ScopedEvent trace_event { "Script"sv, "ClassicScript::run"sv };
+    Core::AllocationTracker::ScopedTag allocation_tag { "JS"sv };
+
     // 3. Prepare to run script given settings.
     settings.prepare_to_run_script();
 
@@ -66,8 +66,8 @@ PolicyContainer WorkerEnvironmentSettingsObject::policy_container()
 
 CanUseCrossOriginIsolatedAPIs WorkerEnvironmentSettingsObject::cross_origin_isolated_capability()
 {
-    // FIXME: Return worker global scope's cross-origin isolated capability.
-    return CanUseCrossOriginIsolatedAPIs::No;
+    // Return worker global scope's cross-origin isolated capability.
+    return m_global_scope->cross_origin_isolated_capability() ? CanUseCrossOriginIsolatedAPIs::Yes : CanUseCrossOriginIsolatedAPIs::No;
 }
 
 void WorkerEnvironmentSettingsObject::visit_edges(JS::Cell::Visitor& visitor)
@@ -5,6 +5,7 @@
  */
 
 #include <AK/HashTable.h>
+#include <LibCore/AllocationTracker.h>
 #include <LibGfx/Bitmap.h>
 #include <LibWeb/Fetch/Fetching/Fetching.h>
 #include <LibWeb/Fetch/Infrastructure/FetchAlgorithms.h>
@@ -158,6 +159,8 @@ void SharedImageRequest::handle_successful_fetch(URL::URL const& url_string, Str
         self.m_callbacks.clear();
     };
 
+    Core::AllocationTracker::ScopedTag allocation_tag { "Images"sv };
+
     if (is_svg_image) {
         auto result = SVG::SVGDecodedImageData::create(m_document->realm(), m_page, url_string, data);
         if (result.is_error()) {
@@ -44,6 +44,7 @@
 #include <LibWeb/Geometry/DOMQuad.h>
 #include <LibWeb/Geometry/DOMRect.h>
 #include <LibWeb/Geometry/DOMRectReadOnly.h>
+#include <LibWeb/HTML/ImageData.h>
 #include <LibWeb/HTML/MessagePort.h>
 #include <LibWeb/HTML/StructuredSerialize.h>
 #include <LibWeb/WebIDL/ExceptionOr.h>
@@ -55,12 +56,12 @@ namespace Web::HTML {
 // values (noted by their position in the list, one value following another).
 // This list represents the "memory" in the StructuredSerialize algorithm.
 // The first item in the list is the root, i.e., the value of everything.
-// The format is generally u32-aligned (hence this leaking out into the type)
+// The format is a plain sequence of bytes, without any alignment, and values are stored in host byte order.
 // Each value has a length based on its type, as defined below.
 //
 // (Should more redundancy be added, e.g., for lengths/positions of values?)
 
-enum ValueTag {
+enum ValueTag : u8 {
     // Unused, for ease of catching bugs.
     Empty,
 
@@ -70,17 +71,17 @@ enum ValueTag {
     // NullPrimitive is serialized indicating that the Type is Null, no value is serialized.
     NullPrimitive,
 
-    // Following u32 is the boolean value.
+    // Following byte is the boolean value.
     BooleanPrimitive,
 
-    // Following two u32s are the double value.
+    // Following eight bytes are the double value.
     NumberPrimitive,
 
     // The BigIntPrimitive is serialized as a string in base 10 representation.
-    // Following two u32s representing the length of the string, then the following u32s, equal to size, is the string representation.
+    // Following u64 is the length of the string in bytes, followed by the UTF-8 string representation.
     BigIntPrimitive,
 
-    // Following two u32s representing the length of the string, then the following u32s, equal to size, is the string representation.
+    // Following u64 is the length of the string in bytes, followed by the UTF-8 string representation.
     StringPrimitive,
 
     BooleanObject,
@@ -97,10 +98,15 @@ enum ValueTag {
 
     GrowableSharedArrayBuffer,
 
+    // Following byte is a SharedArrayBufferStorage, followed by the u32 index of the Shared Data Block in the
+    // SerializedTransferRecord's shared data blocks or of its memory in the record's shared buffers, followed by the u64
+    // byte length. The memory itself is shared with the deserialized value, not copied.
     SharedArrayBuffer,
 
     ResizeableArrayBuffer,
 
+    // Following byte is an ArrayBufferStorage. Inline data follows as a u64 length and the bytes themselves, data in
+    // shared memory as the u32 index of its buffer in the SerializedTransferRecord's shared buffers.
     ArrayBuffer,
 
     ArrayBufferView,
@@ -115,6 +121,7 @@ enum ValueTag {
 
     Object,
 
+    // Following u32 is the index of the value in the memory.
     ObjectReference,
 
     SerializableObject,
@@ -125,6 +132,20 @@ enum ValueTag {
     ValueTagMax,
 };
 
+enum class ArrayBufferStorage : u8 {
+    Inline,
+    SharedMemory,
+};
+
+enum class SharedArrayBufferStorage : u8 {
+    SharedDataBlock,
+    SharedMemory,
+};
+
+// Buffers at least this large are moved to shared memory when the record is sent to another process, where the cost of
+// setting up the mapping is made up for by not having to copy the data into and out of the IPC message.
+static constexpr size_t minimum_size_for_shared_memory = 64 * KiB;
+
 enum ErrorType {
     Error,
 #define __JS_ENUMERATE(ClassName, snake_name, PrototypeName, ConstructorName, ArrayType) \
@@ -160,9 +181,10 @@ public:
     WebIDL::ExceptionOr<SerializationRecord> serialize(JS::Value value)
     {
         // 2. If memory[value] exists, then return memory[value].
-        if (m_memory.contains(value)) {
-            auto index = m_memory.get(value).value();
-            return Vector<u32> { ValueTag::ObjectReference, index };
+        if (auto index = m_memory.indices.get(value); index.has_value()) {
+            serialize_enum(m_serialized, ValueTag::ObjectReference);
+            serialize_primitive_type(m_serialized, *index);
+            return m_serialized;
         }
 
         // 3. Let deep be false.
@@ -239,7 +261,7 @@ public:
 
         // 13. Otherwise, if value has an [[ArrayBufferData]] internal slot, then:
         else if (value.is_object() && is<JS::ArrayBuffer>(value.as_object())) {
-            TRY(serialize_array_buffer(m_vm, m_serialized, static_cast<JS::ArrayBuffer&>(value.as_object()), m_for_storage));
+            TRY(serialize_array_buffer(m_vm, m_serialized, static_cast<JS::ArrayBuffer&>(value.as_object()), m_for_storage, m_memory));
         }
 
         // 14. Otherwise, if value has a [[ViewedArrayBuffer]] internal slot, then:
@@ -348,7 +370,9 @@ public:
         }
 
         // 25. Set memory[value] to serialized.
-        m_memory.set(make_handle(value), m_next_id++);
+        // NOTE: Values are numbered in the order in which they are first serialized, which is the order in which they
+        //       are added to the memory when deserializing.
+        m_memory.indices.set(make_handle(value), m_memory.indices.size());
 
         // 26. If deep is true, then:
         if (deep) {
@@ -366,7 +390,7 @@ public:
                     copied_list.append(entry.value);
                 }
                 u64 size = map.map_size();
-                m_serialized.append(bit_cast<u32*>(&size), 2);
+                serialize_primitive_type(m_serialized, size);
                 // 3. For each Record { [[Key]], [[Value]] } entry of copiedList:
                 for (auto copied_value : copied_list) {
                     // 1. Let serializedKey be ? StructuredSerializeInternal(entry.[[Key]], forStorage, memory).
@@ -439,8 +463,7 @@ public:
 
 private:
     JS::VM& m_vm;
-    SerializationMemory& m_memory; // JS value -> index
-    u32 m_next_id { 0 };
+    SerializationMemory& m_memory;
     SerializationRecord m_serialized;
     bool m_for_storage { false };
 };
@@ -521,50 +544,67 @@ WebIDL::ExceptionOr<void> serialize_reg_exp_object(JS::VM& vm, SerializationReco
     return {};
 }
 
-WebIDL::ExceptionOr<void> serialize_bytes(JS::VM& vm, Vector<u32>& vector, ReadonlyBytes bytes)
+WebIDL::ExceptionOr<void> serialize_bytes(JS::VM& vm, SerializationRecord& serialized, ReadonlyBytes bytes)
 {
     // Append size of the buffer to the serialized structure.
     u64 const size = bytes.size();
-    serialize_primitive_type(vector, size);
+    serialize_primitive_type(serialized, size);
     // Append the bytes of the buffer to the serialized structure.
-    u64 byte_position = 0;
-    while (byte_position < size) {
-        u32 combined_value = 0;
-        for (u8 i = 0; i < 4; ++i) {
-            u8 const byte = bytes[byte_position];
-            combined_value |= byte << (i * 8);
-            byte_position++;
-            if (byte_position == size)
-                break;
-        }
-        TRY_OR_THROW_OOM(vm, vector.try_append(combined_value));
-    }
+    TRY_OR_THROW_OOM(vm, serialized.try_append(bytes.data(), bytes.size()));
     return {};
 }
 
-WebIDL::ExceptionOr<void> serialize_string(JS::VM& vm, Vector<u32>& vector, DeprecatedFlyString const& string)
+WebIDL::ExceptionOr<void> serialize_string(JS::VM& vm, SerializationRecord& serialized, DeprecatedFlyString const& string)
 {
-    return serialize_bytes(vm, vector, string.view().bytes());
+    return serialize_bytes(vm, serialized, string.view().bytes());
 }
 
-WebIDL::ExceptionOr<void> serialize_string(JS::VM& vm, Vector<u32>& vector, String const& string)
+WebIDL::ExceptionOr<void> serialize_string(JS::VM& vm, SerializationRecord& serialized, String const& string)
 {
-    return serialize_bytes(vm, vector, { string.code_points().bytes(), string.code_points().byte_length() });
+    return serialize_bytes(vm, serialized, { string.code_points().bytes(), string.code_points().byte_length() });
 }
 
-WebIDL::ExceptionOr<void> serialize_string(JS::VM& vm, Vector<u32>& vector, JS::PrimitiveString const& primitive_string)
+WebIDL::ExceptionOr<void> serialize_string(JS::VM& vm, SerializationRecord& serialized, JS::PrimitiveString const& primitive_string)
 {
     auto string = primitive_string.utf8_string();
-    TRY(serialize_string(vm, vector, string));
+    TRY(serialize_string(vm, serialized, string));
     return {};
 }
 
-WebIDL::ExceptionOr<void> serialize_array_buffer(JS::VM& vm, Vector<u32>& vector, JS::ArrayBuffer const& array_buffer, bool for_storage)
+// Copies the data into a new shared buffer, and returns the buffer's index in the list.
+static WebIDL::ExceptionOr<u32> append_shared_buffer(JS::VM& vm, Vector<Core::AnonymousBuffer>& shared_buffers, ReadonlyBytes data)
+{
+    // NOTE: Shared memory can't be empty, so empty data is represented by an invalid buffer.
+    Core::AnonymousBuffer buffer;
+    if (!data.is_empty()) {
+        auto buffer_or_error = Core::AnonymousBuffer::create_with_size(data.size());
+        if (buffer_or_error.is_error())
+            return WebIDL::DataCloneError::create(*vm.current_realm(), "Failed to allocate shared memory"_fly_string);
+        buffer = buffer_or_error.release_value();
+        memcpy(buffer.data<u8>(), data.data(), data.size());
+    }
+
+    TRY_OR_THROW_OOM(vm, shared_buffers.try_append(move(buffer)));
+    return shared_buffers.size() - 1;
+}
+
+static WebIDL::ExceptionOr<ByteBuffer> copy_shared_buffer(JS::VM& vm, ReadonlySpan<Core::AnonymousBuffer> shared_buffers, u32 index)
+{
+    if (index >= shared_buffers.size())
+        return WebIDL::DataCloneError::create(*vm.current_realm(), "Invalid shared buffer"_fly_string);
+
+    auto const& buffer = shared_buffers[index];
+    if (!buffer.is_valid())
+        return ByteBuffer {};
+    return TRY_OR_THROW_OOM(vm, ByteBuffer::copy(buffer.data<u8>(), buffer.size()));
+}
+
+WebIDL::ExceptionOr<void> serialize_array_buffer(JS::VM& vm, SerializationRecord& serialized, JS::ArrayBuffer const& array_buffer, bool for_storage, SerializationMemory& memory)
 {
     // 13. Otherwise, if value has an [[ArrayBufferData]] internal slot, then:
 
-    // FIXME: 1.  If IsSharedArrayBuffer(value) is true, then:
-    if (false) {
+    // 1. If IsSharedArrayBuffer(value) is true, then:
+    if (array_buffer.is_shared_array_buffer()) {
         // 1. If the current settings object's cross-origin isolated capability is false, then throw a "DataCloneError" DOMException.
         // NOTE: This check is only needed when serializing (and not when deserializing) as the cross-origin isolated capability cannot change
         //       over time and a SharedArrayBuffer cannot leave an agent cluster.
@@ -578,8 +618,30 @@ WebIDL::ExceptionOr<void> serialize_array_buffer(JS::VM& vm, Vector<u32>& vector
         // FIXME: 3. If value has an [[ArrayBufferMaxByteLength]] internal slot, then set serialized to { [[Type]]: "GrowableSharedArrayBuffer",
         //           [[ArrayBufferData]]: value.[[ArrayBufferData]], [[ArrayBufferByteLengthData]]: value.[[ArrayBufferByteLengthData]],
         //           [[ArrayBufferMaxByteLength]]: value.[[ArrayBufferMaxByteLength]], [[AgentCluster]]: the surrounding agent's agent cluster }.
-        // FIXME: 4. Otherwise, set serialized to { [[Type]]: "SharedArrayBuffer", [[ArrayBufferData]]: value.[[ArrayBufferData]],
-        //           [[ArrayBufferByteLength]]: value.[[ArrayBufferByteLength]], [[AgentCluster]]: the surrounding agent's agent cluster }.
+        // 4. Otherwise, set serialized to { [[Type]]: "SharedArrayBuffer", [[ArrayBufferData]]: value.[[ArrayBufferData]],
+        //    [[ArrayBufferByteLength]]: value.[[ArrayBufferByteLength]], [[AgentCluster]]: the surrounding agent's agent cluster }.
+        // NOTE: A record that stays in this process carries the data block itself. The agents of a cluster may live in different
+        //       processes though, so a record that is sent to another process references the block by the shared memory backing it.
+        auto const& block = *array_buffer.shared_data_block();
+        if (memory.shared_data_blocks.has_value()) {
+            TRY_OR_THROW_OOM(vm, memory.shared_data_blocks->try_append(block));
+
+            serialize_enum(serialized, ValueTag::SharedArrayBuffer);
+            serialize_enum(serialized, SharedArrayBufferStorage::SharedDataBlock);
+            serialize_primitive_type(serialized, static_cast<u32>(memory.shared_data_blocks->size() - 1));
+        } else if (memory.shared_buffers.has_value()) {
+            auto shared_buffer = block.shared_buffer();
+            if (shared_buffer.is_error())
+                return WebIDL::DataCloneError::create(*vm.current_realm(), "Cannot move SharedArrayBuffer into shared memory"_fly_string);
+            TRY_OR_THROW_OOM(vm, memory.shared_buffers->try_append(shared_buffer.release_value()));
+
+            serialize_enum(serialized, ValueTag::SharedArrayBuffer);
+            serialize_enum(serialized, SharedArrayBufferStorage::SharedMemory);
+            serialize_primitive_type(serialized, static_cast<u32>(memory.shared_buffers->size() - 1));
+        } else {
+            return WebIDL::DataCloneError::create(*vm.current_realm(), "Cannot serialize SharedArrayBuffer outside of its agent cluster"_fly_string);
+        }
+        serialize_primitive_type(serialized, static_cast<u64>(block.size()));
     }
     // 2. Otherwise:
     else {
@@ -592,10 +654,10 @@ WebIDL::ExceptionOr<void> serialize_array_buffer(JS::VM& vm, Vector<u32>& vector
 
         // 3. Let dataCopy be ? CreateByteDataBlock(size).
         //    NOTE: This can throw a RangeError exception upon allocation failure.
-        auto data_copy = TRY(JS::create_byte_data_block(vm, size));
-
         // 4. Perform CopyDataBlockBytes(dataCopy, 0, value.[[ArrayBufferData]], 0, size).
-        JS::copy_data_block_bytes(data_copy.buffer(), 0, array_buffer.buffer(), 0, size);
+        // IMPLEMENTATION DEFINED: The data is copied straight into the record, or into shared memory if it is large and
+        //                         the record is sent to another process, rather than into an intermediate data block.
+        auto data = array_buffer.buffer().bytes().trim(size);
 
         // FIXME: 5. If value has an [[ArrayBufferMaxByteLength]] internal slot, then set serialized to { [[Type]]: "ResizableArrayBuffer",
         //    [[ArrayBufferData]]: dataCopy, [[ArrayBufferByteLength]]: size, [[ArrayBufferMaxByteLength]]: value.[[ArrayBufferMaxByteLength]] }.
@@ -603,15 +665,22 @@ WebIDL::ExceptionOr<void> serialize_array_buffer(JS::VM& vm, Vector<u32>& vector
         }
         // 6. Otherwise, set serialized to { [[Type]]: "ArrayBuffer", [[ArrayBufferData]]: dataCopy, [[ArrayBufferByteLength]]: size }.
         else {
-            serialize_enum(vector, ValueTag::ArrayBuffer);
-            TRY(serialize_bytes(vm, vector, data_copy.buffer().bytes()));
+            serialize_enum(serialized, ValueTag::ArrayBuffer);
+
+            if (memory.shared_buffers.has_value() && size >= minimum_size_for_shared_memory) {
+                serialize_enum(serialized, ArrayBufferStorage::SharedMemory);
+                serialize_primitive_type(serialized, TRY(append_shared_buffer(vm, *memory.shared_buffers, data)));
+            } else {
+                serialize_enum(serialized, ArrayBufferStorage::Inline);
+                TRY(serialize_bytes(vm, serialized, data));
+            }
         }
     }
     return {};
 }
 
 template<OneOf<JS::TypedArrayBase, JS::DataView> ViewType>
-WebIDL::ExceptionOr<void> serialize_viewed_array_buffer(JS::VM& vm, Vector<u32>& vector, ViewType const& view, bool for_storage, SerializationMemory& memory)
+WebIDL::ExceptionOr<void> serialize_viewed_array_buffer(JS::VM& vm, SerializationRecord& serialized, ViewType const& view, bool for_storage, SerializationMemory& memory)
 {
     // 14. Otherwise, if value has a [[ViewedArrayBuffer]] internal slot, then:
 
@@ -639,17 +708,17 @@ WebIDL::ExceptionOr<void> serialize_viewed_array_buffer(JS::VM& vm, Vector<u32>&
     auto buffer_serialized = TRY(structured_serialize_internal(vm, JS::Value(buffer), for_storage, memory));
 
     // 4. Assert: bufferSerialized.[[Type]] is "ArrayBuffer", "ResizableArrayBuffer", "SharedArrayBuffer", or "GrowableSharedArrayBuffer".
-    // NOTE: We currently only implement this for ArrayBuffer
-    VERIFY(buffer_serialized[0] == ValueTag::ArrayBuffer);
+    // NOTE: We currently only implement this for ArrayBuffer and SharedArrayBuffer. The buffer may also have been serialized already, by another view.
+    VERIFY(buffer_serialized[0] == ValueTag::ArrayBuffer || buffer_serialized[0] == ValueTag::SharedArrayBuffer || buffer_serialized[0] == ValueTag::ObjectReference);
 
     // 5. If value has a [[DataView]] internal slot, then set serialized to { [[Type]]: "ArrayBufferView", [[Constructor]]: "DataView",
     //    [[ArrayBufferSerialized]]: bufferSerialized, [[ByteLength]]: value.[[ByteLength]], [[ByteOffset]]: value.[[ByteOffset]] }.
     if constexpr (IsSame<ViewType, JS::DataView>) {
-        serialize_enum(vector, ValueTag::ArrayBufferView);
-        vector.extend(move(buffer_serialized));               // [[ArrayBufferSerialized]]
-        TRY(serialize_string(vm, vector, "DataView"_string)); // [[Constructor]]
-        serialize_primitive_type(vector, JS::get_view_byte_length(view_record));
-        serialize_primitive_type(vector, view.byte_offset());
+        serialize_enum(serialized, ValueTag::ArrayBufferView);
+        serialized.extend(move(buffer_serialized));               // [[ArrayBufferSerialized]]
+        TRY(serialize_string(vm, serialized, "DataView"_string)); // [[Constructor]]
+        serialize_primitive_type(serialized, JS::get_view_byte_length(view_record));
+        serialize_primitive_type(serialized, static_cast<u32>(view.byte_offset()));
     }
 
     // 6. Otherwise:
@@ -659,21 +728,21 @@ WebIDL::ExceptionOr<void> serialize_viewed_array_buffer(JS::VM& vm, Vector<u32>&
         // 2. Set serialized to { [[Type]]: "ArrayBufferView", [[Constructor]]: value.[[TypedArrayName]],
         //    [[ArrayBufferSerialized]]: bufferSerialized, [[ByteLength]]: value.[[ByteLength]],
         //    [[ByteOffset]]: value.[[ByteOffset]], [[ArrayLength]]: value.[[ArrayLength]] }.
-        serialize_enum(vector, ValueTag::ArrayBufferView);
-        vector.extend(move(buffer_serialized));                 // [[ArrayBufferSerialized]]
-        TRY(serialize_string(vm, vector, view.element_name())); // [[Constructor]]
-        serialize_primitive_type(vector, JS::typed_array_byte_length(view_record));
-        serialize_primitive_type(vector, view.byte_offset());
-        serialize_primitive_type(vector, JS::typed_array_length(view_record));
+        serialize_enum(serialized, ValueTag::ArrayBufferView);
+        serialized.extend(move(buffer_serialized));                 // [[ArrayBufferSerialized]]
+        TRY(serialize_string(vm, serialized, view.element_name())); // [[Constructor]]
+        serialize_primitive_type(serialized, JS::typed_array_byte_length(view_record));
+        serialize_primitive_type(serialized, view.byte_offset());
+        serialize_primitive_type(serialized, JS::typed_array_length(view_record));
     }
     return {};
 }
-template WebIDL::ExceptionOr<void> serialize_viewed_array_buffer(JS::VM& vm, Vector<u32>& vector, JS::TypedArrayBase const& view, bool for_storage, SerializationMemory& memory);
-template WebIDL::ExceptionOr<void> serialize_viewed_array_buffer(JS::VM& vm, Vector<u32>& vector, JS::DataView const& view, bool for_storage, SerializationMemory& memory);
+template WebIDL::ExceptionOr<void> serialize_viewed_array_buffer(JS::VM& vm, SerializationRecord& serialized, JS::TypedArrayBase const& view, bool for_storage, SerializationMemory& memory);
+template WebIDL::ExceptionOr<void> serialize_viewed_array_buffer(JS::VM& vm, SerializationRecord& serialized, JS::DataView const& view, bool for_storage, SerializationMemory& memory);
 
 class Deserializer {
 public:
-    Deserializer(JS::VM& vm, JS::Realm& target_realm, ReadonlySpan<u32> serialized, DeserializationMemory& memory, Optional<size_t> position = {})
+    Deserializer(JS::VM& vm, JS::Realm& target_realm, ReadonlySpan<u8> serialized, DeserializationMemory& memory, Optional<size_t> position = {})
         : m_vm(vm)
         , m_serialized(serialized)
         , m_memory(memory)
@@ -691,11 +760,10 @@ public:
 
         // 2. If memory[serialized] exists, then return memory[serialized].
         if (tag == ValueTag::ObjectReference) {
-            auto index = m_serialized[m_position++];
-            if (index == NumericLimits<u32>::max()) {
-                return JS::Object::create(*m_vm.current_realm(), nullptr);
-            }
-            return m_memory[index];
+            auto index = deserialize_primitive_type<u32>(m_serialized, m_position);
+            if (index >= m_memory.values.size())
+                return WebIDL::DataCloneError::create(*m_vm.current_realm(), "Invalid object reference"_fly_string);
+            return m_memory.values[index];
         }
 
         // 3. Let deep be false.
@@ -770,13 +838,44 @@ public:
             value = TRY(deserialize_reg_exp_object(*m_vm.current_realm(), m_serialized, m_position));
             break;
         }
-        // FIXME: 12. Otherwise, if serialized.[[Type]] is "SharedArrayBuffer", then:
+        // 12. Otherwise, if serialized.[[Type]] is "SharedArrayBuffer", then:
+        case ValueTag::SharedArrayBuffer: {
+            auto storage = deserialize_primitive_type<SharedArrayBufferStorage>(m_serialized, m_position);
+            auto index = deserialize_primitive_type<u32>(m_serialized, m_position);
+            auto byte_length = deserialize_primitive_type<u64>(m_serialized, m_position);
+
+            // FIXME: 1. If targetRealm's corresponding agent cluster is not serialized.[[AgentCluster]], then throw a "DataCloneError" DOMException.
+            //        NOTE: Records are only sent to agents of the same cluster, and we have no way of telling clusters apart yet.
+
+            // 2. Otherwise, set value to a new SharedArrayBuffer object in targetRealm whose [[ArrayBufferData]] internal slot value is serialized.[[ArrayBufferData]]
+            //    and whose [[ArrayBufferByteLength]] internal slot value is serialized.[[ArrayBufferByteLength]].
+            if (storage == SharedArrayBufferStorage::SharedDataBlock) {
+                if (index >= m_memory.shared_data_blocks.size() || m_memory.shared_data_blocks[index].size() != byte_length)
+                    return WebIDL::DataCloneError::create(*m_vm.current_realm(), "Invalid shared data block"_fly_string);
+                value = JS::ArrayBuffer::create_shared(*m_vm.current_realm(), m_memory.shared_data_blocks[index]);
+                break;
+            }
+
+            if (index >= m_memory.shared_buffers.size())
+                return WebIDL::DataCloneError::create(*m_vm.current_realm(), "Invalid shared buffer"_fly_string);
+            auto block = JS::SharedDataBlock::create_from_buffer(m_memory.shared_buffers[index], byte_length);
+            if (block.is_error())
+                return WebIDL::DataCloneError::create(*m_vm.current_realm(), "Invalid shared buffer"_fly_string);
+            value = JS::ArrayBuffer::create_shared(*m_vm.current_realm(), block.release_value());
+            break;
+        }
         // FIXME: 13. Otherwise, if serialized.[[Type]] is "GrowableSharedArrayBuffer", then:
         // 14. Otherwise, if serialized.[[Type]] is "ArrayBuffer", then set value to a new ArrayBuffer object in targetRealm whose [[ArrayBufferData]] internal slot value is serialized.[[ArrayBufferData]], and whose [[ArrayBufferByteLength]] internal slot value is serialized.[[ArrayBufferByteLength]].
         case ValueTag::ArrayBuffer: {
             auto* realm = m_vm.current_realm();
+            auto storage = deserialize_primitive_type<ArrayBufferStorage>(m_serialized, m_position);
+
             // If this throws an exception, catch it, and then throw a "DataCloneError" DOMException.
-            auto bytes_or_error = deserialize_bytes(m_vm, m_serialized, m_position);
+            auto bytes_or_error = [&]() -> WebIDL::ExceptionOr<ByteBuffer> {
+                if (storage == ArrayBufferStorage::SharedMemory)
+                    return copy_shared_buffer(m_vm, m_memory.shared_buffers, deserialize_primitive_type<u32>(m_serialized, m_position));
+                return deserialize_bytes(m_vm, m_serialized, m_position);
+            }();
             if (bytes_or_error.is_error())
                 return WebIDL::DataCloneError::create(*m_vm.current_realm(), "out of memory"_fly_string);
             value = JS::ArrayBuffer::create(*realm, bytes_or_error.release_value());
@@ -904,7 +1003,7 @@ public:
         // 23. Set memory[serialized] to value.
         // IMPLEMENTATION DEFINED: We don't add primitive values to the memory to match the serialization indices (which also doesn't add them)
         if (!is_primitive)
-            m_memory.append(value);
+            m_memory.values.append(value);
 
         // 24. If deep is true, then:
         if (deep) {
@@ -972,8 +1071,8 @@ public:
 
 private:
     JS::VM& m_vm;
-    ReadonlySpan<u32> m_serialized;
-    JS::MarkedVector<JS::Value> m_memory; // Index -> JS value
+    ReadonlySpan<u8> m_serialized;
+    DeserializationMemory& m_memory;
     size_t m_position { 0 };
 
     static WebIDL::ExceptionOr<JS::NonnullGCPtr<Bindings::PlatformObject>> create_serialized_type(StringView interface_name, JS::Realm& realm)
@@ -1000,6 +1099,8 @@ private:
             return Crypto::CryptoKey::create(realm);
         if (interface_name == "DOMQuad"sv)
             return Geometry::DOMQuad::create(realm);
+        if (interface_name == "ImageData"sv)
+            return HTML::ImageData::create(realm);
 
         VERIFY_NOT_REACHED();
     }
@@ -1013,88 +1114,81 @@ private:
     }
 };
 
-bool deserialize_boolean_primitive(ReadonlySpan<u32> const& serialized, size_t& position)
+bool deserialize_boolean_primitive(ReadonlySpan<u8> const& serialized, size_t& position)
 {
     return deserialize_primitive_type<bool>(serialized, position);
 }
 
-double deserialize_number_primitive(ReadonlySpan<u32> const& serialized, size_t& position)
+double deserialize_number_primitive(ReadonlySpan<u8> const& serialized, size_t& position)
 {
     return deserialize_primitive_type<double>(serialized, position);
 }
 
-JS::NonnullGCPtr<JS::BooleanObject> deserialize_boolean_object(JS::Realm& realm, ReadonlySpan<u32> const& serialized, size_t& position)
+JS::NonnullGCPtr<JS::BooleanObject> deserialize_boolean_object(JS::Realm& realm, ReadonlySpan<u8> const& serialized, size_t& position)
 {
     auto boolean_primitive = deserialize_boolean_primitive(serialized, position);
     return JS::BooleanObject::create(realm, boolean_primitive);
 }
 
-JS::NonnullGCPtr<JS::NumberObject> deserialize_number_object(JS::Realm& realm, ReadonlySpan<u32> const& serialized, size_t& position)
+JS::NonnullGCPtr<JS::NumberObject> deserialize_number_object(JS::Realm& realm, ReadonlySpan<u8> const& serialized, size_t& position)
 {
     auto number_primitive = deserialize_number_primitive(serialized, position);
     return JS::NumberObject::create(realm, number_primitive);
 }
 
-WebIDL::ExceptionOr<JS::NonnullGCPtr<JS::BigIntObject>> deserialize_big_int_object(JS::Realm& realm, ReadonlySpan<u32> const& serialized, size_t& position)
+WebIDL::ExceptionOr<JS::NonnullGCPtr<JS::BigIntObject>> deserialize_big_int_object(JS::Realm& realm, ReadonlySpan<u8> const& serialized, size_t& position)
 {
     auto big_int_primitive = TRY(deserialize_big_int_primitive(realm.vm(), serialized, position));
     return JS::BigIntObject::create(realm, big_int_primitive);
 }
 
-WebIDL::ExceptionOr<JS::NonnullGCPtr<JS::StringObject>> deserialize_string_object(JS::Realm& realm, ReadonlySpan<u32> const& serialized, size_t& position)
+WebIDL::ExceptionOr<JS::NonnullGCPtr<JS::StringObject>> deserialize_string_object(JS::Realm& realm, ReadonlySpan<u8> const& serialized, size_t& position)
 {
     auto string_primitive = TRY(deserialize_string_primitive(realm.vm(), serialized, position));
     return JS::StringObject::create(realm, string_primitive, realm.intrinsics().string_prototype());
 }
 
-JS::NonnullGCPtr<JS::Date> deserialize_date_object(JS::Realm& realm, ReadonlySpan<u32> const& serialized, size_t& position)
+JS::NonnullGCPtr<JS::Date> deserialize_date_object(JS::Realm& realm, ReadonlySpan<u8> const& serialized, size_t& position)
 {
     auto double_value = deserialize_primitive_type<double>(serialized, position);
     return JS::Date::create(realm, double_value);
 }
 
-WebIDL::ExceptionOr<JS::NonnullGCPtr<JS::RegExpObject>> deserialize_reg_exp_object(JS::Realm& realm, ReadonlySpan<u32> const& serialized, size_t& position)
+WebIDL::ExceptionOr<JS::NonnullGCPtr<JS::RegExpObject>> deserialize_reg_exp_object(JS::Realm& realm, ReadonlySpan<u8> const& serialized, size_t& position)
 {
     auto pattern = TRY(deserialize_string_primitive(realm.vm(), serialized, position));
     auto flags = TRY(deserialize_string_primitive(realm.vm(), serialized, position));
     return TRY(JS::regexp_create(realm.vm(), move(pattern), move(flags)));
 }
 
-WebIDL::ExceptionOr<ByteBuffer> deserialize_bytes(JS::VM& vm, ReadonlySpan<u32> vector, size_t& position)
+WebIDL::ExceptionOr<ByteBuffer> deserialize_bytes(JS::VM& vm, ReadonlySpan<u8> serialized, size_t& position)
 {
-    u64 const size = deserialize_primitive_type<u64>(vector, position);
-
-    auto bytes = TRY_OR_THROW_OOM(vm, ByteBuffer::create_uninitialized(size));
-    u64 byte_position = 0;
-    while (position < vector.size() && byte_position < size) {
-        for (u8 i = 0; i < 4; ++i) {
-            bytes[byte_position++] = (vector[position] >> (i * 8) & 0xFF);
-            if (byte_position == size)
-                break;
-        }
-        position++;
-    }
+    u64 const size = deserialize_primitive_type<u64>(serialized, position);
+    VERIFY(size <= serialized.size() - position);
+
+    auto bytes = TRY_OR_THROW_OOM(vm, ByteBuffer::copy(serialized.slice(position, size)));
+    position += size;
     return bytes;
 }
 
-WebIDL::ExceptionOr<String> deserialize_string(JS::VM& vm, ReadonlySpan<u32> vector, size_t& position)
+WebIDL::ExceptionOr<String> deserialize_string(JS::VM& vm, ReadonlySpan<u8> serialized, size_t& position)
 {
-    auto bytes = TRY(deserialize_bytes(vm, vector, position));
+    auto bytes = TRY(deserialize_bytes(vm, serialized, position));
     return TRY_OR_THROW_OOM(vm, String::from_utf8(StringView { bytes }));
 }
 
-WebIDL::ExceptionOr<JS::NonnullGCPtr<JS::PrimitiveString>> deserialize_string_primitive(JS::VM& vm, ReadonlySpan<u32> vector, size_t& position)
+WebIDL::ExceptionOr<JS::NonnullGCPtr<JS::PrimitiveString>> deserialize_string_primitive(JS::VM& vm, ReadonlySpan<u8> serialized, size_t& position)
 {
-    auto bytes = TRY(deserialize_bytes(vm, vector, position));
+    auto bytes = TRY(deserialize_bytes(vm, serialized, position));
 
     return TRY(Bindings::throw_dom_exception_if_needed(vm, [&vm, &bytes]() {
         return JS::PrimitiveString::create(vm, StringView { bytes });
     }));
 }
 
-WebIDL::ExceptionOr<JS::NonnullGCPtr<JS::BigInt>> deserialize_big_int_primitive(JS::VM& vm, ReadonlySpan<u32> vector, size_t& position)
+WebIDL::ExceptionOr<JS::NonnullGCPtr<JS::BigInt>> deserialize_big_int_primitive(JS::VM& vm, ReadonlySpan<u8> serialized, size_t& position)
 {
-    auto string = TRY(deserialize_string_primitive(vm, vector, position));
+    auto string = TRY(deserialize_string_primitive(vm, serialized, position));
     auto string_view = TRY(Bindings::throw_dom_exception_if_needed(vm, [&string]() {
         return string->utf8_string_view();
     }));
@@ -1103,30 +1197,38 @@ WebIDL::ExceptionOr<JS::NonnullGCPtr<JS::BigInt>> deserialize_big_int_primitive(
 }
 
 // https://html.spec.whatwg.org/multipage/structured-data.html#structuredserializewithtransfer
-WebIDL::ExceptionOr<SerializedTransferRecord> structured_serialize_with_transfer(JS::VM& vm, JS::Value value, Vector<JS::Handle<JS::Object>> const& transfer_list)
+WebIDL::ExceptionOr<SerializedTransferRecord> structured_serialize_with_transfer(JS::VM& vm, JS::Value value, Vector<JS::Handle<JS::Object>> const& transfer_list, SerializationDestination destination)
 {
     // 1. Let memory be an empty map.
     SerializationMemory memory = {};
 
+    // IMPLEMENTATION DEFINED: A record that is sent to another process moves its large buffers out of the IPC message.
+    if (destination == SerializationDestination::OtherProcess)
+        memory.shared_buffers = Vector<Core::AnonymousBuffer> {};
+    else
+        memory.shared_data_blocks = Vector<JS::SharedDataBlock> {};
+
     // 2. For each transferable of transferList:
     for (auto const& transferable : transfer_list) {
 
         // 1. If transferable has neither an [[ArrayBufferData]] internal slot nor a [[Detached]] internal slot, then throw a "DataCloneError" DOMException.
-        // FIXME: Handle transferring ArrayBufferData objects
-        if (!is<Bindings::Transferable>(*transferable)) {
+        if (!is<JS::ArrayBuffer>(*transferable) && !is<Bindings::Transferable>(*transferable)) {
             return WebIDL::DataCloneError::create(*vm.current_realm(), "Cannot transfer type"_fly_string);
         }
 
-        // FIXME: 2. If transferable has an [[ArrayBufferData]] internal slot and IsSharedArrayBuffer(transferable) is true, then throw a "DataCloneError" DOMException.
+        // 2. If transferable has an [[ArrayBufferData]] internal slot and IsSharedArrayBuffer(transferable) is true, then throw a "DataCloneError" DOMException.
+        if (is<JS::ArrayBuffer>(*transferable) && static_cast<JS::ArrayBuffer&>(*transferable).is_shared_array_buffer())
+            return WebIDL::DataCloneError::create(*vm.current_realm(), "Cannot transfer SharedArrayBuffer"_fly_string);
 
         // 3. If memory[transferable] exists, then throw a "DataCloneError" DOMException.
         auto transferable_value = JS::Value(transferable);
-        if (memory.contains(transferable_value)) {
+        if (memory.indices.contains(transferable_value)) {
             return WebIDL::DataCloneError::create(*vm.current_realm(), "Cannot transfer value twice"_fly_string);
         }
 
         // 4. Set memory[transferable] to { [[Type]]: an uninitialized value }.
-        memory.set(JS::make_handle(transferable_value), NumericLimits<u32>::max());
+        // NOTE: Transferred values are the first values added to the memory when deserializing, in the same order.
+        memory.indices.set(JS::make_handle(transferable_value), memory.indices.size());
     }
 
     // 3. Let serialized be ? StructuredSerializeInternal(value, false, memory).
@@ -1138,7 +1240,9 @@ WebIDL::ExceptionOr<SerializedTransferRecord> structured_serialize_with_transfer
 
     // 5. For each transferable of transferList:
     for (auto& transferable : transfer_list) {
-        // 1. FIXME: If transferable has an [[ArrayBufferData]] internal slot and IsDetachedBuffer(transferable) is true, then throw a "DataCloneError" DOMException.
+        // 1. If transferable has an [[ArrayBufferData]] internal slot and IsDetachedBuffer(transferable) is true, then throw a "DataCloneError" DOMException.
+        if (is<JS::ArrayBuffer>(*transferable) && static_cast<JS::ArrayBuffer&>(*transferable).is_detached())
+            return WebIDL::DataCloneError::create(*vm.current_realm(), "Cannot transfer detached ArrayBuffer"_fly_string);
 
         // 2. If transferable has a [[Detached]] internal slot and transferable.[[Detached]] is true, then throw a "DataCloneError" DOMException.
         if (is<Bindings::Transferable>(*transferable)) {
@@ -1152,8 +1256,39 @@ WebIDL::ExceptionOr<SerializedTransferRecord> structured_serialize_with_transfer
         // IMPLEMENTATION DEFINED: We just create a data holder here, our memory holds indices into the SerializationRecord
         TransferDataHolder data_holder;
 
-        // FIXME 4. If transferable has an [[ArrayBufferData]] internal slot, then:
-        if (false) {
+        // 4. If transferable has an [[ArrayBufferData]] internal slot, then:
+        if (is<JS::ArrayBuffer>(*transferable)) {
+            auto& array_buffer = static_cast<JS::ArrayBuffer&>(*transferable);
+
+            // FIXME: 1. If transferable has an [[ArrayBufferMaxByteLength]] internal slot, then:
+            // 2. Otherwise:
+            //     1. Set dataHolder.[[Type]] to "ArrayBuffer".
+            //     2. Set dataHolder.[[ArrayBufferData]] to transferable.[[ArrayBufferData]].
+            //     3. Set dataHolder.[[ArrayBufferByteLength]] to transferable.[[ArrayBufferByteLength]].
+            data_holder.data.append(to_underlying(TransferType::ArrayBuffer));
+
+            // IMPLEMENTATION DEFINED: Within the same process, the data itself is moved into the data holder. Otherwise,
+            //                         it is copied to shared memory, and the data holder refers to it by its index.
+            if (destination == SerializationDestination::SameProcess) {
+                // NOTE: The data isn't ours to take if the ArrayBuffer doesn't own it, and it is put back if the
+                //       ArrayBuffer can't be detached.
+                if (array_buffer.owns_buffer())
+                    data_holder.array_buffer_data = move(array_buffer.buffer());
+                else
+                    data_holder.array_buffer_data = TRY_OR_THROW_OOM(vm, ByteBuffer::copy(array_buffer.buffer()));
+            } else {
+                auto data = array_buffer.buffer().bytes().trim(array_buffer.byte_length());
+                auto index = TRY(append_shared_buffer(vm, *memory.shared_buffers, data));
+                data_holder.data.append(bit_cast<u8 const*>(&index), sizeof(index));
+            }
+
+            // 3. Perform ? DetachArrayBuffer(transferable).
+            // NOTE: Specifications can use the [[ArrayBufferDetachKey]] internal slot to prevent ArrayBuffers from being detached. This is used in WebAssembly JavaScript Interface, for example. See: https://webassembly.github.io/spec/js-api/#create-a-memory-buffer
+            if (auto result = JS::detach_array_buffer(vm, array_buffer); result.is_error()) {
+                if (array_buffer.owns_buffer())
+                    array_buffer.buffer() = data_holder.array_buffer_data.release_value();
+                return result.release_error();
+            }
         }
 
         // 5. Otherwise:
@@ -1180,7 +1315,12 @@ WebIDL::ExceptionOr<SerializedTransferRecord> structured_serialize_with_transfer
     }
 
     // 6. Return { [[Serialized]]: serialized, [[TransferDataHolders]]: transferDataHolders }.
-    return SerializedTransferRecord { .serialized = move(serialized), .transfer_data_holders = move(transfer_data_holders) };
+    return SerializedTransferRecord {
+        .serialized = move(serialized),
+        .transfer_data_holders = move(transfer_data_holders),
+        .shared_buffers = memory.shared_buffers.has_value() ? memory.shared_buffers.release_value() : Vector<Core::AnonymousBuffer> {},
+        .shared_data_blocks = memory.shared_data_blocks.has_value() ? memory.shared_data_blocks.release_value() : Vector<JS::SharedDataBlock> {},
+    };
 }
 
 static bool is_interface_exposed_on_target_realm(u8 name, JS::Realm& realm)
@@ -1205,6 +1345,9 @@ static WebIDL::ExceptionOr<JS::NonnullGCPtr<Bindings::PlatformObject>> create_tr
         TRY(message_port->transfer_receiving_steps(transfer_data_holder));
         return message_port;
     }
+    case TransferType::ArrayBuffer:
+        // NOTE: ArrayBuffers are not platform objects, they are created by StructuredDeserializeWithTransfer itself.
+        break;
     }
     VERIFY_NOT_REACHED();
 }
@@ -1216,6 +1359,8 @@ WebIDL::ExceptionOr<DeserializedTransferRecord> structured_deserialize_with_tran
 
     // 1. Let memory be an empty map.
     auto memory = DeserializationMemory(vm.heap());
+    memory.shared_buffers = serialize_with_transfer_result.shared_buffers;
+    memory.shared_data_blocks = serialize_with_transfer_result.shared_data_blocks;
 
     // 2. Let transferredValues be a new empty List.
     Vector<JS::Handle<JS::Object>> transferred_values;
@@ -1225,14 +1370,27 @@ WebIDL::ExceptionOr<DeserializedTransferRecord> structured_deserialize_with_tran
         // 1. Let value be an uninitialized value.
         JS::Value value;
 
-        // FIXME: 2. If transferDataHolder.[[Type]] is "ArrayBuffer", then set value to a new ArrayBuffer object in targetRealm
+        // 2. If transferDataHolder.[[Type]] is "ArrayBuffer", then set value to a new ArrayBuffer object in targetRealm
         //    whose [[ArrayBufferData]] internal slot value is transferDataHolder.[[ArrayBufferData]], and
         //    whose [[ArrayBufferByteLength]] internal slot value is transferDataHolder.[[ArrayBufferByteLength]].
         // NOTE: In cases where the original memory occupied by [[ArrayBufferData]] is accessible during the deserialization,
         //       this step is unlikely to throw an exception, as no new memory needs to be allocated: the memory occupied by
         //       [[ArrayBufferData]] is instead just getting transferred into the new ArrayBuffer. This could be true, for example,
         //       when both the source and target realms are in the same process.
-        if (false) {
+        if (transfer_data_holder.data.first() == to_underlying(TransferType::ArrayBuffer)) {
+            if (transfer_data_holder.array_buffer_data.has_value()) {
+                value = JS::ArrayBuffer::create(target_realm, transfer_data_holder.array_buffer_data.release_value());
+            } else {
+                u32 index = 0;
+                VERIFY(transfer_data_holder.data.size() == 1 + sizeof(index));
+                memcpy(&index, transfer_data_holder.data.data() + 1, sizeof(index));
+
+                // FIXME: Map the shared memory into the ArrayBuffer rather than copying it.
+                auto bytes_or_error = copy_shared_buffer(vm, memory.shared_buffers, index);
+                if (bytes_or_error.is_error())
+                    return WebIDL::DataCloneError::create(target_realm, "Failed to transfer ArrayBuffer"_fly_string);
+                value = JS::ArrayBuffer::create(target_realm, bytes_or_error.release_value());
+            }
         }
 
         // FIXME: 3. Otherwise, if transferDataHolder.[[Type]] is "ResizableArrayBuffer", then set value to a new ArrayBuffer object
@@ -1258,7 +1416,7 @@ WebIDL::ExceptionOr<DeserializedTransferRecord> structured_deserialize_with_tran
         }
 
         // 5. Set memory[transferDataHolder] to value.
-        memory.append(value);
+        memory.values.append(value);
 
         // 6. Append value to transferredValues.
         transferred_values.append(JS::make_handle(value.as_object()));
@@ -1314,7 +1472,7 @@ WebIDL::ExceptionOr<JS::Value> structured_deserialize(JS::VM& vm, SerializationR
     return *result.value;
 }
 
-WebIDL::ExceptionOr<DeserializedRecord> structured_deserialize_internal(JS::VM& vm, ReadonlySpan<u32> const& serialized, JS::Realm& target_realm, DeserializationMemory& memory, Optional<size_t> position)
+WebIDL::ExceptionOr<DeserializedRecord> structured_deserialize_internal(JS::VM& vm, ReadonlySpan<u8> const& serialized, JS::Realm& target_realm, DeserializationMemory& memory, Optional<size_t> position)
 {
     Deserializer deserializer(vm, target_realm, serialized, memory, move(position));
     auto value = TRY(deserializer.deserialize());
@@ -1332,6 +1490,9 @@ namespace IPC {
 template<>
 ErrorOr<void> encode(Encoder& encoder, ::Web::HTML::TransferDataHolder const& data_holder)
 {
+    // A record that is sent over IPC must have been serialized for another process.
+    VERIFY(!data_holder.array_buffer_data.has_value());
+
     TRY(encoder.encode(data_holder.data));
     TRY(encoder.encode(data_holder.fds));
     return {};
@@ -1340,8 +1501,12 @@ ErrorOr<void> encode(Encoder& encoder, ::Web::HTML::TransferDataHolder const& da
 template<>
 ErrorOr<void> encode(Encoder& encoder, ::Web::HTML::SerializedTransferRecord const& record)
 {
+    // A record that is sent over IPC must have been serialized for another process.
+    VERIFY(record.shared_data_blocks.is_empty());
+
     TRY(encoder.encode(record.serialized));
     TRY(encoder.encode(record.transfer_data_holders));
+    TRY(encoder.encode(record.shared_buffers));
     return {};
 }
 
@@ -1356,9 +1521,10 @@ ErrorOr<::Web::HTML::TransferDataHolder> decode(Decoder& decoder)
 template<>
 ErrorOr<::Web::HTML::SerializedTransferRecord> decode(Decoder& decoder)
 {
-    auto serialized = TRY(decoder.decode<Vector<u32>>());
+    auto serialized = TRY(decoder.decode<Vector<u8>>());
     auto transfer_data_holders = TRY(decoder.decode<Vector<::Web::HTML::TransferDataHolder>>());
-    return ::Web::HTML::SerializedTransferRecord { move(serialized), move(transfer_data_holders) };
+    auto shared_buffers = TRY(decoder.decode<Vector<Core::AnonymousBuffer>>());
+    return ::Web::HTML::SerializedTransferRecord { move(serialized), move(transfer_data_holders), move(shared_buffers) };
 }
 
 }
@@ -11,8 +11,10 @@
 #include <AK/Result.h>
 #include <AK/Types.h>
 #include <AK/Vector.h>
+#include <LibCore/AnonymousBuffer.h>
 #include <LibIPC/Forward.h>
 #include <LibJS/Forward.h>
+#include <LibJS/Runtime/ArrayBuffer.h>
 #include <LibWeb/WebIDL/ExceptionOr.h>
 
 // Structured serialize is an entirely different format from IPC because:
@@ -22,18 +24,51 @@
 
 namespace Web::HTML {
 
-using SerializationRecord = Vector<u32>;
-using SerializationMemory = HashMap<JS::Handle<JS::Value>, u32>;
-using DeserializationMemory = JS::MarkedVector<JS::Value>;
+using SerializationRecord = Vector<u8>;
+
+struct SerializationMemory {
+    // JS value -> index
+    HashMap<JS::Handle<JS::Value>, u32> indices;
+
+    // Large binary payloads of a record that is sent to another process are kept out of the record, in shared memory
+    // that can be handed over without copying it. The record refers to them by their index in this list, which is only
+    // set up by StructuredSerializeWithTransfer.
+    Optional<Vector<Core::AnonymousBuffer>> shared_buffers;
+
+    // The Shared Data Blocks of a record that stays in this process, which the record refers to by their index in this
+    // list. This is also only set up by StructuredSerializeWithTransfer.
+    Optional<Vector<JS::SharedDataBlock>> shared_data_blocks;
+};
+
+struct DeserializationMemory {
+    explicit DeserializationMemory(JS::Heap& heap)
+        : values(heap)
+    {
+    }
+
+    // Index -> JS value
+    JS::MarkedVector<JS::Value> values;
+
+    ReadonlySpan<Core::AnonymousBuffer> shared_buffers;
+    ReadonlySpan<JS::SharedDataBlock> shared_data_blocks;
+};
 
 struct TransferDataHolder {
     Vector<u8> data;
     Vector<IPC::File> fds;
+
+    // The data of an ArrayBuffer that is transferred within the same process, which is moved instead of copied. This is
+    // never sent over IPC.
+    Optional<ByteBuffer> array_buffer_data {};
 };
 
 struct SerializedTransferRecord {
     SerializationRecord serialized;
     Vector<TransferDataHolder> transfer_data_holders;
+    Vector<Core::AnonymousBuffer> shared_buffers;
+
+    // This is never sent over IPC.
+    Vector<JS::SharedDataBlock> shared_data_blocks {};
 };
 
 struct DeserializedTransferRecord {
@@ -48,6 +83,14 @@ struct DeserializedRecord {
 
 enum class TransferType : u8 {
     MessagePort,
+    ArrayBuffer,
+};
+
+// Where the record of StructuredSerializeWithTransfer is going to be deserialized. Only a record that crosses a process
+// boundary moves its large buffers into shared memory.
+enum class SerializationDestination : u8 {
+    SameProcess,
+    OtherProcess,
 };
 
 WebIDL::ExceptionOr<SerializationRecord> structured_serialize(JS::VM& vm, JS::Value);
@@ -55,7 +98,7 @@ WebIDL::ExceptionOr<SerializationRecord> structured_serialize_for_storage(JS::VM
 WebIDL::ExceptionOr<SerializationRecord> structured_serialize_internal(JS::VM& vm, JS::Value, bool for_storage, SerializationMemory&);
 
 WebIDL::ExceptionOr<JS::Value> structured_deserialize(JS::VM& vm, SerializationRecord const& serialized, JS::Realm& target_realm, Optional<DeserializationMemory>);
-WebIDL::ExceptionOr<DeserializedRecord> structured_deserialize_internal(JS::VM& vm, ReadonlySpan<u32> const& serialized, JS::Realm& target_realm, DeserializationMemory& memory, Optional<size_t> position = {});
+WebIDL::ExceptionOr<DeserializedRecord> structured_deserialize_internal(JS::VM& vm, ReadonlySpan<u8> const& serialized, JS::Realm& target_realm, DeserializationMemory& memory, Optional<size_t> position = {});
 
 void serialize_boolean_primitive(SerializationRecord& serialized, JS::Value& value);
 void serialize_number_primitive(SerializationRecord& serialized, JS::Value& value);
@@ -72,12 +115,7 @@ template<typename T>
 requires(IsIntegral<T> || IsFloatingPoint<T>)
 void serialize_primitive_type(SerializationRecord& serialized, T value)
 {
-    if constexpr (sizeof(T) < sizeof(u32)) {
-        // NOTE: If the value is smaller than a u32, we can just store it directly.
-        serialized.append(static_cast<u32>(value));
-        return;
-    }
-    serialized.append(bit_cast<u32*>(&value), sizeof(T) / 4);
+    serialized.append(bit_cast<u8 const*>(&value), sizeof(T));
 }
 
 template<typename T>
@@ -87,42 +125,40 @@ void serialize_enum(SerializationRecord& serialized, T value)
     serialize_primitive_type<UnderlyingType<T>>(serialized, to_underlying(value));
 }
 
-WebIDL::ExceptionOr<void> serialize_bytes(JS::VM& vm, Vector<u32>& vector, ReadonlyBytes bytes);
-WebIDL::ExceptionOr<void> serialize_string(JS::VM& vm, Vector<u32>& vector, DeprecatedFlyString const& string);
-WebIDL::ExceptionOr<void> serialize_string(JS::VM& vm, Vector<u32>& vector, String const& string);
-WebIDL::ExceptionOr<void> serialize_string(JS::VM& vm, Vector<u32>& vector, JS::PrimitiveString const& primitive_string);
-WebIDL::ExceptionOr<void> serialize_array_buffer(JS::VM& vm, Vector<u32>& vector, JS::ArrayBuffer const& array_buffer, bool for_storage);
+WebIDL::ExceptionOr<void> serialize_bytes(JS::VM& vm, SerializationRecord& serialized, ReadonlyBytes bytes);
+WebIDL::ExceptionOr<void> serialize_string(JS::VM& vm, SerializationRecord& serialized, DeprecatedFlyString const& string);
+WebIDL::ExceptionOr<void> serialize_string(JS::VM& vm, SerializationRecord& serialized, String const& string);
+WebIDL::ExceptionOr<void> serialize_string(JS::VM& vm, SerializationRecord& serialized, JS::PrimitiveString const& primitive_string);
+WebIDL::ExceptionOr<void> serialize_array_buffer(JS::VM& vm, SerializationRecord& serialized, JS::ArrayBuffer const& array_buffer, bool for_storage, SerializationMemory& memory);
 template<OneOf<JS::TypedArrayBase, JS::DataView> ViewType>
-WebIDL::ExceptionOr<void> serialize_viewed_array_buffer(JS::VM& vm, Vector<u32>& vector, ViewType const& view, bool for_storage, SerializationMemory& memory);
+WebIDL::ExceptionOr<void> serialize_viewed_array_buffer(JS::VM& vm, SerializationRecord& serialized, ViewType const& view, bool for_storage, SerializationMemory& memory);
 
-bool deserialize_boolean_primitive(ReadonlySpan<u32> const& serialized, size_t& position);
-double deserialize_number_primitive(ReadonlySpan<u32> const& serialized, size_t& position);
-JS::NonnullGCPtr<JS::BooleanObject> deserialize_boolean_object(JS::Realm& realm, ReadonlySpan<u32> const& serialized, size_t& position);
-JS::NonnullGCPtr<JS::NumberObject> deserialize_number_object(JS::Realm& realm, ReadonlySpan<u32> const& serialized, size_t& position);
-WebIDL::ExceptionOr<JS::NonnullGCPtr<JS::BigIntObject>> deserialize_big_int_object(JS::Realm& realm, ReadonlySpan<u32> const& serialized, size_t& position);
-WebIDL::ExceptionOr<JS::NonnullGCPtr<JS::StringObject>> deserialize_string_object(JS::Realm& realm, ReadonlySpan<u32> const& serialized, size_t& position);
-JS::NonnullGCPtr<JS::Date> deserialize_date_object(JS::Realm& realm, ReadonlySpan<u32> const& serialized, size_t& position);
-WebIDL::ExceptionOr<JS::NonnullGCPtr<JS::RegExpObject>> deserialize_reg_exp_object(JS::Realm& realm, ReadonlySpan<u32> const& serialized, size_t& position);
+bool deserialize_boolean_primitive(ReadonlySpan<u8> const& serialized, size_t& position);
+double deserialize_number_primitive(ReadonlySpan<u8> const& serialized, size_t& position);
+JS::NonnullGCPtr<JS::BooleanObject> deserialize_boolean_object(JS::Realm& realm, ReadonlySpan<u8> const& serialized, size_t& position);
+JS::NonnullGCPtr<JS::NumberObject> deserialize_number_object(JS::Realm& realm, ReadonlySpan<u8> const& serialized, size_t& position);
+WebIDL::ExceptionOr<JS::NonnullGCPtr<JS::BigIntObject>> deserialize_big_int_object(JS::Realm& realm, ReadonlySpan<u8> const& serialized, size_t& position);
+WebIDL::ExceptionOr<JS::NonnullGCPtr<JS::StringObject>> deserialize_string_object(JS::Realm& realm, ReadonlySpan<u8> const& serialized, size_t& position);
+JS::NonnullGCPtr<JS::Date> deserialize_date_object(JS::Realm& realm, ReadonlySpan<u8> const& serialized, size_t& position);
+WebIDL::ExceptionOr<JS::NonnullGCPtr<JS::RegExpObject>> deserialize_reg_exp_object(JS::Realm& realm, ReadonlySpan<u8> const& serialized, size_t& position);
 
 template<typename T>
 requires(IsIntegral<T> || IsFloatingPoint<T> || IsEnum<T>)
-T deserialize_primitive_type(ReadonlySpan<u32> const& serialized, size_t& position)
+T deserialize_primitive_type(ReadonlySpan<u8> const& serialized, size_t& position)
 {
     T value;
-    // NOTE: Make sure we always round up, otherwise Ts that are less than 32 bit will end up with a size of 0.
-    auto size = 1 + ((sizeof(value) - 1) / 4);
-    VERIFY(position + size <= serialized.size());
+    VERIFY(position + sizeof(value) <= serialized.size());
     memcpy(&value, serialized.offset_pointer(position), sizeof(value));
-    position += size;
+    position += sizeof(value);
     return value;
 }
 
-WebIDL::ExceptionOr<ByteBuffer> deserialize_bytes(JS::VM& vm, ReadonlySpan<u32> vector, size_t& position);
-WebIDL::ExceptionOr<String> deserialize_string(JS::VM& vm, ReadonlySpan<u32> vector, size_t& position);
-WebIDL::ExceptionOr<JS::NonnullGCPtr<JS::PrimitiveString>> deserialize_string_primitive(JS::VM& vm, ReadonlySpan<u32> vector, size_t& position);
-WebIDL::ExceptionOr<JS::NonnullGCPtr<JS::BigInt>> deserialize_big_int_primitive(JS::VM& vm, ReadonlySpan<u32> vector, size_t& position);
+WebIDL::ExceptionOr<ByteBuffer> deserialize_bytes(JS::VM& vm, ReadonlySpan<u8> serialized, size_t& position);
+WebIDL::ExceptionOr<String> deserialize_string(JS::VM& vm, ReadonlySpan<u8> serialized, size_t& position);
+WebIDL::ExceptionOr<JS::NonnullGCPtr<JS::PrimitiveString>> deserialize_string_primitive(JS::VM& vm, ReadonlySpan<u8> serialized, size_t& position);
+WebIDL::ExceptionOr<JS::NonnullGCPtr<JS::BigInt>> deserialize_big_int_primitive(JS::VM& vm, ReadonlySpan<u8> serialized, size_t& position);
 
-WebIDL::ExceptionOr<SerializedTransferRecord> structured_serialize_with_transfer(JS::VM& vm, JS::Value value, Vector<JS::Handle<JS::Object>> const& transfer_list);
+WebIDL::ExceptionOr<SerializedTransferRecord> structured_serialize_with_transfer(JS::VM& vm, JS::Value value, Vector<JS::Handle<JS::Object>> const& transfer_list, SerializationDestination = SerializationDestination::SameProcess);
 WebIDL::ExceptionOr<DeserializedTransferRecord> structured_deserialize_with_transfer(JS::VM& vm, SerializedTransferRecord&);
 
 }
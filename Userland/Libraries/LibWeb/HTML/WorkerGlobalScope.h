@@ -97,6 +97,9 @@ public:
 
     PolicyContainer policy_container() const { return m_policy_container; }
 
+    bool cross_origin_isolated_capability() const { return m_cross_origin_isolated_capability; }
+    void set_cross_origin_isolated_capability(bool capability) { m_cross_origin_isolated_capability = capability; }
+
 protected:
     explicit WorkerGlobalScope(JS::Realm&, JS::NonnullGCPtr<Web::Page>);
 
@@ -0,0 +1,506 @@
+/*
+ * Copyright (c) 2024, the SerenityOS developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibWeb/Bindings/IDBCursorPrototype.h>
+#include <LibWeb/Bindings/Intrinsics.h>
+#include <LibWeb/IndexedDB/IDBCursor.h>
+#include <LibWeb/IndexedDB/IDBCursorWithValue.h>
+#include <LibWeb/IndexedDB/IDBIndex.h>
+#include <LibWeb/IndexedDB/IDBObjectStore.h>
+#include <LibWeb/IndexedDB/IDBRequest.h>
+#include <LibWeb/IndexedDB/IDBTransaction.h>
+#include <LibWeb/IndexedDB/Internal/Algorithms.h>
+#include <LibWeb/WebIDL/DOMException.h>
+
+namespace Web::IndexedDB {
+
+JS_DEFINE_ALLOCATOR(IDBCursor);
+
+JS::NonnullGCPtr<IDBCursor> IDBCursor::create(JS::Realm& realm, Source source, Bindings::IDBCursorDirection direction, KeyRange range, bool key_only)
+{
+    if (key_only)
+        return realm.heap().allocate<IDBCursor>(realm, realm, move(source), direction, move(range), true);
+    return realm.heap().allocate<IDBCursorWithValue>(realm, realm, move(source), direction, move(range));
+}
+
+IDBCursor::IDBCursor(JS::Realm& realm, Source source, Bindings::IDBCursorDirection direction, KeyRange range, bool key_only)
+    : PlatformObject(realm)
+    , m_source(move(source))
+    , m_direction(direction)
+    , m_range(move(range))
+    , m_key_only(key_only)
+{
+}
+
+IDBCursor::~IDBCursor() = default;
+
+void IDBCursor::initialize(JS::Realm& realm)
+{
+    Base::initialize(realm);
+    WEB_SET_PROTOTYPE_FOR_INTERFACE(IDBCursor);
+}
+
+void IDBCursor::visit_edges(Cell::Visitor& visitor)
+{
+    Base::visit_edges(visitor);
+    m_source.visit([&](auto const& source) { visitor.visit(source); });
+    visitor.visit(m_value);
+    visitor.visit(m_request);
+    visitor.visit(m_key_value);
+    visitor.visit(m_primary_key_value);
+}
+
+IDBTransaction& IDBCursor::transaction() const
+{
+    return effective_object_store().transaction();
+}
+
+// https://w3c.github.io/IndexedDB/#cursor-effective-object-store
+IDBObjectStore& IDBCursor::effective_object_store() const
+{
+    // The effective object store of a cursor is as follows:
+    // - If the cursor’s source is an object store, the effective object store is that object store.
+    // - If the cursor’s source is an index, the effective object store is that index’s referenced object store.
+    return m_source.visit(
+        [](JS::NonnullGCPtr<IDBObjectStore> const& object_store) -> IDBObjectStore& { return object_store; },
+        [](JS::NonnullGCPtr<IDBIndex> const& index) -> IDBObjectStore& { return index->object_store(); });
+}
+
+// https://w3c.github.io/IndexedDB/#cursor-effective-key
+Optional<Key> const& IDBCursor::effective_key() const
+{
+    // The effective key of a cursor is as follows:
+    // - If the cursor’s source is an object store, the effective key is the cursor’s position.
+    // - If the cursor’s source is an index, the effective key is the cursor’s object store position.
+    if (m_source.has<JS::NonnullGCPtr<IDBObjectStore>>())
+        return m_position;
+    return m_object_store_position;
+}
+
+bool IDBCursor::is_source_deleted() const
+{
+    // NOTE: An index is also deleted along with its object store.
+    return m_source.visit([](auto const& source) { return source->is_deleted(); });
+}
+
+// https://w3c.github.io/IndexedDB/#dom-idbcursor-source
+Variant<JS::Handle<IDBObjectStore>, JS::Handle<IDBIndex>> IDBCursor::source() const
+{
+    // The source getter steps are to return this's source.
+    return m_source.visit([](auto const& source) -> Variant<JS::Handle<IDBObjectStore>, JS::Handle<IDBIndex>> {
+        return JS::make_handle(*source);
+    });
+}
+
+// https://w3c.github.io/IndexedDB/#dom-idbcursor-key
+JS::Value IDBCursor::key()
+{
+    // The key getter steps are to return the result of converting a key to a value with the cursor’s current key.
+    // NOTE: If key returns an object (e.g. a Date or Array), it returns the same object instance every time it is
+    //       inspected, until the cursor’s key is changed.
+    if (!m_key.has_value())
+        return JS::js_undefined();
+    if (m_key_value.is_undefined())
+        m_key_value = convert_a_key_to_a_value(realm(), *m_key);
+    return m_key_value;
+}
+
+// https://w3c.github.io/IndexedDB/#dom-idbcursor-primarykey
+JS::Value IDBCursor::primary_key()
+{
+    // The primaryKey getter steps are to return the result of converting a key to a value with the cursor’s current
+    // effective key.
+    // NOTE: If primaryKey returns an object (e.g. a Date or Array), it returns the same object instance every time it
+    //       is inspected, until the cursor’s effective key is changed.
+    auto const& effective_key = this->effective_key();
+    if (!effective_key.has_value())
+        return JS::js_undefined();
+    if (m_primary_key_value.is_undefined())
+        m_primary_key_value = convert_a_key_to_a_value(realm(), *effective_key);
+    return m_primary_key_value;
+}
+
+// https://w3c.github.io/IndexedDB/#dom-idbcursor-advance
+WebIDL::ExceptionOr<void> IDBCursor::advance(WebIDL::UnsignedLong count)
+{
+    auto& realm = this->realm();
+
+    // 1. If count is 0 (zero), throw a TypeError.
+    if (count == 0)
+        return WebIDL::SimpleException { WebIDL::SimpleExceptionType::TypeError, "The count must not be zero"sv };
+
+    // 2. Let transaction be this's transaction.
+    // 3. If transaction’s state is not active, then throw a "TransactionInactiveError" DOMException.
+    if (!transaction().is_active())
+        return WebIDL::TransactionInactiveError::create(realm, "The transaction is not active"_fly_string);
+
+    // 4. If this's source or effective object store has been deleted, throw an "InvalidStateError" DOMException.
+    if (is_source_deleted())
+        return WebIDL::InvalidStateError::create(realm, "The cursor's source has been deleted"_fly_string);
+
+    // 5. If this's got value flag is false, indicating that the cursor is being iterated or has iterated past its end,
+    //    throw an "InvalidStateError" DOMException.
+    if (!m_got_value)
+        return WebIDL::InvalidStateError::create(realm, "The cursor is being iterated or has iterated past its end"_fly_string);
+
+    continue_with({}, count);
+    return {};
+}
+
+// https://w3c.github.io/IndexedDB/#dom-idbcursor-continue
+WebIDL::ExceptionOr<void> IDBCursor::continue_(JS::Value key_value)
+{
+    auto& realm = this->realm();
+
+    // 1. Let transaction be this's transaction.
+    // 2. If transaction’s state is not active, then throw a "TransactionInactiveError" DOMException.
+    if (!transaction().is_active())
+        return WebIDL::TransactionInactiveError::create(realm, "The transaction is not active"_fly_string);
+
+    // 3. If this's source or effective object store has been deleted, throw an "InvalidStateError" DOMException.
+    if (is_source_deleted())
+        return WebIDL::InvalidStateError::create(realm, "The cursor's source has been deleted"_fly_string);
+
+    // 4. If this's got value flag is false, indicating that the cursor is being iterated or has iterated past its end,
+    //    throw an "InvalidStateError" DOMException.
+    if (!m_got_value)
+        return WebIDL::InvalidStateError::create(realm, "The cursor is being iterated or has iterated past its end"_fly_string);
+
+    // 5. If key is given, then:
+    Optional<Key> key;
+    if (!key_value.is_undefined()) {
+        // 1. Let r be the result of converting a value to a key with key. Rethrow any exceptions.
+        // 2. If r is invalid, throw a "DataError" DOMException.
+        // 3. Let key be r.
+        key = TRY(convert_a_value_to_a_key(realm, key_value));
+        if (!key.has_value())
+            return WebIDL::DataError::create(realm, "The key is not a valid key"_fly_string);
+
+        auto comparison = Key::compare(*key, *m_position);
+
+        // 4. If key is less than or equal to this's position and this's direction is "next" or "nextunique", then
+        //    throw a "DataError" DOMException.
+        if (comparison <= 0 && (m_direction == Bindings::IDBCursorDirection::Next || m_direction == Bindings::IDBCursorDirection::Nextunique))
+            return WebIDL::DataError::create(realm, "The key is not after the cursor's position"_fly_string);
+
+        // 5. If key is greater than or equal to this's position and this's direction is "prev" or "prevunique", then
+        //    throw a "DataError" DOMException.
+        if (comparison >= 0 && (m_direction == Bindings::IDBCursorDirection::Prev || m_direction == Bindings::IDBCursorDirection::Prevunique))
+            return WebIDL::DataError::create(realm, "The key is not before the cursor's position"_fly_string);
+    }
+
+    continue_with(move(key), 1);
+    return {};
+}
+
+void IDBCursor::continue_with(Optional<Key> key, u32 count)
+{
+    // 6. Set this's got value flag to false.
+    m_got_value = false;
+
+    // 7. Let request be this's request.
+    // 8. Set request’s processed flag to false.
+    // 9. Set request’s done flag to false.
+    // NOTE: Running asynchronously execute a request with an existing request resets it.
+
+    // 10. Let operation be an algorithm to run iterate a cursor with the current Realm record, this, and key (if
+    //     given), or count.
+    auto operation = JS::create_heap_function(heap(), [this, key = move(key), count]() -> WebIDL::ExceptionOr<JS::Value> {
+        return iterate(key, count);
+    });
+
+    // 11. Run asynchronously execute a request with this's source, operation, and request.
+    auto& source = m_source.visit([](auto const& source) -> JS::Object& { return *source; });
+    transaction().asynchronously_execute_a_request(source, operation, m_request);
+}
+
+// https://w3c.github.io/IndexedDB/#dom-idbcursor-update
+WebIDL::ExceptionOr<JS::NonnullGCPtr<IDBRequest>> IDBCursor::update(JS::Value value)
+{
+    auto& realm = this->realm();
+    auto& transaction = this->transaction();
+
+    // 1. Let transaction be this's transaction.
+    // 2. If transaction’s state is not active, then throw a "TransactionInactiveError" DOMException.
+    if (!transaction.is_active())
+        return WebIDL::TransactionInactiveError::create(realm, "The transaction is not active"_fly_string);
+
+    // 3. If transaction is a read-only transaction, throw a "ReadOnlyError" DOMException.
+    if (transaction.is_read_only())
+        return WebIDL::ReadOnlyError::create(realm, "The transaction is read-only"_fly_string);
+
+    // 4. If this's source or effective object store has been deleted, throw an "InvalidStateError" DOMException.
+    if (is_source_deleted())
+        return WebIDL::InvalidStateError::create(realm, "The cursor's source has been deleted"_fly_string);
+
+    // 5. If this's got value flag is false, indicating that the cursor is being iterated or has iterated past its end,
+    //    throw an "InvalidStateError" DOMException.
+    if (!m_got_value)
+        return WebIDL::InvalidStateError::create(realm, "The cursor is being iterated or has iterated past its end"_fly_string);
+
+    // 6. If this's key only flag is true, throw an "InvalidStateError" DOMException.
+    if (m_key_only)
+        return WebIDL::InvalidStateError::create(realm, "The cursor has no value"_fly_string);
+
+    // 7. Let targetRealm be a user-agent defined Realm.
+    // 8. Let clone be a clone of value in targetRealm during transaction. Rethrow any exceptions.
+    auto clone = TRY(clone_a_value(realm, transaction, value));
+
+    // 9. If this's effective object store uses in-line keys, then:
+    auto& store = effective_object_store().store();
+    if (store.uses_inline_keys()) {
+        // 1. Let kpk be the result of extracting a key from a value using a key path with clone and the key path of
+        //    this's effective object store. Rethrow any exceptions.
+        auto key_path_key = TRY(extract_a_key_from_a_value_using_a_key_path(realm, clone, *store.key_path()));
+
+        // 2. If kpk is failure, invalid, or not equal to this's effective key, throw a "DataError" DOMException.
+        if (!key_path_key.has<Key>() || key_path_key.get<Key>() != *effective_key())
+            return WebIDL::DataError::create(realm, "The value's key does not match the cursor's key"_fly_string);
+    }
+
+    // 10. Let operation be an algorithm to run store a record into an object store with this's effective object
+    //     store, clone, this's effective key, and false.
+    auto operation = JS::create_heap_function(heap(), [this, clone, key = *effective_key()]() -> WebIDL::ExceptionOr<JS::Value> {
+        auto stored_key = TRY(store_a_record_into_an_object_store(this->realm(), this->transaction().batch(), effective_object_store().store(), clone, key, false));
+        return convert_a_key_to_a_value(this->realm(), stored_key);
+    });
+
+    // 11. Return the result (an IDBRequest) of running asynchronously execute a request with this and operation.
+    return transaction.asynchronously_execute_a_request(*this, operation);
+}
+
+// https://w3c.github.io/IndexedDB/#dom-idbcursor-delete
+WebIDL::ExceptionOr<JS::NonnullGCPtr<IDBRequest>> IDBCursor::delete_()
+{
+    auto& realm = this->realm();
+    auto& transaction = this->transaction();
+
+    // 1. Let transaction be this's transaction.
+    // 2. If transaction’s state is not active, then throw a "TransactionInactiveError" DOMException.
+    if (!transaction.is_active())
+        return WebIDL::TransactionInactiveError::create(realm, "The transaction is not active"_fly_string);
+
+    // 3. If transaction is a read-only transaction, throw a "ReadOnlyError" DOMException.
+    if (transaction.is_read_only())
+        return WebIDL::ReadOnlyError::create(realm, "The transaction is read-only"_fly_string);
+
+    // 4. If this's source or effective object store has been deleted, throw an "InvalidStateError" DOMException.
+    if (is_source_deleted())
+        return WebIDL::InvalidStateError::create(realm, "The cursor's source has been deleted"_fly_string);
+
+    // 5. If this's got value flag is false, indicating that the cursor is being iterated or has iterated past its end,
+    //    throw an "InvalidStateError" DOMException.
+    if (!m_got_value)
+        return WebIDL::InvalidStateError::create(realm, "The cursor is being iterated or has iterated past its end"_fly_string);
+
+    // 6. If this's key only flag is true, throw an "InvalidStateError" DOMException.
+    if (m_key_only)
+        return WebIDL::InvalidStateError::create(realm, "The cursor has no value"_fly_string);
+
+    // 7. Let operation be an algorithm to run delete records from an object store with this's effective object store
+    //    and this's effective key.
+    auto operation = JS::create_heap_function(heap(), [this, key = *effective_key()]() -> WebIDL::ExceptionOr<JS::Value> {
+        effective_object_store().store().delete_records(this->transaction().batch(), KeyRange::only(key));
+        return JS::js_undefined();
+    });
+
+    // 8. Return the result (an IDBRequest) of running asynchronously execute a request with this and operation.
+    return transaction.asynchronously_execute_a_request(*this, operation);
+}
+
+static bool is_ascending(Bindings::IDBCursorDirection direction)
+{
+    return direction == Bindings::IDBCursorDirection::Next || direction == Bindings::IDBCursorDirection::Nextunique;
+}
+
+// Finds the record that a cursor over an object store moves to. For an object store, "nextunique" and "prevunique"
+// are the same as "next" and "prev", as its keys are unique.
+static Optional<Key> find_object_store_record(ObjectStore const& store, KeyRange const& range, Optional<Key> const& position, Optional<Key> const& key, Bindings::IDBCursorDirection direction)
+{
+    if (is_ascending(direction)) {
+        // Let found record be the first record in records which satisfy all of the following requirements:
+        // - If key is defined, the record’s key is greater than or equal to key.
+        // - If position is defined, the record’s key is greater than position.
+        // - The record’s key is in range.
+        auto const* entry = store.records().first_not_before([&](Key const& record_key) {
+            return (key.has_value() && Key::compare(record_key, *key) < 0)
+                || (position.has_value() && Key::compare(record_key, *position) <= 0)
+                || range.is_below_lower_bound(record_key);
+        });
+        if (!entry || range.is_above_upper_bound(entry->key))
+            return {};
+        return entry->key;
+    }
+
+    // Let found record be the last record in records which satisfy all of the following requirements:
+    // - If key is defined, the record’s key is less than or equal to key.
+    // - If position is defined, the record’s key is less than position.
+    // - The record’s key is in range.
+    auto const* entry = store.records().last_before([&](Key const& record_key) {
+        return (!key.has_value() || Key::compare(record_key, *key) <= 0)
+            && (!position.has_value() || Key::compare(record_key, *position) < 0)
+            && !range.is_above_upper_bound(record_key);
+    });
+    if (!entry || range.is_below_lower_bound(entry->key))
+        return {};
+    return entry->key;
+}
+
+// Finds the record that a cursor over an index moves to.
+static Optional<Index::RecordKey> find_index_record(Index const& index, KeyRange const& range, Optional<Key> const& position, Optional<Key> const& object_store_position, Optional<Key> const& key, Bindings::IDBCursorDirection direction)
+{
+    auto const& records = index.records();
+    auto unique = direction == Bindings::IDBCursorDirection::Nextunique || direction == Bindings::IDBCursorDirection::Prevunique;
+
+    // Whether the record comes before the cursor's position, or is at it.
+    auto is_at_or_before_position = [&](Index::RecordKey const& record_key, bool inclusive) {
+        auto comparison = Key::compare(record_key.key, *position);
+        if (comparison != 0 || unique)
+            return inclusive ? comparison <= 0 : comparison < 0;
+        comparison = Key::compare(record_key.primary_key, *object_store_position);
+        return inclusive ? comparison <= 0 : comparison < 0;
+    };
+
+    if (is_ascending(direction)) {
+        // "next": Let found record be the first record in records which satisfy all of the following requirements:
+        // - If key is defined, the record’s key is greater than or equal to key.
+        // - If position is defined, and the record’s key is equal to position, then the record’s value is greater than
+        //   object store position.
+        // - If position is defined, the record’s key is greater than or equal to position.
+        // - The record’s key is in range.
+        // "nextunique": Let found record be the first record in records which satisfy all of the following
+        // requirements:
+        // - If key is defined, the record’s key is greater than or equal to key.
+        // - If position is defined, the record’s key is greater than position.
+        // - The record’s key is in range.
+        auto const* entry = records.first_not_before([&](Index::RecordKey const& record_key) {
+            return (key.has_value() && Key::compare(record_key.key, *key) < 0)
+                || (position.has_value() && is_at_or_before_position(record_key, true))
+                || range.is_below_lower_bound(record_key.key);
+        });
+        if (!entry || range.is_above_upper_bound(entry->key.key))
+            return {};
+        return entry->key;
+    }
+
+    // "prev": Let found record be the last record in records which satisfy all of the following requirements:
+    // - If key is defined, the record’s key is less than or equal to key.
+    // - If position is defined, and the record’s key is equal to position, then the record’s value is less than
+    //   object store position.
+    // - If position is defined, the record’s key is less than or equal to position.
+    // - The record’s key is in range.
+    // "prevunique": Let temp record be the last record in records which satisfy all of the following requirements:
+    // - If key is defined, the record’s key is less than or equal to key.
+    // - If position is defined, the record’s key is less than position.
+    // - The record’s key is in range.
+    auto const* entry = records.last_before([&](Index::RecordKey const& record_key) {
+        return (!key.has_value() || Key::compare(record_key.key, *key) <= 0)
+            && (!position.has_value() || is_at_or_before_position(record_key, false))
+            && !range.is_above_upper_bound(record_key.key);
+    });
+    if (!entry || range.is_below_lower_bound(entry->key.key))
+        return {};
+    if (!unique)
+        return entry->key;
+
+    // If temp record is defined, let found record be the first record in records whose key is equal to temp record’s
+    // key.
+    auto const& found_key = entry->key.key;
+    return records.first_not_before([&](Index::RecordKey const& record_key) {
+        return Key::compare(record_key.key, found_key) < 0;
+    })->key;
+}
+
+// https://w3c.github.io/IndexedDB/#iterate-a-cursor
+WebIDL::ExceptionOr<JS::Value> IDBCursor::iterate(Optional<Key> const& key, u32 count)
+{
+    // 1. Let source be cursor’s source.
+    // 2. Let direction be cursor’s direction.
+    // 3. Assert: if primaryKey is given, source is an index and direction is "next" or "prev".
+    // 4. Let records be the list of records in source.
+    // 5. Let range be cursor’s range.
+    // 6. Let position be cursor’s position.
+    auto position = m_position;
+
+    // 7. Let object store position be cursor’s object store position.
+    auto object_store_position = m_object_store_position;
+
+    // 8. If count is not given, let count be 1.
+    // 9. While count is greater than 0:
+    for (; count > 0; --count) {
+        // 1. Switch on direction: (see find_object_store_record() and find_index_record())
+        // 2. If found record is not defined, then:
+        // 3. Let position be found record’s key.
+        // 4. If source is an index, let object store position be found record’s value.
+        // 5. Decrease count by 1.
+        bool found = m_source.visit(
+            [&](JS::NonnullGCPtr<IDBObjectStore> const& object_store) {
+                auto found_key = find_object_store_record(object_store->store(), m_range, position, key, m_direction);
+                if (!found_key.has_value())
+                    return false;
+                position = found_key.release_value();
+                return true;
+            },
+            [&](JS::NonnullGCPtr<IDBIndex> const& index) {
+                auto found_record = find_index_record(index->index(), m_range, position, object_store_position, key, m_direction);
+                if (!found_record.has_value())
+                    return false;
+                position = move(found_record->key);
+                object_store_position = move(found_record->primary_key);
+                return true;
+            });
+
+        if (!found) {
+            // 1. Set cursor’s key to undefined.
+            m_key = {};
+            m_key_value = JS::js_undefined();
+
+            // 2. If source is an index, set cursor’s object store position to undefined.
+            if (m_source.has<JS::NonnullGCPtr<IDBIndex>>()) {
+                m_object_store_position = {};
+                m_primary_key_value = JS::js_undefined();
+            }
+
+            // 3. If cursor’s key only flag is false, set cursor’s value to undefined.
+            if (!m_key_only)
+                m_value = JS::js_undefined();
+
+            // 4. Return null.
+            return JS::js_null();
+        }
+    }
+
+    // 10. Set cursor’s position to position.
+    m_position = position;
+
+    // 11. If source is an index, set cursor’s object store position to object store position.
+    if (m_source.has<JS::NonnullGCPtr<IDBIndex>>())
+        m_object_store_position = object_store_position;
+
+    // 12. Set cursor’s key to found record’s key.
+    m_key = position;
+    m_key_value = JS::js_undefined();
+    m_primary_key_value = JS::js_undefined();
+
+    // 13. If cursor’s key only flag is false, then:
+    if (!m_key_only) {
+        // 1. Let serialized be found record’s value if source is an object store, or found record’s referenced value
+        //    otherwise.
+        auto& store = effective_object_store().store();
+        auto const& serialized = *store.records().find(*effective_key());
+
+        // 2. Set cursor’s value to ! StructuredDeserialize(serialized, targetRealm)
+        m_value = MUST(deserialize_a_record_value(realm(), serialized));
+    }
+
+    // 14. Set cursor’s got value flag to true.
+    m_got_value = true;
+
+    // 15. Return cursor.
+    return this;
+}
+
+}
@@ -0,0 +1,94 @@
+/*
+ * Copyright (c) 2024, the SerenityOS developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <LibJS/Heap/Handle.h>
+#include <LibWeb/Bindings/IDBCursorPrototype.h>
+#include <LibWeb/Bindings/PlatformObject.h>
+#include <LibWeb/IndexedDB/Internal/Key.h>
+#include <LibWeb/WebIDL/ExceptionOr.h>
+#include <LibWeb/WebIDL/Types.h>
+
+namespace Web::IndexedDB {
+
+// https://w3c.github.io/IndexedDB/#idbcursor
+class IDBCursor : public Bindings::PlatformObject {
+    WEB_PLATFORM_OBJECT(IDBCursor, Bindings::PlatformObject);
+    JS_DECLARE_ALLOCATOR(IDBCursor);
+
+public:
+    using Source = Variant<JS::NonnullGCPtr<IDBObjectStore>, JS::NonnullGCPtr<IDBIndex>>;
+
+    // Creates an IDBCursor if key_only is true, and an IDBCursorWithValue otherwise.
+    [[nodiscard]] static JS::NonnullGCPtr<IDBCursor> create(JS::Realm&, Source, Bindings::IDBCursorDirection, KeyRange, bool key_only);
+
+    virtual ~IDBCursor() override;
+
+    Variant<JS::Handle<IDBObjectStore>, JS::Handle<IDBIndex>> source() const;
+    Bindings::IDBCursorDirection direction() const { return m_direction; }
+    JS::Value key();
+    JS::Value primary_key();
+    JS::NonnullGCPtr<IDBRequest> request() const { return *m_request; }
+
+    WebIDL::ExceptionOr<void> advance(WebIDL::UnsignedLong count);
+    WebIDL::ExceptionOr<void> continue_(JS::Value key);
+
+    WebIDL::ExceptionOr<JS::NonnullGCPtr<IDBRequest>> update(JS::Value value);
+    WebIDL::ExceptionOr<JS::NonnullGCPtr<IDBRequest>> delete_();
+
+    void set_request(IDBRequest& request) { m_request = &request; }
+
+    // https://w3c.github.io/IndexedDB/#iterate-a-cursor
+    // Returns the cursor, or null if it ran out of records.
+    WebIDL::ExceptionOr<JS::Value> iterate(Optional<Key> const& key, u32 count);
+
+protected:
+    IDBCursor(JS::Realm&, Source, Bindings::IDBCursorDirection, KeyRange, bool key_only);
+
+    virtual void initialize(JS::Realm&) override;
+    virtual void visit_edges(Cell::Visitor&) override;
+
+    // https://w3c.github.io/IndexedDB/#cursor-value
+    JS::Value m_value;
+
+private:
+    IDBTransaction& transaction() const;
+    IDBObjectStore& effective_object_store() const;
+    Optional<Key> const& effective_key() const;
+
+    bool is_source_deleted() const;
+
+    // Continues the cursor with the given operation, once it was checked that it can be continued.
+    void continue_with(Optional<Key> key, u32 count);
+
+    Source m_source;
+    Bindings::IDBCursorDirection m_direction;
+    KeyRange m_range;
+
+    // https://w3c.github.io/IndexedDB/#cursor-key-only-flag
+    bool m_key_only { false };
+
+    // https://w3c.github.io/IndexedDB/#cursor-position
+    Optional<Key> m_position;
+
+    // https://w3c.github.io/IndexedDB/#cursor-object-store-position
+    Optional<Key> m_object_store_position;
+
+    // https://w3c.github.io/IndexedDB/#cursor-key
+    Optional<Key> m_key;
+
+    // https://w3c.github.io/IndexedDB/#cursor-got-value-flag
+    bool m_got_value { false };
+
+    JS::GCPtr<IDBRequest> m_request;
+
+    // The key and primaryKey attributes return the same object until the cursor moves.
+    JS::Value m_key_value;
+    JS::Value m_primary_key_value;
+};
+
+}
@@ -0,0 +1,28 @@
+/*
+ * Copyright (c) 2024, the SerenityOS developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibWeb/Bindings/IDBCursorWithValuePrototype.h>
+#include <LibWeb/Bindings/Intrinsics.h>
+#include <LibWeb/IndexedDB/IDBCursorWithValue.h>
+
+namespace Web::IndexedDB {
+
+JS_DEFINE_ALLOCATOR(IDBCursorWithValue);
+
+IDBCursorWithValue::IDBCursorWithValue(JS::Realm& realm, Source source, Bindings::IDBCursorDirection direction, KeyRange range)
+    : IDBCursor(realm, move(source), direction, move(range), false)
+{
+}
+
+IDBCursorWithValue::~IDBCursorWithValue() = default;
+
+void IDBCursorWithValue::initialize(JS::Realm& realm)
+{
+    Base::initialize(realm);
+    WEB_SET_PROTOTYPE_FOR_INTERFACE(IDBCursorWithValue);
+}
+
+}
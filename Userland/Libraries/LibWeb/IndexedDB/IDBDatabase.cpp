@@ -0,0 +1,271 @@
+/*
+ * Copyright (c) 2024, the SerenityOS developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibWeb/Bindings/IDBDatabasePrototype.h>
+#include <LibWeb/Bindings/Intrinsics.h>
+#include <LibWeb/DOM/Event.h>
+#include <LibWeb/HTML/DOMStringList.h>
+#include <LibWeb/HTML/EventHandler.h>
+#include <LibWeb/HTML/EventLoop/EventLoop.h>
+#include <LibWeb/HTML/EventNames.h>
+#include <LibWeb/IndexedDB/IDBDatabase.h>
+#include <LibWeb/IndexedDB/IDBObjectStore.h>
+#include <LibWeb/IndexedDB/IDBTransaction.h>
+#include <LibWeb/IndexedDB/Internal/Algorithms.h>
+#include <LibWeb/IndexedDB/Internal/DatabaseState.h>
+#include <LibWeb/WebIDL/DOMException.h>
+
+namespace Web::IndexedDB {
+
+JS_DEFINE_ALLOCATOR(IDBDatabase);
+
+JS::NonnullGCPtr<IDBDatabase> IDBDatabase::create(JS::Realm& realm, DatabaseState& state)
+{
+    auto connection = realm.heap().allocate<IDBDatabase>(realm, realm, state);
+    state.add_connection(connection);
+    return connection;
+}
+
+IDBDatabase::IDBDatabase(JS::Realm& realm, DatabaseState& state)
+    : EventTarget(realm)
+    , m_state(state)
+    , m_database(state.ensure_database())
+    , m_version(m_database->version())
+{
+}
+
+IDBDatabase::~IDBDatabase() = default;
+
+void IDBDatabase::initialize(JS::Realm& realm)
+{
+    Base::initialize(realm);
+    WEB_SET_PROTOTYPE_FOR_INTERFACE(IDBDatabase);
+}
+
+void IDBDatabase::visit_edges(Cell::Visitor& visitor)
+{
+    Base::visit_edges(visitor);
+    visitor.visit(m_upgrade_transaction);
+}
+
+void IDBDatabase::finalize()
+{
+    Base::finalize();
+
+    // A connection that can no longer be reached from script will never be used again, and must not keep others from
+    // upgrading or deleting the database.
+    if (!m_closed)
+        m_state->remove_connection(*this);
+}
+
+String const& IDBDatabase::name() const
+{
+    return m_database->name();
+}
+
+// https://w3c.github.io/IndexedDB/#dom-idbdatabase-objectstorenames
+JS::NonnullGCPtr<HTML::DOMStringList> IDBDatabase::object_store_names() const
+{
+    // 1. Let names be a list of the names of the object stores in this's object store set.
+    Vector<String> names;
+    for (auto const& object_store : m_database->object_stores())
+        names.append(object_store->name());
+
+    // 2. Return the result (a DOMStringList) of creating a sorted name list with names.
+    return create_a_sorted_name_list(realm(), move(names));
+}
+
+// https://w3c.github.io/IndexedDB/#dom-idbdatabase-transaction
+WebIDL::ExceptionOr<JS::NonnullGCPtr<IDBTransaction>> IDBDatabase::transaction(Variant<String, Vector<String>> const& store_names, Bindings::IDBTransactionMode mode, IDBTransactionOptions const&)
+{
+    auto& realm = this->realm();
+
+    // 1. If a live upgrade transaction is associated with the connection, throw an "InvalidStateError" DOMException.
+    if (m_upgrade_transaction)
+        return WebIDL::InvalidStateError::create(realm, "An upgrade transaction is running"_fly_string);
+
+    // 2. If this's close pending flag is true, then throw an "InvalidStateError" DOMException.
+    if (m_close_pending)
+        return WebIDL::InvalidStateError::create(realm, "The connection is closing"_fly_string);
+
+    // 3. Let scope be the set of unique strings in storeNames if it is a sequence, or a set containing one string equal
+    //    to storeNames otherwise.
+    Vector<String> scope;
+    store_names.visit(
+        [&](String const& name) { scope.append(name); },
+        [&](Vector<String> const& names) {
+            for (auto const& name : names) {
+                if (!scope.contains_slow(name))
+                    scope.append(name);
+            }
+        });
+
+    // 4. If any string in scope is not the name of an object store in the connected database, throw a "NotFoundError"
+    //    DOMException.
+    for (auto const& name : scope) {
+        if (!m_database->object_store(name))
+            return WebIDL::NotFoundError::create(realm, MUST(String::formatted("No object store named '{}'", name)));
+    }
+
+    // 5. If scope is empty, throw an "InvalidAccessError" DOMException.
+    if (scope.is_empty())
+        return WebIDL::InvalidAccessError::create(realm, "The transaction's scope is empty"_fly_string);
+
+    // 6. If mode is not "readonly" or "readwrite", throw a TypeError.
+    if (mode != Bindings::IDBTransactionMode::Readonly && mode != Bindings::IDBTransactionMode::Readwrite)
+        return WebIDL::SimpleException { WebIDL::SimpleExceptionType::TypeError, "The transaction mode must be 'readonly' or 'readwrite'"sv };
+
+    // 7. Let transaction be a newly created transaction with connection, mode, options’ durability member, and the set
+    //    of object stores named in scope.
+    // NOTE: Every transaction is written to disk before it completes, whatever its durability.
+    auto transaction = IDBTransaction::create(realm, *this, move(scope), mode);
+
+    // 8. Set transaction’s cleanup event loop to the current event loop.
+    transaction->set_cleanup_event_loop(HTML::main_thread_event_loop());
+
+    // 9. Return an IDBTransaction object representing transaction.
+    return transaction;
+}
+
+// https://w3c.github.io/IndexedDB/#dom-idbdatabase-close
+void IDBDatabase::close()
+{
+    // The close() method steps are to run close a database connection with this.
+    close_a_database_connection(false);
+}
+
+// https://w3c.github.io/IndexedDB/#close-a-database-connection
+void IDBDatabase::close_a_database_connection(bool forced)
+{
+    auto& realm = this->realm();
+
+    // 1. Set connection’s close pending flag to true.
+    m_close_pending = true;
+
+    // 2. If the forced flag is true, then for each transaction created using connection run abort a transaction with
+    //    transaction and newly created "AbortError" DOMException.
+    if (forced) {
+        m_state->for_each_transaction([&](IDBTransaction& transaction) {
+            if (&transaction.connection() == this && !transaction.is_finished())
+                transaction.abort_a_transaction(WebIDL::AbortError::create(realm, "The connection was closed"_fly_string));
+        });
+    }
+
+    // 3. Wait for all transactions created using connection to complete. Once they are complete, connection is closed.
+    if (!m_state->has_unfinished_transactions(*this))
+        become_closed();
+
+    // 4. If the forced flag is true, then fire an event named close at connection.
+    if (forced)
+        dispatch_event(DOM::Event::create(realm, HTML::EventNames::close));
+}
+
+void IDBDatabase::transaction_finished()
+{
+    if (m_close_pending && !m_closed && !m_state->has_unfinished_transactions(*this))
+        become_closed();
+}
+
+void IDBDatabase::become_closed()
+{
+    VERIFY(!m_closed);
+    m_closed = true;
+    m_state->remove_connection(*this);
+}
+
+// https://w3c.github.io/IndexedDB/#dom-idbdatabase-createobjectstore
+WebIDL::ExceptionOr<JS::NonnullGCPtr<IDBObjectStore>> IDBDatabase::create_object_store(String const& name, IDBObjectStoreParameters const& options)
+{
+    auto& realm = this->realm();
+
+    // 1. Let database be this's associated database.
+    // 2. Let transaction be database’s upgrade transaction if it is not null, or throw an "InvalidStateError"
+    //    DOMException otherwise.
+    if (!m_upgrade_transaction)
+        return WebIDL::InvalidStateError::create(realm, "Object stores can only be created in an upgrade transaction"_fly_string);
+    auto& transaction = *m_upgrade_transaction;
+
+    // 3. If transaction’s state is not active, then throw a "TransactionInactiveError" DOMException.
+    if (!transaction.is_active())
+        return WebIDL::TransactionInactiveError::create(realm, "The transaction is not active"_fly_string);
+
+    // 4. Let keyPath be options’s keyPath member if it is not undefined or null, or null otherwise.
+    auto const& key_path = options.key_path;
+
+    // 5. If keyPath is not null and is not a valid key path, throw a "SyntaxError" DOMException.
+    if (key_path.has_value() && !is_valid_key_path(*key_path))
+        return WebIDL::SyntaxError::create(realm, "The key path is not valid"_fly_string);
+
+    // 6. If an object store named name already exists in database throw a "ConstraintError" DOMException.
+    if (m_database->object_store(name))
+        return WebIDL::ConstraintError::create(realm, MUST(String::formatted("An object store named '{}' already exists", name)));
+
+    // 7. Let autoIncrement be options’s autoIncrement member.
+    auto auto_increment = options.auto_increment;
+
+    // 8. If autoIncrement is true and keyPath is an empty string or any sequence (empty or otherwise), throw an
+    //    "InvalidAccessError" DOMException.
+    if (auto_increment && key_path.has_value()) {
+        auto is_empty_or_sequence = key_path->visit(
+            [](String const& string) { return string.is_empty(); },
+            [](Vector<String> const&) { return true; });
+        if (is_empty_or_sequence)
+            return WebIDL::InvalidAccessError::create(realm, "An auto-incrementing object store requires a non-empty key path string"_fly_string);
+    }
+
+    // 9. Let store be a new object store in database. Set the created object store's name to name. If autoIncrement
+    //    is true, then the created object store uses a key generator. If keyPath is not null, set the created object
+    //    store's key path to keyPath.
+    auto& store = m_database->create_object_store(transaction.batch(), name, key_path, auto_increment);
+
+    // 10. Return a new object store handle associated with store and transaction.
+    return transaction.object_store(store.name());
+}
+
+// https://w3c.github.io/IndexedDB/#dom-idbdatabase-deleteobjectstore
+WebIDL::ExceptionOr<void> IDBDatabase::delete_object_store(String const& name)
+{
+    auto& realm = this->realm();
+
+    // 1. Let database be this's associated database.
+    // 2. Let transaction be database’s upgrade transaction if it is not null, or throw an "InvalidStateError"
+    //    DOMException otherwise.
+    if (!m_upgrade_transaction)
+        return WebIDL::InvalidStateError::create(realm, "Object stores can only be deleted in an upgrade transaction"_fly_string);
+    auto& transaction = *m_upgrade_transaction;
+
+    // 3. If transaction’s state is not active, then throw a "TransactionInactiveError" DOMException.
+    if (!transaction.is_active())
+        return WebIDL::TransactionInactiveError::create(realm, "The transaction is not active"_fly_string);
+
+    // 4. Let store be the object store named name in database, or throw a "NotFoundError" DOMException if none.
+    auto store = m_database->object_store(name);
+    if (!store)
+        return WebIDL::NotFoundError::create(realm, MUST(String::formatted("No object store named '{}'", name)));
+
+    // 5. Remove store from this's object store set.
+    // 6. If there is an object store handle associated with store and transaction, remove all entries from its index
+    //    set.
+    // 7. Destroy store.
+    // NOTE: Handles of a deleted object store find it deleted, and no longer reach its indexes.
+    m_database->delete_object_store(transaction.batch(), *store);
+    return {};
+}
+
+#undef __ENUMERATE
+#define __ENUMERATE(attribute_name, event_name)                         \
+    void IDBDatabase::set_##attribute_name(WebIDL::CallbackType* value) \
+    {                                                                   \
+        set_event_handler_attribute(event_name, value);                 \
+    }                                                                   \
+    WebIDL::CallbackType* IDBDatabase::attribute_name()                 \
+    {                                                                   \
+        return event_handler_attribute(event_name);                     \
+    }
+ENUMERATE_IDB_DATABASE_EVENT_HANDLERS(__ENUMERATE)
+#undef __ENUMERATE
+
+}
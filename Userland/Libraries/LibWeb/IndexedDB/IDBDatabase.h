@@ -0,0 +1,101 @@
+/*
+ * Copyright (c) 2024, the SerenityOS developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/NonnullRefPtr.h>
+#include <LibWeb/Bindings/IDBDatabasePrototype.h>
+#include <LibWeb/Bindings/IDBTransactionPrototype.h>
+#include <LibWeb/DOM/EventTarget.h>
+#include <LibWeb/IndexedDB/Internal/Database.h>
+#include <LibWeb/WebIDL/ExceptionOr.h>
+
+namespace Web::IndexedDB {
+
+#define ENUMERATE_IDB_DATABASE_EVENT_HANDLERS(E) \
+    E(onabort, HTML::EventNames::abort)          \
+    E(onclose, HTML::EventNames::close)          \
+    E(onerror, HTML::EventNames::error)          \
+    E(onversionchange, HTML::EventNames::versionchange)
+
+struct IDBTransactionOptions {
+    Bindings::IDBTransactionDurability durability { Bindings::IDBTransactionDurability::Default };
+};
+
+struct IDBObjectStoreParameters {
+    Optional<KeyPath> key_path;
+    bool auto_increment { false };
+};
+
+// https://w3c.github.io/IndexedDB/#idbdatabase
+// An IDBDatabase is a connection to a database.
+class IDBDatabase final : public DOM::EventTarget {
+    WEB_PLATFORM_OBJECT(IDBDatabase, DOM::EventTarget);
+    JS_DECLARE_ALLOCATOR(IDBDatabase);
+
+public:
+    [[nodiscard]] static JS::NonnullGCPtr<IDBDatabase> create(JS::Realm&, DatabaseState&);
+
+    virtual ~IDBDatabase() override;
+
+    String const& name() const;
+    u64 version() const { return m_version; }
+    JS::NonnullGCPtr<HTML::DOMStringList> object_store_names() const;
+
+    WebIDL::ExceptionOr<JS::NonnullGCPtr<IDBTransaction>> transaction(Variant<String, Vector<String>> const& store_names, Bindings::IDBTransactionMode, IDBTransactionOptions const&);
+    void close();
+
+    WebIDL::ExceptionOr<JS::NonnullGCPtr<IDBObjectStore>> create_object_store(String const& name, IDBObjectStoreParameters const&);
+    WebIDL::ExceptionOr<void> delete_object_store(String const& name);
+
+#undef __ENUMERATE
+#define __ENUMERATE(attribute_name, event_name)       \
+    void set_##attribute_name(WebIDL::CallbackType*); \
+    WebIDL::CallbackType* attribute_name();
+    ENUMERATE_IDB_DATABASE_EVENT_HANDLERS(__ENUMERATE)
+#undef __ENUMERATE
+
+    DatabaseState& state() const { return m_state; }
+    Database& database() const { return m_database; }
+
+    void set_version(u64 version) { m_version = version; }
+
+    // https://w3c.github.io/IndexedDB/#connection-close-pending-flag
+    bool is_close_pending() const { return m_close_pending; }
+    bool is_closed() const { return m_closed; }
+
+    // https://w3c.github.io/IndexedDB/#database-upgrade-transaction
+    JS::GCPtr<IDBTransaction> upgrade_transaction() const { return m_upgrade_transaction; }
+    void set_upgrade_transaction(JS::GCPtr<IDBTransaction> transaction) { m_upgrade_transaction = transaction; }
+
+    // https://w3c.github.io/IndexedDB/#close-a-database-connection
+    void close_a_database_connection(bool forced);
+
+    // Invoked when a transaction created using this connection has finished.
+    void transaction_finished();
+
+private:
+    IDBDatabase(JS::Realm&, DatabaseState&);
+
+    virtual void initialize(JS::Realm&) override;
+    virtual void visit_edges(Cell::Visitor&) override;
+    virtual void finalize() override;
+
+    void become_closed();
+
+    NonnullRefPtr<DatabaseState> m_state;
+    NonnullRefPtr<Database> m_database;
+
+    // https://w3c.github.io/IndexedDB/#connection-version
+    u64 m_version { 0 };
+
+    bool m_close_pending { false };
+    bool m_closed { false };
+
+    JS::GCPtr<IDBTransaction> m_upgrade_transaction;
+};
+
+}
@@ -6,7 +6,18 @@
 
 #include <LibWeb/Bindings/IDBFactoryPrototype.h>
 #include <LibWeb/Bindings/Intrinsics.h>
+#include <LibWeb/DOM/Event.h>
+#include <LibWeb/HTML/EventLoop/EventLoop.h>
+#include <LibWeb/HTML/EventNames.h>
+#include <LibWeb/HTML/Scripting/Environments.h>
+#include <LibWeb/IndexedDB/IDBDatabase.h>
 #include <LibWeb/IndexedDB/IDBFactory.h>
+#include <LibWeb/IndexedDB/IDBOpenDBRequest.h>
+#include <LibWeb/IndexedDB/IDBTransaction.h>
+#include <LibWeb/IndexedDB/IDBVersionChangeEvent.h>
+#include <LibWeb/IndexedDB/Internal/Algorithms.h>
+#include <LibWeb/IndexedDB/Internal/DatabaseState.h>
+#include <LibWeb/WebIDL/DOMException.h>
 
 namespace Web::IndexedDB {
 
@@ -25,4 +36,446 @@ void IDBFactory::initialize(JS::Realm& realm)
     WEB_SET_PROTOTYPE_FOR_INTERFACE(IDBFactory);
 }
 
+// https://storage.spec.whatwg.org/#obtain-a-storage-key
+static Optional<String> obtain_a_storage_key(HTML::EnvironmentSettingsObject& environment)
+{
+    // 1. Let key be the result of running obtain a storage key for non-storage purposes with environment.
+    auto origin = environment.origin();
+
+    // 2. If key’s origin is an opaque origin, then return failure.
+    if (origin.is_opaque())
+        return {};
+
+    // FIXME: 3. If the user has disabled storage, then return failure.
+
+    // 4. Return key.
+    return MUST(String::from_byte_string(origin.serialize()));
+}
+
+// https://w3c.github.io/IndexedDB/#fire-a-version-change-event
+static void fire_a_version_change_event(JS::Realm& realm, FlyString const& type, DOM::EventTarget& target, u64 old_version, Optional<u64> new_version)
+{
+    // 1. Let event be the result of creating an event using IDBVersionChangeEvent.
+    // 2. Set event’s type attribute to e.
+    // 3. Set event’s bubbles and cancelable attributes to false.
+    // 4. Set event’s oldVersion attribute to oldVersion.
+    // 5. Set event’s newVersion attribute to newVersion.
+    IDBVersionChangeEventInit event_init;
+    event_init.old_version = old_version;
+    event_init.new_version = new_version;
+    auto event = IDBVersionChangeEvent::create(realm, type, event_init);
+
+    // FIXME: 6. Let legacyOutputDidListenersThrowFlag be false.
+    // 7. Dispatch event at target with legacyOutputDidListenersThrowFlag.
+    target.dispatch_event(event);
+
+    // FIXME: 8. Return legacyOutputDidListenersThrowFlag.
+}
+
+// The steps of opening and deleting a database that ask the other connections to the database to close, and then wait
+// until they have.
+static void wait_for_open_connections_to_close(DatabaseState& state, IDBOpenDBRequest& request, u64 old_version, Optional<u64> new_version, Function<void()> on_closed)
+{
+    // 1. Let openConnections be the set of all connections associated with db.
+    auto open_connections = state.connections();
+
+    if (open_connections.is_empty()) {
+        on_closed();
+        return;
+    }
+
+    // 2. For each entry of openConnections that does not have its close pending flag set to true, queue a database
+    //    task to fire a version change event named versionchange at entry with db’s version and version.
+    for (auto& connection : open_connections) {
+        if (connection->is_close_pending())
+            continue;
+
+        HTML::queue_global_task(HTML::Task::Source::DatabaseAccess, connection->realm().global_object(), JS::create_heap_function(connection->heap(), [connection = connection.ptr(), old_version, new_version] {
+            // NOTE: Firing this event might cause one or more of the other objects in openConnections to be closed, in
+            //       which case the versionchange event is not fired at those objects, even if that hasn’t yet been done.
+            if (connection->is_close_pending())
+                return;
+            fire_a_version_change_event(connection->realm(), HTML::EventNames::versionchange, *connection, old_version, new_version);
+        }));
+    }
+
+    // 3. Wait for all of the events to be fired.
+    auto& realm = request.realm();
+    HTML::queue_global_task(HTML::Task::Source::DatabaseAccess, realm.global_object(), JS::create_heap_function(realm.heap(), [&realm, state = NonnullRefPtr { state }, request = JS::NonnullGCPtr { request }, open_connections = move(open_connections), old_version, new_version, on_closed = move(on_closed)]() mutable {
+        // 4. If any of the connections in openConnections are still not closed, queue a database task to fire a
+        //    version change event named blocked at request with db’s version and version.
+        // NOTE: The events have been fired, so this is the database task.
+        if (any_of(open_connections, [](auto const& connection) { return !connection->is_closed(); }))
+            fire_a_version_change_event(realm, HTML::EventNames::blocked, request, old_version, new_version);
+
+        // 5. Wait until all connections in openConnections are closed.
+        state->wait_for_connections_to_close(move(on_closed));
+    }));
+}
+
+// https://w3c.github.io/IndexedDB/#upgrade-a-database
+static void upgrade_a_database(IDBDatabase& connection, u64 version, IDBOpenDBRequest& request, Function<void(IDBTransaction&)> on_finish)
+{
+    auto& realm = request.realm();
+
+    // 1. Let db be connection’s database.
+    auto& database = connection.database();
+
+    // 2. Let transaction be a new upgrade transaction with connection used as connection.
+    // 3. Set transaction’s scope to connection’s object store set.
+    // 6. Start transaction.
+    // NOTE: Transactions on the database can no longer be running, so the transaction is started as soon as it is
+    //       created.
+    auto transaction = IDBTransaction::create(realm, connection, {}, Bindings::IDBTransactionMode::Versionchange);
+    transaction->set_open_request(request);
+
+    // 11. Wait for transaction to finish.
+    transaction->set_on_finish([transaction = transaction.ptr(), on_finish = move(on_finish)] {
+        on_finish(*transaction);
+    });
+
+    // 4. Set db’s upgrade transaction to transaction.
+    connection.set_upgrade_transaction(transaction);
+
+    // 5. Set transaction’s state to inactive.
+    transaction->set_state(IDBTransaction::State::Inactive);
+
+    // 7. Let old version be db’s version.
+    auto old_version = database.version();
+
+    // 8. Set db’s version to version. This change is considered part of the transaction, and so if the transaction is
+    //    aborted, this change is reverted.
+    database.set_version(transaction->batch(), version);
+
+    // 9. Set request’s processed flag to true.
+    request.set_processed(true);
+
+    // 10. Queue a database task to run these steps:
+    HTML::queue_global_task(HTML::Task::Source::DatabaseAccess, realm.global_object(), JS::create_heap_function(realm.heap(), [&realm, connection = JS::NonnullGCPtr { connection }, transaction, request = JS::NonnullGCPtr { request }, old_version, version] {
+        // 1. Set request’s result to connection.
+        request->set_result(connection);
+
+        // 2. Set request’s transaction to transaction.
+        request->set_transaction(transaction);
+
+        // 3. Set request’s done flag to true.
+        request->set_done(true);
+
+        // 4. Set transaction’s state to active.
+        transaction->set_state(IDBTransaction::State::Active);
+
+        // 5. Let didThrow be the result of firing a version change event named upgradeneeded at request with old
+        //    version and version.
+        fire_a_version_change_event(realm, HTML::EventNames::upgradeneeded, request, old_version, version);
+
+        // 6. If transaction’s state is active, then:
+        if (transaction->is_active()) {
+            // 1. Set transaction’s state to inactive.
+            transaction->set_state(IDBTransaction::State::Inactive);
+
+            // FIXME: 2. If didThrow is true, run abort a transaction with transaction and a newly created "AbortError"
+            //           DOMException.
+
+            // NOTE: A transaction without requests can no longer become active, and is committed.
+            if (!transaction->has_pending_requests())
+                transaction->commit_a_transaction();
+        }
+    }));
+}
+
+using ConnectionOrError = Variant<JS::NonnullGCPtr<IDBDatabase>, JS::NonnullGCPtr<WebIDL::DOMException>>;
+
+// https://w3c.github.io/IndexedDB/#open-a-database-connection
+static void open_a_database_connection(DatabaseState& state, Optional<u64> version, IDBOpenDBRequest& request, Function<void(ConnectionOrError)> on_complete)
+{
+    // 1. Let queue be the connection queue for storageKey and name.
+    // 2. Add request to queue.
+    // 3. Wait until all previous requests in queue have been processed.
+    state.enqueue_request([state = NonnullRefPtr { state }, version, request = JS::make_handle(request), on_complete = move(on_complete)]() mutable {
+        // NOTE: The request is processed once the result has been handed over.
+        auto complete = [state, on_complete = move(on_complete)](ConnectionOrError result) {
+            on_complete(move(result));
+            state->request_processed();
+        };
+
+        state->load([state, version, request = move(request), complete = move(complete)](ErrorOr<void> result) mutable {
+            auto& realm = request->realm();
+
+            if (result.is_error()) {
+                dbgln("IndexedDB: Failed to load database '{}': {}", state->name(), result.error());
+                complete(WebIDL::UnknownError::create(realm, "Failed to load the database"_fly_string));
+                return;
+            }
+
+            // 4. Let db be the database named name in storageKey, or null otherwise.
+            auto database = state->database();
+
+            // 5. If version is undefined, let version be 1 if db is null, or db’s version otherwise.
+            if (!version.has_value())
+                version = database ? database->version() : 1;
+
+            // 6. If db is not null and version is less than db’s version, then return a newly created "VersionError"
+            //    DOMException and abort these steps.
+            if (database && *version < database->version()) {
+                complete(WebIDL::VersionError::create(realm, "The requested version is less than the database's version"_fly_string));
+                return;
+            }
+
+            // 7. If db is null, let db be a new database with name name, version 0 (zero), and with no object stores.
+            //    If this fails for any reason, return an appropriate error (e.g. a "QuotaExceededError" or
+            //    "UnknownError" DOMException).
+            auto old_version = database ? database->version() : 0;
+
+            // 10. If db’s version is less than version, then:
+            if (old_version >= *version) {
+                // 8. Let connection be a new connection to db.
+                // 9. Set connection’s version to version.
+                // 11. Return connection.
+                complete(IDBDatabase::create(realm, *state));
+                return;
+            }
+
+            // 1. Let openConnections be the set of all connections, except connection, associated with db.
+            // ...
+            // 5. Wait until all connections in openConnections are closed.
+            // NOTE: The new connection is only created once the others have closed.
+            wait_for_open_connections_to_close(*state, *request, old_version, version, [state, version, request = move(request), complete = move(complete)]() mutable {
+                auto& realm = request->realm();
+
+                // 8. Let connection be a new connection to db.
+                auto connection = IDBDatabase::create(realm, *state);
+
+                // 9. Set connection’s version to version.
+                connection->set_version(*version);
+
+                // 6. Run upgrade a database using connection, version and request.
+                upgrade_a_database(connection, *version, *request, [&realm, connection, complete = move(complete)](IDBTransaction& transaction) mutable {
+                    // 7. If connection was closed, return a newly created "AbortError" DOMException and abort these
+                    //    steps.
+                    if (connection->is_closed()) {
+                        complete(WebIDL::AbortError::create(realm, "The connection was closed during the upgrade"_fly_string));
+                        return;
+                    }
+
+                    // 8. If the upgrade transaction was aborted, run the steps to close a database connection with
+                    //    connection, return a newly created "AbortError" DOMException and abort these steps.
+                    if (transaction.was_aborted()) {
+                        connection->close_a_database_connection(false);
+                        complete(WebIDL::AbortError::create(realm, "The upgrade transaction was aborted"_fly_string));
+                        return;
+                    }
+
+                    // 11. Return connection.
+                    complete(connection);
+                });
+            });
+        });
+    });
+}
+
+// https://w3c.github.io/IndexedDB/#dom-idbfactory-open
+WebIDL::ExceptionOr<JS::NonnullGCPtr<IDBOpenDBRequest>> IDBFactory::open(String const& name, Optional<u64> version)
+{
+    auto& realm = this->realm();
+
+    // 1. Let environment be this's relevant settings object.
+    auto& environment = HTML::relevant_settings_object(*this);
+
+    // 2. Let storageKey be the result of running obtain a storage key given environment. If failure is returned, then
+    //    throw a "SecurityError" DOMException and abort these steps.
+    auto storage_key = obtain_a_storage_key(environment);
+    if (!storage_key.has_value())
+        return WebIDL::SecurityError::create(realm, "Indexed databases are not available to this origin"_fly_string);
+
+    // 3. If version is 0 (zero), throw a TypeError.
+    if (version == 0u)
+        return WebIDL::SimpleException { WebIDL::SimpleExceptionType::TypeError, "The version must not be zero"sv };
+
+    // 4. Let request be a new open request.
+    auto request = IDBOpenDBRequest::create(realm);
+
+    // 5. Run these steps in parallel:
+    // 1. Let result be the result of opening a database connection, with storageKey, name, version if given and
+    //    undefined otherwise, and request.
+    auto state = DatabaseState::get_or_create(*storage_key, name);
+    open_a_database_connection(*state, version, request, [request = JS::make_handle(request)](ConnectionOrError result) {
+        auto& realm = request->realm();
+
+        // 2. Set request’s processed flag to true.
+        request->set_processed(true);
+
+        // 3. Queue a database task to run these steps:
+        // NOTE: If the steps above resulted in an upgrade transaction being run, these steps will run after that
+        //       transaction finishes. This ensures that in the case where another version upgrade is about to happen,
+        //       the success event is fired on the connection first so that the script gets a chance to register a
+        //       listener for the versionchange event.
+        HTML::queue_global_task(HTML::Task::Source::DatabaseAccess, realm.global_object(), JS::create_heap_function(realm.heap(), [&realm, request = request.ptr(), result = move(result)] {
+            result.visit(
+                // 1. If result is an error, then:
+                [&](JS::NonnullGCPtr<WebIDL::DOMException> const& error) {
+                    // 1. Set request’s result to undefined.
+                    request->set_result(JS::js_undefined());
+
+                    // 2. Set request’s error to result.
+                    request->set_error(error);
+
+                    // 3. Set request’s done flag to true.
+                    request->set_done(true);
+
+                    // 4. Fire an event named error at request with its bubbles and cancelable attributes initialized to
+                    //    true.
+                    DOM::EventInit event_init;
+                    event_init.bubbles = true;
+                    event_init.cancelable = true;
+                    request->dispatch_event(DOM::Event::create(realm, HTML::EventNames::error, event_init));
+                },
+                // 2. Otherwise:
+                [&](JS::NonnullGCPtr<IDBDatabase> const& connection) {
+                    // 1. Set request’s result to result.
+                    request->set_result(connection);
+
+                    // 2. Set request’s done flag to true.
+                    request->set_done(true);
+
+                    // 3. Fire an event named success at request.
+                    request->dispatch_event(DOM::Event::create(realm, HTML::EventNames::success));
+                });
+        }));
+    });
+
+    // 6. Return a new IDBOpenDBRequest object for request.
+    return request;
+}
+
+using VersionOrError = Variant<u64, JS::NonnullGCPtr<WebIDL::DOMException>>;
+
+// https://w3c.github.io/IndexedDB/#delete-a-database
+static void delete_a_database(DatabaseState& state, IDBOpenDBRequest& request, Function<void(VersionOrError)> on_complete)
+{
+    // 1. Let queue be the connection queue for storageKey and name.
+    // 2. Add request to queue.
+    // 3. Wait until all previous requests in queue have been processed.
+    state.enqueue_request([state = NonnullRefPtr { state }, request = JS::make_handle(request), on_complete = move(on_complete)]() mutable {
+        // NOTE: The request is processed once the result has been handed over.
+        auto complete = [state, on_complete = move(on_complete)](VersionOrError result) {
+            on_complete(move(result));
+            state->request_processed();
+        };
+
+        state->load([state, request = move(request), complete = move(complete)](ErrorOr<void> result) mutable {
+            auto& realm = request->realm();
+
+            if (result.is_error()) {
+                dbgln("IndexedDB: Failed to load database '{}': {}", state->name(), result.error());
+                complete(WebIDL::UnknownError::create(realm, "Failed to load the database"_fly_string));
+                return;
+            }
+
+            // 4. Let db be the database named name in storageKey, if one exists. Otherwise, return 0 (zero).
+            auto database = state->database();
+            if (!database) {
+                complete(0u);
+                return;
+            }
+
+            // 5. Let openConnections be the set of all connections associated with db.
+            // ...
+            // 9. Wait until all connections in openConnections are closed.
+            auto old_version = database->version();
+            wait_for_open_connections_to_close(*state, *request, old_version, {}, [state, request = move(request), old_version, complete = move(complete)]() mutable {
+                // 10. Let version be db’s version.
+                // 11. Delete db. If this fails for any reason, return an appropriate error (e.g. "QuotaExceededError"
+                //     or "UnknownError" DOMException).
+                state->delete_database([state, request = move(request), old_version, complete = move(complete)](ErrorOr<void> result) {
+                    if (result.is_error()) {
+                        dbgln("IndexedDB: Failed to delete database '{}': {}", state->name(), result.error());
+                        complete(WebIDL::UnknownError::create(request->realm(), "Failed to delete the database"_fly_string));
+                        return;
+                    }
+
+                    // 12. Return version.
+                    complete(old_version);
+                });
+            });
+        });
+    });
+}
+
+// https://w3c.github.io/IndexedDB/#dom-idbfactory-deletedatabase
+WebIDL::ExceptionOr<JS::NonnullGCPtr<IDBOpenDBRequest>> IDBFactory::delete_database(String const& name)
+{
+    auto& realm = this->realm();
+
+    // 1. Let environment be this's relevant settings object.
+    auto& environment = HTML::relevant_settings_object(*this);
+
+    // 2. Let storageKey be the result of running obtain a storage key given environment. If failure is returned, then
+    //    throw a "SecurityError" DOMException and abort these steps.
+    auto storage_key = obtain_a_storage_key(environment);
+    if (!storage_key.has_value())
+        return WebIDL::SecurityError::create(realm, "Indexed databases are not available to this origin"_fly_string);
+
+    // 3. Let request be a new open request.
+    auto request = IDBOpenDBRequest::create(realm);
+
+    // 4. Run these steps in parallel:
+    // 1. Let result be the result of deleting a database, with storageKey, name, and request.
+    auto state = DatabaseState::get_or_create(*storage_key, name);
+    delete_a_database(*state, request, [request = JS::make_handle(request)](VersionOrError result) {
+        auto& realm = request->realm();
+
+        // 2. Set request’s processed flag to true.
+        request->set_processed(true);
+
+        // 3. Queue a database task to run these steps:
+        HTML::queue_global_task(HTML::Task::Source::DatabaseAccess, realm.global_object(), JS::create_heap_function(realm.heap(), [&realm, request = request.ptr(), result = move(result)] {
+            result.visit(
+                // 1. If result is an error, set request’s error to result, set request’s done flag to true, and fire an
+                //    event named error at request with its bubbles and cancelable attributes initialized to true.
+                [&](JS::NonnullGCPtr<WebIDL::DOMException> const& error) {
+                    request->set_error(error);
+                    request->set_done(true);
+
+                    DOM::EventInit event_init;
+                    event_init.bubbles = true;
+                    event_init.cancelable = true;
+                    request->dispatch_event(DOM::Event::create(realm, HTML::EventNames::error, event_init));
+                },
+                // 2. Otherwise, set request’s result to undefined, set request’s done flag to true, and fire a version
+                //    change event named success at request with result and null.
+                [&](u64 old_version) {
+                    request->set_result(JS::js_undefined());
+                    request->set_done(true);
+                    fire_a_version_change_event(realm, HTML::EventNames::success, *request, old_version, {});
+                });
+        }));
+    });
+
+    // 5. Return a new IDBOpenDBRequest object for request.
+    return request;
+}
+
+// https://w3c.github.io/IndexedDB/#dom-idbfactory-cmp
+WebIDL::ExceptionOr<i16> IDBFactory::cmp(JS::Value first, JS::Value second)
+{
+    auto& realm = this->realm();
+
+    // 1. Let a be the result of converting a value to a key with first. Rethrow any exceptions.
+    auto a = TRY(convert_a_value_to_a_key(realm, first));
+
+    // 2. If a is invalid, throw a "DataError" DOMException.
+    if (!a.has_value())
+        return WebIDL::DataError::create(realm, "The first value is not a valid key"_fly_string);
+
+    // 3. Let b be the result of converting a value to a key with second. Rethrow any exceptions.
+    auto b = TRY(convert_a_value_to_a_key(realm, second));
+
+    // 4. If b is invalid, throw a "DataError" DOMException.
+    if (!b.has_value())
+        return WebIDL::DataError::create(realm, "The second value is not a valid key"_fly_string);
+
+    // 5. Return the results of comparing two keys with a and b.
+    return static_cast<i16>(Key::compare(*a, *b));
+}
+
 }
@@ -7,6 +7,7 @@
 #pragma once
 
 #include <LibWeb/Bindings/PlatformObject.h>
+#include <LibWeb/WebIDL/ExceptionOr.h>
 
 namespace Web::IndexedDB {
 
@@ -18,6 +19,10 @@ class IDBFactory : public Bindings::PlatformObject {
 public:
     virtual ~IDBFactory() override;
 
+    WebIDL::ExceptionOr<JS::NonnullGCPtr<IDBOpenDBRequest>> open(String const& name, Optional<u64> version);
+    WebIDL::ExceptionOr<JS::NonnullGCPtr<IDBOpenDBRequest>> delete_database(String const& name);
+    WebIDL::ExceptionOr<i16> cmp(JS::Value first, JS::Value second);
+
 protected:
     explicit IDBFactory(JS::Realm&);
 
@@ -0,0 +1,336 @@
+/*
+ * Copyright (c) 2024, the SerenityOS developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibJS/Runtime/Array.h>
+#include <LibWeb/Bindings/IDBIndexPrototype.h>
+#include <LibWeb/Bindings/Intrinsics.h>
+#include <LibWeb/IndexedDB/IDBCursor.h>
+#include <LibWeb/IndexedDB/IDBIndex.h>
+#include <LibWeb/IndexedDB/IDBObjectStore.h>
+#include <LibWeb/IndexedDB/IDBRequest.h>
+#include <LibWeb/IndexedDB/IDBTransaction.h>
+#include <LibWeb/IndexedDB/Internal/Algorithms.h>
+#include <LibWeb/WebIDL/DOMException.h>
+
+namespace Web::IndexedDB {
+
+JS_DEFINE_ALLOCATOR(IDBIndex);
+
+JS::NonnullGCPtr<IDBIndex> IDBIndex::create(JS::Realm& realm, Index& index, IDBObjectStore& object_store)
+{
+    return realm.heap().allocate<IDBIndex>(realm, realm, index, object_store);
+}
+
+IDBIndex::IDBIndex(JS::Realm& realm, Index& index, IDBObjectStore& object_store)
+    : PlatformObject(realm)
+    , m_index(index)
+    , m_object_store(object_store)
+{
+}
+
+IDBIndex::~IDBIndex() = default;
+
+void IDBIndex::initialize(JS::Realm& realm)
+{
+    Base::initialize(realm);
+    WEB_SET_PROTOTYPE_FOR_INTERFACE(IDBIndex);
+}
+
+void IDBIndex::visit_edges(Cell::Visitor& visitor)
+{
+    Base::visit_edges(visitor);
+    visitor.visit(m_object_store);
+    visitor.visit(m_key_path_value);
+}
+
+IDBTransaction& IDBIndex::transaction() const
+{
+    return m_object_store->transaction();
+}
+
+bool IDBIndex::is_deleted() const
+{
+    // NOTE: An index is also deleted along with its object store.
+    return m_object_store->is_deleted() || m_object_store->store().index(m_index->name()) != m_index.ptr();
+}
+
+WebIDL::ExceptionOr<void> IDBIndex::check_request_can_be_made()
+{
+    auto& realm = this->realm();
+
+    // If index or index’s object store has been deleted, throw an "InvalidStateError" DOMException.
+    if (is_deleted())
+        return WebIDL::InvalidStateError::create(realm, "The index has been deleted"_fly_string);
+
+    // If transaction’s state is not active, then throw a "TransactionInactiveError" DOMException.
+    if (!transaction().is_active())
+        return WebIDL::TransactionInactiveError::create(realm, "The transaction is not active"_fly_string);
+
+    return {};
+}
+
+// https://w3c.github.io/IndexedDB/#dom-idbindex-name
+WebIDL::ExceptionOr<void> IDBIndex::set_name(String const& name)
+{
+    auto& realm = this->realm();
+    auto& transaction = this->transaction();
+
+    // 1. Let name be the given value.
+    // 2. Let transaction be this's transaction.
+    // 3. Let index be this's index.
+
+    // 4. If transaction is not an upgrade transaction, throw an "InvalidStateError" DOMException.
+    if (!transaction.is_upgrade_transaction())
+        return WebIDL::InvalidStateError::create(realm, "Indexes can only be renamed in an upgrade transaction"_fly_string);
+
+    // 5. If transaction’s state is not active, then throw a "TransactionInactiveError" DOMException.
+    if (!transaction.is_active())
+        return WebIDL::TransactionInactiveError::create(realm, "The transaction is not active"_fly_string);
+
+    // 6. If index or index’s object store has been deleted, throw an "InvalidStateError" DOMException.
+    if (is_deleted())
+        return WebIDL::InvalidStateError::create(realm, "The index has been deleted"_fly_string);
+
+    // 7. If index’s name is equal to name, terminate these steps.
+    if (m_index->name() == name)
+        return {};
+
+    // 8. If an index named name already exists in index’s object store, throw a "ConstraintError" DOMException.
+    if (m_object_store->store().index(name))
+        return WebIDL::ConstraintError::create(realm, MUST(String::formatted("An index named '{}' already exists", name)));
+
+    // 9. Set index’s name to name.
+    // 10. Set this's name to name.
+    m_object_store->store().rename_index(transaction.batch(), m_index, name);
+    return {};
+}
+
+// https://w3c.github.io/IndexedDB/#dom-idbindex-keypath
+JS::Value IDBIndex::key_path()
+{
+    // The keyPath getter steps are to return this's index's key path. The key path is converted as a DOMString (if a
+    // string) or a sequence<DOMString> (if a list of strings), per [WEBIDL].
+    if (m_key_path_value.is_undefined())
+        m_key_path_value = convert_a_key_path_to_a_value(realm(), m_index->key_path());
+    return m_key_path_value;
+}
+
+// https://w3c.github.io/IndexedDB/#dom-idbindex-get
+WebIDL::ExceptionOr<JS::NonnullGCPtr<IDBRequest>> IDBIndex::get(JS::Value query)
+{
+    // 1. Let transaction be this's transaction.
+    // 2. Let index be this's index.
+    // 3. If index or index’s object store has been deleted, throw an "InvalidStateError" DOMException.
+    // 4. If transaction’s state is not active, then throw a "TransactionInactiveError" DOMException.
+    TRY(check_request_can_be_made());
+
+    // 5. Let range be the result of converting a value to a key range with query and true. Rethrow any exceptions.
+    auto range = TRY(convert_a_value_to_a_key_range(realm(), query, true));
+
+    // 6. Let operation be an algorithm to run retrieve a referenced value from an index with the current Realm
+    //    record, index, and range.
+    auto operation = JS::create_heap_function(heap(), [this, range = move(range)]() -> WebIDL::ExceptionOr<JS::Value> {
+        // https://w3c.github.io/IndexedDB/#retrieve-a-referenced-value-from-an-index
+        // 1. Let record be the first record in index’s list of records whose key is in range, if any.
+        // 2. If record was not found, return undefined.
+        // 3. Let serialized be record’s referenced value.
+        // 4. Return ! StructuredDeserialize(serialized, targetRealm).
+        JS::Value result = JS::js_undefined();
+        m_index->for_each_record_in_range(range, [&](auto const& record) {
+            auto const& serialized = *m_object_store->store().records().find(record.primary_key);
+            result = MUST(deserialize_a_record_value(realm(), serialized));
+            return IterationDecision::Break;
+        });
+        return result;
+    });
+
+    // 7. Return the result (an IDBRequest) of running asynchronously execute a request with this and operation.
+    return transaction().asynchronously_execute_a_request(*this, operation);
+}
+
+// https://w3c.github.io/IndexedDB/#dom-idbindex-getkey
+WebIDL::ExceptionOr<JS::NonnullGCPtr<IDBRequest>> IDBIndex::get_key(JS::Value query)
+{
+    // 1. Let transaction be this's transaction.
+    // 2. Let index be this's index.
+    // 3. If index or index’s object store has been deleted, throw an "InvalidStateError" DOMException.
+    // 4. If transaction’s state is not active, then throw a "TransactionInactiveError" DOMException.
+    TRY(check_request_can_be_made());
+
+    // 5. Let range be the result of converting a value to a key range with query and true. Rethrow any exceptions.
+    auto range = TRY(convert_a_value_to_a_key_range(realm(), query, true));
+
+    // 6. Let operation be an algorithm to run retrieve a value from an index with index and range.
+    auto operation = JS::create_heap_function(heap(), [this, range = move(range)]() -> WebIDL::ExceptionOr<JS::Value> {
+        // https://w3c.github.io/IndexedDB/#retrieve-a-value-from-an-index
+        // 1. Let record be the first record in index’s list of records whose key is in range, if any.
+        // 2. If record was not found, return undefined.
+        // 3. Return the result of converting a key to a value with record’s value.
+        JS::Value result = JS::js_undefined();
+        m_index->for_each_record_in_range(range, [&](auto const& record) {
+            result = convert_a_key_to_a_value(realm(), record.primary_key);
+            return IterationDecision::Break;
+        });
+        return result;
+    });
+
+    // 7. Return the result (an IDBRequest) of running asynchronously execute a request with this and operation.
+    return transaction().asynchronously_execute_a_request(*this, operation);
+}
+
+// https://w3c.github.io/IndexedDB/#dom-idbindex-getall
+WebIDL::ExceptionOr<JS::NonnullGCPtr<IDBRequest>> IDBIndex::get_all(JS::Value query, Optional<WebIDL::UnsignedLong> count)
+{
+    // 1. Let transaction be this's transaction.
+    // 2. Let index be this's index.
+    // 3. If index or index’s object store has been deleted, throw an "InvalidStateError" DOMException.
+    // 4. If transaction’s state is not active, then throw a "TransactionInactiveError" DOMException.
+    TRY(check_request_can_be_made());
+
+    // 5. Let range be the result of converting a value to a key range with query. Rethrow any exceptions.
+    auto range = TRY(convert_a_value_to_a_key_range(realm(), query));
+
+    // 6. Let operation be an algorithm to run retrieve multiple referenced values from an index with the current
+    //    Realm record, index, range, and count if given.
+    auto operation = JS::create_heap_function(heap(), [this, range = move(range), count]() -> WebIDL::ExceptionOr<JS::Value> {
+        // https://w3c.github.io/IndexedDB/#retrieve-multiple-referenced-values-from-an-index
+        // 1. If count is not given or is 0 (zero), let count be infinity.
+        // 2. Let records be a list containing the first count records in index’s list of records whose key is in
+        //    range.
+        // 3. Let list be an empty list.
+        // 4. For each record of records:
+        //    1. Let serialized be record’s referenced value.
+        //    2. Let entry be ! StructuredDeserialize(serialized, targetRealm).
+        //    3. Append entry to list.
+        // 5. Return list converted to a sequence<any>.
+        auto limit = count.value_or(0);
+        JS::MarkedVector<JS::Value> list { heap() };
+        m_index->for_each_record_in_range(range, [&](auto const& record) {
+            auto const& serialized = *m_object_store->store().records().find(record.primary_key);
+            list.append(MUST(deserialize_a_record_value(realm(), serialized)));
+            return list.size() == limit ? IterationDecision::Break : IterationDecision::Continue;
+        });
+        return JS::Array::create_from(realm(), list);
+    });
+
+    // 7. Return the result (an IDBRequest) of running asynchronously execute a request with this and operation.
+    return transaction().asynchronously_execute_a_request(*this, operation);
+}
+
+// https://w3c.github.io/IndexedDB/#dom-idbindex-getallkeys
+WebIDL::ExceptionOr<JS::NonnullGCPtr<IDBRequest>> IDBIndex::get_all_keys(JS::Value query, Optional<WebIDL::UnsignedLong> count)
+{
+    // 1. Let transaction be this's transaction.
+    // 2. Let index be this's index.
+    // 3. If index or index’s object store has been deleted, throw an "InvalidStateError" DOMException.
+    // 4. If transaction’s state is not active, then throw a "TransactionInactiveError" DOMException.
+    TRY(check_request_can_be_made());
+
+    // 5. Let range be the result of converting a value to a key range with query. Rethrow any exceptions.
+    auto range = TRY(convert_a_value_to_a_key_range(realm(), query));
+
+    // 6. Let operation be an algorithm to run retrieve multiple values from an index with index, range, and count if
+    //    given.
+    auto operation = JS::create_heap_function(heap(), [this, range = move(range), count]() -> WebIDL::ExceptionOr<JS::Value> {
+        // https://w3c.github.io/IndexedDB/#retrieve-multiple-values-from-an-index
+        // 1. If count is not given or is 0 (zero), let count be infinity.
+        // 2. Let records be a list containing the first count records in index’s list of records whose key is in
+        //    range.
+        // 3. Let list be an empty list.
+        // 4. For each record of records:
+        //    1. Let entry be the result of converting a key to a value with record’s value.
+        //    2. Append entry to list.
+        // 5. Return list converted to a sequence<any>.
+        auto limit = count.value_or(0);
+        JS::MarkedVector<JS::Value> list { heap() };
+        m_index->for_each_record_in_range(range, [&](auto const& record) {
+            list.append(convert_a_key_to_a_value(realm(), record.primary_key));
+            return list.size() == limit ? IterationDecision::Break : IterationDecision::Continue;
+        });
+        return JS::Array::create_from(realm(), list);
+    });
+
+    // 7. Return the result (an IDBRequest) of running asynchronously execute a request with this and operation.
+    return transaction().asynchronously_execute_a_request(*this, operation);
+}
+
+// https://w3c.github.io/IndexedDB/#dom-idbindex-count
+WebIDL::ExceptionOr<JS::NonnullGCPtr<IDBRequest>> IDBIndex::count(JS::Value query)
+{
+    // 1. Let transaction be this's transaction.
+    // 2. Let index be this's index.
+    // 3. If index or index’s object store has been deleted, throw an "InvalidStateError" DOMException.
+    // 4. If transaction’s state is not active, then throw a "TransactionInactiveError" DOMException.
+    TRY(check_request_can_be_made());
+
+    // 5. Let range be the result of converting a value to a key range with query. Rethrow any exceptions.
+    auto range = TRY(convert_a_value_to_a_key_range(realm(), query));
+
+    // 6. Let operation be an algorithm to run count the records in a range with index and range.
+    auto operation = JS::create_heap_function(heap(), [this, range = move(range)]() -> WebIDL::ExceptionOr<JS::Value> {
+        // https://w3c.github.io/IndexedDB/#count-the-records-in-a-range
+        // 1. Let count be the number of records, if any, in source’s list of records with key in range.
+        // 2. Return count.
+        size_t count = 0;
+        if (range.lower.has_value() || range.upper.has_value()) {
+            m_index->for_each_record_in_range(range, [&](auto const&) {
+                ++count;
+                return IterationDecision::Continue;
+            });
+        } else {
+            count = m_index->records().size();
+        }
+        return JS::Value(count);
+    });
+
+    // 7. Return the result (an IDBRequest) of running asynchronously execute a request with this and operation.
+    return transaction().asynchronously_execute_a_request(*this, operation);
+}
+
+// https://w3c.github.io/IndexedDB/#dom-idbindex-opencursor
+WebIDL::ExceptionOr<JS::NonnullGCPtr<IDBRequest>> IDBIndex::open_cursor(JS::Value query, Bindings::IDBCursorDirection direction)
+{
+    return open_a_cursor(query, direction, false);
+}
+
+// https://w3c.github.io/IndexedDB/#dom-idbindex-openkeycursor
+WebIDL::ExceptionOr<JS::NonnullGCPtr<IDBRequest>> IDBIndex::open_key_cursor(JS::Value query, Bindings::IDBCursorDirection direction)
+{
+    return open_a_cursor(query, direction, true);
+}
+
+WebIDL::ExceptionOr<JS::NonnullGCPtr<IDBRequest>> IDBIndex::open_a_cursor(JS::Value query, Bindings::IDBCursorDirection direction, bool key_only)
+{
+    // 1. Let transaction be this's transaction.
+    // 2. Let index be this's index.
+    // 3. If index or index’s object store has been deleted, throw an "InvalidStateError" DOMException.
+    // 4. If transaction’s state is not active, then throw a "TransactionInactiveError" DOMException.
+    TRY(check_request_can_be_made());
+
+    // 5. Let range be the result of converting a value to a key range with query. Rethrow any exceptions.
+    auto range = TRY(convert_a_value_to_a_key_range(realm(), query));
+
+    // 6. Let cursor be a new cursor with its transaction set to transaction, undefined position, direction set to
+    //    direction, got value flag set to false, undefined key and value, source set to index, range set to range,
+    //    and key only flag set to false (or true for openKeyCursor()).
+    auto cursor = IDBCursor::create(realm(), JS::NonnullGCPtr { *this }, direction, move(range), key_only);
+
+    // 7. Let operation be an algorithm to run iterate a cursor with the current Realm record and cursor.
+    auto operation = JS::create_heap_function(heap(), [cursor]() -> WebIDL::ExceptionOr<JS::Value> {
+        return cursor->iterate({}, 1);
+    });
+
+    // 8. Let request be the result of running asynchronously execute a request with this and operation.
+    auto request = transaction().asynchronously_execute_a_request(*this, operation);
+
+    // 9. Set cursor’s request to request.
+    cursor->set_request(request);
+
+    // 10. Return request.
+    return request;
+}
+
+}
@@ -0,0 +1,71 @@
+/*
+ * Copyright (c) 2024, the SerenityOS developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/NonnullRefPtr.h>
+#include <LibWeb/Bindings/IDBCursorPrototype.h>
+#include <LibWeb/Bindings/PlatformObject.h>
+#include <LibWeb/IndexedDB/Internal/Database.h>
+#include <LibWeb/WebIDL/ExceptionOr.h>
+#include <LibWeb/WebIDL/Types.h>
+
+namespace Web::IndexedDB {
+
+// https://w3c.github.io/IndexedDB/#idbindex
+// An IDBIndex is an index handle, which accesses an index within a transaction.
+class IDBIndex final : public Bindings::PlatformObject {
+    WEB_PLATFORM_OBJECT(IDBIndex, Bindings::PlatformObject);
+    JS_DECLARE_ALLOCATOR(IDBIndex);
+
+public:
+    [[nodiscard]] static JS::NonnullGCPtr<IDBIndex> create(JS::Realm&, Index&, IDBObjectStore&);
+
+    virtual ~IDBIndex() override;
+
+    String const& name() const { return m_index->name(); }
+    WebIDL::ExceptionOr<void> set_name(String const&);
+    JS::NonnullGCPtr<IDBObjectStore> object_store() const { return m_object_store; }
+    JS::Value key_path();
+    bool multi_entry() const { return m_index->multi_entry(); }
+    bool unique() const { return m_index->unique(); }
+
+    WebIDL::ExceptionOr<JS::NonnullGCPtr<IDBRequest>> get(JS::Value query);
+    WebIDL::ExceptionOr<JS::NonnullGCPtr<IDBRequest>> get_key(JS::Value query);
+    WebIDL::ExceptionOr<JS::NonnullGCPtr<IDBRequest>> get_all(JS::Value query, Optional<WebIDL::UnsignedLong> count);
+    WebIDL::ExceptionOr<JS::NonnullGCPtr<IDBRequest>> get_all_keys(JS::Value query, Optional<WebIDL::UnsignedLong> count);
+    WebIDL::ExceptionOr<JS::NonnullGCPtr<IDBRequest>> count(JS::Value query);
+
+    WebIDL::ExceptionOr<JS::NonnullGCPtr<IDBRequest>> open_cursor(JS::Value query, Bindings::IDBCursorDirection);
+    WebIDL::ExceptionOr<JS::NonnullGCPtr<IDBRequest>> open_key_cursor(JS::Value query, Bindings::IDBCursorDirection);
+
+    Index& index() const { return m_index; }
+
+    // https://w3c.github.io/IndexedDB/#index-deleted
+    bool is_deleted() const;
+
+private:
+    IDBIndex(JS::Realm&, Index&, IDBObjectStore&);
+
+    virtual void initialize(JS::Realm&) override;
+    virtual void visit_edges(Cell::Visitor&) override;
+
+    // Checks that requests can be made against the index: that neither it nor its object store has been deleted, and
+    // that the transaction is active.
+    WebIDL::ExceptionOr<void> check_request_can_be_made();
+
+    WebIDL::ExceptionOr<JS::NonnullGCPtr<IDBRequest>> open_a_cursor(JS::Value query, Bindings::IDBCursorDirection, bool key_only);
+
+    IDBTransaction& transaction() const;
+
+    NonnullRefPtr<Index> m_index;
+    JS::NonnullGCPtr<IDBObjectStore> m_object_store;
+
+    // The keyPath attribute returns the same object every time.
+    JS::Value m_key_path_value;
+};
+
+}
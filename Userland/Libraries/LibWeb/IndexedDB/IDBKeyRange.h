@@ -0,0 +1,46 @@
+/*
+ * Copyright (c) 2024, the SerenityOS developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <LibWeb/Bindings/PlatformObject.h>
+#include <LibWeb/IndexedDB/Internal/Key.h>
+
+namespace Web::IndexedDB {
+
+// https://w3c.github.io/IndexedDB/#idbkeyrange
+class IDBKeyRange final : public Bindings::PlatformObject {
+    WEB_PLATFORM_OBJECT(IDBKeyRange, Bindings::PlatformObject);
+    JS_DECLARE_ALLOCATOR(IDBKeyRange);
+
+public:
+    [[nodiscard]] static JS::NonnullGCPtr<IDBKeyRange> create(JS::Realm&, KeyRange);
+
+    static WebIDL::ExceptionOr<JS::NonnullGCPtr<IDBKeyRange>> only(JS::VM&, JS::Value value);
+    static WebIDL::ExceptionOr<JS::NonnullGCPtr<IDBKeyRange>> lower_bound(JS::VM&, JS::Value lower, bool open);
+    static WebIDL::ExceptionOr<JS::NonnullGCPtr<IDBKeyRange>> upper_bound(JS::VM&, JS::Value upper, bool open);
+    static WebIDL::ExceptionOr<JS::NonnullGCPtr<IDBKeyRange>> bound(JS::VM&, JS::Value lower, JS::Value upper, bool lower_open, bool upper_open);
+
+    virtual ~IDBKeyRange() override;
+
+    KeyRange const& range() const { return m_range; }
+
+    JS::Value lower() const;
+    JS::Value upper() const;
+    bool lower_open() const { return m_range.lower_open; }
+    bool upper_open() const { return m_range.upper_open; }
+
+    WebIDL::ExceptionOr<bool> includes(JS::Value key) const;
+
+private:
+    IDBKeyRange(JS::Realm&, KeyRange);
+
+    virtual void initialize(JS::Realm&) override;
+
+    KeyRange m_range;
+};
+
+}
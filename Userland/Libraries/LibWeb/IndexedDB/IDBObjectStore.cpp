@@ -0,0 +1,639 @@
+/*
+ * Copyright (c) 2024, the SerenityOS developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibJS/Runtime/Array.h>
+#include <LibWeb/Bindings/IDBObjectStorePrototype.h>
+#include <LibWeb/Bindings/Intrinsics.h>
+#include <LibWeb/HTML/DOMStringList.h>
+#include <LibWeb/IndexedDB/IDBCursor.h>
+#include <LibWeb/IndexedDB/IDBIndex.h>
+#include <LibWeb/IndexedDB/IDBObjectStore.h>
+#include <LibWeb/IndexedDB/IDBRequest.h>
+#include <LibWeb/IndexedDB/IDBTransaction.h>
+#include <LibWeb/IndexedDB/Internal/Algorithms.h>
+#include <LibWeb/WebIDL/DOMException.h>
+
+namespace Web::IndexedDB {
+
+JS_DEFINE_ALLOCATOR(IDBObjectStore);
+
+JS::NonnullGCPtr<IDBObjectStore> IDBObjectStore::create(JS::Realm& realm, ObjectStore& store, IDBTransaction& transaction)
+{
+    return realm.heap().allocate<IDBObjectStore>(realm, realm, store, transaction);
+}
+
+IDBObjectStore::IDBObjectStore(JS::Realm& realm, ObjectStore& store, IDBTransaction& transaction)
+    : PlatformObject(realm)
+    , m_store(store)
+    , m_transaction(transaction)
+{
+}
+
+IDBObjectStore::~IDBObjectStore() = default;
+
+void IDBObjectStore::initialize(JS::Realm& realm)
+{
+    Base::initialize(realm);
+    WEB_SET_PROTOTYPE_FOR_INTERFACE(IDBObjectStore);
+}
+
+void IDBObjectStore::visit_edges(Cell::Visitor& visitor)
+{
+    Base::visit_edges(visitor);
+    visitor.visit(m_transaction);
+    visitor.visit(m_index_handles);
+    visitor.visit(m_key_path_value);
+}
+
+bool IDBObjectStore::is_deleted() const
+{
+    return m_transaction->database().object_store(m_store->name()) != m_store.ptr();
+}
+
+WebIDL::ExceptionOr<void> IDBObjectStore::check_request_can_be_made(Writes writes)
+{
+    auto& realm = this->realm();
+
+    // If store has been deleted, throw an "InvalidStateError" DOMException.
+    if (is_deleted())
+        return WebIDL::InvalidStateError::create(realm, "The object store has been deleted"_fly_string);
+
+    // If transaction’s state is not active, then throw a "TransactionInactiveError" DOMException.
+    if (!m_transaction->is_active())
+        return WebIDL::TransactionInactiveError::create(realm, "The transaction is not active"_fly_string);
+
+    // If transaction is a read-only transaction, throw a "ReadOnlyError" DOMException.
+    if (writes == Writes::Yes && m_transaction->is_read_only())
+        return WebIDL::ReadOnlyError::create(realm, "The transaction is read-only"_fly_string);
+
+    return {};
+}
+
+// https://w3c.github.io/IndexedDB/#dom-idbobjectstore-name
+WebIDL::ExceptionOr<void> IDBObjectStore::set_name(String const& name)
+{
+    auto& realm = this->realm();
+
+    // 1. Let name be the given value.
+    // 2. Let transaction be this's transaction.
+    // 3. Let store be this's object store.
+
+    // 4. If store has been deleted, throw an "InvalidStateError" DOMException.
+    if (is_deleted())
+        return WebIDL::InvalidStateError::create(realm, "The object store has been deleted"_fly_string);
+
+    // 5. If transaction is not an upgrade transaction, throw an "InvalidStateError" DOMException.
+    if (!m_transaction->is_upgrade_transaction())
+        return WebIDL::InvalidStateError::create(realm, "Object stores can only be renamed in an upgrade transaction"_fly_string);
+
+    // 6. If transaction’s state is not active, throw a "TransactionInactiveError" DOMException.
+    if (!m_transaction->is_active())
+        return WebIDL::TransactionInactiveError::create(realm, "The transaction is not active"_fly_string);
+
+    // 7. If store’s name is equal to name, terminate these steps.
+    if (m_store->name() == name)
+        return {};
+
+    // 8. If an object store named name already exists in store’s database, throw a "ConstraintError" DOMException.
+    if (m_transaction->database().object_store(name))
+        return WebIDL::ConstraintError::create(realm, MUST(String::formatted("An object store named '{}' already exists", name)));
+
+    // 9. Set store’s name to name.
+    // 10. Set this's name to name.
+    m_store->rename(m_transaction->batch(), name);
+    return {};
+}
+
+// https://w3c.github.io/IndexedDB/#dom-idbobjectstore-keypath
+JS::Value IDBObjectStore::key_path()
+{
+    // The keyPath getter steps are to return this's object store's key path, or null if none. The key path is
+    // converted as a DOMString (if a string) or a sequence<DOMString> (if a list of strings), per [WEBIDL].
+    // NOTE: The returned value is not the same instance that was used when the object store was created. However, if
+    //       this attribute returns an object (specifically an Array), it returns the same object instance every time it
+    //       is inspected.
+    if (!m_store->key_path().has_value())
+        return JS::js_null();
+    if (m_key_path_value.is_undefined())
+        m_key_path_value = convert_a_key_path_to_a_value(realm(), *m_store->key_path());
+    return m_key_path_value;
+}
+
+// https://w3c.github.io/IndexedDB/#dom-idbobjectstore-indexnames
+JS::NonnullGCPtr<HTML::DOMStringList> IDBObjectStore::index_names() const
+{
+    // 1. Let names be a list of the names of the indexes in this's index set.
+    Vector<String> names;
+    if (!is_deleted()) {
+        for (auto const& index : m_store->indexes())
+            names.append(index->name());
+    }
+
+    // 2. Return the result (a DOMStringList) of creating a sorted name list with names.
+    return create_a_sorted_name_list(realm(), move(names));
+}
+
+// https://w3c.github.io/IndexedDB/#dom-idbobjectstore-put
+WebIDL::ExceptionOr<JS::NonnullGCPtr<IDBRequest>> IDBObjectStore::put(JS::Value value, JS::Value key)
+{
+    // The put(value, key) method steps are to return the result of running add or put with this, value, key and the
+    // no-overwrite flag false.
+    return add_or_put(value, key, NoOverwrite::No);
+}
+
+// https://w3c.github.io/IndexedDB/#dom-idbobjectstore-add
+WebIDL::ExceptionOr<JS::NonnullGCPtr<IDBRequest>> IDBObjectStore::add(JS::Value value, JS::Value key)
+{
+    // The add(value, key) method steps are to return the result of running add or put with this, value, key and the
+    // no-overwrite flag true.
+    return add_or_put(value, key, NoOverwrite::Yes);
+}
+
+// https://w3c.github.io/IndexedDB/#add-or-put
+WebIDL::ExceptionOr<JS::NonnullGCPtr<IDBRequest>> IDBObjectStore::add_or_put(JS::Value value, JS::Value key_value, NoOverwrite no_overwrite)
+{
+    auto& realm = this->realm();
+
+    // 1. Let transaction be handle’s transaction.
+    // 2. Let store be handle’s object store.
+    // 3. If store has been deleted, throw an "InvalidStateError" DOMException.
+    // 4. If transaction’s state is not active, then throw a "TransactionInactiveError" DOMException.
+    // 5. If transaction is a read-only transaction, throw a "ReadOnlyError" DOMException.
+    TRY(check_request_can_be_made(Writes::Yes));
+
+    // 6. If store uses in-line keys and key was given, throw a "DataError" DOMException.
+    if (m_store->uses_inline_keys() && !key_value.is_undefined())
+        return WebIDL::DataError::create(realm, "A key was given for an object store that uses in-line keys"_fly_string);
+
+    // 7. If store uses out-of-line keys and has no key generator and key was not given, throw a "DataError"
+    //    DOMException.
+    if (!m_store->uses_inline_keys() && !m_store->has_key_generator() && key_value.is_undefined())
+        return WebIDL::DataError::create(realm, "A key is required for an object store that uses out-of-line keys"_fly_string);
+
+    // 8. If key was given, then:
+    Optional<Key> key;
+    if (!key_value.is_undefined()) {
+        // 1. Let r be the result of converting a value to a key with key. Rethrow any exceptions.
+        // 2. If r is invalid, throw a "DataError" DOMException.
+        // 3. Let key be r.
+        key = TRY(convert_a_value_to_a_key(realm, key_value));
+        if (!key.has_value())
+            return WebIDL::DataError::create(realm, "The key is not a valid key"_fly_string);
+    }
+
+    // 9. Let targetRealm be a user-agent defined Realm.
+    // 10. Let clone be a clone of value in targetRealm during transaction. Rethrow any exceptions.
+    auto clone = TRY(clone_a_value(realm, m_transaction, value));
+
+    // 11. If store uses in-line keys, then:
+    if (m_store->uses_inline_keys()) {
+        // 1. Let kpk be the result of extracting a key from a value using a key path with clone and store’s key path.
+        //    Rethrow any exceptions.
+        auto key_path_key = TRY(extract_a_key_from_a_value_using_a_key_path(realm, clone, *m_store->key_path()));
+
+        // 2. If kpk is invalid, throw a "DataError" DOMException.
+        if (key_path_key.has<InvalidKey>())
+            return WebIDL::DataError::create(realm, "The value at the object store's key path is not a valid key"_fly_string);
+
+        // 3. If kpk is not failure, let key be kpk.
+        if (key_path_key.has<Key>()) {
+            key = key_path_key.get<Key>();
+        }
+        // 4. Otherwise (kpk is failure):
+        else {
+            // 1. If store does not have a key generator, throw a "DataError" DOMException.
+            if (!m_store->has_key_generator())
+                return WebIDL::DataError::create(realm, "The value has no key at the object store's key path"_fly_string);
+
+            // 2. Otherwise, if check that a key could be injected into a value with clone and store’s key path return
+            //    false, throw a "DataError" DOMException.
+            if (!check_that_a_key_could_be_injected_into_a_value(clone, m_store->key_path()->get<String>()))
+                return WebIDL::DataError::create(realm, "A key could not be injected into the value"_fly_string);
+        }
+    }
+
+    // 12. Let operation be an algorithm to run store a record into an object store with store, clone, key, and
+    //     no-overwrite flag.
+    auto operation = JS::create_heap_function(heap(), [this, clone, key = move(key), no_overwrite]() -> WebIDL::ExceptionOr<JS::Value> {
+        auto stored_key = TRY(store_a_record_into_an_object_store(this->realm(), m_transaction->batch(), m_store, clone, key, no_overwrite == NoOverwrite::Yes));
+        return convert_a_key_to_a_value(this->realm(), stored_key);
+    });
+
+    // 13. Return the result (an IDBRequest) of running asynchronously execute a request with handle and operation.
+    return m_transaction->asynchronously_execute_a_request(*this, operation);
+}
+
+// https://w3c.github.io/IndexedDB/#dom-idbobjectstore-delete
+WebIDL::ExceptionOr<JS::NonnullGCPtr<IDBRequest>> IDBObjectStore::delete_(JS::Value query)
+{
+    // 1. Let transaction be this's transaction.
+    // 2. Let store be this's object store.
+    // 3. If store has been deleted, throw an "InvalidStateError" DOMException.
+    // 4. If transaction’s state is not active, then throw a "TransactionInactiveError" DOMException.
+    // 5. If transaction is a read-only transaction, throw a "ReadOnlyError" DOMException.
+    TRY(check_request_can_be_made(Writes::Yes));
+
+    // 6. Let range be the result of converting a value to a key range with query and true. Rethrow any exceptions.
+    auto range = TRY(convert_a_value_to_a_key_range(realm(), query, true));
+
+    // 7. Let operation be an algorithm to run delete records from an object store with store and range.
+    auto operation = JS::create_heap_function(heap(), [this, range = move(range)]() -> WebIDL::ExceptionOr<JS::Value> {
+        m_store->delete_records(m_transaction->batch(), range);
+        return JS::js_undefined();
+    });
+
+    // 8. Return the result (an IDBRequest) of running asynchronously execute a request with this and operation.
+    return m_transaction->asynchronously_execute_a_request(*this, operation);
+}
+
+// https://w3c.github.io/IndexedDB/#dom-idbobjectstore-clear
+WebIDL::ExceptionOr<JS::NonnullGCPtr<IDBRequest>> IDBObjectStore::clear()
+{
+    // 1. Let transaction be this's transaction.
+    // 2. Let store be this's object store.
+    // 3. If store has been deleted, throw an "InvalidStateError" DOMException.
+    // 4. If transaction’s state is not active, then throw a "TransactionInactiveError" DOMException.
+    // 5. If transaction is a read-only transaction, throw a "ReadOnlyError" DOMException.
+    TRY(check_request_can_be_made(Writes::Yes));
+
+    // 6. Let operation be an algorithm to run clear an object store with store.
+    auto operation = JS::create_heap_function(heap(), [this]() -> WebIDL::ExceptionOr<JS::Value> {
+        m_store->clear(m_transaction->batch());
+        return JS::js_undefined();
+    });
+
+    // 7. Return the result (an IDBRequest) of running asynchronously execute a request with this and operation.
+    return m_transaction->asynchronously_execute_a_request(*this, operation);
+}
+
+// https://w3c.github.io/IndexedDB/#dom-idbobjectstore-get
+WebIDL::ExceptionOr<JS::NonnullGCPtr<IDBRequest>> IDBObjectStore::get(JS::Value query)
+{
+    // 1. Let transaction be this's transaction.
+    // 2. Let store be this's object store.
+    // 3. If store has been deleted, throw an "InvalidStateError" DOMException.
+    // 4. If transaction’s state is not active, then throw a "TransactionInactiveError" DOMException.
+    TRY(check_request_can_be_made(Writes::No));
+
+    // 5. Let range be the result of converting a value to a key range with query and true. Rethrow any exceptions.
+    auto range = TRY(convert_a_value_to_a_key_range(realm(), query, true));
+
+    // 6. Let operation be an algorithm to run retrieve a value from an object store with the current Realm record,
+    //    store, and range.
+    auto operation = JS::create_heap_function(heap(), [this, range = move(range)]() -> WebIDL::ExceptionOr<JS::Value> {
+        // https://w3c.github.io/IndexedDB/#retrieve-a-value-from-an-object-store
+        // 1. Let record be the first record in store’s list of records whose key is in range, if any.
+        // 2. If record was not found, return undefined.
+        // 3. Let serialized be record’s value.
+        // 4. Return ! StructuredDeserialize(serialized, targetRealm).
+        JS::Value result = JS::js_undefined();
+        m_store->for_each_record_in_range(range, [&](auto const& record) {
+            result = MUST(deserialize_a_record_value(realm(), record.value));
+            return IterationDecision::Break;
+        });
+        return result;
+    });
+
+    // 7. Return the result (an IDBRequest) of running asynchronously execute a request with this and operation.
+    return m_transaction->asynchronously_execute_a_request(*this, operation);
+}
+
+// https://w3c.github.io/IndexedDB/#dom-idbobjectstore-getkey
+WebIDL::ExceptionOr<JS::NonnullGCPtr<IDBRequest>> IDBObjectStore::get_key(JS::Value query)
+{
+    // 1. Let transaction be this's transaction.
+    // 2. Let store be this's object store.
+    // 3. If store has been deleted, throw an "InvalidStateError" DOMException.
+    // 4. If transaction’s state is not active, then throw a "TransactionInactiveError" DOMException.
+    TRY(check_request_can_be_made(Writes::No));
+
+    // 5. Let range be the result of converting a value to a key range with query and true. Rethrow any exceptions.
+    auto range = TRY(convert_a_value_to_a_key_range(realm(), query, true));
+
+    // 6. Let operation be an algorithm to run retrieve a key from an object store with store and range.
+    auto operation = JS::create_heap_function(heap(), [this, range = move(range)]() -> WebIDL::ExceptionOr<JS::Value> {
+        // https://w3c.github.io/IndexedDB/#retrieve-a-key-from-an-object-store
+        // 1. Let record be the first record in store’s list of records whose key is in range, if any.
+        // 2. If record was not found, return undefined.
+        // 3. Return the result of converting a key to a value with record's key.
+        JS::Value result = JS::js_undefined();
+        m_store->for_each_record_in_range(range, [&](auto const& record) {
+            result = convert_a_key_to_a_value(realm(), record.key);
+            return IterationDecision::Break;
+        });
+        return result;
+    });
+
+    // 7. Return the result (an IDBRequest) of running asynchronously execute a request with this and operation.
+    return m_transaction->asynchronously_execute_a_request(*this, operation);
+}
+
+// https://w3c.github.io/IndexedDB/#dom-idbobjectstore-getall
+WebIDL::ExceptionOr<JS::NonnullGCPtr<IDBRequest>> IDBObjectStore::get_all(JS::Value query, Optional<WebIDL::UnsignedLong> count)
+{
+    // 1. Let transaction be this's transaction.
+    // 2. Let store be this's object store.
+    // 3. If store has been deleted, throw an "InvalidStateError" DOMException.
+    // 4. If transaction’s state is not active, then throw a "TransactionInactiveError" DOMException.
+    TRY(check_request_can_be_made(Writes::No));
+
+    // 5. Let range be the result of converting a value to a key range with query. Rethrow any exceptions.
+    auto range = TRY(convert_a_value_to_a_key_range(realm(), query));
+
+    // 6. Let operation be an algorithm to run retrieve multiple values from an object store with the current Realm
+    //    record, store, range, and count if given.
+    auto operation = JS::create_heap_function(heap(), [this, range = move(range), count]() -> WebIDL::ExceptionOr<JS::Value> {
+        // https://w3c.github.io/IndexedDB/#retrieve-multiple-values-from-an-object-store
+        // 1. If count is not given or is 0 (zero), let count be infinity.
+        // 2. Let records be a list containing the first count records in store’s list of records whose key is in
+        //    range.
+        // 3. Let list be an empty list.
+        // 4. For each record of records:
+        //    1. Let serialized be record’s value.
+        //    2. Let entry be ! StructuredDeserialize(serialized, targetRealm).
+        //    3. Append entry to list.
+        // 5. Return list converted to a sequence<any>.
+        auto limit = count.value_or(0);
+        JS::MarkedVector<JS::Value> list { heap() };
+        m_store->for_each_record_in_range(range, [&](auto const& record) {
+            list.append(MUST(deserialize_a_record_value(realm(), record.value)));
+            return list.size() == limit ? IterationDecision::Break : IterationDecision::Continue;
+        });
+        return JS::Array::create_from(realm(), list);
+    });
+
+    // 7. Return the result (an IDBRequest) of running asynchronously execute a request with this and operation.
+    return m_transaction->asynchronously_execute_a_request(*this, operation);
+}
+
+// https://w3c.github.io/IndexedDB/#dom-idbobjectstore-getallkeys
+WebIDL::ExceptionOr<JS::NonnullGCPtr<IDBRequest>> IDBObjectStore::get_all_keys(JS::Value query, Optional<WebIDL::UnsignedLong> count)
+{
+    // 1. Let transaction be this's transaction.
+    // 2. Let store be this's object store.
+    // 3. If store has been deleted, throw an "InvalidStateError" DOMException.
+    // 4. If transaction’s state is not active, then throw a "TransactionInactiveError" DOMException.
+    TRY(check_request_can_be_made(Writes::No));
+
+    // 5. Let range be the result of converting a value to a key range with query. Rethrow any exceptions.
+    auto range = TRY(convert_a_value_to_a_key_range(realm(), query));
+
+    // 6. Let operation be an algorithm to run retrieve multiple keys from an object store with store, range, and
+    //    count if given.
+    auto operation = JS::create_heap_function(heap(), [this, range = move(range), count]() -> WebIDL::ExceptionOr<JS::Value> {
+        // https://w3c.github.io/IndexedDB/#retrieve-multiple-keys-from-an-object-store
+        // 1. If count is not given or is 0 (zero), let count be infinity.
+        // 2. Let records be a list containing the first count records in store’s list of records whose key is in
+        //    range.
+        // 3. Let list be an empty list.
+        // 4. For each record of records:
+        //    1. Let entry be the result of converting a key to a value with record’s key.
+        //    2. Append entry to list.
+        // 5. Return list converted to a sequence<any>.
+        auto limit = count.value_or(0);
+        JS::MarkedVector<JS::Value> list { heap() };
+        m_store->for_each_record_in_range(range, [&](auto const& record) {
+            list.append(convert_a_key_to_a_value(realm(), record.key));
+            return list.size() == limit ? IterationDecision::Break : IterationDecision::Continue;
+        });
+        return JS::Array::create_from(realm(), list);
+    });
+
+    // 7. Return the result (an IDBRequest) of running asynchronously execute a request with this and operation.
+    return m_transaction->asynchronously_execute_a_request(*this, operation);
+}
+
+// https://w3c.github.io/IndexedDB/#dom-idbobjectstore-count
+WebIDL::ExceptionOr<JS::NonnullGCPtr<IDBRequest>> IDBObjectStore::count(JS::Value query)
+{
+    // 1. Let transaction be this's transaction.
+    // 2. Let store be this's object store.
+    // 3. If store has been deleted, throw an "InvalidStateError" DOMException.
+    // 4. If transaction’s state is not active, then throw a "TransactionInactiveError" DOMException.
+    TRY(check_request_can_be_made(Writes::No));
+
+    // 5. Let range be the result of converting a value to a key range with query. Rethrow any exceptions.
+    auto range = TRY(convert_a_value_to_a_key_range(realm(), query));
+
+    // 6. Let operation be an algorithm to run count the records in a range with store and range.
+    auto operation = JS::create_heap_function(heap(), [this, range = move(range)]() -> WebIDL::ExceptionOr<JS::Value> {
+        // https://w3c.github.io/IndexedDB/#count-the-records-in-a-range
+        // 1. Let count be the number of records, if any, in source’s list of records with key in range.
+        // 2. Return count.
+        size_t count = 0;
+        if (range.lower.has_value() || range.upper.has_value()) {
+            m_store->for_each_record_in_range(range, [&](auto const&) {
+                ++count;
+                return IterationDecision::Continue;
+            });
+        } else {
+            count = m_store->records().size();
+        }
+        return JS::Value(count);
+    });
+
+    // 7. Return the result (an IDBRequest) of running asynchronously execute a request with this and operation.
+    return m_transaction->asynchronously_execute_a_request(*this, operation);
+}
+
+// https://w3c.github.io/IndexedDB/#dom-idbobjectstore-opencursor
+WebIDL::ExceptionOr<JS::NonnullGCPtr<IDBRequest>> IDBObjectStore::open_cursor(JS::Value query, Bindings::IDBCursorDirection direction)
+{
+    return open_a_cursor(query, direction, false);
+}
+
+// https://w3c.github.io/IndexedDB/#dom-idbobjectstore-openkeycursor
+WebIDL::ExceptionOr<JS::NonnullGCPtr<IDBRequest>> IDBObjectStore::open_key_cursor(JS::Value query, Bindings::IDBCursorDirection direction)
+{
+    return open_a_cursor(query, direction, true);
+}
+
+WebIDL::ExceptionOr<JS::NonnullGCPtr<IDBRequest>> IDBObjectStore::open_a_cursor(JS::Value query, Bindings::IDBCursorDirection direction, bool key_only)
+{
+    // 1. Let transaction be this's transaction.
+    // 2. Let store be this's object store.
+    // 3. If store has been deleted, throw an "InvalidStateError" DOMException.
+    // 4. If transaction’s state is not active, then throw a "TransactionInactiveError" DOMException.
+    TRY(check_request_can_be_made(Writes::No));
+
+    // 5. Let range be the result of converting a value to a key range with query. Rethrow any exceptions.
+    auto range = TRY(convert_a_value_to_a_key_range(realm(), query));
+
+    // 6. Let cursor be a new cursor with its transaction set to transaction, undefined position, direction set to
+    //    direction, got value flag set to false, undefined key and value, source set to store, range set to range,
+    //    and key only flag set to false (or true for openKeyCursor()).
+    auto cursor = IDBCursor::create(realm(), JS::NonnullGCPtr { *this }, direction, move(range), key_only);
+
+    // 7. Let operation be an algorithm to run iterate a cursor with the current Realm record and cursor.
+    auto operation = JS::create_heap_function(heap(), [cursor]() -> WebIDL::ExceptionOr<JS::Value> {
+        return cursor->iterate({}, 1);
+    });
+
+    // 8. Let request be the result of running asynchronously execute a request with this and operation.
+    auto request = m_transaction->asynchronously_execute_a_request(*this, operation);
+
+    // 9. Set cursor’s request to request.
+    cursor->set_request(request);
+
+    // 10. Return request.
+    return request;
+}
+
+JS::NonnullGCPtr<IDBIndex> IDBObjectStore::index_handle(Index& index)
+{
+    for (auto const& handle : m_index_handles) {
+        if (&handle->index() == &index)
+            return handle;
+    }
+
+    auto handle = IDBIndex::create(realm(), index, *this);
+    m_index_handles.append(handle);
+    return handle;
+}
+
+// https://w3c.github.io/IndexedDB/#dom-idbobjectstore-index
+WebIDL::ExceptionOr<JS::NonnullGCPtr<IDBIndex>> IDBObjectStore::index(String const& name)
+{
+    auto& realm = this->realm();
+
+    // 1. Let transaction be this's transaction.
+    // 2. Let store be this's object store.
+
+    // 3. If store has been deleted, throw an "InvalidStateError" DOMException.
+    if (is_deleted())
+        return WebIDL::InvalidStateError::create(realm, "The object store has been deleted"_fly_string);
+
+    // 4. If transaction’s state is finished, then throw an "InvalidStateError" DOMException.
+    if (m_transaction->is_finished())
+        return WebIDL::InvalidStateError::create(realm, "The transaction has finished"_fly_string);
+
+    // 5. Let index be the index named name in this's index set if one exists, or throw a "NotFoundError"
+    //    DOMException otherwise.
+    auto index = m_store->index(name);
+    if (!index)
+        return WebIDL::NotFoundError::create(realm, MUST(String::formatted("No index named '{}'", name)));
+
+    // 6. Return an index handle associated with index and this.
+    // NOTE: Each call to this method on the same IDBObjectStore instance with the same name returns the same IDBIndex
+    //       instance.
+    return index_handle(*index);
+}
+
+// https://w3c.github.io/IndexedDB/#dom-idbobjectstore-createindex
+WebIDL::ExceptionOr<JS::NonnullGCPtr<IDBIndex>> IDBObjectStore::create_index(String const& name, KeyPath const& key_path, IDBIndexParameters const& options)
+{
+    auto& realm = this->realm();
+
+    // 1. Let transaction be this's transaction.
+    // 2. Let store be this's object store.
+
+    // 3. If transaction is not an upgrade transaction, throw an "InvalidStateError" DOMException.
+    if (!m_transaction->is_upgrade_transaction())
+        return WebIDL::InvalidStateError::create(realm, "Indexes can only be created in an upgrade transaction"_fly_string);
+
+    // 4. If store has been deleted, throw an "InvalidStateError" DOMException.
+    if (is_deleted())
+        return WebIDL::InvalidStateError::create(realm, "The object store has been deleted"_fly_string);
+
+    // 5. If transaction’s state is not active, then throw a "TransactionInactiveError" DOMException.
+    if (!m_transaction->is_active())
+        return WebIDL::TransactionInactiveError::create(realm, "The transaction is not active"_fly_string);
+
+    // 6. If an index named name already exists in store, throw a "ConstraintError" DOMException.
+    if (m_store->index(name))
+        return WebIDL::ConstraintError::create(realm, MUST(String::formatted("An index named '{}' already exists", name)));
+
+    // 7. If keyPath is not a valid key path, throw a "SyntaxError" DOMException.
+    if (!is_valid_key_path(key_path))
+        return WebIDL::SyntaxError::create(realm, "The key path is not valid"_fly_string);
+
+    // 8. Let unique be options’s unique member.
+    // 9. Let multiEntry be options’s multiEntry member.
+
+    // 10. If keyPath is a sequence and multiEntry is true, throw an "InvalidAccessError" DOMException.
+    if (key_path.has<Vector<String>>() && options.multi_entry)
+        return WebIDL::InvalidAccessError::create(realm, "A multiEntry index cannot have a sequence key path"_fly_string);
+
+    // 11. Let index be a new index in store. Set index’s name to name, key path to keyPath, unique flag to unique, and
+    //     multiEntry flag to multiEntry.
+    auto& batch = m_transaction->batch();
+    auto& index = m_store->create_index(batch, name, key_path, options.unique, options.multi_entry);
+
+    // NOTE: The index is populated with the records of the store right away. If a record violates the index's unique
+    //       constraint, the transaction is aborted with a "ConstraintError" DOMException, as the population would
+    //       have failed in parallel.
+    bool violates_unique_constraint = false;
+    Vector<Key> primary_keys;
+    m_store->records().for_each([&](auto const& record) {
+        primary_keys.append(record.key);
+        return IterationDecision::Continue;
+    });
+    for (auto const& primary_key : primary_keys) {
+        auto value = MUST(deserialize_a_record_value(realm, *m_store->records().find(primary_key)));
+        auto index_key = extract_a_key_from_a_value_using_a_key_path(realm, value, key_path, options.multi_entry);
+        if (index_key.is_error() || !index_key.value().has<Key>())
+            continue;
+
+        auto& extracted_key = index_key.value().get<Key>();
+        Vector<Key> keys;
+        if (options.multi_entry && extracted_key.type() == Key::Type::Array)
+            keys = extracted_key.array_value();
+        else
+            keys.append(move(extracted_key));
+
+        if (options.unique && any_of(keys, [&](auto const& key) { return index.has_conflicting_record(key, primary_key); })) {
+            violates_unique_constraint = true;
+            break;
+        }
+
+        m_store->add_index_records(batch, index, primary_key, move(keys));
+    }
+
+    if (violates_unique_constraint) {
+        HTML::queue_global_task(HTML::Task::Source::DatabaseAccess, realm.global_object(), JS::create_heap_function(heap(), [transaction = m_transaction, &realm] {
+            if (!transaction->is_finished())
+                transaction->abort_a_transaction(WebIDL::ConstraintError::create(realm, "The index's unique constraint is violated by the object store's records"_fly_string));
+        }));
+    }
+
+    // 12. Add index to this's index set.
+    // 13. Return a new index handle associated with index and this.
+    return index_handle(index);
+}
+
+// https://w3c.github.io/IndexedDB/#dom-idbobjectstore-deleteindex
+WebIDL::ExceptionOr<void> IDBObjectStore::delete_index(String const& name)
+{
+    auto& realm = this->realm();
+
+    // 1. Let transaction be this's transaction.
+    // 2. Let store be this's object store.
+
+    // 3. If transaction is not an upgrade transaction, throw an "InvalidStateError" DOMException.
+    if (!m_transaction->is_upgrade_transaction())
+        return WebIDL::InvalidStateError::create(realm, "Indexes can only be deleted in an upgrade transaction"_fly_string);
+
+    // 4. If store has been deleted, throw an "InvalidStateError" DOMException.
+    if (is_deleted())
+        return WebIDL::InvalidStateError::create(realm, "The object store has been deleted"_fly_string);
+
+    // 5. If transaction’s state is not active, then throw a "TransactionInactiveError" DOMException.
+    if (!m_transaction->is_active())
+        return WebIDL::TransactionInactiveError::create(realm, "The transaction is not active"_fly_string);
+
+    // 6. Let index be the index named name in store if one exists, or throw a "NotFoundError" DOMException otherwise.
+    auto index = m_store->index(name);
+    if (!index)
+        return WebIDL::NotFoundError::create(realm, MUST(String::formatted("No index named '{}'", name)));
+
+    // 7. Remove index from this's index set.
+    // 8. Destroy index.
+    // NOTE: Handles of a deleted index find it deleted, and are kept in case the transaction is aborted.
+    m_store->delete_index(m_transaction->batch(), *index);
+    return {};
+}
+
+}
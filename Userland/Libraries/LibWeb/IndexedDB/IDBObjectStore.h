@@ -0,0 +1,100 @@
+/*
+ * Copyright (c) 2024, the SerenityOS developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/NonnullRefPtr.h>
+#include <LibWeb/Bindings/IDBCursorPrototype.h>
+#include <LibWeb/Bindings/PlatformObject.h>
+#include <LibWeb/IndexedDB/Internal/Database.h>
+#include <LibWeb/WebIDL/ExceptionOr.h>
+#include <LibWeb/WebIDL/Types.h>
+
+namespace Web::IndexedDB {
+
+struct IDBIndexParameters {
+    bool unique { false };
+    bool multi_entry { false };
+};
+
+// https://w3c.github.io/IndexedDB/#idbobjectstore
+// An IDBObjectStore is an object store handle, which accesses an object store within a transaction.
+class IDBObjectStore final : public Bindings::PlatformObject {
+    WEB_PLATFORM_OBJECT(IDBObjectStore, Bindings::PlatformObject);
+    JS_DECLARE_ALLOCATOR(IDBObjectStore);
+
+public:
+    [[nodiscard]] static JS::NonnullGCPtr<IDBObjectStore> create(JS::Realm&, ObjectStore&, IDBTransaction&);
+
+    virtual ~IDBObjectStore() override;
+
+    String const& name() const { return m_store->name(); }
+    WebIDL::ExceptionOr<void> set_name(String const&);
+    JS::Value key_path();
+    JS::NonnullGCPtr<HTML::DOMStringList> index_names() const;
+    JS::NonnullGCPtr<IDBTransaction> transaction() const { return m_transaction; }
+    bool auto_increment() const { return m_store->has_key_generator(); }
+
+    WebIDL::ExceptionOr<JS::NonnullGCPtr<IDBRequest>> put(JS::Value value, JS::Value key);
+    WebIDL::ExceptionOr<JS::NonnullGCPtr<IDBRequest>> add(JS::Value value, JS::Value key);
+    WebIDL::ExceptionOr<JS::NonnullGCPtr<IDBRequest>> delete_(JS::Value query);
+    WebIDL::ExceptionOr<JS::NonnullGCPtr<IDBRequest>> clear();
+    WebIDL::ExceptionOr<JS::NonnullGCPtr<IDBRequest>> get(JS::Value query);
+    WebIDL::ExceptionOr<JS::NonnullGCPtr<IDBRequest>> get_key(JS::Value query);
+    WebIDL::ExceptionOr<JS::NonnullGCPtr<IDBRequest>> get_all(JS::Value query, Optional<WebIDL::UnsignedLong> count);
+    WebIDL::ExceptionOr<JS::NonnullGCPtr<IDBRequest>> get_all_keys(JS::Value query, Optional<WebIDL::UnsignedLong> count);
+    WebIDL::ExceptionOr<JS::NonnullGCPtr<IDBRequest>> count(JS::Value query);
+
+    WebIDL::ExceptionOr<JS::NonnullGCPtr<IDBRequest>> open_cursor(JS::Value query, Bindings::IDBCursorDirection);
+    WebIDL::ExceptionOr<JS::NonnullGCPtr<IDBRequest>> open_key_cursor(JS::Value query, Bindings::IDBCursorDirection);
+
+    WebIDL::ExceptionOr<JS::NonnullGCPtr<IDBIndex>> index(String const& name);
+    WebIDL::ExceptionOr<JS::NonnullGCPtr<IDBIndex>> create_index(String const& name, KeyPath const& key_path, IDBIndexParameters const&);
+    WebIDL::ExceptionOr<void> delete_index(String const& name);
+
+    ObjectStore& store() const { return m_store; }
+
+    // https://w3c.github.io/IndexedDB/#object-store-deleted
+    bool is_deleted() const;
+
+private:
+    IDBObjectStore(JS::Realm&, ObjectStore&, IDBTransaction&);
+
+    virtual void initialize(JS::Realm&) override;
+    virtual void visit_edges(Cell::Visitor&) override;
+
+    enum class NoOverwrite : bool {
+        No,
+        Yes,
+    };
+
+    // https://w3c.github.io/IndexedDB/#add-or-put
+    WebIDL::ExceptionOr<JS::NonnullGCPtr<IDBRequest>> add_or_put(JS::Value value, JS::Value key, NoOverwrite);
+
+    WebIDL::ExceptionOr<JS::NonnullGCPtr<IDBRequest>> open_a_cursor(JS::Value query, Bindings::IDBCursorDirection, bool key_only);
+
+    // Checks that requests can be made against the object store: that it has not been deleted, and that the
+    // transaction is active and, if the request changes the store, not read-only.
+    enum class Writes : bool {
+        No,
+        Yes,
+    };
+    WebIDL::ExceptionOr<void> check_request_can_be_made(Writes);
+
+    JS::NonnullGCPtr<IDBIndex> index_handle(Index&);
+
+    NonnullRefPtr<ObjectStore> m_store;
+    JS::NonnullGCPtr<IDBTransaction> m_transaction;
+
+    // https://w3c.github.io/IndexedDB/#object-store-handle-index-set
+    // The handles of the indexes of the object store that were requested through this handle.
+    Vector<JS::NonnullGCPtr<IDBIndex>> m_index_handles;
+
+    // The keyPath attribute returns the same object every time.
+    JS::Value m_key_path_value;
+};
+
+}
@@ -6,12 +6,19 @@
 
 #include <LibWeb/Bindings/IDBOpenDBRequestPrototype.h>
 #include <LibWeb/Bindings/Intrinsics.h>
+#include <LibWeb/HTML/EventHandler.h>
+#include <LibWeb/HTML/EventNames.h>
 #include <LibWeb/IndexedDB/IDBOpenDBRequest.h>
 
 namespace Web::IndexedDB {
 
 JS_DEFINE_ALLOCATOR(IDBOpenDBRequest);
 
+JS::NonnullGCPtr<IDBOpenDBRequest> IDBOpenDBRequest::create(JS::Realm& realm)
+{
+    return realm.heap().allocate<IDBOpenDBRequest>(realm, realm);
+}
+
 IDBOpenDBRequest::~IDBOpenDBRequest() = default;
 
 IDBOpenDBRequest::IDBOpenDBRequest(JS::Realm& realm)
@@ -25,4 +32,17 @@ void IDBOpenDBRequest::initialize(JS::Realm& realm)
     WEB_SET_PROTOTYPE_FOR_INTERFACE(IDBOpenDBRequest);
 }
 
+#undef __ENUMERATE
+#define __ENUMERATE(attribute_name, event_name)                              \
+    void IDBOpenDBRequest::set_##attribute_name(WebIDL::CallbackType* value) \
+    {                                                                        \
+        set_event_handler_attribute(event_name, value);                      \
+    }                                                                        \
+    WebIDL::CallbackType* IDBOpenDBRequest::attribute_name()                 \
+    {                                                                        \
+        return event_handler_attribute(event_name);                          \
+    }
+ENUMERATE_IDB_OPEN_DB_REQUEST_EVENT_HANDLERS(__ENUMERATE)
+#undef __ENUMERATE
+
 }
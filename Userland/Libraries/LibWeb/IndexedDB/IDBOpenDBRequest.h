@@ -10,14 +10,27 @@
 
 namespace Web::IndexedDB {
 
+#define ENUMERATE_IDB_OPEN_DB_REQUEST_EVENT_HANDLERS(E) \
+    E(onblocked, HTML::EventNames::blocked)             \
+    E(onupgradeneeded, HTML::EventNames::upgradeneeded)
+
 // https://w3c.github.io/IndexedDB/#idbopendbrequest
 class IDBOpenDBRequest : public IDBRequest {
     WEB_PLATFORM_OBJECT(IDBOpenDBRequest, IDBRequest);
     JS_DECLARE_ALLOCATOR(IDBOpenDBRequest);
 
 public:
+    [[nodiscard]] static JS::NonnullGCPtr<IDBOpenDBRequest> create(JS::Realm&);
+
     virtual ~IDBOpenDBRequest();
 
+#undef __ENUMERATE
+#define __ENUMERATE(attribute_name, event_name)       \
+    void set_##attribute_name(WebIDL::CallbackType*); \
+    WebIDL::CallbackType* attribute_name();
+    ENUMERATE_IDB_OPEN_DB_REQUEST_EVENT_HANDLERS(__ENUMERATE)
+#undef __ENUMERATE
+
 protected:
     explicit IDBOpenDBRequest(JS::Realm&);
 
@@ -6,23 +6,138 @@
 
 #include <LibWeb/Bindings/IDBRequestPrototype.h>
 #include <LibWeb/Bindings/Intrinsics.h>
+#include <LibWeb/HTML/EventHandler.h>
+#include <LibWeb/HTML/EventNames.h>
+#include <LibWeb/IndexedDB/IDBCursor.h>
+#include <LibWeb/IndexedDB/IDBIndex.h>
+#include <LibWeb/IndexedDB/IDBObjectStore.h>
 #include <LibWeb/IndexedDB/IDBRequest.h>
+#include <LibWeb/IndexedDB/IDBTransaction.h>
+#include <LibWeb/WebIDL/DOMException.h>
 
 namespace Web::IndexedDB {
 
 JS_DEFINE_ALLOCATOR(IDBRequest);
 
-IDBRequest::~IDBRequest() = default;
+JS::NonnullGCPtr<IDBRequest> IDBRequest::create(JS::Realm& realm, JS::GCPtr<JS::Object> source, JS::GCPtr<IDBTransaction> transaction, JS::GCPtr<Operation> operation)
+{
+    return realm.heap().allocate<IDBRequest>(realm, realm, source, transaction, operation);
+}
 
-IDBRequest::IDBRequest(JS::Realm& realm)
+IDBRequest::IDBRequest(JS::Realm& realm, JS::GCPtr<JS::Object> source, JS::GCPtr<IDBTransaction> transaction, JS::GCPtr<Operation> operation)
     : EventTarget(realm)
+    , m_source(source)
+    , m_transaction(transaction)
+    , m_operation(operation)
 {
 }
 
+IDBRequest::~IDBRequest() = default;
+
 void IDBRequest::initialize(JS::Realm& realm)
 {
     Base::initialize(realm);
     WEB_SET_PROTOTYPE_FOR_INTERFACE(IDBRequest);
 }
 
+void IDBRequest::visit_edges(Cell::Visitor& visitor)
+{
+    Base::visit_edges(visitor);
+    visitor.visit(m_source);
+    visitor.visit(m_transaction);
+    visitor.visit(m_operation);
+    visitor.visit(m_result);
+    visitor.visit(m_error);
+}
+
+// https://w3c.github.io/IndexedDB/#dom-idbrequest-result
+WebIDL::ExceptionOr<JS::Value> IDBRequest::result() const
+{
+    // 1. If this's done flag is false, then throw an "InvalidStateError" DOMException.
+    if (!m_done)
+        return WebIDL::InvalidStateError::create(realm(), "The request is not done"_fly_string);
+
+    // 2. Otherwise, return this's result, or undefined if the request resulted in an error.
+    return m_result;
+}
+
+// https://w3c.github.io/IndexedDB/#dom-idbrequest-error
+WebIDL::ExceptionOr<JS::GCPtr<WebIDL::DOMException>> IDBRequest::error() const
+{
+    // 1. If this's done flag is false, then throw an "InvalidStateError" DOMException.
+    if (!m_done)
+        return WebIDL::InvalidStateError::create(realm(), "The request is not done"_fly_string);
+
+    // 2. Otherwise, return this's error, or null if no error occurred.
+    return m_error;
+}
+
+// https://w3c.github.io/IndexedDB/#dom-idbrequest-source
+Variant<Empty, JS::Handle<IDBObjectStore>, JS::Handle<IDBIndex>, JS::Handle<IDBCursor>> IDBRequest::source() const
+{
+    // The source getter steps are to return this's source, or null if no source is set.
+    if (!m_source)
+        return Empty {};
+    if (is<IDBObjectStore>(*m_source))
+        return JS::make_handle(verify_cast<IDBObjectStore>(*m_source));
+    if (is<IDBIndex>(*m_source))
+        return JS::make_handle(verify_cast<IDBIndex>(*m_source));
+    return JS::make_handle(verify_cast<IDBCursor>(*m_source));
+}
+
+// https://w3c.github.io/IndexedDB/#dom-idbrequest-readystate
+Bindings::IDBRequestReadyState IDBRequest::ready_state() const
+{
+    // The readyState getter steps are to return "pending" if this's done flag is false, and "done" otherwise.
+    return m_done ? Bindings::IDBRequestReadyState::Done : Bindings::IDBRequestReadyState::Pending;
+}
+
+// https://w3c.github.io/IndexedDB/#request-construct
+DOM::EventTarget* IDBRequest::get_parent(DOM::Event const&)
+{
+    // The get the parent algorithm for a request returns the request's transaction.
+    return m_transaction;
+}
+
+void IDBRequest::reset(JS::NonnullGCPtr<Operation> operation)
+{
+    m_operation = operation;
+    m_processed = false;
+    m_done = false;
+}
+
+void IDBRequest::process()
+{
+    VERIFY(m_operation);
+    VERIFY(!m_processed);
+
+    auto result = m_operation->function()();
+    if (result.is_exception()) {
+        auto exception = result.release_error();
+        m_result = JS::js_undefined();
+        if (auto* dom_exception = exception.get_pointer<JS::NonnullGCPtr<WebIDL::DOMException>>())
+            m_error = *dom_exception;
+        else
+            m_error = WebIDL::UnknownError::create(realm(), "The operation failed"_fly_string);
+    } else {
+        m_result = result.release_value();
+        m_error = nullptr;
+    }
+
+    m_processed = true;
+}
+
+#undef __ENUMERATE
+#define __ENUMERATE(attribute_name, event_name)                        \
+    void IDBRequest::set_##attribute_name(WebIDL::CallbackType* value) \
+    {                                                                  \
+        set_event_handler_attribute(event_name, value);                \
+    }                                                                  \
+    WebIDL::CallbackType* IDBRequest::attribute_name()                 \
+    {                                                                  \
+        return event_handler_attribute(event_name);                    \
+    }
+ENUMERATE_IDB_REQUEST_EVENT_HANDLERS(__ENUMERATE)
+#undef __ENUMERATE
+
 }
@@ -6,21 +6,80 @@
 
 #pragma once
 
+#include <LibJS/Heap/HeapFunction.h>
+#include <LibWeb/Bindings/IDBRequestPrototype.h>
 #include <LibWeb/DOM/EventTarget.h>
+#include <LibWeb/WebIDL/ExceptionOr.h>
 
 namespace Web::IndexedDB {
 
+#define ENUMERATE_IDB_REQUEST_EVENT_HANDLERS(E) \
+    E(onsuccess, HTML::EventNames::success)     \
+    E(onerror, HTML::EventNames::error)
+
+// https://w3c.github.io/IndexedDB/#idbrequest
 class IDBRequest : public DOM::EventTarget {
     WEB_PLATFORM_OBJECT(IDBRequest, DOM::EventTarget);
     JS_DECLARE_ALLOCATOR(IDBRequest);
 
 public:
+    using Operation = JS::HeapFunction<WebIDL::ExceptionOr<JS::Value>()>;
+
+    [[nodiscard]] static JS::NonnullGCPtr<IDBRequest> create(JS::Realm&, JS::GCPtr<JS::Object> source, JS::GCPtr<IDBTransaction>, JS::GCPtr<Operation>);
+
     virtual ~IDBRequest() override;
 
+    WebIDL::ExceptionOr<JS::Value> result() const;
+    WebIDL::ExceptionOr<JS::GCPtr<WebIDL::DOMException>> error() const;
+    Variant<Empty, JS::Handle<IDBObjectStore>, JS::Handle<IDBIndex>, JS::Handle<IDBCursor>> source() const;
+    JS::GCPtr<IDBTransaction> transaction() const { return m_transaction; }
+    Bindings::IDBRequestReadyState ready_state() const;
+
+#undef __ENUMERATE
+#define __ENUMERATE(attribute_name, event_name)       \
+    void set_##attribute_name(WebIDL::CallbackType*); \
+    WebIDL::CallbackType* attribute_name();
+    ENUMERATE_IDB_REQUEST_EVENT_HANDLERS(__ENUMERATE)
+#undef __ENUMERATE
+
+    bool is_done() const { return m_done; }
+    bool is_processed() const { return m_processed; }
+
+    void set_transaction(JS::GCPtr<IDBTransaction> transaction) { m_transaction = transaction; }
+
+    // Makes the request pending again with a new operation, as iterating a cursor does.
+    void reset(JS::NonnullGCPtr<Operation>);
+
+    // Runs the request's operation. Its result or error becomes visible once the request is marked as done.
+    void process();
+
+    void set_done(bool done) { m_done = done; }
+    void set_processed(bool processed) { m_processed = processed; }
+    void set_result(JS::Value result) { m_result = result; }
+    JS::GCPtr<WebIDL::DOMException> error_value() const { return m_error; }
+    void set_error(JS::GCPtr<WebIDL::DOMException> error) { m_error = error; }
+
 protected:
-    explicit IDBRequest(JS::Realm&);
+    IDBRequest(JS::Realm&, JS::GCPtr<JS::Object> source = {}, JS::GCPtr<IDBTransaction> = {}, JS::GCPtr<Operation> = {});
 
     virtual void initialize(JS::Realm&) override;
+    virtual void visit_edges(Cell::Visitor&) override;
+
+private:
+    virtual EventTarget* get_parent(DOM::Event const&) override;
+
+    JS::GCPtr<JS::Object> m_source;
+    JS::GCPtr<IDBTransaction> m_transaction;
+    JS::GCPtr<Operation> m_operation;
+
+    // https://w3c.github.io/IndexedDB/#request-processed-flag
+    bool m_processed { false };
+
+    // https://w3c.github.io/IndexedDB/#request-done-flag
+    bool m_done { false };
+
+    JS::Value m_result;
+    JS::GCPtr<WebIDL::DOMException> m_error;
 };
 
 }
@@ -0,0 +1,548 @@
+/*
+ * Copyright (c) 2024, the SerenityOS developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibWeb/Bindings/IDBTransactionPrototype.h>
+#include <LibWeb/Bindings/Intrinsics.h>
+#include <LibWeb/DOM/Event.h>
+#include <LibWeb/HTML/DOMStringList.h>
+#include <LibWeb/HTML/EventHandler.h>
+#include <LibWeb/HTML/EventLoop/EventLoop.h>
+#include <LibWeb/HTML/EventNames.h>
+#include <LibWeb/IndexedDB/IDBDatabase.h>
+#include <LibWeb/IndexedDB/IDBObjectStore.h>
+#include <LibWeb/IndexedDB/IDBOpenDBRequest.h>
+#include <LibWeb/IndexedDB/IDBTransaction.h>
+#include <LibWeb/IndexedDB/Internal/Algorithms.h>
+#include <LibWeb/IndexedDB/Internal/DatabaseState.h>
+#include <LibWeb/WebIDL/DOMException.h>
+
+namespace Web::IndexedDB {
+
+JS_DEFINE_ALLOCATOR(IDBTransaction);
+
+JS::NonnullGCPtr<IDBTransaction> IDBTransaction::create(JS::Realm& realm, IDBDatabase& connection, Vector<String> scope, Bindings::IDBTransactionMode mode)
+{
+    auto transaction = realm.heap().allocate<IDBTransaction>(realm, realm, connection, move(scope), mode);
+    connection.state().add_transaction(transaction);
+    return transaction;
+}
+
+IDBTransaction::IDBTransaction(JS::Realm& realm, IDBDatabase& connection, Vector<String> scope, Bindings::IDBTransactionMode mode)
+    : EventTarget(realm)
+    , m_connection(connection)
+    , m_scope(move(scope))
+    , m_mode(mode)
+{
+}
+
+IDBTransaction::~IDBTransaction() = default;
+
+void IDBTransaction::initialize(JS::Realm& realm)
+{
+    Base::initialize(realm);
+    WEB_SET_PROTOTYPE_FOR_INTERFACE(IDBTransaction);
+}
+
+void IDBTransaction::visit_edges(Cell::Visitor& visitor)
+{
+    Base::visit_edges(visitor);
+    visitor.visit(m_connection);
+    visitor.visit(m_error);
+    visitor.visit(m_request_list);
+    visitor.visit(m_object_store_handles);
+    visitor.visit(m_cleanup_event_loop);
+    visitor.visit(m_open_request);
+}
+
+// https://w3c.github.io/IndexedDB/#transaction-construct
+DOM::EventTarget* IDBTransaction::get_parent(DOM::Event const&)
+{
+    // The get the parent algorithm for a transaction returns the transaction’s connection.
+    return m_connection.ptr();
+}
+
+Database& IDBTransaction::database() const
+{
+    return m_connection->database();
+}
+
+bool IDBTransaction::is_in_scope(String const& object_store_name) const
+{
+    if (is_upgrade_transaction())
+        return true;
+    return m_scope.contains_slow(object_store_name);
+}
+
+// https://w3c.github.io/IndexedDB/#transaction-overlap
+bool IDBTransaction::overlaps(IDBTransaction const& other) const
+{
+    // A transaction’s scope overlaps with another transaction’s scope if any object store is in both scopes.
+    if (is_upgrade_transaction() || other.is_upgrade_transaction())
+        return true;
+    return any_of(m_scope, [&](auto const& name) { return other.m_scope.contains_slow(name); });
+}
+
+void IDBTransaction::clear_cleanup_event_loop()
+{
+    VERIFY(m_cleanup_event_loop);
+    m_cleanup_event_loop = nullptr;
+
+    if (m_state != State::Active)
+        return;
+
+    m_state = State::Inactive;
+
+    // https://w3c.github.io/IndexedDB/#transaction-lifetime
+    // When a transaction has been started and it can no longer become active, the implementation must attempt to
+    // commit it, as long as the transaction has not been aborted. This usually happens after all requests placed
+    // against the transaction have been executed and their returned results handled, and no new requests have been
+    // placed against the transaction.
+    if (m_request_list.is_empty())
+        commit_a_transaction();
+}
+
+// https://w3c.github.io/IndexedDB/#dom-idbtransaction-objectstorenames
+JS::NonnullGCPtr<HTML::DOMStringList> IDBTransaction::object_store_names() const
+{
+    // 1. Let names be a list of the names of the object stores in this's scope.
+    Vector<String> names;
+    if (is_upgrade_transaction()) {
+        for (auto const& object_store : database().object_stores())
+            names.append(object_store->name());
+    } else {
+        names = m_scope;
+    }
+
+    // 2. Return the result (a DOMStringList) of creating a sorted name list with names.
+    return create_a_sorted_name_list(realm(), move(names));
+}
+
+JS::GCPtr<IDBObjectStore> IDBTransaction::object_store_handle(ObjectStore const& object_store) const
+{
+    for (auto const& handle : m_object_store_handles) {
+        if (&handle->store() == &object_store)
+            return handle;
+    }
+    return nullptr;
+}
+
+// https://w3c.github.io/IndexedDB/#dom-idbtransaction-objectstore
+WebIDL::ExceptionOr<JS::NonnullGCPtr<IDBObjectStore>> IDBTransaction::object_store(String const& name)
+{
+    auto& realm = this->realm();
+
+    // 1. If this's state is finished, then throw an "InvalidStateError" DOMException.
+    if (m_state == State::Finished)
+        return WebIDL::InvalidStateError::create(realm, "The transaction has finished"_fly_string);
+
+    // 2. Let store be the object store named name in this's scope, or throw a "NotFoundError" DOMException if none.
+    auto store = is_in_scope(name) ? database().object_store(name) : nullptr;
+    if (!store)
+        return WebIDL::NotFoundError::create(realm, MUST(String::formatted("No object store named '{}' in the transaction's scope", name)));
+
+    // 3. Return an object store handle associated with store and this.
+    // NOTE: Each call to this method on the same transaction instance with the same name returns the same handle.
+    if (auto handle = object_store_handle(*store))
+        return JS::NonnullGCPtr { *handle };
+
+    auto handle = IDBObjectStore::create(realm, *store, *this);
+    m_object_store_handles.append(handle);
+    return handle;
+}
+
+// https://w3c.github.io/IndexedDB/#dom-idbtransaction-commit
+WebIDL::ExceptionOr<void> IDBTransaction::commit()
+{
+    // 1. If this's state is not active, then throw an "InvalidStateError" DOMException.
+    if (m_state != State::Active)
+        return WebIDL::InvalidStateError::create(realm(), "The transaction is not active"_fly_string);
+
+    // 2. Run commit a transaction with this.
+    commit_a_transaction();
+    return {};
+}
+
+// https://w3c.github.io/IndexedDB/#dom-idbtransaction-abort
+WebIDL::ExceptionOr<void> IDBTransaction::abort()
+{
+    // 1. If this's state is committing or finished, then throw an "InvalidStateError" DOMException.
+    if (m_state == State::Committing || m_state == State::Finished)
+        return WebIDL::InvalidStateError::create(realm(), "The transaction is committing or has finished"_fly_string);
+
+    // 2. Set this's state to inactive and run abort a transaction with this and null.
+    m_state = State::Inactive;
+    abort_a_transaction(nullptr);
+    return {};
+}
+
+// https://w3c.github.io/IndexedDB/#transaction-lifecycle
+void IDBTransaction::start()
+{
+    VERIFY(!m_started);
+
+    // Once the transaction has been started the implementation can begin executing the requests placed against the
+    // transaction.
+    m_started = true;
+    schedule_processing();
+}
+
+// https://w3c.github.io/IndexedDB/#asynchronously-execute-a-request
+JS::NonnullGCPtr<IDBRequest> IDBTransaction::asynchronously_execute_a_request(JS::Object& source, JS::NonnullGCPtr<IDBRequest::Operation> operation, JS::GCPtr<IDBRequest> request)
+{
+    // 1. Let transaction be the transaction associated with source.
+    // 2. Assert: transaction’s state is active.
+    VERIFY(m_state == State::Active);
+
+    // 3. If request was not given, let request be a new request with source as source.
+    if (!request)
+        request = IDBRequest::create(realm(), source, this, operation);
+    else
+        request->reset(operation);
+
+    // 4. Add request to the end of transaction’s request list.
+    m_request_list.append(*request);
+
+    // 5. Run these steps in parallel:
+    schedule_processing();
+
+    // 6. Return request.
+    return *request;
+}
+
+void IDBTransaction::schedule_processing()
+{
+    if (!m_started || m_is_processing_scheduled || m_state == State::Finished)
+        return;
+
+    m_is_processing_scheduled = true;
+    HTML::queue_global_task(HTML::Task::Source::DatabaseAccess, realm().global_object(), JS::create_heap_function(heap(), [this] {
+        process_requests();
+    }));
+}
+
+void IDBTransaction::process_requests()
+{
+    m_is_processing_scheduled = false;
+
+    for (auto& request : Vector { m_request_list }) {
+        if (m_state == State::Finished)
+            return;
+        if (request->is_processed())
+            continue;
+
+        // 1. Wait until request is the first item in transaction’s request list that is not processed.
+        // 2. Let result be the result of performing operation.
+        // 4. If result is an error, then revert all changes made by operation.
+        // NOTE: Operations check for errors before they make any changes.
+        // 5. Set request’s processed flag to true.
+        request->process();
+
+        // 3. If result is an error and transaction’s state is committing, then run abort a transaction with
+        //    transaction and result, and terminate these steps.
+        if (request->error_value() && m_state == State::Committing) {
+            abort_a_transaction(request->error_value());
+            return;
+        }
+
+        // 6. Queue a database task to run these steps:
+        HTML::queue_global_task(HTML::Task::Source::DatabaseAccess, realm().global_object(), JS::create_heap_function(heap(), [this, request] {
+            deliver_result(request);
+        }));
+    }
+
+    // https://w3c.github.io/IndexedDB/#commit-a-transaction
+    // 2. Run the following steps in parallel:
+    //    1. Wait until every item in transaction’s request list is processed.
+    if (m_state == State::Committing && !m_is_writing)
+        write_changes();
+}
+
+void IDBTransaction::deliver_result(IDBRequest& request)
+{
+    // NOTE: Requests that were pending when the transaction was aborted have already been removed.
+    auto index = m_request_list.find_first_index_if([&](auto& other) { return other.ptr() == &request; });
+    if (!index.has_value())
+        return;
+
+    // 1. Remove request from transaction’s request list.
+    m_request_list.remove(*index);
+
+    // 2. Set request’s done flag to true.
+    request.set_done(true);
+
+    // 3. If result is an error, then:
+    if (request.error_value()) {
+        // 1. Set request’s result to undefined.
+        // 2. Set request’s error to result.
+        // 3. Fire an error event at request.
+        fire_error_event(request);
+    }
+    // 4. Otherwise:
+    else {
+        // 1. Set request’s result to result.
+        // 2. Set request’s error to undefined.
+        // 3. Fire a success event at request.
+        fire_success_event(request);
+    }
+}
+
+// https://w3c.github.io/IndexedDB/#fire-a-success-event
+void IDBTransaction::fire_success_event(IDBRequest& request)
+{
+    // 1. Let event be the result of creating an event using Event.
+    // 2. Set event’s type attribute to "success".
+    // 3. Set event’s bubbles and cancelable attributes to false.
+    auto event = DOM::Event::create(realm(), HTML::EventNames::success);
+
+    // 4. Let transaction be request’s transaction.
+    // 5. Let legacyOutputDidListenersThrowFlag be initially false.
+    // 6. If transaction’s state is inactive, then set transaction’s state to active.
+    if (m_state == State::Inactive)
+        m_state = State::Active;
+
+    // 7. Dispatch event at request with legacyOutputDidListenersThrowFlag.
+    request.dispatch_event(event);
+
+    // 8. If transaction’s state is active, then:
+    if (m_state == State::Active) {
+        // 1. Set transaction’s state to inactive.
+        m_state = State::Inactive;
+
+        // FIXME: 2. If legacyOutputDidListenersThrowFlag is true, then run abort a transaction with transaction and a
+        //           newly created "AbortError" DOMException.
+
+        // 3. If transaction’s request list is empty, then run commit a transaction with transaction.
+        if (m_request_list.is_empty())
+            commit_a_transaction();
+    }
+}
+
+// https://w3c.github.io/IndexedDB/#fire-an-error-event
+void IDBTransaction::fire_error_event(IDBRequest& request)
+{
+    // 1. Let event be the result of creating an event using Event.
+    // 2. Set event’s type attribute to "error".
+    // 3. Set event’s bubbles and cancelable attributes to true.
+    DOM::EventInit event_init;
+    event_init.bubbles = true;
+    event_init.cancelable = true;
+    auto event = DOM::Event::create(realm(), HTML::EventNames::error, event_init);
+
+    // 4. Let transaction be request’s transaction.
+    // 5. Let legacyOutputDidListenersThrowFlag be initially false.
+    // 6. If transaction’s state is inactive, then set transaction’s state to active.
+    if (m_state == State::Inactive)
+        m_state = State::Active;
+
+    // 7. Dispatch event at request with legacyOutputDidListenersThrowFlag.
+    request.dispatch_event(event);
+
+    // 8. If transaction’s state is active, then:
+    if (m_state == State::Active) {
+        // 1. Set transaction’s state to inactive.
+        m_state = State::Inactive;
+
+        // FIXME: 2. If legacyOutputDidListenersThrowFlag is true, then run abort a transaction with transaction and a
+        //           newly created "AbortError" DOMException and terminate these steps.
+
+        // 3. If event’s canceled flag is false, then run abort a transaction using transaction and request's error,
+        //    and terminate these steps.
+        if (!event->cancelled()) {
+            abort_a_transaction(request.error_value());
+            return;
+        }
+
+        // 4. If transaction’s request list is empty, then run commit a transaction with transaction.
+        if (m_request_list.is_empty())
+            commit_a_transaction();
+    }
+}
+
+// https://w3c.github.io/IndexedDB/#commit-a-transaction
+void IDBTransaction::commit_a_transaction()
+{
+    // 1. Set transaction’s state to committing.
+    m_state = State::Committing;
+
+    // 2. Run the following steps in parallel:
+    schedule_processing();
+}
+
+void IDBTransaction::write_changes()
+{
+    m_is_writing = true;
+
+    auto completed = [this, transaction = JS::make_handle(this)](ErrorOr<void> result) {
+        // 2. If transaction’s state is no longer committing, then terminate these steps.
+        if (m_state != State::Committing)
+            return;
+
+        // 3. Attempt to write any outstanding changes made by transaction to the database, considering transaction’s
+        //    durability hint.
+        // 4. If an error occurs while writing the changes to the database, then run abort a transaction with
+        //    transaction and an appropriate type for the error, for example "QuotaExceededError" or "UnknownError"
+        //    DOMException, and terminate these steps.
+        if (result.is_error()) {
+            dbgln("IndexedDB: Failed to write changes to database '{}': {}", m_connection->name(), result.error());
+            if (result.error().is_errno() && result.error().code() == ENOSPC)
+                abort_a_transaction(WebIDL::QuotaExceededError::create(realm(), "Not enough space to store the changes"_fly_string));
+            else
+                abort_a_transaction(WebIDL::UnknownError::create(realm(), "Failed to store the changes"_fly_string));
+            return;
+        }
+
+        // 5. Queue a database task to run these steps:
+        HTML::queue_global_task(HTML::Task::Source::DatabaseAccess, realm().global_object(), JS::create_heap_function(heap(), [this] {
+            // 1. If transaction is an upgrade transaction, then set transaction’s connection's associated database's
+            //    upgrade transaction to null.
+            if (is_upgrade_transaction())
+                m_connection->set_upgrade_transaction(nullptr);
+
+            // 2. Set transaction’s state to finished.
+            m_state = State::Finished;
+            m_batch = {};
+
+            // 3. Fire an event named complete at transaction.
+            dispatch_event(DOM::Event::create(realm(), HTML::EventNames::complete));
+
+            // 4. If transaction is an upgrade transaction, then let request be the request associated with
+            //    transaction and set request’s transaction to null.
+            if (is_upgrade_transaction())
+                m_open_request->set_transaction(nullptr);
+
+            finish();
+        }));
+    };
+
+    if (m_batch.is_empty()) {
+        completed({});
+        return;
+    }
+
+    m_connection->state().write_journal(m_batch.take_journal(), move(completed));
+}
+
+// https://w3c.github.io/IndexedDB/#abort-a-transaction
+void IDBTransaction::abort_a_transaction(JS::GCPtr<WebIDL::DOMException> error)
+{
+    auto& realm = this->realm();
+
+    // 1. All the changes made to the database by the transaction are reverted. For upgrade transactions this includes
+    //    changes to the set of object stores and indexes, as well as the change to the version. Any object stores and
+    //    indexes which were created during the transaction are now considered deleted for the purposes of other
+    //    algorithms.
+    m_batch.revert();
+
+    // 2. If transaction is an upgrade transaction, run the steps to abort an upgrade transaction with transaction.
+    if (is_upgrade_transaction()) {
+        // https://w3c.github.io/IndexedDB/#abort-an-upgrade-transaction
+        // 1. Let connection be transaction’s connection.
+        // 2. Let database be connection’s database.
+        // 3. Set connection’s version to database’s version if database previously existed, or 0 (zero) if database
+        //    was newly created.
+        // 4. Set connection’s object store set to the set of object stores in database if database previously
+        //    existed, or the empty set if database was newly created.
+        // NOTE: Reverting the transaction's changes restored the database's version, and its object stores.
+        m_connection->set_version(database().version());
+
+        // 5. For each object store handle handle associated with transaction, including those for object stores that
+        //    were created or deleted during transaction:
+        //    1. If handle’s object store was not newly created during transaction, set handle’s name to its object
+        //       store's name.
+        //    2. Set handle’s index set to the set of indexes that reference its object store.
+        // NOTE: Handles read their name and indexes from their object store, which were reverted.
+    }
+
+    // 3. Set transaction’s state to finished.
+    m_state = State::Finished;
+    m_was_aborted = true;
+
+    // 4. If error is not null, set transaction’s error to error.
+    if (error)
+        m_error = error;
+
+    // 5. For each request of transaction’s request list, abort the steps to asynchronously execute a request for
+    //    request, set request’s processed flag to true, and queue a database task to run these steps:
+    for (auto& request : m_request_list) {
+        request->set_processed(true);
+
+        HTML::queue_global_task(HTML::Task::Source::DatabaseAccess, realm.global_object(), JS::create_heap_function(heap(), [&realm, request] {
+            // 1. Set request’s done flag to true.
+            request->set_done(true);
+
+            // 2. Set request’s result to undefined.
+            request->set_result(JS::js_undefined());
+
+            // 3. Set request’s error to a newly created "AbortError" DOMException.
+            request->set_error(WebIDL::AbortError::create(realm, "The transaction was aborted"_fly_string));
+
+            // 4. Fire an event named error at request with its bubbles and cancelable attributes initialized to true.
+            DOM::EventInit event_init;
+            event_init.bubbles = true;
+            event_init.cancelable = true;
+            request->dispatch_event(DOM::Event::create(realm, HTML::EventNames::error, event_init));
+        }));
+    }
+    m_request_list.clear();
+
+    // 6. Queue a database task to run these steps:
+    HTML::queue_global_task(HTML::Task::Source::DatabaseAccess, realm.global_object(), JS::create_heap_function(heap(), [this, &realm] {
+        // 1. If transaction is an upgrade transaction, then set transaction’s connection's associated database's
+        //    upgrade transaction to null.
+        if (is_upgrade_transaction())
+            m_connection->set_upgrade_transaction(nullptr);
+
+        // 2. Fire an event named abort at transaction with its bubbles attribute initialized to true.
+        DOM::EventInit event_init;
+        event_init.bubbles = true;
+        dispatch_event(DOM::Event::create(realm, HTML::EventNames::abort, event_init));
+
+        // 3. If transaction is an upgrade transaction, then:
+        if (is_upgrade_transaction()) {
+            // 1. Let request be the open request associated with transaction.
+            // 2. Set request’s transaction to null.
+            m_open_request->set_transaction(nullptr);
+
+            // 3. Set request’s result to undefined.
+            m_open_request->set_result(JS::js_undefined());
+
+            // 4. Set request’s processed flag to false.
+            m_open_request->set_processed(false);
+
+            // 5. Set request’s done flag to false.
+            m_open_request->set_done(false);
+        }
+
+        finish();
+    }));
+}
+
+void IDBTransaction::finish()
+{
+    VERIFY(m_state == State::Finished);
+
+    m_batch = {};
+    m_connection->state().remove_transaction(*this);
+    m_connection->transaction_finished();
+
+    if (auto on_finish = move(m_on_finish))
+        on_finish();
+}
+
+#undef __ENUMERATE
+#define __ENUMERATE(attribute_name, event_name)                            \
+    void IDBTransaction::set_##attribute_name(WebIDL::CallbackType* value) \
+    {                                                                      \
+        set_event_handler_attribute(event_name, value);                    \
+    }                                                                      \
+    WebIDL::CallbackType* IDBTransaction::attribute_name()                 \
+    {                                                                      \
+        return event_handler_attribute(event_name);                        \
+    }
+ENUMERATE_IDB_TRANSACTION_EVENT_HANDLERS(__ENUMERATE)
+#undef __ENUMERATE
+
+}
@@ -0,0 +1,143 @@
+/*
+ * Copyright (c) 2024, the SerenityOS developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <LibJS/Heap/HeapFunction.h>
+#include <LibWeb/Bindings/IDBTransactionPrototype.h>
+#include <LibWeb/DOM/EventTarget.h>
+#include <LibWeb/IndexedDB/IDBRequest.h>
+#include <LibWeb/IndexedDB/Internal/Database.h>
+
+namespace Web::IndexedDB {
+
+#define ENUMERATE_IDB_TRANSACTION_EVENT_HANDLERS(E) \
+    E(onabort, HTML::EventNames::abort)             \
+    E(oncomplete, HTML::EventNames::complete)       \
+    E(onerror, HTML::EventNames::error)
+
+// https://w3c.github.io/IndexedDB/#idbtransaction
+class IDBTransaction final : public DOM::EventTarget {
+    WEB_PLATFORM_OBJECT(IDBTransaction, DOM::EventTarget);
+    JS_DECLARE_ALLOCATOR(IDBTransaction);
+
+public:
+    // https://w3c.github.io/IndexedDB/#transaction-state
+    enum class State {
+        Active,
+        Inactive,
+        Committing,
+        Finished,
+    };
+
+    // Creates a transaction and schedules it to start. An empty scope is the scope of an upgrade transaction, which
+    // is every object store in the database.
+    [[nodiscard]] static JS::NonnullGCPtr<IDBTransaction> create(JS::Realm&, IDBDatabase& connection, Vector<String> scope, Bindings::IDBTransactionMode);
+
+    virtual ~IDBTransaction() override;
+
+    JS::NonnullGCPtr<HTML::DOMStringList> object_store_names() const;
+    Bindings::IDBTransactionMode mode() const { return m_mode; }
+    JS::NonnullGCPtr<IDBDatabase> db() const { return m_connection; }
+    JS::GCPtr<WebIDL::DOMException> error() const { return m_error; }
+
+    WebIDL::ExceptionOr<JS::NonnullGCPtr<IDBObjectStore>> object_store(String const& name);
+    WebIDL::ExceptionOr<void> commit();
+    WebIDL::ExceptionOr<void> abort();
+
+#undef __ENUMERATE
+#define __ENUMERATE(attribute_name, event_name)       \
+    void set_##attribute_name(WebIDL::CallbackType*); \
+    WebIDL::CallbackType* attribute_name();
+    ENUMERATE_IDB_TRANSACTION_EVENT_HANDLERS(__ENUMERATE)
+#undef __ENUMERATE
+
+    IDBDatabase& connection() const { return m_connection; }
+    Database& database() const;
+
+    State state() const { return m_state; }
+    void set_state(State state) { m_state = state; }
+    bool is_active() const { return m_state == State::Active; }
+    bool is_finished() const { return m_state == State::Finished; }
+    bool is_read_only() const { return m_mode == Bindings::IDBTransactionMode::Readonly; }
+    bool is_upgrade_transaction() const { return m_mode == Bindings::IDBTransactionMode::Versionchange; }
+    bool was_aborted() const { return m_was_aborted; }
+
+    // https://w3c.github.io/IndexedDB/#transaction-scope
+    bool is_in_scope(String const& object_store_name) const;
+    bool overlaps(IDBTransaction const&) const;
+
+    // Every change the transaction makes is recorded here, to be written when it commits and reverted if it aborts.
+    WriteBatch& batch() { return m_batch; }
+
+    // https://w3c.github.io/IndexedDB/#transaction-cleanup-event-loop
+    HTML::EventLoop* cleanup_event_loop() const { return m_cleanup_event_loop; }
+    void set_cleanup_event_loop(HTML::EventLoop& event_loop) { m_cleanup_event_loop = &event_loop; }
+    void clear_cleanup_event_loop();
+
+    bool has_started() const { return m_started; }
+    bool has_pending_requests() const { return !m_request_list.is_empty(); }
+    void start();
+
+    // https://w3c.github.io/IndexedDB/#asynchronously-execute-a-request
+    JS::NonnullGCPtr<IDBRequest> asynchronously_execute_a_request(JS::Object& source, JS::NonnullGCPtr<IDBRequest::Operation>, JS::GCPtr<IDBRequest> = {});
+
+    // https://w3c.github.io/IndexedDB/#commit-a-transaction
+    void commit_a_transaction();
+
+    // https://w3c.github.io/IndexedDB/#abort-a-transaction
+    void abort_a_transaction(JS::GCPtr<WebIDL::DOMException>);
+
+    // The open request that an upgrade transaction was created for.
+    void set_open_request(IDBOpenDBRequest& request) { m_open_request = &request; }
+
+    // Invoked once the transaction has finished and its final event has been fired.
+    void set_on_finish(Function<void()> on_finish) { m_on_finish = move(on_finish); }
+
+    // Object store handles of a store that was deleted or renamed in an upgrade transaction are kept, and only found
+    // by their object store.
+    JS::GCPtr<IDBObjectStore> object_store_handle(ObjectStore const&) const;
+
+private:
+    IDBTransaction(JS::Realm&, IDBDatabase& connection, Vector<String> scope, Bindings::IDBTransactionMode);
+
+    virtual void initialize(JS::Realm&) override;
+    virtual void visit_edges(Cell::Visitor&) override;
+    virtual EventTarget* get_parent(DOM::Event const&) override;
+
+    void schedule_processing();
+    void process_requests();
+    void deliver_result(IDBRequest&);
+    void fire_success_event(IDBRequest&);
+    void fire_error_event(IDBRequest&);
+    void write_changes();
+    void finish();
+
+    JS::NonnullGCPtr<IDBDatabase> m_connection;
+    Vector<String> m_scope;
+    Bindings::IDBTransactionMode m_mode;
+
+    State m_state { State::Active };
+    bool m_started { false };
+    bool m_was_aborted { false };
+    bool m_is_processing_scheduled { false };
+    bool m_is_writing { false };
+
+    JS::GCPtr<WebIDL::DOMException> m_error;
+
+    // https://w3c.github.io/IndexedDB/#transaction-request-list
+    Vector<JS::NonnullGCPtr<IDBRequest>> m_request_list;
+
+    Vector<JS::NonnullGCPtr<IDBObjectStore>> m_object_store_handles;
+
+    JS::GCPtr<HTML::EventLoop> m_cleanup_event_loop;
+    JS::GCPtr<IDBOpenDBRequest> m_open_request;
+
+    WriteBatch m_batch;
+    Function<void()> m_on_finish;
+};
+
+}
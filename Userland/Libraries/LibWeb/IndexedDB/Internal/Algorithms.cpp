@@ -0,0 +1,751 @@
+/*
+ * Copyright (c) 2024, the SerenityOS developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/QuickSort.h>
+#include <AK/ScopeGuard.h>
+#include <LibJS/Runtime/AbstractOperations.h>
+#include <LibJS/Runtime/Array.h>
+#include <LibJS/Runtime/ArrayBuffer.h>
+#include <LibJS/Runtime/DataView.h>
+#include <LibJS/Runtime/Date.h>
+#include <LibJS/Runtime/TypedArray.h>
+#include <LibUnicode/CharacterTypes.h>
+#include <LibWeb/Bindings/HostDefined.h>
+#include <LibWeb/FileAPI/File.h>
+#include <LibWeb/HTML/DOMStringList.h>
+#include <LibWeb/HTML/Scripting/Environments.h>
+#include <LibWeb/HTML/StructuredSerialize.h>
+#include <LibWeb/IndexedDB/IDBKeyRange.h>
+#include <LibWeb/IndexedDB/IDBTransaction.h>
+#include <LibWeb/IndexedDB/Internal/Algorithms.h>
+#include <LibWeb/IndexedDB/Internal/DatabaseState.h>
+#include <LibWeb/WebIDL/AbstractOperations.h>
+#include <LibWeb/WebIDL/DOMException.h>
+
+namespace Web::IndexedDB {
+
+static bool is_buffer_source(JS::Object const& object)
+{
+    return is<JS::ArrayBuffer>(object) || is<JS::TypedArrayBase>(object) || is<JS::DataView>(object);
+}
+
+static bool is_detached(JS::Object const& object)
+{
+    if (is<JS::ArrayBuffer>(object))
+        return static_cast<JS::ArrayBuffer const&>(object).is_detached();
+    if (is<JS::TypedArrayBase>(object))
+        return static_cast<JS::TypedArrayBase const&>(object).viewed_array_buffer()->is_detached();
+    return static_cast<JS::DataView const&>(object).viewed_array_buffer()->is_detached();
+}
+
+// https://w3c.github.io/IndexedDB/#convert-a-value-to-a-key
+WebIDL::ExceptionOr<Optional<Key>> convert_a_value_to_a_key(JS::Realm& realm, JS::Value input, Vector<JS::Object*> seen)
+{
+    auto& vm = realm.vm();
+
+    // 1. If seen was not given, then let seen be a new empty set.
+    // 2. If seen contains input, then return invalid.
+    if (input.is_object() && seen.contains_slow(&input.as_object()))
+        return Optional<Key> {};
+
+    // 3. Jump to the appropriate step below:
+
+    // - If Type(input) is Number
+    if (input.is_number()) {
+        // 1. If input is NaN then return invalid.
+        if (input.is_nan())
+            return Optional<Key> {};
+
+        // 2. Otherwise, return a new key with type number and value input.
+        return Key::number(input.as_double());
+    }
+
+    // - If Type(input) is String
+    if (input.is_string()) {
+        // 1. Return a new key with type string and value input.
+        return Key::string(input.as_string().utf8_string());
+    }
+
+    if (!input.is_object())
+        return Optional<Key> {};
+
+    auto& object = input.as_object();
+
+    // - If input is a Date (has a [[DateValue]] internal slot)
+    if (is<JS::Date>(object)) {
+        // 1. Let ms be the value of input’s [[DateValue]] internal slot.
+        auto ms = static_cast<JS::Date const&>(object).date_value();
+
+        // 2. If ms is NaN then return invalid.
+        if (isnan(ms))
+            return Optional<Key> {};
+
+        // 3. Otherwise, return a new key with type date and value ms.
+        return Key::date(ms);
+    }
+
+    // - If input is a buffer source type
+    if (is_buffer_source(object)) {
+        // 1. If input is detached then return invalid.
+        if (is_detached(object))
+            return Optional<Key> {};
+
+        // 2. Let bytes be the result of getting a copy of the bytes held by the buffer source input.
+        auto bytes = TRY_OR_THROW_OOM(vm, WebIDL::get_buffer_source_copy(object));
+
+        // 3. Return a new key with type binary containing bytes.
+        return Key::binary(move(bytes));
+    }
+
+    // - If input is an Array exotic object
+    if (is<JS::Array>(object)) {
+        // 1. Let len be ? ToLength( ? Get(input, "length")).
+        auto length = TRY(JS::length_of_array_like(vm, object));
+
+        // 2. Append input to seen.
+        seen.append(&object);
+
+        // 3. Let keys be a new empty list.
+        Vector<Key> keys;
+        keys.ensure_capacity(length);
+
+        // 4. Let index be 0.
+        // 5. While index is less than len:
+        for (size_t index = 0; index < length; ++index) {
+            // 1. Let hop be ? HasOwnProperty(input, index).
+            auto hop = TRY(object.has_own_property(index));
+
+            // 2. If hop is false, return invalid.
+            if (!hop)
+                return Optional<Key> {};
+
+            // 3. Let entry be ? Get(input, index).
+            auto entry = TRY(object.get(index));
+
+            // 4. Let key be the result of converting a value to a key with arguments entry and seen.
+            // 5. ReturnIfAbrupt(key).
+            auto key = TRY(convert_a_value_to_a_key(realm, entry, seen));
+
+            // 6. If key is invalid abort these steps and return invalid.
+            if (!key.has_value())
+                return Optional<Key> {};
+
+            // 7. Append key to keys.
+            keys.unchecked_append(key.release_value());
+
+            // 8. Increase index by 1.
+        }
+
+        // 6. Return a new array key with value keys.
+        return Key::array(move(keys));
+    }
+
+    // - Otherwise
+    //   Return invalid.
+    return Optional<Key> {};
+}
+
+// https://w3c.github.io/IndexedDB/#convert-a-value-to-a-multientry-key
+WebIDL::ExceptionOr<Optional<Key>> convert_a_value_to_a_multi_entry_key(JS::Realm& realm, JS::Value input)
+{
+    auto& vm = realm.vm();
+
+    // 1. If input is an Array exotic object, then:
+    if (input.is_object() && is<JS::Array>(input.as_object())) {
+        auto& object = input.as_object();
+
+        // 1. Let len be ? ToLength( ? Get(input, "length")).
+        auto length = TRY(JS::length_of_array_like(vm, object));
+
+        // 2. Let seen be a new set containing only input.
+        Vector<JS::Object*> seen { &object };
+
+        // 3. Let keys be a new empty list.
+        Vector<Key> keys;
+
+        // 4. Let index be 0.
+        // 5. While index is less than len:
+        for (size_t index = 0; index < length; ++index) {
+            // 1. Let entry be Get(input, index).
+            auto entry = object.get(index);
+
+            // 2. If entry is not an abrupt completion, then:
+            if (entry.is_error())
+                continue;
+
+            // 1. Let key be the result of converting a value to a key with arguments entry and seen.
+            auto key = convert_a_value_to_a_key(realm, entry.value(), seen);
+
+            // 2. If key is not invalid or an abrupt completion, and there is no item in keys equal to key, then
+            //    append key to keys.
+            if (key.is_error() || !key.value().has_value())
+                continue;
+            if (!keys.contains_slow(*key.value()))
+                keys.append(key.release_value().release_value());
+
+            // 3. Increase index by 1.
+        }
+
+        // 6. Return a new array key with value set to keys.
+        return Key::array(move(keys));
+    }
+
+    // 2. Otherwise, return the result of converting a value to a key with argument input. Rethrow any exceptions.
+    return convert_a_value_to_a_key(realm, input);
+}
+
+// https://w3c.github.io/IndexedDB/#convert-a-key-to-a-value
+JS::Value convert_a_key_to_a_value(JS::Realm& realm, Key const& key)
+{
+    auto& vm = realm.vm();
+
+    // 1. Let type be key’s type.
+    // 2. Let value be key’s value.
+    // 3. Switch on type:
+    switch (key.type()) {
+    // - number
+    //   Return an ECMAScript Number value equal to value
+    case Key::Type::Number:
+        return JS::Value(key.number_value());
+
+    // - string
+    //   Return an ECMAScript String value equal to value
+    case Key::Type::String:
+        return JS::PrimitiveString::create(vm, key.string_value());
+
+    // - date
+    case Key::Type::Date:
+        // 1. Let date be the result of executing the ECMAScript Date constructor with the single argument value.
+        // 2. Assert: date is not an abrupt completion.
+        // 3. Return date.
+        return JS::Date::create(realm, key.number_value());
+
+    // - binary
+    case Key::Type::Binary: {
+        // 1. Let len be value’s length.
+        // 2. Let buffer be the result of executing the ECMAScript ArrayBuffer constructor with len.
+        // 3. Assert: buffer is not an abrupt completion.
+        // 4. Set the entries in buffer’s [[ArrayBufferData]] internal slot to the entries in value.
+        // 5. Return buffer.
+        return JS::ArrayBuffer::create(realm, MUST(ByteBuffer::copy(key.binary_value())));
+    }
+
+    // - array
+    case Key::Type::Array: {
+        // 1. Let array be the result of executing the ECMAScript Array constructor with no arguments.
+        // 2. Assert: array is not an abrupt completion.
+        auto array = MUST(JS::Array::create(realm, 0));
+
+        // 3. Let len be value’s size.
+        // 4. Let index be 0.
+        // 5. While index is less than len:
+        auto const& keys = key.array_value();
+        for (size_t index = 0; index < keys.size(); ++index) {
+            // 1. Let entry be the result of converting a key to a value with value[index].
+            auto entry = convert_a_key_to_a_value(realm, keys[index]);
+
+            // 2. Let status be CreateDataProperty(array, index, entry).
+            // 3. Assert: status is true.
+            MUST(array->create_data_property(index, entry));
+
+            // 4. Increase index by 1.
+        }
+
+        // 6. Return array.
+        return array;
+    }
+    }
+
+    VERIFY_NOT_REACHED();
+}
+
+// https://w3c.github.io/IndexedDB/#convert-a-value-to-a-key-range
+WebIDL::ExceptionOr<KeyRange> convert_a_value_to_a_key_range(JS::Realm& realm, JS::Value value, bool null_disallowed)
+{
+    // 1. If value is a key range, return value.
+    if (value.is_object() && is<IDBKeyRange>(value.as_object()))
+        return static_cast<IDBKeyRange const&>(value.as_object()).range();
+
+    // 2. If value is undefined or is null, then throw a "DataError" DOMException if null disallowed flag is set, or
+    //    return an unbounded key range otherwise.
+    if (value.is_nullish()) {
+        if (null_disallowed)
+            return WebIDL::DataError::create(realm, "A key range is required"_fly_string);
+        return KeyRange::unbounded();
+    }
+
+    // 3. Let key be the result of converting a value to a key with value. Rethrow any exceptions.
+    auto key = TRY(convert_a_value_to_a_key(realm, value));
+
+    // 4. If key is invalid, throw a "DataError" DOMException.
+    if (!key.has_value())
+        return WebIDL::DataError::create(realm, "Value is not a valid key"_fly_string);
+
+    // 5. Return a key range containing only key.
+    return KeyRange::only(key.release_value());
+}
+
+static bool is_identifier_start(u32 code_point)
+{
+    static auto id_start_property = Unicode::property_from_string("ID_Start"sv);
+    if (is_ascii_alpha(code_point) || code_point == '$' || code_point == '_')
+        return true;
+    return !is_ascii(code_point) && id_start_property.has_value() && Unicode::code_point_has_property(code_point, *id_start_property);
+}
+
+static bool is_identifier_part(u32 code_point)
+{
+    static auto id_continue_property = Unicode::property_from_string("ID_Continue"sv);
+    if (is_ascii_alphanumeric(code_point) || code_point == '$' || code_point == '_' || code_point == 0x200C || code_point == 0x200D)
+        return true;
+    return !is_ascii(code_point) && id_continue_property.has_value() && Unicode::code_point_has_property(code_point, *id_continue_property);
+}
+
+static bool is_valid_key_path_string(StringView key_path)
+{
+    // - An empty string.
+    if (key_path.is_empty())
+        return true;
+
+    // - An identifier, which is a string matching the IdentifierName production from the ECMAScript Language
+    //   Specification.
+    // - A string consisting of two or more identifiers separated by periods (U+002E FULL STOP).
+    auto is_valid = true;
+    key_path.for_each_split_view('.', SplitBehavior::KeepEmpty, [&](StringView identifier) {
+        if (identifier.is_empty()) {
+            is_valid = false;
+            return;
+        }
+
+        Utf8View code_points { identifier };
+        auto it = code_points.begin();
+        if (!is_identifier_start(*it)) {
+            is_valid = false;
+            return;
+        }
+        for (++it; it != code_points.end(); ++it) {
+            if (!is_identifier_part(*it)) {
+                is_valid = false;
+                return;
+            }
+        }
+    });
+    return is_valid;
+}
+
+// https://w3c.github.io/IndexedDB/#valid-key-path
+bool is_valid_key_path(KeyPath const& key_path)
+{
+    return key_path.visit(
+        [](String const& string) { return is_valid_key_path_string(string); },
+        // - A non-empty list containing only strings conforming to the above requirements.
+        [](Vector<String> const& strings) {
+            if (strings.is_empty())
+                return false;
+            return all_of(strings, [](auto const& string) { return is_valid_key_path_string(string); });
+        });
+}
+
+JS::Value convert_a_key_path_to_a_value(JS::Realm& realm, KeyPath const& key_path)
+{
+    auto& vm = realm.vm();
+
+    return key_path.visit(
+        [&](String const& string) -> JS::Value { return JS::PrimitiveString::create(vm, string); },
+        [&](Vector<String> const& strings) -> JS::Value {
+            return JS::Array::create_from<String>(realm, strings, [&](auto const& string) -> JS::Value {
+                return JS::PrimitiveString::create(vm, string);
+            });
+        });
+}
+
+static WebIDL::ExceptionOr<Optional<JS::Value>> evaluate_a_key_path_string_on_a_value(JS::Realm& realm, JS::Value value, String const& key_path)
+{
+    auto& vm = realm.vm();
+
+    // 3. If keyPath is the empty string, return value and skip the remaining steps.
+    if (key_path.is_empty())
+        return value;
+
+    // 4. Let identifiers be the result of strictly splitting keyPath on U+002E FULL STOP characters (.).
+    auto identifiers = MUST(key_path.split('.', SplitBehavior::KeepEmpty));
+
+    // 5. For each identifier of identifiers, jump to the appropriate step below:
+    for (auto const& identifier : identifiers) {
+        // - If Type(value) is String, and identifier is "length"
+        if (value.is_string() && identifier == "length"sv) {
+            // Let value be a Number equal to the number of elements in value.
+            value = JS::Value(value.as_string().utf16_string_view().length_in_code_units());
+            continue;
+        }
+
+        // - If value is an Array and identifier is "length"
+        if (value.is_object() && is<JS::Array>(value.as_object()) && identifier == "length"sv) {
+            // Let value be ! ToLength(! Get(value, "length")).
+            value = JS::Value(MUST(JS::length_of_array_like(vm, value.as_object())));
+            continue;
+        }
+
+        if (value.is_object()) {
+            // - If value is a Blob and identifier is "size"
+            // - If value is a Blob and identifier is "type"
+            if (is<FileAPI::Blob>(value.as_object())) {
+                auto const& blob = static_cast<FileAPI::Blob const&>(value.as_object());
+                if (identifier == "size"sv) {
+                    value = JS::Value(static_cast<double>(blob.size()));
+                    continue;
+                }
+                if (identifier == "type"sv) {
+                    value = JS::PrimitiveString::create(vm, blob.type());
+                    continue;
+                }
+            }
+
+            // - If value is a File and identifier is "name"
+            // - If value is a File and identifier is "lastModified"
+            if (is<FileAPI::File>(value.as_object())) {
+                auto const& file = static_cast<FileAPI::File const&>(value.as_object());
+                if (identifier == "name"sv) {
+                    value = JS::PrimitiveString::create(vm, file.name());
+                    continue;
+                }
+                if (identifier == "lastModified"sv) {
+                    value = JS::Value(static_cast<double>(file.last_modified()));
+                    continue;
+                }
+            }
+        }
+
+        // - Otherwise
+        // 1. If Type(value) is not Object, return failure.
+        if (!value.is_object())
+            return Optional<JS::Value> {};
+
+        // 2. Let hop be ! HasOwnProperty(value, identifier).
+        auto property_key = JS::PropertyKey { identifier.to_byte_string() };
+        auto hop = TRY(value.as_object().has_own_property(property_key));
+
+        // 3. If hop is false, return failure.
+        if (!hop)
+            return Optional<JS::Value> {};
+
+        // 4. Let value be ! Get(value, identifier).
+        value = TRY(value.as_object().get(property_key));
+
+        // 5. If value is undefined, return failure.
+        if (value.is_undefined())
+            return Optional<JS::Value> {};
+    }
+
+    // 6. Assert: value is not an abrupt completion.
+    // 7. Return value.
+    return value;
+}
+
+// https://w3c.github.io/IndexedDB/#evaluate-a-key-path-on-a-value
+WebIDL::ExceptionOr<Optional<JS::Value>> evaluate_a_key_path_on_a_value(JS::Realm& realm, JS::Value value, KeyPath const& key_path)
+{
+    // 1. If keyPath is a list of strings, then:
+    if (auto const* strings = key_path.get_pointer<Vector<String>>()) {
+        // 1. Let result be a new Array object created as if by the expression [].
+        auto result = MUST(JS::Array::create(realm, 0));
+
+        // 2. Let i be 0.
+        // 3. For each item of keyPath:
+        for (size_t i = 0; i < strings->size(); ++i) {
+            // 1. Let key be the result of recursively evaluating a key path on a value with item and value.
+            // 2. Assert: key is not an abrupt completion.
+            auto key = TRY(evaluate_a_key_path_string_on_a_value(realm, value, strings->at(i)));
+
+            // 3. If key is failure, abort the overall algorithm and return failure.
+            if (!key.has_value())
+                return Optional<JS::Value> {};
+
+            // 4. Let p be ! ToString(i).
+            // 5. Let status be CreateDataProperty(result, p, key).
+            // 6. Assert: status is true.
+            MUST(result->create_data_property(i, *key));
+
+            // 7. Increase i by 1.
+        }
+
+        // 4. Return result.
+        return JS::Value(result);
+    }
+
+    // 2. Otherwise, evaluate the key path string.
+    return evaluate_a_key_path_string_on_a_value(realm, value, key_path.get<String>());
+}
+
+// https://w3c.github.io/IndexedDB/#extract-a-key-from-a-value-using-a-key-path
+WebIDL::ExceptionOr<ExtractedKey> extract_a_key_from_a_value_using_a_key_path(JS::Realm& realm, JS::Value value, KeyPath const& key_path, bool multi_entry)
+{
+    // 1. Let r be the result of evaluating a key path on a value with value and keyPath. Rethrow any exceptions.
+    auto result = TRY(evaluate_a_key_path_on_a_value(realm, value, key_path));
+
+    // 2. If r is failure, return failure.
+    if (!result.has_value())
+        return NoValueAtKeyPath {};
+
+    // 3. Let key be the result of converting a value to a key with r if the multiEntry flag is unset, and the result
+    //    of converting a value to a multiEntry key with r otherwise. Rethrow any exceptions.
+    auto key = multi_entry
+        ? TRY(convert_a_value_to_a_multi_entry_key(realm, *result))
+        : TRY(convert_a_value_to_a_key(realm, *result));
+
+    // 4. If key is invalid, return invalid.
+    if (!key.has_value())
+        return InvalidKey {};
+
+    // 5. Return key.
+    return key.release_value();
+}
+
+// https://w3c.github.io/IndexedDB/#check-that-a-key-could-be-injected-into-a-value
+bool check_that_a_key_could_be_injected_into_a_value(JS::Value value, String const& key_path)
+{
+    // 1. Let identifiers be the result of strictly splitting keyPath on U+002E FULL STOP characters (.).
+    auto identifiers = MUST(key_path.split('.', SplitBehavior::KeepEmpty));
+
+    // 2. Assert: identifiers is not empty.
+    VERIFY(!identifiers.is_empty());
+
+    // 3. Remove the last item of identifiers.
+    identifiers.take_last();
+
+    // 4. For each remaining identifier of identifiers, if any:
+    for (auto const& identifier : identifiers) {
+        // 1. If value is not an Object or an Array, return false.
+        if (!value.is_object())
+            return false;
+
+        // 2. Let hop be ! HasOwnProperty(value, identifier).
+        auto property_key = JS::PropertyKey { identifier.to_byte_string() };
+        auto hop = MUST(value.as_object().has_own_property(property_key));
+
+        // 3. If hop is false, return true.
+        if (!hop)
+            return true;
+
+        // 4. Let value be ! Get(value, identifier).
+        value = MUST(value.as_object().get(property_key));
+    }
+
+    // 5. Return true if value is an Object or an Array, or false otherwise.
+    return value.is_object();
+}
+
+// https://w3c.github.io/IndexedDB/#inject-a-key-into-a-value-using-a-key-path
+void inject_a_key_into_a_value_using_a_key_path(JS::Realm& realm, JS::Value value, Key const& key, String const& key_path)
+{
+    // 1. Let identifiers be the result of strictly splitting keyPath on U+002E FULL STOP characters (.).
+    auto identifiers = MUST(key_path.split('.', SplitBehavior::KeepEmpty));
+
+    // 2. Assert: identifiers is not empty.
+    VERIFY(!identifiers.is_empty());
+
+    // 3. Let last be the last item of identifiers and remove it from the list.
+    auto last = identifiers.take_last();
+
+    // 4. For each remaining identifier of identifiers:
+    for (auto const& identifier : identifiers) {
+        // 1. Assert: value is an Object or an Array.
+        VERIFY(value.is_object());
+
+        // 2. Let hop be ! HasOwnProperty(value, identifier).
+        auto property_key = JS::PropertyKey { identifier.to_byte_string() };
+        auto hop = MUST(value.as_object().has_own_property(property_key));
+
+        // 3. If hop is false, then:
+        if (!hop) {
+            // 1. Let o be a new Object created as if by the expression ({}).
+            auto object = JS::Object::create(realm, realm.intrinsics().object_prototype());
+
+            // 2. Let status be CreateDataProperty(value, identifier, o).
+            // 3. Assert: status is true.
+            MUST(value.as_object().create_data_property(property_key, object));
+        }
+
+        // 4. Let value be ! Get(value, identifier).
+        value = MUST(value.as_object().get(property_key));
+    }
+
+    // 5. Assert: value is an Object or an Array.
+    VERIFY(value.is_object());
+
+    // 6. Let keyValue be the result of converting a key to a value with key.
+    auto key_value = convert_a_key_to_a_value(realm, key);
+
+    // 7. Let status be CreateDataProperty(value, last, keyValue).
+    // 8. Assert: status is true.
+    MUST(value.as_object().create_data_property(JS::PropertyKey { last.to_byte_string() }, key_value));
+}
+
+// https://w3c.github.io/IndexedDB/#clone
+WebIDL::ExceptionOr<JS::Value> clone_a_value(JS::Realm& target_realm, IDBTransaction& transaction, JS::Value value)
+{
+    auto& vm = target_realm.vm();
+
+    // 1. Assert: transaction’s state is active.
+    VERIFY(transaction.is_active());
+
+    // 2. Set transaction’s state to inactive.
+    // NOTE: The transaction is made inactive so that getters or other side effects triggered by the cloning operation
+    //       are unable to make additional requests against the transaction.
+    transaction.set_state(IDBTransaction::State::Inactive);
+    ScopeGuard make_active = [&] {
+        // 5. Set transaction’s state to active.
+        transaction.set_state(IDBTransaction::State::Active);
+    };
+
+    // 3. Let serialized be ? StructuredSerializeForStorage(value).
+    auto serialized = TRY(HTML::structured_serialize_for_storage(vm, value));
+
+    // 4. Let clone be ? StructuredDeserialize(serialized, targetRealm).
+    auto clone = TRY(HTML::structured_deserialize(vm, serialized, target_realm, {}));
+
+    // 6. Return clone.
+    return clone;
+}
+
+// https://w3c.github.io/IndexedDB/#store-a-record-into-an-object-store
+WebIDL::ExceptionOr<Key> store_a_record_into_an_object_store(JS::Realm& realm, WriteBatch& batch, ObjectStore& store, JS::Value value, Optional<Key> key, bool no_overwrite)
+{
+    // NOTE: Updating the key generator is the only change made before a step can fail, and it is reverted if one does.
+    auto savepoint = batch.savepoint();
+    auto fail = [&](JS::NonnullGCPtr<WebIDL::DOMException> error) -> WebIDL::ExceptionOr<Key> {
+        batch.revert_to(savepoint);
+        return error;
+    };
+
+    // 1. If store uses a key generator, then:
+    if (store.has_key_generator()) {
+        // 1. If key is undefined, then:
+        if (!key.has_value()) {
+            // 1. Let key be the result of generating a key for store.
+            key = store.generate_key(batch);
+
+            // 2. If key is failure, then this operation failed with a "ConstraintError" DOMException. Abort this
+            //    algorithm without taking any further steps.
+            if (!key.has_value())
+                return WebIDL::ConstraintError::create(realm, "The key generator has run out of keys"_fly_string);
+
+            // 3. If store also uses in-line keys, then run inject a key into a value using a key path with value, key
+            //    and store’s key path.
+            if (store.uses_inline_keys())
+                inject_a_key_into_a_value_using_a_key_path(realm, value, *key, store.key_path()->get<String>());
+        }
+        // 2. Otherwise, run possibly update the key generator for store with key.
+        else {
+            store.possibly_update_key_generator(batch, *key);
+        }
+    }
+
+    // 2. If the no-overwrite flag was given to these steps and is true, and a record already exists in store with its
+    //    key equal to key, then this operation failed with a "ConstraintError" DOMException. Abort this algorithm
+    //    without taking any further steps.
+    if (no_overwrite && store.records().contains(*key))
+        return fail(WebIDL::ConstraintError::create(realm, "A record with the key already exists"_fly_string));
+
+    // 5. For each index which references store:
+    // NOTE: The index keys are found first, so that a unique index can reject the record before anything is changed.
+    Vector<Vector<Key>> index_keys;
+    index_keys.ensure_capacity(store.indexes().size());
+    for (auto const& index : store.indexes()) {
+        Vector<Key> keys;
+
+        // 1. Let index key be the result of extracting a key from a value using a key path with value, index’s key
+        //    path, and index’s multiEntry flag.
+        auto index_key = extract_a_key_from_a_value_using_a_key_path(realm, value, index->key_path(), index->multi_entry());
+
+        // 2. If index key is an exception, or invalid, or failure, take no further actions for index, and continue
+        //    these steps for the next index.
+        if (!index_key.is_error() && index_key.value().has<Key>()) {
+            auto& extracted_key = index_key.value().get<Key>();
+
+            // 5. If index’s multiEntry flag is true and index key is an array key, then store a record in index for
+            //    each subkey of index key, with that subkey as its key and key as its value.
+            if (index->multi_entry() && extracted_key.type() == Key::Type::Array)
+                keys = extracted_key.array_value();
+            // 4. If index’s multiEntry flag is false, or if index key is not an array key, then store a record in
+            //    index containing index key as its key and key as its value.
+            else
+                keys.append(move(extracted_key));
+
+            // 3. If index’s unique flag is true and a record already exists in index with its key equal to index key
+            //    (or any subkey of a multiEntry array key), then this operation failed with a "ConstraintError"
+            //    DOMException. Abort this algorithm without taking any further steps.
+            if (index->unique()) {
+                for (auto const& index_record_key : keys) {
+                    if (index->has_conflicting_record(index_record_key, *key))
+                        return fail(WebIDL::ConstraintError::create(realm, MUST(String::formatted("A record in the unique index '{}' already has the key", index->name()))));
+                }
+            }
+        }
+
+        index_keys.unchecked_append(move(keys));
+    }
+
+    // 3. If a record already exists in store with its key equal to key, then remove the record from store using
+    //    delete records from an object store.
+    // 4. Store a record in store containing key as its key and ! StructuredSerializeForStorage(value) as its value.
+    auto serialized = MUST(HTML::structured_serialize_for_storage(realm.vm(), value));
+    store.put_record(batch, *key, MUST(ByteBuffer::copy(serialized.span())), move(index_keys));
+
+    // 6. Return key.
+    return key.release_value();
+}
+
+// https://w3c.github.io/IndexedDB/#create-a-sorted-name-list
+JS::NonnullGCPtr<HTML::DOMStringList> create_a_sorted_name_list(JS::Realm& realm, Vector<String> names)
+{
+    // 1. Let sorted be names sorted in ascending order with the code unit less than algorithm.
+    // NOTE: String keys compare by code units.
+    quick_sort(names, [](auto const& a, auto const& b) {
+        return Key::compare(Key::string(a), Key::string(b)) < 0;
+    });
+
+    // 2. Return a new DOMStringList associated with sorted.
+    return HTML::DOMStringList::create(realm, move(names));
+}
+
+WebIDL::ExceptionOr<JS::Value> deserialize_a_record_value(JS::Realm& realm, ReadonlyBytes serialized)
+{
+    auto& vm = realm.vm();
+    HTML::DeserializationMemory memory { vm.heap() };
+
+    auto& settings = Bindings::host_defined_environment_settings_object(realm);
+    settings.prepare_to_run_script();
+    auto result = HTML::structured_deserialize_internal(vm, serialized, realm, memory);
+    settings.clean_up_after_running_script();
+
+    return TRY(result).value.release_value();
+}
+
+// https://w3c.github.io/IndexedDB/#cleanup-indexed-database-transactions
+bool cleanup_indexed_database_transactions(HTML::EventLoop& event_loop)
+{
+    // 1. Let cleanedUp be false.
+    bool cleaned_up = false;
+
+    // 2. For each transaction with cleanup event loop matching the current event loop:
+    DatabaseState::for_each_transaction([&](IDBTransaction& transaction) {
+        if (transaction.cleanup_event_loop() != &event_loop)
+            return;
+
+        // 1. Set transaction’s state to inactive.
+        // 2. Clear transaction’s cleanup event loop.
+        transaction.clear_cleanup_event_loop();
+
+        // 3. Set cleanedUp to true.
+        cleaned_up = true;
+    });
+
+    // 3. Return cleanedUp.
+    return cleaned_up;
+}
+
+}
@@ -0,0 +1,73 @@
+/*
+ * Copyright (c) 2024, the SerenityOS developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/Optional.h>
+#include <AK/Variant.h>
+#include <AK/Vector.h>
+#include <LibJS/Forward.h>
+#include <LibWeb/Forward.h>
+#include <LibWeb/IndexedDB/Internal/Database.h>
+#include <LibWeb/IndexedDB/Internal/Key.h>
+#include <LibWeb/WebIDL/ExceptionOr.h>
+
+namespace Web::IndexedDB {
+
+// The outcome of extracting a key from a value: the key, the value at the key path not being a valid key, or the key
+// path not resolving to a value at all.
+struct InvalidKey { };
+struct NoValueAtKeyPath { };
+using ExtractedKey = Variant<Key, InvalidKey, NoValueAtKeyPath>;
+
+// https://w3c.github.io/IndexedDB/#convert-a-value-to-a-key
+// Returns an empty Optional if the value is not a valid key.
+WebIDL::ExceptionOr<Optional<Key>> convert_a_value_to_a_key(JS::Realm&, JS::Value, Vector<JS::Object*> seen = {});
+
+// https://w3c.github.io/IndexedDB/#convert-a-value-to-a-multientry-key
+WebIDL::ExceptionOr<Optional<Key>> convert_a_value_to_a_multi_entry_key(JS::Realm&, JS::Value);
+
+// https://w3c.github.io/IndexedDB/#convert-a-key-to-a-value
+JS::Value convert_a_key_to_a_value(JS::Realm&, Key const&);
+
+// https://w3c.github.io/IndexedDB/#convert-a-value-to-a-key-range
+WebIDL::ExceptionOr<KeyRange> convert_a_value_to_a_key_range(JS::Realm&, JS::Value, bool null_disallowed = false);
+
+// https://w3c.github.io/IndexedDB/#valid-key-path
+bool is_valid_key_path(KeyPath const&);
+
+JS::Value convert_a_key_path_to_a_value(JS::Realm&, KeyPath const&);
+
+// https://w3c.github.io/IndexedDB/#evaluate-a-key-path-on-a-value
+// Returns an empty Optional if the key path does not resolve to a value.
+WebIDL::ExceptionOr<Optional<JS::Value>> evaluate_a_key_path_on_a_value(JS::Realm&, JS::Value, KeyPath const&);
+
+// https://w3c.github.io/IndexedDB/#extract-a-key-from-a-value-using-a-key-path
+WebIDL::ExceptionOr<ExtractedKey> extract_a_key_from_a_value_using_a_key_path(JS::Realm&, JS::Value, KeyPath const&, bool multi_entry = false);
+
+// https://w3c.github.io/IndexedDB/#check-that-a-key-could-be-injected-into-a-value
+bool check_that_a_key_could_be_injected_into_a_value(JS::Value, String const& key_path);
+
+// https://w3c.github.io/IndexedDB/#inject-a-key-into-a-value-using-a-key-path
+void inject_a_key_into_a_value_using_a_key_path(JS::Realm&, JS::Value, Key const&, String const& key_path);
+
+// https://w3c.github.io/IndexedDB/#clone
+WebIDL::ExceptionOr<JS::Value> clone_a_value(JS::Realm&, IDBTransaction&, JS::Value);
+
+// https://w3c.github.io/IndexedDB/#store-a-record-into-an-object-store
+// The value must be a clone that script has no access to, as the store's key may be injected into it.
+WebIDL::ExceptionOr<Key> store_a_record_into_an_object_store(JS::Realm&, WriteBatch&, ObjectStore&, JS::Value, Optional<Key>, bool no_overwrite);
+
+// https://w3c.github.io/IndexedDB/#create-a-sorted-name-list
+JS::NonnullGCPtr<HTML::DOMStringList> create_a_sorted_name_list(JS::Realm&, Vector<String>);
+
+// Deserializes the value of a record, which was serialized with StructuredSerializeForStorage.
+WebIDL::ExceptionOr<JS::Value> deserialize_a_record_value(JS::Realm&, ReadonlyBytes);
+
+// https://w3c.github.io/IndexedDB/#cleanup-indexed-database-transactions
+bool cleanup_indexed_database_transactions(HTML::EventLoop&);
+
+}
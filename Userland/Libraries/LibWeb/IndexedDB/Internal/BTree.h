@@ -0,0 +1,333 @@
+/*
+ * Copyright (c) 2024, the SerenityOS developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/NonnullOwnPtr.h>
+#include <AK/Optional.h>
+#include <AK/Vector.h>
+
+namespace Web::IndexedDB {
+
+template<typename K>
+concept ComparableKey = requires(K const& a, K const& b) {
+    { K::compare(a, b) } -> SameAs<int>;
+};
+
+// An ordered map that keeps its entries in sorted leaves of a bounded size, with the first key of every leaf serving
+// as the separator. This is a B+tree with a single interior level, which keeps inserts cheap and makes in-order
+// iteration a walk over contiguous arrays.
+template<ComparableKey K, typename V>
+class BTree {
+public:
+    struct Entry {
+        K key;
+        V value;
+    };
+
+    size_t size() const { return m_size; }
+    bool is_empty() const { return m_size == 0; }
+
+    V* find(K const& key)
+    {
+        auto position = find_position(key);
+        if (!position.has_value())
+            return nullptr;
+        return &m_leaves[position->leaf]->entries[position->index].value;
+    }
+
+    V const* find(K const& key) const
+    {
+        return const_cast<BTree&>(*this).find(key);
+    }
+
+    bool contains(K const& key) const { return find_position(key).has_value(); }
+
+    // Inserts the entry, or replaces the value of an existing one. Returns the value that was replaced, if any.
+    Optional<V> set(K key, V value)
+    {
+        if (m_leaves.is_empty()) {
+            auto leaf = make<Leaf>();
+            leaf->entries.append({ move(key), move(value) });
+            m_leaves.append(move(leaf));
+            m_size = 1;
+            return {};
+        }
+
+        auto leaf_index = leaf_index_for(key);
+        auto& entries = m_leaves[leaf_index]->entries;
+
+        // Keys are usually inserted in ascending order, so check the end of the last leaf first.
+        auto is_append = leaf_index == m_leaves.size() - 1 && K::compare(entries.last().key, key) < 0;
+        auto index = is_append ? entries.size() : lower_bound(entries, key);
+
+        if (index < entries.size() && K::compare(entries[index].key, key) == 0) {
+            Optional<V> old_value = move(entries[index].value);
+            entries[index].value = move(value);
+            return old_value;
+        }
+
+        entries.insert(index, { move(key), move(value) });
+        ++m_size;
+
+        if (entries.size() > max_leaf_size)
+            split_leaf(leaf_index, is_append);
+        return {};
+    }
+
+    // Removes the entry with the given key. Returns its value, if there was one.
+    Optional<V> remove(K const& key)
+    {
+        auto position = find_position(key);
+        if (!position.has_value())
+            return {};
+
+        auto& entries = m_leaves[position->leaf]->entries;
+        Optional<V> value = move(entries[position->index].value);
+        entries.remove(position->index);
+        --m_size;
+
+        if (entries.is_empty())
+            m_leaves.remove(position->leaf);
+        return value;
+    }
+
+    void clear()
+    {
+        m_leaves.clear();
+        m_size = 0;
+    }
+
+    Entry const* first() const
+    {
+        if (m_leaves.is_empty())
+            return nullptr;
+        return &m_leaves.first()->entries.first();
+    }
+
+    Entry const* last() const
+    {
+        if (m_leaves.is_empty())
+            return nullptr;
+        return &m_leaves.last()->entries.last();
+    }
+
+    // Searches are given a predicate that tells whether a key comes before the position being searched for. It must
+    // hold for the keys up to that position, and for none of the keys after it.
+
+    // Returns the first entry whose key does not come before the position.
+    template<typename IsBefore>
+    Entry const* first_not_before(IsBefore is_before) const
+    {
+        Entry const* result = nullptr;
+        for_each_from(is_before, [&](auto const& entry) {
+            result = &entry;
+            return IterationDecision::Break;
+        });
+        return result;
+    }
+
+    // Returns the last entry whose key comes before the position.
+    template<typename IsBefore>
+    Entry const* last_before(IsBefore is_before) const
+    {
+        Entry const* result = nullptr;
+        for_each_backward_before(is_before, [&](auto const& entry) {
+            result = &entry;
+            return IterationDecision::Break;
+        });
+        return result;
+    }
+
+    // Returns the first entry whose key is greater than the given key, or equal to it if inclusive is true.
+    Entry const* first_after(K const& key, bool inclusive) const
+    {
+        return first_not_before(before(key, inclusive));
+    }
+
+    // Returns the last entry whose key is less than the given key, or equal to it if inclusive is true.
+    Entry const* last_before(K const& key, bool inclusive) const
+    {
+        return last_before(before(key, !inclusive));
+    }
+
+    // Calls the callback for every entry in ascending order, until it returns IterationDecision::Break.
+    template<typename Callback>
+    void for_each(Callback callback) const
+    {
+        for (auto const& leaf : m_leaves) {
+            for (auto const& entry : leaf->entries) {
+                if (callback(entry) == IterationDecision::Break)
+                    return;
+            }
+        }
+    }
+
+    // Calls the callback in ascending order for every entry starting with first_not_before(), until it returns
+    // IterationDecision::Break.
+    template<typename IsBefore, typename Callback>
+    void for_each_from(IsBefore is_before, Callback callback) const
+    {
+        auto [leaf_index, index] = partition_point(is_before);
+
+        for (; leaf_index < m_leaves.size(); ++leaf_index, index = 0) {
+            auto const& entries = m_leaves[leaf_index]->entries;
+            for (; index < entries.size(); ++index) {
+                if (callback(entries[index]) == IterationDecision::Break)
+                    return;
+            }
+        }
+    }
+
+    // Calls the callback for every entry starting with first_after() the given key, until it returns
+    // IterationDecision::Break.
+    template<typename Callback>
+    void for_each_after(K const& key, bool inclusive, Callback callback) const
+    {
+        for_each_from(before(key, inclusive), move(callback));
+    }
+
+    // Calls the callback in descending order for every entry starting with last_before(), until it returns
+    // IterationDecision::Break.
+    template<typename IsBefore, typename Callback>
+    void for_each_backward_before(IsBefore is_before, Callback callback) const
+    {
+        auto [leaf_index, index] = partition_point(is_before);
+
+        while (true) {
+            if (index == 0) {
+                if (leaf_index == 0)
+                    return;
+                --leaf_index;
+                index = m_leaves[leaf_index]->entries.size();
+                continue;
+            }
+
+            --index;
+            if (callback(m_leaves[leaf_index]->entries[index]) == IterationDecision::Break)
+                return;
+        }
+    }
+
+private:
+    static constexpr size_t max_leaf_size = 128;
+
+    struct Leaf {
+        Vector<Entry> entries;
+    };
+
+    struct Position {
+        size_t leaf { 0 };
+        size_t index { 0 };
+    };
+
+    static size_t lower_bound(Vector<Entry> const& entries, K const& key)
+    {
+        return partition_point(entries, before(key, true));
+    }
+
+    // Returns a predicate for the keys before the given key, or before and including it if inclusive is false.
+    static auto before(K const& key, bool inclusive)
+    {
+        return [&key, inclusive](K const& other) {
+            auto result = K::compare(other, key);
+            return inclusive ? result < 0 : result <= 0;
+        };
+    }
+
+    template<typename IsBefore>
+    static size_t partition_point(Vector<Entry> const& entries, IsBefore const& is_before)
+    {
+        size_t begin = 0;
+        size_t end = entries.size();
+        while (begin < end) {
+            auto middle = begin + (end - begin) / 2;
+            if (is_before(entries[middle].key))
+                begin = middle + 1;
+            else
+                end = middle;
+        }
+        return begin;
+    }
+
+    // Returns the position of the first entry whose key does not come before the searched for position, which may
+    // be one past the end of a leaf, or of the last leaf.
+    template<typename IsBefore>
+    Position partition_point(IsBefore const& is_before) const
+    {
+        // Find the first leaf whose first key does not come before the position. The position is in the leaf before
+        // it, or at its start.
+        size_t begin = 0;
+        size_t end = m_leaves.size();
+        while (begin < end) {
+            auto middle = begin + (end - begin) / 2;
+            if (is_before(m_leaves[middle]->entries.first().key))
+                begin = middle + 1;
+            else
+                end = middle;
+        }
+
+        if (begin == 0)
+            return { 0, 0 };
+
+        auto const& entries = m_leaves[begin - 1]->entries;
+        auto index = partition_point(entries, is_before);
+        if (index == entries.size())
+            return { begin, 0 };
+        return { begin - 1, index };
+    }
+
+    // Returns the last leaf whose first key is not greater than the given key, or the first leaf.
+    size_t leaf_index_for(K const& key) const
+    {
+        VERIFY(!m_leaves.is_empty());
+
+        size_t begin = 1;
+        size_t end = m_leaves.size();
+        while (begin < end) {
+            auto middle = begin + (end - begin) / 2;
+            if (K::compare(m_leaves[middle]->entries.first().key, key) <= 0)
+                begin = middle + 1;
+            else
+                end = middle;
+        }
+        return begin - 1;
+    }
+
+    Optional<Position> find_position(K const& key) const
+    {
+        if (m_leaves.is_empty())
+            return {};
+
+        auto leaf_index = leaf_index_for(key);
+        auto const& entries = m_leaves[leaf_index]->entries;
+        auto index = lower_bound(entries, key);
+        if (index == entries.size() || K::compare(entries[index].key, key) != 0)
+            return {};
+        return Position { leaf_index, index };
+    }
+
+    void split_leaf(size_t leaf_index, bool is_append)
+    {
+        auto& entries = m_leaves[leaf_index]->entries;
+        auto new_leaf = make<Leaf>();
+
+        // Keys that are appended are likely to keep ascending, so leave the full leaf behind rather than a half empty one.
+        auto split_index = is_append ? entries.size() - 1 : entries.size() / 2;
+
+        new_leaf->entries.ensure_capacity(entries.size() - split_index);
+        for (auto i = split_index; i < entries.size(); ++i)
+            new_leaf->entries.unchecked_append(move(entries[i]));
+        entries.shrink(split_index);
+
+        m_leaves.insert(leaf_index + 1, move(new_leaf));
+    }
+
+    Vector<NonnullOwnPtr<Leaf>> m_leaves;
+    size_t m_size { 0 };
+};
+
+}
@@ -0,0 +1,677 @@
+/*
+ * Copyright (c) 2024, the SerenityOS developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/Math.h>
+#include <LibWeb/IndexedDB/Internal/Database.h>
+
+namespace Web::IndexedDB {
+
+// The largest number that a key generator can produce.
+static constexpr u64 maximum_key_generator_value = 1ull << 53;
+
+void WriteBatch::revert_to(Savepoint savepoint)
+{
+    for (auto i = m_revert_steps.size(); i > savepoint.revert_step_count; --i)
+        m_revert_steps[i - 1]();
+
+    m_revert_steps.shrink(savepoint.revert_step_count);
+    m_journal.trim(savepoint.journal_size, false);
+}
+
+void WriteBatch::append_u64(u64 value)
+{
+    m_journal.append(&value, sizeof(value));
+}
+
+void WriteBatch::append_string(StringView string)
+{
+    append_bytes(string.bytes());
+}
+
+void WriteBatch::append_bytes(ReadonlyBytes bytes)
+{
+    append_u64(bytes.size());
+    m_journal.append(bytes);
+}
+
+void WriteBatch::append_key_path(Optional<KeyPath> const& key_path)
+{
+    if (!key_path.has_value()) {
+        m_journal.append(0);
+        return;
+    }
+
+    key_path->visit(
+        [&](String const& path) {
+            m_journal.append(1);
+            append_string(path);
+        },
+        [&](Vector<String> const& paths) {
+            m_journal.append(2);
+            append_u64(paths.size());
+            for (auto const& path : paths)
+                append_string(path);
+        });
+}
+
+void WriteBatch::append_keys(ReadonlySpan<Key> keys)
+{
+    append_u64(keys.size());
+    for (auto const& key : keys)
+        append_key(key);
+}
+
+namespace {
+
+class JournalReader {
+public:
+    explicit JournalReader(ReadonlyBytes journal)
+        : m_journal(journal)
+    {
+    }
+
+    bool is_eof() const { return m_offset == m_journal.size(); }
+
+    ErrorOr<u8> read_u8()
+    {
+        u8 value = 0;
+        TRY(read(&value, sizeof(value)));
+        return value;
+    }
+
+    ErrorOr<u64> read_u64()
+    {
+        u64 value = 0;
+        TRY(read(&value, sizeof(value)));
+        return value;
+    }
+
+    ErrorOr<bool> read_bool() { return TRY(read_u8()) != 0; }
+
+    ErrorOr<ReadonlyBytes> read_bytes()
+    {
+        auto size = TRY(read_u64());
+        if (size > m_journal.size() - m_offset)
+            return Error::from_string_literal("Unexpected end of journal");
+
+        auto bytes = m_journal.slice(m_offset, size);
+        m_offset += size;
+        return bytes;
+    }
+
+    ErrorOr<String> read_string() { return String::from_utf8(StringView { TRY(read_bytes()) }); }
+
+    ErrorOr<Key> read_key() { return Key::decode(m_journal, m_offset); }
+
+    ErrorOr<Vector<Key>> read_keys()
+    {
+        auto count = TRY(read_u64());
+
+        Vector<Key> keys;
+        for (u64 i = 0; i < count; ++i)
+            TRY(keys.try_append(TRY(read_key())));
+        return keys;
+    }
+
+    ErrorOr<Optional<KeyPath>> read_key_path()
+    {
+        switch (TRY(read_u8())) {
+        case 0:
+            return OptionalNone {};
+        case 1:
+            return KeyPath { TRY(read_string()) };
+        case 2: {
+            auto count = TRY(read_u64());
+
+            Vector<String> paths;
+            for (u64 i = 0; i < count; ++i)
+                TRY(paths.try_append(TRY(read_string())));
+            return KeyPath { move(paths) };
+        }
+        default:
+            return Error::from_string_literal("Invalid key path in journal");
+        }
+    }
+
+private:
+    ErrorOr<void> read(void* destination, size_t size)
+    {
+        if (size > m_journal.size() - m_offset)
+            return Error::from_string_literal("Unexpected end of journal");
+
+        __builtin_memcpy(destination, m_journal.offset_pointer(m_offset), size);
+        m_offset += size;
+        return {};
+    }
+
+    ReadonlyBytes m_journal;
+    size_t m_offset { 0 };
+};
+
+}
+
+int Index::RecordKey::compare(RecordKey const& a, RecordKey const& b)
+{
+    if (auto result = Key::compare(a.key, b.key); result != 0)
+        return result;
+    return Key::compare(a.primary_key, b.primary_key);
+}
+
+NonnullRefPtr<Index> Index::create(String name, KeyPath key_path, bool unique, bool multi_entry)
+{
+    return adopt_ref(*new Index(move(name), move(key_path), unique, multi_entry));
+}
+
+Index::Index(String name, KeyPath key_path, bool unique, bool multi_entry)
+    : m_name(move(name))
+    , m_key_path(move(key_path))
+    , m_unique(unique)
+    , m_multi_entry(multi_entry)
+{
+}
+
+bool Index::has_conflicting_record(Key const& key, Key const& primary_key) const
+{
+    // No key sorts before negative infinity, so this finds the first record with the key.
+    bool has_conflict = false;
+    m_records.for_each_after({ key, Key::number(-AK::Infinity<double>) }, true, [&](auto const& entry) {
+        if (entry.key.key != key)
+            return IterationDecision::Break;
+        if (entry.key.primary_key != primary_key) {
+            has_conflict = true;
+            return IterationDecision::Break;
+        }
+        return IterationDecision::Continue;
+    });
+    return has_conflict;
+}
+
+void Index::insert_records(Key const& primary_key, Vector<Key> keys)
+{
+    for (auto const& key : keys)
+        m_records.set({ key, primary_key }, {});
+
+    if (!keys.is_empty())
+        m_keys_by_primary_key.set(primary_key, move(keys));
+}
+
+Vector<Key> Index::remove_records(Key const& primary_key)
+{
+    auto keys = m_keys_by_primary_key.remove(primary_key);
+    if (!keys.has_value())
+        return {};
+
+    for (auto const& key : *keys)
+        m_records.remove({ key, primary_key });
+    return keys.release_value();
+}
+
+NonnullRefPtr<ObjectStore> ObjectStore::create(String name, Optional<KeyPath> key_path, bool auto_increment)
+{
+    return adopt_ref(*new ObjectStore(move(name), move(key_path), auto_increment));
+}
+
+ObjectStore::ObjectStore(String name, Optional<KeyPath> key_path, bool auto_increment)
+    : m_name(move(name))
+    , m_key_path(move(key_path))
+    , m_auto_increment(auto_increment)
+{
+}
+
+RefPtr<Index> ObjectStore::index(StringView name) const
+{
+    for (auto const& index : m_indexes) {
+        if (index->name() == name)
+            return index;
+    }
+    return nullptr;
+}
+
+void ObjectStore::rename(WriteBatch& batch, String name)
+{
+    if (batch.is_recording()) {
+        batch.append_operation(WriteBatch::Operation::RenameObjectStore);
+        batch.append_string(m_name);
+        batch.append_string(name);
+        batch.add_revert_step([this, self = NonnullRefPtr(*this), old_name = m_name] {
+            m_name = old_name;
+        });
+    }
+    m_name = move(name);
+}
+
+void ObjectStore::set_key_generator_current_number(WriteBatch& batch, u64 value)
+{
+    if (batch.is_recording()) {
+        batch.append_operation(WriteBatch::Operation::SetKeyGenerator);
+        batch.append_string(m_name);
+        batch.append_u64(value);
+        batch.add_revert_step([this, self = NonnullRefPtr(*this), old_value = m_key_generator_current_number] {
+            m_key_generator_current_number = old_value;
+        });
+    }
+    m_key_generator_current_number = value;
+}
+
+// https://w3c.github.io/IndexedDB/#generate-a-key
+Optional<Key> ObjectStore::generate_key(WriteBatch& batch)
+{
+    VERIFY(m_auto_increment);
+
+    // 1. Let generator be store's key generator.
+    // 2. Let key be generator's current number.
+    auto key = m_key_generator_current_number;
+
+    // 3. If key is greater than 2^53 (9007199254740992), then return failure.
+    if (key > maximum_key_generator_value)
+        return {};
+
+    // 4. Increase generator's current number by 1.
+    set_key_generator_current_number(batch, key + 1);
+
+    // 5. Return key.
+    return Key::number(static_cast<double>(key));
+}
+
+// https://w3c.github.io/IndexedDB/#possibly-update-the-key-generator
+void ObjectStore::possibly_update_key_generator(WriteBatch& batch, Key const& key)
+{
+    // 1. If the type of key is not number, abort these steps.
+    if (key.type() != Key::Type::Number)
+        return;
+
+    // 2. Let value be the value of key.
+    // 3. Set value to the minimum of value and 2^53 (9007199254740992).
+    auto value = min(key.number_value(), static_cast<double>(maximum_key_generator_value));
+
+    // 4. Set value to the largest integer not greater than value.
+    value = AK::floor(value);
+
+    // 5. Let generator be store's key generator.
+    // 6. If value is greater than or equal to generator's current number, then set generator's current number to
+    //    value + 1.
+    if (value >= static_cast<double>(m_key_generator_current_number))
+        set_key_generator_current_number(batch, static_cast<u64>(value) + 1);
+}
+
+Optional<ObjectStore::StoredRecord> ObjectStore::remove_record(Key const& key)
+{
+    auto value = m_records.remove(key);
+    if (!value.has_value())
+        return {};
+
+    StoredRecord record { key, value.release_value(), {} };
+    record.index_keys.ensure_capacity(m_indexes.size());
+    for (auto& index : m_indexes)
+        record.index_keys.unchecked_append(index->remove_records(key));
+    return record;
+}
+
+void ObjectStore::restore_record(StoredRecord record)
+{
+    VERIFY(record.index_keys.size() == m_indexes.size());
+
+    for (size_t i = 0; i < m_indexes.size(); ++i)
+        m_indexes[i]->insert_records(record.key, move(record.index_keys[i]));
+    m_records.set(move(record.key), move(record.value));
+}
+
+void ObjectStore::put_record(WriteBatch& batch, Key key, ByteBuffer value, Vector<Vector<Key>> index_keys)
+{
+    VERIFY(index_keys.size() == m_indexes.size());
+
+    if (batch.is_recording()) {
+        batch.append_operation(WriteBatch::Operation::PutRecord);
+        batch.append_string(m_name);
+        batch.append_key(key);
+        batch.append_bytes(value);
+        for (auto const& keys : index_keys)
+            batch.append_keys(keys);
+
+        batch.add_revert_step([this, self = NonnullRefPtr(*this), key, old_record = remove_record(key)]() mutable {
+            remove_record(key);
+            if (old_record.has_value())
+                restore_record(old_record.release_value());
+        });
+    } else {
+        remove_record(key);
+    }
+
+    for (size_t i = 0; i < m_indexes.size(); ++i)
+        m_indexes[i]->insert_records(key, move(index_keys[i]));
+    m_records.set(move(key), move(value));
+}
+
+// https://w3c.github.io/IndexedDB/#delete-records-from-an-object-store
+void ObjectStore::delete_records(WriteBatch& batch, KeyRange const& range)
+{
+    // 1. Remove all records, if any, from store's list of records with key in range.
+    // 2. For each index which references store, remove every record from index's list of records whose value is in
+    //    range, if any such records exist.
+    Vector<Key> keys;
+    if (range.lower.has_value() && range.upper.has_value() && range.lower == range.upper && !range.lower_open && !range.upper_open) {
+        if (m_records.contains(*range.lower))
+            keys.append(*range.lower);
+    } else {
+        auto collect = [&](auto const& entry) {
+            if (!range.contains(entry.key))
+                return IterationDecision::Break;
+            keys.append(entry.key);
+            return IterationDecision::Continue;
+        };
+
+        if (range.lower.has_value())
+            m_records.for_each_after(*range.lower, !range.lower_open, collect);
+        else
+            m_records.for_each(collect);
+    }
+
+    Vector<StoredRecord> removed_records;
+    removed_records.ensure_capacity(keys.size());
+    for (auto const& key : keys)
+        removed_records.unchecked_append(remove_record(key).release_value());
+
+    if (batch.is_recording()) {
+        batch.append_operation(WriteBatch::Operation::DeleteRecords);
+        batch.append_string(m_name);
+        batch.append_keys(keys);
+        batch.add_revert_step([this, self = NonnullRefPtr(*this), removed_records = move(removed_records)]() mutable {
+            for (auto& record : removed_records)
+                restore_record(move(record));
+        });
+    }
+}
+
+// https://w3c.github.io/IndexedDB/#clear-an-object-store
+void ObjectStore::clear(WriteBatch& batch)
+{
+    // 1. Remove all records from store.
+    // 2. In all indexes which reference store, remove all records.
+    delete_records(batch, KeyRange::unbounded());
+}
+
+Index& ObjectStore::create_index(WriteBatch& batch, String name, KeyPath key_path, bool unique, bool multi_entry)
+{
+    if (batch.is_recording()) {
+        batch.append_operation(WriteBatch::Operation::CreateIndex);
+        batch.append_string(m_name);
+        batch.append_string(name);
+        batch.append_key_path(key_path);
+        batch.append_bool(unique);
+        batch.append_bool(multi_entry);
+    }
+
+    auto index = Index::create(move(name), move(key_path), unique, multi_entry);
+    m_indexes.append(index);
+
+    if (batch.is_recording()) {
+        batch.add_revert_step([this, self = NonnullRefPtr(*this), index] {
+            m_indexes.remove_first_matching([&](auto const& entry) { return entry.ptr() == index.ptr(); });
+        });
+    }
+    return index;
+}
+
+void ObjectStore::delete_index(WriteBatch& batch, Index& index)
+{
+    auto position = m_indexes.find_first_index_if([&](auto const& entry) { return entry.ptr() == &index; });
+    VERIFY(position.has_value());
+
+    if (batch.is_recording()) {
+        batch.append_operation(WriteBatch::Operation::DeleteIndex);
+        batch.append_string(m_name);
+        batch.append_string(index.name());
+        batch.add_revert_step([this, self = NonnullRefPtr(*this), index = NonnullRefPtr(index), position = *position] {
+            m_indexes.insert(position, index);
+        });
+    }
+
+    m_indexes.remove(*position);
+}
+
+void ObjectStore::rename_index(WriteBatch& batch, Index& index, String name)
+{
+    if (batch.is_recording()) {
+        batch.append_operation(WriteBatch::Operation::RenameIndex);
+        batch.append_string(m_name);
+        batch.append_string(index.name());
+        batch.append_string(name);
+        batch.add_revert_step([index = NonnullRefPtr(index), old_name = index.name()] {
+            index->m_name = old_name;
+        });
+    }
+    index.m_name = move(name);
+}
+
+void ObjectStore::add_index_records(WriteBatch& batch, Index& index, Key const& primary_key, Vector<Key> keys)
+{
+    if (batch.is_recording()) {
+        batch.append_operation(WriteBatch::Operation::AddIndexRecords);
+        batch.append_string(m_name);
+        batch.append_string(index.name());
+        batch.append_key(primary_key);
+        batch.append_keys(keys);
+        batch.add_revert_step([index = NonnullRefPtr(index), primary_key] {
+            index->remove_records(primary_key);
+        });
+    }
+
+    index.insert_records(primary_key, move(keys));
+}
+
+NonnullRefPtr<Database> Database::create(String name)
+{
+    return adopt_ref(*new Database(move(name)));
+}
+
+Database::Database(String name)
+    : m_name(move(name))
+{
+}
+
+void Database::set_version(WriteBatch& batch, u64 version)
+{
+    if (batch.is_recording()) {
+        batch.append_operation(WriteBatch::Operation::SetVersion);
+        batch.append_u64(version);
+        batch.add_revert_step([this, self = NonnullRefPtr(*this), old_version = m_version] {
+            m_version = old_version;
+        });
+    }
+    m_version = version;
+}
+
+RefPtr<ObjectStore> Database::object_store(StringView name) const
+{
+    for (auto const& object_store : m_object_stores) {
+        if (object_store->name() == name)
+            return object_store;
+    }
+    return nullptr;
+}
+
+ObjectStore& Database::create_object_store(WriteBatch& batch, String name, Optional<KeyPath> key_path, bool auto_increment)
+{
+    if (batch.is_recording()) {
+        batch.append_operation(WriteBatch::Operation::CreateObjectStore);
+        batch.append_string(name);
+        batch.append_key_path(key_path);
+        batch.append_bool(auto_increment);
+    }
+
+    auto object_store = ObjectStore::create(move(name), move(key_path), auto_increment);
+    m_object_stores.append(object_store);
+
+    if (batch.is_recording()) {
+        batch.add_revert_step([this, self = NonnullRefPtr(*this), object_store] {
+            m_object_stores.remove_first_matching([&](auto const& entry) { return entry.ptr() == object_store.ptr(); });
+        });
+    }
+    return object_store;
+}
+
+void Database::delete_object_store(WriteBatch& batch, ObjectStore& object_store)
+{
+    auto position = m_object_stores.find_first_index_if([&](auto const& entry) { return entry.ptr() == &object_store; });
+    VERIFY(position.has_value());
+
+    if (batch.is_recording()) {
+        batch.append_operation(WriteBatch::Operation::DeleteObjectStore);
+        batch.append_string(object_store.name());
+        batch.add_revert_step([this, self = NonnullRefPtr(*this), object_store = NonnullRefPtr(object_store), position = *position] {
+            m_object_stores.insert(position, object_store);
+        });
+    }
+
+    m_object_stores.remove(*position);
+}
+
+ErrorOr<void> Database::replay(ReadonlyBytes journal)
+{
+    WriteBatch batch { WriteBatch::IsReplaying::Yes };
+    JournalReader reader { journal };
+
+    auto read_object_store = [&]() -> ErrorOr<NonnullRefPtr<ObjectStore>> {
+        auto object_store = this->object_store(TRY(reader.read_string()));
+        if (!object_store)
+            return Error::from_string_literal("Journal refers to an unknown object store");
+        return object_store.release_nonnull();
+    };
+
+    auto read_index = [&](ObjectStore& object_store) -> ErrorOr<NonnullRefPtr<Index>> {
+        auto index = object_store.index(TRY(reader.read_string()));
+        if (!index)
+            return Error::from_string_literal("Journal refers to an unknown index");
+        return index.release_nonnull();
+    };
+
+    while (!reader.is_eof()) {
+        switch (static_cast<WriteBatch::Operation>(TRY(reader.read_u8()))) {
+        case WriteBatch::Operation::SetVersion:
+            set_version(batch, TRY(reader.read_u64()));
+            break;
+        case WriteBatch::Operation::CreateObjectStore: {
+            auto name = TRY(reader.read_string());
+            auto key_path = TRY(reader.read_key_path());
+            auto auto_increment = TRY(reader.read_bool());
+            create_object_store(batch, move(name), move(key_path), auto_increment);
+            break;
+        }
+        case WriteBatch::Operation::DeleteObjectStore:
+            delete_object_store(batch, TRY(read_object_store()));
+            break;
+        case WriteBatch::Operation::RenameObjectStore: {
+            auto object_store = TRY(read_object_store());
+            object_store->rename(batch, TRY(reader.read_string()));
+            break;
+        }
+        case WriteBatch::Operation::SetKeyGenerator: {
+            auto object_store = TRY(read_object_store());
+            object_store->set_key_generator_current_number(batch, TRY(reader.read_u64()));
+            break;
+        }
+        case WriteBatch::Operation::PutRecord: {
+            auto object_store = TRY(read_object_store());
+            auto key = TRY(reader.read_key());
+            auto value = TRY(ByteBuffer::copy(TRY(reader.read_bytes())));
+
+            Vector<Vector<Key>> index_keys;
+            TRY(index_keys.try_ensure_capacity(object_store->indexes().size()));
+            for (size_t i = 0; i < object_store->indexes().size(); ++i)
+                index_keys.unchecked_append(TRY(reader.read_keys()));
+
+            object_store->put_record(batch, move(key), move(value), move(index_keys));
+            break;
+        }
+        case WriteBatch::Operation::DeleteRecords: {
+            auto object_store = TRY(read_object_store());
+            for (auto& key : TRY(reader.read_keys()))
+                object_store->delete_records(batch, KeyRange::only(move(key)));
+            break;
+        }
+        case WriteBatch::Operation::CreateIndex: {
+            auto object_store = TRY(read_object_store());
+            auto name = TRY(reader.read_string());
+            auto key_path = TRY(reader.read_key_path());
+            if (!key_path.has_value())
+                return Error::from_string_literal("Index without a key path in journal");
+            auto unique = TRY(reader.read_bool());
+            auto multi_entry = TRY(reader.read_bool());
+            object_store->create_index(batch, move(name), key_path.release_value(), unique, multi_entry);
+            break;
+        }
+        case WriteBatch::Operation::DeleteIndex: {
+            auto object_store = TRY(read_object_store());
+            object_store->delete_index(batch, TRY(read_index(object_store)));
+            break;
+        }
+        case WriteBatch::Operation::RenameIndex: {
+            auto object_store = TRY(read_object_store());
+            auto index = TRY(read_index(object_store));
+            object_store->rename_index(batch, index, TRY(reader.read_string()));
+            break;
+        }
+        case WriteBatch::Operation::AddIndexRecords: {
+            auto object_store = TRY(read_object_store());
+            auto index = TRY(read_index(object_store));
+            auto primary_key = TRY(reader.read_key());
+            object_store->add_index_records(batch, index, primary_key, TRY(reader.read_keys()));
+            break;
+        }
+        default:
+            return Error::from_string_literal("Invalid operation in journal");
+        }
+    }
+
+    return {};
+}
+
+ByteBuffer Database::snapshot() const
+{
+    WriteBatch batch;
+
+    batch.append_operation(WriteBatch::Operation::SetVersion);
+    batch.append_u64(m_version);
+
+    for (auto const& object_store : m_object_stores) {
+        batch.append_operation(WriteBatch::Operation::CreateObjectStore);
+        batch.append_string(object_store->name());
+        batch.append_key_path(object_store->key_path());
+        batch.append_bool(object_store->has_key_generator());
+
+        if (object_store->has_key_generator()) {
+            batch.append_operation(WriteBatch::Operation::SetKeyGenerator);
+            batch.append_string(object_store->name());
+            batch.append_u64(object_store->m_key_generator_current_number);
+        }
+
+        for (auto const& index : object_store->indexes()) {
+            batch.append_operation(WriteBatch::Operation::CreateIndex);
+            batch.append_string(object_store->name());
+            batch.append_string(index->name());
+            batch.append_key_path(index->key_path());
+            batch.append_bool(index->unique());
+            batch.append_bool(index->multi_entry());
+        }
+
+        object_store->records().for_each([&](auto const& entry) {
+            batch.append_operation(WriteBatch::Operation::PutRecord);
+            batch.append_string(object_store->name());
+            batch.append_key(entry.key);
+            batch.append_bytes(entry.value);
+
+            for (auto const& index : object_store->indexes()) {
+                auto const* keys = index->keys_for_primary_key(entry.key);
+                batch.append_keys(keys ? keys->span() : ReadonlySpan<Key> {});
+            }
+            return IterationDecision::Continue;
+        });
+    }
+
+    return batch.take_journal();
+}
+
+}
@@ -0,0 +1,266 @@
+/*
+ * Copyright (c) 2024, the SerenityOS developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/ByteBuffer.h>
+#include <AK/Function.h>
+#include <AK/NonnullRefPtr.h>
+#include <AK/RefCounted.h>
+#include <AK/String.h>
+#include <AK/Variant.h>
+#include <AK/Vector.h>
+#include <LibWeb/IndexedDB/Internal/BTree.h>
+#include <LibWeb/IndexedDB/Internal/Key.h>
+
+// The storage engine behind IndexedDB.
+//
+// A Database holds its object stores and their indexes in memory, where all reads are served from. Every change is
+// made through a WriteBatch, which records it both as a journal entry and as a step that reverts it. When a
+// transaction commits, its journal entry is appended to the database's file (see DatabaseFile), and when it aborts,
+// its changes are reverted. Opening a database replays its journal.
+
+namespace Web::IndexedDB {
+
+// https://w3c.github.io/IndexedDB/#key-path-construct
+using KeyPath = Variant<String, Vector<String>>;
+
+class WriteBatch {
+    AK_MAKE_NONCOPYABLE(WriteBatch);
+    AK_MAKE_DEFAULT_MOVABLE(WriteBatch);
+
+public:
+    WriteBatch() = default;
+
+    bool is_empty() const { return m_journal.is_empty(); }
+
+    ReadonlyBytes journal() const { return m_journal; }
+    ByteBuffer take_journal() { return move(m_journal); }
+
+    // A position in the batch, for reverting the changes of an operation that fails after making some.
+    struct Savepoint {
+        size_t journal_size { 0 };
+        size_t revert_step_count { 0 };
+    };
+    Savepoint savepoint() const { return { m_journal.size(), m_revert_steps.size() }; }
+
+    // Reverts every change made after the savepoint, most recent first.
+    void revert_to(Savepoint);
+
+    // Reverts every change in the batch, most recent first.
+    void revert() { revert_to({}); }
+
+private:
+    friend class Database;
+    friend class ObjectStore;
+    friend class Index;
+
+    enum class Operation : u8 {
+        SetVersion,
+        CreateObjectStore,
+        DeleteObjectStore,
+        RenameObjectStore,
+        SetKeyGenerator,
+        PutRecord,
+        DeleteRecords,
+        CreateIndex,
+        DeleteIndex,
+        RenameIndex,
+        AddIndexRecords,
+    };
+
+    // Changes made while replaying a journal are already on disk, and are never reverted.
+    enum class IsReplaying : bool {
+        No,
+        Yes,
+    };
+
+    explicit WriteBatch(IsReplaying is_replaying)
+        : m_is_replaying(is_replaying)
+    {
+    }
+
+    bool is_recording() const { return m_is_replaying == IsReplaying::No; }
+
+    void append_operation(Operation operation) { m_journal.append(to_underlying(operation)); }
+    void append_u64(u64);
+    void append_bool(bool value) { m_journal.append(value); }
+    void append_string(StringView);
+    void append_bytes(ReadonlyBytes);
+    void append_key(Key const& key) { key.encode(m_journal); }
+    void append_key_path(Optional<KeyPath> const&);
+    void append_keys(ReadonlySpan<Key>);
+
+    void add_revert_step(Function<void()> step) { m_revert_steps.append(move(step)); }
+
+    IsReplaying m_is_replaying { IsReplaying::No };
+    ByteBuffer m_journal;
+    Vector<Function<void()>> m_revert_steps;
+};
+
+// https://w3c.github.io/IndexedDB/#index-construct
+class Index : public RefCounted<Index> {
+public:
+    struct RecordKey {
+        Key key;
+        Key primary_key;
+
+        // Records are ordered by their key, and records with the same key by the primary key they refer to.
+        static int compare(RecordKey const&, RecordKey const&);
+    };
+
+    static NonnullRefPtr<Index> create(String name, KeyPath, bool unique, bool multi_entry);
+
+    String const& name() const { return m_name; }
+    KeyPath const& key_path() const { return m_key_path; }
+    bool unique() const { return m_unique; }
+    bool multi_entry() const { return m_multi_entry; }
+
+    BTree<RecordKey, Empty> const& records() const { return m_records; }
+
+    // Calls the callback in ascending order for every record whose key is in the range, until it returns
+    // IterationDecision::Break.
+    template<typename Callback>
+    void for_each_record_in_range(KeyRange const& range, Callback callback) const
+    {
+        m_records.for_each_from([&](RecordKey const& record_key) { return range.is_below_lower_bound(record_key.key); }, [&](auto const& entry) {
+            if (range.is_above_upper_bound(entry.key.key))
+                return IterationDecision::Break;
+            return callback(entry.key);
+        });
+    }
+
+    // Whether a record with the key refers to a record other than the one with the primary key.
+    bool has_conflicting_record(Key const& key, Key const& primary_key) const;
+
+private:
+    friend class Database;
+    friend class ObjectStore;
+
+    Index(String name, KeyPath, bool unique, bool multi_entry);
+
+    Vector<Key> const* keys_for_primary_key(Key const& primary_key) const { return m_keys_by_primary_key.find(primary_key); }
+    void insert_records(Key const& primary_key, Vector<Key> keys);
+    Vector<Key> remove_records(Key const& primary_key);
+
+    String m_name;
+    KeyPath m_key_path;
+    bool m_unique { false };
+    bool m_multi_entry { false };
+
+    BTree<RecordKey, Empty> m_records;
+
+    // The keys of the records that refer to each record of the object store, for removing them again.
+    BTree<Key, Vector<Key>> m_keys_by_primary_key;
+};
+
+// https://w3c.github.io/IndexedDB/#object-store-construct
+class ObjectStore : public RefCounted<ObjectStore> {
+public:
+    static NonnullRefPtr<ObjectStore> create(String name, Optional<KeyPath>, bool auto_increment);
+
+    String const& name() const { return m_name; }
+    Optional<KeyPath> const& key_path() const { return m_key_path; }
+    bool uses_inline_keys() const { return m_key_path.has_value(); }
+    bool has_key_generator() const { return m_auto_increment; }
+
+    Vector<NonnullRefPtr<Index>> const& indexes() const { return m_indexes; }
+    RefPtr<Index> index(StringView name) const;
+
+    BTree<Key, ByteBuffer> const& records() const { return m_records; }
+
+    // Calls the callback in ascending order for every record whose key is in the range, until it returns
+    // IterationDecision::Break.
+    template<typename Callback>
+    void for_each_record_in_range(KeyRange const& range, Callback callback) const
+    {
+        m_records.for_each_from([&](Key const& key) { return range.is_below_lower_bound(key); }, [&](auto const& entry) {
+            if (range.is_above_upper_bound(entry.key))
+                return IterationDecision::Break;
+            return callback(entry);
+        });
+    }
+
+    void rename(WriteBatch&, String name);
+
+    // https://w3c.github.io/IndexedDB/#generate-a-key
+    Optional<Key> generate_key(WriteBatch&);
+
+    // https://w3c.github.io/IndexedDB/#possibly-update-the-key-generator
+    void possibly_update_key_generator(WriteBatch&, Key const&);
+
+    // Stores the record, replacing any record with the same key. The keys for each index of the store are given in
+    // the same order as indexes().
+    void put_record(WriteBatch&, Key, ByteBuffer value, Vector<Vector<Key>> index_keys);
+
+    // https://w3c.github.io/IndexedDB/#delete-records-from-an-object-store
+    void delete_records(WriteBatch&, KeyRange const&);
+
+    void clear(WriteBatch&);
+
+    Index& create_index(WriteBatch&, String name, KeyPath, bool unique, bool multi_entry);
+    void delete_index(WriteBatch&, Index&);
+    void rename_index(WriteBatch&, Index&, String name);
+
+    // Adds the records that refer to an existing record to an index, while the index is being created.
+    void add_index_records(WriteBatch&, Index&, Key const& primary_key, Vector<Key> keys);
+
+private:
+    ObjectStore(String name, Optional<KeyPath>, bool auto_increment);
+
+    friend class Database;
+
+    struct StoredRecord {
+        Key key;
+        ByteBuffer value;
+        Vector<Vector<Key>> index_keys;
+    };
+
+    void set_key_generator_current_number(WriteBatch&, u64);
+    Optional<StoredRecord> remove_record(Key const&);
+    void restore_record(StoredRecord);
+
+    String m_name;
+    Optional<KeyPath> m_key_path;
+    bool m_auto_increment { false };
+
+    // https://w3c.github.io/IndexedDB/#key-generator-current-number
+    u64 m_key_generator_current_number { 1 };
+
+    Vector<NonnullRefPtr<Index>> m_indexes;
+    BTree<Key, ByteBuffer> m_records;
+};
+
+// https://w3c.github.io/IndexedDB/#database-construct
+class Database : public RefCounted<Database> {
+public:
+    static NonnullRefPtr<Database> create(String name);
+
+    String const& name() const { return m_name; }
+    u64 version() const { return m_version; }
+    void set_version(WriteBatch&, u64);
+
+    Vector<NonnullRefPtr<ObjectStore>> const& object_stores() const { return m_object_stores; }
+    RefPtr<ObjectStore> object_store(StringView name) const;
+
+    ObjectStore& create_object_store(WriteBatch&, String name, Optional<KeyPath>, bool auto_increment);
+    void delete_object_store(WriteBatch&, ObjectStore&);
+
+    // Applies the changes of a journal entry that was written by a committed transaction.
+    ErrorOr<void> replay(ReadonlyBytes journal);
+
+    // Encodes the current contents of the database as a single journal entry.
+    ByteBuffer snapshot() const;
+
+private:
+    explicit Database(String name);
+
+    String m_name;
+    u64 m_version { 0 };
+    Vector<NonnullRefPtr<ObjectStore>> m_object_stores;
+};
+
+}
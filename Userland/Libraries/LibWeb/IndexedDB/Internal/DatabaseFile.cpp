@@ -0,0 +1,178 @@
+/*
+ * Copyright (c) 2024, the SerenityOS developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibCore/System.h>
+#include <LibCrypto/Checksum/CRC32.h>
+#include <LibWeb/IndexedDB/Internal/DatabaseFile.h>
+#include <errno.h>
+#include <sys/file.h>
+
+namespace Web::IndexedDB {
+
+// A journal starts with a magic number and a version, followed by its entries. Each entry is its size and checksum,
+// followed by the changes it holds, as written by a WriteBatch.
+static constexpr u32 journal_magic = 0x42444949; // "IIDB"
+static constexpr u32 journal_version = 1;
+
+struct [[gnu::packed]] JournalHeader {
+    u32 magic { journal_magic };
+    u32 version { journal_version };
+};
+
+struct [[gnu::packed]] EntryHeader {
+    u32 size { 0 };
+    u32 checksum { 0 };
+};
+
+// Takes the lock that makes the file ours for as long as it stays open.
+static ErrorOr<void> lock_journal(Core::File& file, ByteString const& path)
+{
+    if (flock(file.fd(), LOCK_EX | LOCK_NB) < 0) {
+        if (errno == EWOULDBLOCK)
+            return Error::from_string_literal("IndexedDB journal is in use by another process");
+        return Error::from_syscall("flock"sv, -errno);
+    }
+
+    // The journal may have been rewritten by its previous owner between opening and locking it, in which case the file
+    // we locked is no longer the journal.
+    auto file_stat = TRY(Core::System::fstat(file.fd()));
+    auto path_stat = TRY(Core::System::stat(path));
+    if (file_stat.st_dev != path_stat.st_dev || file_stat.st_ino != path_stat.st_ino)
+        return Error::from_string_literal("IndexedDB journal is in use by another process");
+
+    return {};
+}
+
+ErrorOr<NonnullRefPtr<DatabaseFile>> DatabaseFile::open(ByteString path)
+{
+    auto file = TRY(Core::File::open(path, Core::File::OpenMode::ReadWrite, 0600));
+    TRY(lock_journal(*file, path));
+    return adopt_nonnull_ref_or_enomem(new (nothrow) DatabaseFile(move(path), move(file)));
+}
+
+DatabaseFile::DatabaseFile(ByteString path, NonnullOwnPtr<Core::File> file)
+    : m_path(move(path))
+    , m_file(move(file))
+{
+}
+
+ErrorOr<Vector<ByteBuffer>> DatabaseFile::read_entries()
+{
+    TRY(m_file->seek(0, SeekMode::SetPosition));
+    auto contents = TRY(m_file->read_until_eof());
+
+    if (contents.is_empty()) {
+        JournalHeader header;
+        TRY(m_file->write_until_depleted({ &header, sizeof(header) }));
+        return Vector<ByteBuffer> {};
+    }
+
+    JournalHeader header;
+    if (contents.size() < sizeof(header))
+        return Error::from_string_literal("IndexedDB journal is truncated");
+
+    __builtin_memcpy(&header, contents.data(), sizeof(header));
+    if (header.magic != journal_magic)
+        return Error::from_string_literal("Not an IndexedDB journal");
+    if (header.version != journal_version)
+        return Error::from_string_literal("Unsupported IndexedDB journal version");
+
+    Vector<ByteBuffer> entries;
+    size_t offset = sizeof(header);
+
+    while (contents.size() - offset >= sizeof(EntryHeader)) {
+        EntryHeader entry_header;
+        __builtin_memcpy(&entry_header, contents.offset_pointer(offset), sizeof(entry_header));
+
+        if (contents.size() - offset - sizeof(entry_header) < entry_header.size)
+            break;
+
+        auto entry = contents.bytes().slice(offset + sizeof(entry_header), entry_header.size);
+        if (Crypto::Checksum::CRC32 { entry }.digest() != entry_header.checksum)
+            break;
+
+        TRY(entries.try_append(TRY(ByteBuffer::copy(entry))));
+        offset += sizeof(entry_header) + entry_header.size;
+    }
+
+    m_entry_count = entries.size();
+
+    if (offset != contents.size()) {
+        dbgln("IndexedDB: Discarding {} bytes of an incomplete entry at the end of {}", contents.size() - offset, m_path);
+        TRY(m_file->truncate(offset));
+        TRY(m_file->seek(0, SeekMode::FromEndPosition));
+    }
+
+    return entries;
+}
+
+ErrorOr<NonnullRefPtr<Database>> DatabaseFile::load_database(String name)
+{
+    auto entries = TRY(read_entries());
+
+    auto database = Database::create(move(name));
+    for (auto const& entry : entries)
+        TRY(database->replay(entry));
+
+    if (entries.size() >= compaction_entry_count)
+        TRY(rewrite(database->snapshot()));
+
+    return database;
+}
+
+ErrorOr<void> DatabaseFile::append_entry(ReadonlyBytes entry)
+{
+    if (entry.size() > NumericLimits<u32>::max())
+        return Error::from_errno(EFBIG);
+
+    EntryHeader header { static_cast<u32>(entry.size()), Crypto::Checksum::CRC32 { entry }.digest() };
+    TRY(m_file->write_until_depleted({ &header, sizeof(header) }));
+    TRY(m_file->write_until_depleted(entry));
+    TRY(Core::System::fsync(m_file->fd()));
+    ++m_entry_count;
+    return {};
+}
+
+ErrorOr<void> DatabaseFile::rewrite(ReadonlyBytes entry)
+{
+    // Write the new journal next to the old one and move it into place, so that one of them survives a crash.
+    auto temporary_path = ByteString::formatted("{}.tmp", m_path);
+    // The new journal is locked before it is moved into place, so that it can't be opened by anyone else either.
+    auto file = TRY(Core::File::open(temporary_path, Core::File::OpenMode::ReadWrite | Core::File::OpenMode::Truncate, 0600));
+    if (auto result = lock_journal(*file, temporary_path); result.is_error()) {
+        (void)Core::System::unlink(temporary_path);
+        return result.release_error();
+    }
+
+    JournalHeader header;
+    TRY(file->write_until_depleted({ &header, sizeof(header) }));
+    swap(file, m_file);
+
+    auto entry_count = m_entry_count;
+    m_entry_count = 0;
+
+    auto result = append_entry(entry);
+    if (!result.is_error())
+        result = Core::System::rename(temporary_path, m_path);
+
+    if (result.is_error()) {
+        swap(file, m_file);
+        m_entry_count = entry_count;
+        (void)Core::System::unlink(temporary_path);
+        return result.release_error();
+    }
+
+    return {};
+}
+
+ErrorOr<void> DatabaseFile::remove(ByteString const& path)
+{
+    if (auto result = Core::System::unlink(path); result.is_error() && result.error().code() != ENOENT)
+        return result.release_error();
+    return {};
+}
+
+}
@@ -0,0 +1,55 @@
+/*
+ * Copyright (c) 2024, the SerenityOS developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/AtomicRefCounted.h>
+#include <AK/ByteString.h>
+#include <AK/NonnullOwnPtr.h>
+#include <LibCore/File.h>
+#include <LibWeb/IndexedDB/Internal/Database.h>
+
+namespace Web::IndexedDB {
+
+// The on-disk form of a database: a journal with an entry for every transaction that changed it, each written as a
+// whole when the transaction commits. A DatabaseFile blocks on I/O, so it is only used from the storage thread.
+//
+// Nothing coordinates writes to a journal, so only one DatabaseFile may use it at a time: an exclusive lock is held on
+// the journal for as long as it is open, and opening a journal that is in use by another process fails.
+class DatabaseFile : public AtomicRefCounted<DatabaseFile> {
+public:
+    // Once a journal has this many entries, it is rewritten as a single one.
+    static constexpr size_t compaction_entry_count = 64;
+
+    static ErrorOr<NonnullRefPtr<DatabaseFile>> open(ByteString path);
+
+    // Reads the journal into a new database with the given name. If the journal has grown long, it is compacted into
+    // a single entry.
+    ErrorOr<NonnullRefPtr<Database>> load_database(String name);
+
+    // Appends an entry to the journal, and waits for it to reach the disk.
+    ErrorOr<void> append_entry(ReadonlyBytes);
+
+    // Replaces the whole journal with a single entry.
+    ErrorOr<void> rewrite(ReadonlyBytes entry);
+
+    size_t entry_count() const { return m_entry_count; }
+
+    static ErrorOr<void> remove(ByteString const& path);
+
+private:
+    DatabaseFile(ByteString path, NonnullOwnPtr<Core::File>);
+
+    // Reads every entry of the journal. An entry that was only partially written, because the process went away
+    // while writing it, is cut off the end of the file.
+    ErrorOr<Vector<ByteBuffer>> read_entries();
+
+    ByteString m_path;
+    NonnullOwnPtr<Core::File> m_file;
+    size_t m_entry_count { 0 };
+};
+
+}
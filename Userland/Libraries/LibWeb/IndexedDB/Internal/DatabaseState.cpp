@@ -0,0 +1,346 @@
+/*
+ * Copyright (c) 2024, the SerenityOS developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/AtomicRefCounted.h>
+#include <AK/HashMap.h>
+#include <AK/Hex.h>
+#include <LibCore/Directory.h>
+#include <LibCrypto/Hash/SHA2.h>
+#include <LibThreading/BackgroundAction.h>
+#include <LibWeb/IndexedDB/IDBDatabase.h>
+#include <LibWeb/IndexedDB/IDBTransaction.h>
+#include <LibWeb/IndexedDB/Internal/DatabaseState.h>
+#include <LibWeb/Platform/EventLoopPlugin.h>
+
+namespace Web::IndexedDB {
+
+static ByteString s_storage_directory;
+
+// Storage key -> database name -> database.
+static HashMap<String, HashMap<String, NonnullRefPtr<DatabaseState>>> s_databases;
+
+// Background actions are given separate callbacks for success and failure, which both complete the same operation.
+// An action is released on whichever thread drops its last reference, which is often the background thread. Everything
+// that may only be touched on the event loop's thread is therefore kept here, and moved out by complete(), so that it is
+// also destroyed on the event loop's thread.
+struct PendingCompletion : public AtomicRefCounted<PendingCompletion> {
+    PendingCompletion(NonnullRefPtr<DatabaseState> state, Function<void(ErrorOr<void>)> on_complete)
+        : state(move(state))
+        , on_complete(move(on_complete))
+    {
+    }
+
+    // Must be called on the event loop's thread.
+    void complete(ErrorOr<void> result)
+    {
+        auto database_state = move(state);
+        auto callback = move(on_complete);
+        if (callback)
+            callback(move(result));
+    }
+
+    RefPtr<DatabaseState> state;
+    Function<void(ErrorOr<void>)> on_complete;
+};
+
+// NOTE: A background action's error callback is invoked on the background thread if the action was cancelled, which only
+//       happens once the event loop has exited. There is nothing left to complete then.
+static bool was_cancelled(Error const& error)
+{
+    return error.is_errno() && error.code() == ECANCELED;
+}
+
+void DatabaseState::set_storage_directory(ByteString directory)
+{
+    s_storage_directory = move(directory);
+}
+
+NonnullRefPtr<DatabaseState> DatabaseState::get_or_create(String const& storage_key, String const& name)
+{
+    auto& databases = s_databases.ensure(storage_key);
+    if (auto database = databases.get(name); database.has_value())
+        return *database.value();
+
+    // Database names are arbitrary strings, so files are named after a hash of the storage key and the name.
+    ByteString path;
+    if (!s_storage_directory.is_empty()) {
+        ::Crypto::Hash::SHA256 hash;
+        hash.update(storage_key.bytes());
+        hash.update(ReadonlyBytes { "\0", 1 });
+        hash.update(name.bytes());
+        path = ByteString::formatted("{}/{}.idb", s_storage_directory, encode_hex(hash.digest().bytes()));
+    }
+
+    auto database = adopt_ref(*new DatabaseState(name, move(path)));
+    databases.set(name, database);
+    return database;
+}
+
+void DatabaseState::for_each_transaction(Function<void(IDBTransaction&)> const& callback)
+{
+    for (auto const& databases : s_databases) {
+        for (auto const& database : databases.value) {
+            for (auto& transaction : Vector { database.value->m_transactions })
+                callback(*transaction);
+        }
+    }
+}
+
+DatabaseState::DatabaseState(String name, ByteString path)
+    : m_name(move(name))
+    , m_path(move(path))
+{
+}
+
+RefPtr<Database> DatabaseState::database() const
+{
+    if (!m_database || m_database->version() == 0)
+        return nullptr;
+    return m_database;
+}
+
+Database& DatabaseState::ensure_database()
+{
+    VERIFY(m_is_loaded);
+    if (!m_database)
+        m_database = Database::create(m_name);
+    return *m_database;
+}
+
+void DatabaseState::load(Function<void(ErrorOr<void>)> on_complete)
+{
+    if (m_is_loaded || m_path.is_empty()) {
+        m_is_loaded = true;
+        on_complete({});
+        return;
+    }
+
+    // NOTE: The loaded database is handed over through this rather than as the action's result, as the action keeps a
+    //       reference to its result, and the database must not be shared between threads.
+    struct LoadResult : public AtomicRefCounted<LoadResult> {
+        RefPtr<DatabaseFile> file;
+        RefPtr<Database> database;
+    };
+
+    auto completion = make_ref_counted<PendingCompletion>(*this, move(on_complete));
+    auto result = make_ref_counted<LoadResult>();
+
+    // NOTE: Strings are not safe to share between threads, so the background thread is given copies of its own.
+    (void)Threading::BackgroundAction<Empty>::construct(
+        [result, path = ByteString { m_path.view() }, name = MUST(String::from_utf8(m_name.bytes_as_string_view()))](auto&) -> ErrorOr<Empty> {
+            TRY(Core::Directory::create(LexicalPath { path }.parent(), Core::Directory::CreateDirectories::Yes, 0700));
+            result->file = TRY(DatabaseFile::open(path));
+            result->database = TRY(result->file->load_database(name));
+            return Empty {};
+        },
+        [completion, result](Empty) -> ErrorOr<void> {
+            auto& state = *completion->state;
+            state.m_journal_entry_count = result->file->entry_count();
+            state.m_file = move(result->file);
+            state.m_database = move(result->database);
+            state.m_is_loaded = true;
+            completion->complete({});
+            return {};
+        },
+        [completion](Error error) {
+            if (!was_cancelled(error))
+                completion->complete(move(error));
+        });
+}
+
+void DatabaseState::write_journal(ByteBuffer journal, Function<void(ErrorOr<void>)> on_complete)
+{
+    if (!m_file) {
+        on_complete({});
+        return;
+    }
+
+    ++m_journal_entry_count;
+
+    auto completion = make_ref_counted<PendingCompletion>(*this, move(on_complete));
+
+    (void)Threading::BackgroundAction<Empty>::construct(
+        [file = NonnullRefPtr { *m_file }, journal = move(journal)](auto&) -> ErrorOr<Empty> {
+            TRY(file->append_entry(journal));
+            return Empty {};
+        },
+        [completion](Empty) -> ErrorOr<void> {
+            completion->complete({});
+            return {};
+        },
+        [completion](Error error) {
+            if (!was_cancelled(error))
+                completion->complete(move(error));
+        });
+}
+
+void DatabaseState::delete_database(Function<void(ErrorOr<void>)> on_complete)
+{
+    m_database = nullptr;
+
+    if (!m_file) {
+        on_complete({});
+        return;
+    }
+    m_file = nullptr;
+
+    auto completion = make_ref_counted<PendingCompletion>(*this, move(on_complete));
+
+    (void)Threading::BackgroundAction<Empty>::construct(
+        [path = ByteString { m_path.view() }](auto&) -> ErrorOr<Empty> {
+            TRY(DatabaseFile::remove(path));
+            return Empty {};
+        },
+        [completion](Empty) -> ErrorOr<void> {
+            completion->complete({});
+            return {};
+        },
+        [completion](Error error) {
+            if (!was_cancelled(error))
+                completion->complete(move(error));
+        });
+
+    // The next connection to open the database will create its file again.
+    m_is_loaded = false;
+}
+
+void DatabaseState::enqueue_request(Function<void()> steps)
+{
+    m_request_queue.append(move(steps));
+    if (m_request_queue.size() == 1)
+        m_request_queue.first()();
+}
+
+void DatabaseState::request_processed()
+{
+    m_request_queue.take_first();
+    if (!m_request_queue.is_empty())
+        m_request_queue.first()();
+}
+
+void DatabaseState::add_connection(IDBDatabase& connection)
+{
+    m_connections.append(connection);
+}
+
+void DatabaseState::remove_connection(IDBDatabase& connection)
+{
+    m_connections.remove_first_matching([&](auto& other) { return &other == &connection; });
+    if (!m_connections.is_empty() || !m_on_connections_closed)
+        return;
+
+    // Connections are also removed while they are being garbage collected, which is no time to run any steps.
+    Platform::EventLoopPlugin::the().deferred_invoke([callback = move(m_on_connections_closed)] {
+        callback();
+    });
+}
+
+Vector<JS::Handle<IDBDatabase>> DatabaseState::connections()
+{
+    Vector<JS::Handle<IDBDatabase>> connections;
+    connections.ensure_capacity(m_connections.size());
+    for (auto& connection : m_connections)
+        connections.unchecked_append(JS::make_handle(connection));
+    return connections;
+}
+
+void DatabaseState::wait_for_connections_to_close(Function<void()> callback)
+{
+    VERIFY(!m_on_connections_closed);
+    if (m_connections.is_empty()) {
+        callback();
+        return;
+    }
+    m_on_connections_closed = move(callback);
+}
+
+void DatabaseState::add_transaction(IDBTransaction& transaction)
+{
+    m_transactions.append(transaction);
+    start_transactions();
+}
+
+void DatabaseState::remove_transaction(IDBTransaction& transaction)
+{
+    m_transactions.remove_first_matching([&](auto& other) { return other.ptr() == &transaction; });
+    start_transactions();
+    compact_journal_if_needed();
+}
+
+void DatabaseState::compact_journal_if_needed()
+{
+    if (!m_file || !m_database || m_is_compacting_journal || m_journal_entry_count < DatabaseFile::compaction_entry_count)
+        return;
+
+    // Every change of an unfinished transaction is already applied to the database, and would end up in the snapshot
+    // even if the transaction is aborted later.
+    if (!m_transactions.is_empty())
+        return;
+
+    // NOTE: Writes complete in the order they were made, so the rewrite happens after every entry that is already in
+    //       the snapshot has been appended.
+    m_is_compacting_journal = true;
+    m_journal_entry_count = 1;
+
+    auto completion = make_ref_counted<PendingCompletion>(*this, nullptr);
+
+    (void)Threading::BackgroundAction<Empty>::construct(
+        [file = NonnullRefPtr { *m_file }, snapshot = m_database->snapshot()](auto&) -> ErrorOr<Empty> {
+            TRY(file->rewrite(snapshot));
+            return Empty {};
+        },
+        [completion](Empty) -> ErrorOr<void> {
+            completion->state->m_is_compacting_journal = false;
+            completion->complete({});
+            return {};
+        },
+        [completion](Error error) {
+            if (was_cancelled(error))
+                return;
+
+            // The old journal is left as it was, and is compacted when the database is next loaded instead.
+            dbgln("IndexedDB: Failed to compact the journal of {}: {}", completion->state->m_name, error);
+            completion->state->m_is_compacting_journal = false;
+            completion->complete({});
+        });
+}
+
+bool DatabaseState::has_unfinished_transactions(IDBDatabase const& connection) const
+{
+    return any_of(m_transactions, [&](auto& transaction) { return &transaction->connection() == &connection; });
+}
+
+// https://w3c.github.io/IndexedDB/#transaction-scheduling
+void DatabaseState::start_transactions()
+{
+    for (size_t i = 0; i < m_transactions.size(); ++i) {
+        auto& transaction = *m_transactions[i];
+        if (transaction.has_started())
+            continue;
+
+        // A read-only transaction tx can start when there are no read/write transactions which:
+        // - Were created before tx; and
+        // - have overlapping scopes with tx; and
+        // - are not finished.
+        // A read/write transaction tx can start when there are no transactions which:
+        // - Were created before tx; and
+        // - have overlapping scopes with tx; and
+        // - are not finished.
+        bool can_start = true;
+        for (size_t j = 0; j < i && can_start; ++j) {
+            auto& other = *m_transactions[j];
+            if (transaction.is_read_only() && other.is_read_only())
+                continue;
+            if (transaction.overlaps(other))
+                can_start = false;
+        }
+
+        if (can_start)
+            transaction.start();
+    }
+}
+
+}
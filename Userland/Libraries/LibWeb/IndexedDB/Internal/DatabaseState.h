@@ -0,0 +1,100 @@
+/*
+ * Copyright (c) 2024, the SerenityOS developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/ByteString.h>
+#include <AK/Function.h>
+#include <AK/RefCounted.h>
+#include <AK/RefPtr.h>
+#include <AK/String.h>
+#include <AK/Vector.h>
+#include <LibJS/Heap/Handle.h>
+#include <LibWeb/Forward.h>
+#include <LibWeb/IndexedDB/Internal/Database.h>
+#include <LibWeb/IndexedDB/Internal/DatabaseFile.h>
+
+namespace Web::IndexedDB {
+
+// Everything that the connections to a database in this process share: the database itself and the file it is
+// stored in, the connection queue, the open connections and the transactions that have not finished yet.
+class DatabaseState : public RefCounted<DatabaseState> {
+public:
+    // Databases are only kept in memory until a directory to store them in is set.
+    static void set_storage_directory(ByteString);
+
+    static NonnullRefPtr<DatabaseState> get_or_create(String const& storage_key, String const& name);
+
+    static void for_each_transaction(Function<void(IDBTransaction&)> const&);
+
+    String const& name() const { return m_name; }
+
+    // The database, if it exists. A database that was loaded, but never upgraded to a version, does not.
+    RefPtr<Database> database() const;
+
+    // Creates the database if it does not exist. Must be called after load().
+    Database& ensure_database();
+
+    // Reads the database from its file, once. The callback is invoked on the current event loop.
+    void load(Function<void(ErrorOr<void>)>);
+
+    // Writes the journal of a committing transaction to the database's file. Writes complete in the order they were
+    // made.
+    void write_journal(ByteBuffer, Function<void(ErrorOr<void>)>);
+
+    // Deletes the database and its file.
+    void delete_database(Function<void(ErrorOr<void>)>);
+
+    // https://w3c.github.io/IndexedDB/#connection-queue
+    // Runs the steps once every request that was queued before has been processed. The steps must call
+    // request_processed() when they are done.
+    void enqueue_request(Function<void()> steps);
+    void request_processed();
+
+    Vector<JS::Handle<IDBDatabase>> connections();
+    void add_connection(IDBDatabase&);
+    void remove_connection(IDBDatabase&);
+
+    // Invokes the callback once every connection is closed.
+    void wait_for_connections_to_close(Function<void()>);
+
+    // Transactions are kept in the order they were created in, which decides the order they start in.
+    void add_transaction(IDBTransaction&);
+    void remove_transaction(IDBTransaction&);
+    bool has_unfinished_transactions(IDBDatabase const&) const;
+
+    // https://w3c.github.io/IndexedDB/#transaction-scheduling
+    void start_transactions();
+
+private:
+    DatabaseState(String name, ByteString path);
+
+    // Rewrites the journal as a single entry once it has grown long, while no transaction has changes that could still
+    // be reverted.
+    void compact_journal_if_needed();
+
+    String m_name;
+
+    // The path of the database's file, which is empty if databases are kept in memory.
+    ByteString m_path;
+
+    bool m_is_loaded { false };
+    RefPtr<Database> m_database;
+    RefPtr<DatabaseFile> m_file;
+
+    // The number of entries in the file's journal, including writes that have not completed yet.
+    size_t m_journal_entry_count { 0 };
+    bool m_is_compacting_journal { false };
+
+    Vector<Function<void()>> m_request_queue;
+
+    Vector<IDBDatabase&> m_connections;
+    Function<void()> m_on_connections_closed;
+
+    Vector<JS::Handle<IDBTransaction>> m_transactions;
+};
+
+}
@@ -0,0 +1,227 @@
+/*
+ * Copyright (c) 2024, the SerenityOS developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/Utf8View.h>
+#include <LibWeb/IndexedDB/Internal/Key.h>
+
+namespace Web::IndexedDB {
+
+// Strings are ordered by their UTF-16 code units, which only differs from the code point order of their UTF-8 bytes
+// when a code point above U+FFFF (a surrogate pair) is compared with one from U+E000 to U+FFFF.
+static int compare_code_units(StringView a, StringView b)
+{
+    auto length = min(a.length(), b.length());
+
+    size_t offset = 0;
+    while (offset < length && a[offset] == b[offset])
+        ++offset;
+
+    if (offset == length) {
+        if (a.length() == b.length())
+            return 0;
+        return a.length() < b.length() ? -1 : 1;
+    }
+
+    // Move back to the start of the code point that differs.
+    while (offset > 0 && (static_cast<u8>(a[offset]) & 0xc0) == 0x80)
+        --offset;
+
+    auto code_point_a = *Utf8View(a.substring_view(offset)).begin();
+    auto code_point_b = *Utf8View(b.substring_view(offset)).begin();
+
+    auto first_code_unit = [](u32 code_point) -> u32 {
+        if (code_point < 0x10000)
+            return code_point;
+        return 0xd800 + ((code_point - 0x10000) >> 10);
+    };
+
+    auto code_unit_a = first_code_unit(code_point_a);
+    auto code_unit_b = first_code_unit(code_point_b);
+    if (code_unit_a != code_unit_b)
+        return code_unit_a < code_unit_b ? -1 : 1;
+
+    // Both are surrogate pairs with the same lead surrogate, so the trail surrogates keep the code point order.
+    return code_point_a < code_point_b ? -1 : 1;
+}
+
+// https://w3c.github.io/IndexedDB/#compare-two-keys
+int Key::compare(Key const& a, Key const& b)
+{
+    // 1. Let ta be the type of a.
+    // 2. Let tb be the type of b.
+    // 3. If ta does not equal tb, then run these steps: [...]
+    if (a.type() != b.type())
+        return a.type() < b.type() ? -1 : 1;
+
+    // 4. Let va be the value of a.
+    // 5. Let vb be the value of b.
+    // 6. Switch on ta:
+    switch (a.type()) {
+    case Type::Number:
+    case Type::Date: {
+        // 1. If va is greater than vb, then return 1.
+        // 2. If va is less than vb, then return -1.
+        // 3. Return 0.
+        auto va = a.number_value();
+        auto vb = b.number_value();
+        if (va > vb)
+            return 1;
+        if (va < vb)
+            return -1;
+        return 0;
+    }
+    case Type::String:
+        // 1. If va is code unit less than vb, then return -1.
+        // 2. If vb is code unit less than va, then return 1.
+        // 3. Return 0.
+        return compare_code_units(a.string_value(), b.string_value());
+    case Type::Binary: {
+        // 1. If va is byte less than vb, then return -1.
+        // 2. If vb is byte less than va, then return 1.
+        // 3. Return 0.
+        auto va = a.binary_value().bytes();
+        auto vb = b.binary_value().bytes();
+        auto length = min(va.size(), vb.size());
+        if (length > 0) {
+            if (auto result = __builtin_memcmp(va.data(), vb.data(), length); result != 0)
+                return result < 0 ? -1 : 1;
+        }
+        if (va.size() == vb.size())
+            return 0;
+        return va.size() < vb.size() ? -1 : 1;
+    }
+    case Type::Array: {
+        auto const& va = a.array_value();
+        auto const& vb = b.array_value();
+
+        // 1. Let length be the lesser of va's size and vb's size.
+        auto length = min(va.size(), vb.size());
+
+        // 2. Let i be 0.
+        // 3. While i is less than length, then:
+        for (size_t i = 0; i < length; ++i) {
+            // 1. Let c be the result of recursively comparing two keys with va[i] and vb[i].
+            // 2. If c is not 0, return c.
+            if (auto c = compare(va[i], vb[i]); c != 0)
+                return c;
+        }
+
+        // 4. If va's size is greater than vb's size, then return 1.
+        // 5. If va's size is less than vb's size, then return -1.
+        // 6. Return 0.
+        if (va.size() > vb.size())
+            return 1;
+        if (va.size() < vb.size())
+            return -1;
+        return 0;
+    }
+    }
+    VERIFY_NOT_REACHED();
+}
+
+// Keys are encoded as their type, followed by the number, or a length and the contents. Numbers are stored in the
+// native byte order, as the files they end up in never leave the machine.
+void Key::encode(ByteBuffer& buffer) const
+{
+    buffer.append(to_underlying(m_type));
+
+    auto append_length = [&](size_t length) {
+        auto length_u32 = static_cast<u32>(length);
+        buffer.append(&length_u32, sizeof(length_u32));
+    };
+
+    switch (m_type) {
+    case Type::Number:
+    case Type::Date: {
+        auto value = number_value();
+        buffer.append(&value, sizeof(value));
+        break;
+    }
+    case Type::String:
+        append_length(string_value().bytes().size());
+        buffer.append(string_value().bytes());
+        break;
+    case Type::Binary:
+        append_length(binary_value().size());
+        buffer.append(binary_value().bytes());
+        break;
+    case Type::Array:
+        append_length(array_value().size());
+        for (auto const& key : array_value())
+            key.encode(buffer);
+        break;
+    }
+}
+
+ErrorOr<Key> Key::decode(ReadonlyBytes bytes, size_t& offset)
+{
+    auto read = [&](void* destination, size_t size) -> ErrorOr<void> {
+        if (offset + size > bytes.size())
+            return Error::from_string_literal("Unexpected end of key data");
+        __builtin_memcpy(destination, bytes.offset_pointer(offset), size);
+        offset += size;
+        return {};
+    };
+
+    u8 type = 0;
+    TRY(read(&type, sizeof(type)));
+
+    if (type == to_underlying(Type::Number) || type == to_underlying(Type::Date)) {
+        double value = 0;
+        TRY(read(&value, sizeof(value)));
+        return Key(static_cast<Type>(type), value);
+    }
+
+    u32 length = 0;
+    TRY(read(&length, sizeof(length)));
+
+    switch (static_cast<Type>(type)) {
+    case Type::String:
+    case Type::Binary: {
+        if (offset + length > bytes.size())
+            return Error::from_string_literal("Unexpected end of key data");
+        auto data = bytes.slice(offset, length);
+        offset += length;
+
+        if (type == to_underlying(Type::String))
+            return string(TRY(String::from_utf8(StringView { data })));
+        return binary(TRY(ByteBuffer::copy(data)));
+    }
+    case Type::Array: {
+        Vector<Key> keys;
+        TRY(keys.try_ensure_capacity(min<size_t>(length, bytes.size() - offset)));
+        for (u32 i = 0; i < length; ++i)
+            TRY(keys.try_append(TRY(decode(bytes, offset))));
+        return array(move(keys));
+    }
+    default:
+        return Error::from_string_literal("Invalid key type");
+    }
+}
+
+// https://w3c.github.io/IndexedDB/#in
+bool KeyRange::is_below_lower_bound(Key const& key) const
+{
+    // A key is in a key range range if both of the following conditions are fulfilled:
+    // * The range's lower bound is null, or it is less than key, or it is both equal to key and the range's lower
+    //   open flag is false.
+    if (!lower.has_value())
+        return false;
+    auto result = Key::compare(*lower, key);
+    return result > 0 || (result == 0 && lower_open);
+}
+
+bool KeyRange::is_above_upper_bound(Key const& key) const
+{
+    // * The range's upper bound is null, or it is greater than key, or it is both equal to key and the range's upper
+    //   open flag is false.
+    if (!upper.has_value())
+        return false;
+    auto result = Key::compare(*upper, key);
+    return result < 0 || (result == 0 && upper_open);
+}
+
+}
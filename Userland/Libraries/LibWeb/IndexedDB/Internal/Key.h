@@ -0,0 +1,81 @@
+/*
+ * Copyright (c) 2024, the SerenityOS developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/ByteBuffer.h>
+#include <AK/String.h>
+#include <AK/Variant.h>
+#include <AK/Vector.h>
+
+namespace Web::IndexedDB {
+
+// https://w3c.github.io/IndexedDB/#key-construct
+class Key {
+public:
+    // Keys of different types are ordered by their type, in the order listed here.
+    enum class Type : u8 {
+        Number,
+        Date,
+        String,
+        Binary,
+        Array,
+    };
+
+    static Key number(double value) { return Key(Type::Number, value); }
+    static Key date(double value) { return Key(Type::Date, value); }
+    static Key string(String value) { return Key(Type::String, move(value)); }
+    static Key binary(ByteBuffer value) { return Key(Type::Binary, move(value)); }
+    static Key array(Vector<Key> value) { return Key(Type::Array, move(value)); }
+
+    Type type() const { return m_type; }
+
+    double number_value() const { return m_value.get<double>(); }
+    String const& string_value() const { return m_value.get<String>(); }
+    ByteBuffer const& binary_value() const { return m_value.get<ByteBuffer>(); }
+    Vector<Key> const& array_value() const { return m_value.get<Vector<Key>>(); }
+
+    // https://w3c.github.io/IndexedDB/#compare-two-keys
+    static int compare(Key const&, Key const&);
+
+    bool operator==(Key const& other) const { return compare(*this, other) == 0; }
+
+    void encode(ByteBuffer&) const;
+    static ErrorOr<Key> decode(ReadonlyBytes, size_t& offset);
+
+private:
+    using Value = Variant<double, String, ByteBuffer, Vector<Key>>;
+
+    Key(Type type, Value value)
+        : m_type(type)
+        , m_value(move(value))
+    {
+    }
+
+    Type m_type;
+    Value m_value;
+};
+
+// https://w3c.github.io/IndexedDB/#range-construct
+struct KeyRange {
+    Optional<Key> lower;
+    Optional<Key> upper;
+    bool lower_open { false };
+    bool upper_open { false };
+
+    static KeyRange only(Key key) { return { key, key, false, false }; }
+    static KeyRange unbounded() { return {}; }
+
+    // https://w3c.github.io/IndexedDB/#in
+    bool contains(Key const& key) const { return !is_below_lower_bound(key) && !is_above_upper_bound(key); }
+
+    // Whether the key is out of the range because of its lower or its upper bound. Keys are below the lower bound
+    // for a prefix of all keys, which makes this a predicate for BTree searches.
+    bool is_below_lower_bound(Key const&) const;
+    bool is_above_upper_bound(Key const&) const;
+};
+
+}
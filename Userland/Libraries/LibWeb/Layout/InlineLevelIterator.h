@@ -32,7 +32,7 @@ public:
         };
         Type type {};
         JS::GCPtr<Layout::Node const> node {};
-        Vector<Gfx::DrawGlyphOrEmoji> glyph_run {};
+        RefPtr<Gfx::GlyphRun> glyph_run {};
         size_t offset_in_node { 0 };
         size_t length_in_node { 0 };
         CSSPixels width { 0.0f };
@@ -83,8 +83,8 @@ private:
         bool do_respect_linebreaks {};
         bool is_first_chunk {};
         bool is_last_chunk {};
-        TextNode::ChunkIterator chunk_iterator;
-        Optional<TextNode::Chunk> next_chunk {};
+        ReadonlySpan<TextNode::ShapedChunk> chunks;
+        size_t next_chunk_index { 0 };
     };
 
     Optional<TextNodeContext> m_text_node_context;
@@ -40,6 +40,14 @@ CSSPixelRect const LineBoxFragment::absolute_rect() const
     return rect;
 }
 
+Gfx::GlyphRun& LineBoxFragment::mutable_glyph_run()
+{
+    // Copy on write, so that we never modify a glyph run that's also in use elsewhere.
+    if (m_glyph_run->ref_count() > 1)
+        m_glyph_run = adopt_ref(*new Gfx::GlyphRun(Vector<Gfx::DrawGlyphOrEmoji>(m_glyph_run->glyphs())));
+    return *m_glyph_run;
+}
+
 bool LineBoxFragment::is_atomic_inline() const
 {
     return layout_node().is_replaced_box() || (layout_node().display().is_inline_outside() && !layout_node().display().is_flow_inside());
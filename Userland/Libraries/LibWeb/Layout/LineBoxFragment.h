@@ -19,14 +19,16 @@ class LineBoxFragment {
     friend class LineBox;
 
 public:
-    LineBoxFragment(Node const& layout_node, int start, int length, CSSPixelPoint offset, CSSPixelSize size, CSSPixels border_box_top, Vector<Gfx::DrawGlyphOrEmoji> glyphs)
+    // NOTE: The glyph run may be shared with the shaping cache of the text node, and is only copied once the fragment
+    //       needs to extend it.
+    LineBoxFragment(Node const& layout_node, int start, int length, CSSPixelPoint offset, CSSPixelSize size, CSSPixels border_box_top, RefPtr<Gfx::GlyphRun> glyph_run)
         : m_layout_node(layout_node)
         , m_start(start)
         , m_length(length)
         , m_offset(offset)
         , m_size(size)
         , m_border_box_top(border_box_top)
-        , m_glyph_run(adopt_ref(*new Gfx::GlyphRun(move(glyphs))))
+        , m_glyph_run(glyph_run ? glyph_run.release_nonnull() : adopt_ref(*new Gfx::GlyphRun))
     {
     }
 
@@ -69,6 +71,8 @@ private:
     CSSPixelSize m_size;
     CSSPixels m_border_box_top { 0 };
     CSSPixels m_baseline { 0 };
+    Gfx::GlyphRun& mutable_glyph_run();
+
     NonnullRefPtr<Gfx::GlyphRun> m_glyph_run;
 };
 
@@ -304,6 +304,47 @@ static ErrorOr<String> apply_text_transform(String const& string, CSS::TextTrans
 void TextNode::invalidate_text_for_rendering()
 {
     m_text_for_rendering = {};
+    m_shaped_chunks_cache = {};
+}
+
+Vector<TextNode::ShapedChunk> const& TextNode::shaped_chunks(bool wrap_lines, bool respect_linebreaks) const
+{
+    auto const& font_list = computed_values().font_list();
+
+    // NOTE: Every style update creates a new font list, so compare them by their fonts rather than by identity.
+    if (m_shaped_chunks_cache.has_value()) {
+        auto const& cache = *m_shaped_chunks_cache;
+        if (cache.wrap_lines == wrap_lines && cache.respect_linebreaks == respect_linebreaks && (cache.font_list.ptr() == &font_list || cache.font_list->equals(font_list)))
+            return cache.chunks;
+    }
+
+    Vector<ShapedChunk> chunks;
+    ChunkIterator iterator { text_for_rendering(), wrap_lines, respect_linebreaks };
+
+    for (auto chunk = iterator.next(); chunk.has_value(); chunk = iterator.next()) {
+        Vector<Gfx::DrawGlyphOrEmoji> glyphs;
+        float width = 0;
+
+        // Forced line breaks are never drawn, so there's no need to shape them.
+        if (!respect_linebreaks || !chunk->has_breaking_newline) {
+            Gfx::for_each_glyph_position(
+                { 0, 0 }, chunk->view, font_list, [&](Gfx::DrawGlyphOrEmoji const& glyph_or_emoji) {
+                    glyphs.append(glyph_or_emoji);
+                    return IterationDecision::Continue;
+                },
+                Gfx::IncludeLeftBearing::No, width);
+        }
+
+        chunks.append({ .chunk = *chunk, .glyph_run = adopt_ref(*new Gfx::GlyphRun(move(glyphs))), .width = width });
+    }
+
+    m_shaped_chunks_cache = ShapedChunksCache {
+        .wrap_lines = wrap_lines,
+        .respect_linebreaks = respect_linebreaks,
+        .font_list = font_list,
+        .chunks = move(chunks),
+    };
+    return m_shaped_chunks_cache->chunks;
 }
 
 String const& TextNode::text_for_rendering() const
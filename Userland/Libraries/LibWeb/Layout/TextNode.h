@@ -7,6 +7,8 @@
 #pragma once
 
 #include <AK/Utf8View.h>
+#include <LibGfx/FontCascadeList.h>
+#include <LibGfx/TextLayout.h>
 #include <LibWeb/DOM/Text.h>
 #include <LibWeb/Layout/Node.h>
 
@@ -48,6 +50,17 @@ public:
         Utf8View::Iterator m_iterator;
     };
 
+    struct ShapedChunk {
+        Chunk chunk;
+        // Shared with the line box fragments this chunk ends up in, so it must not be modified.
+        NonnullRefPtr<Gfx::GlyphRun> glyph_run;
+        float width { 0 };
+    };
+
+    // Returns the chunks of text_for_rendering() along with their glyphs and widths. These are cached, so that
+    // relayouts don't have to segment and shape the text again unless its text, font or white-space changed.
+    Vector<ShapedChunk> const& shaped_chunks(bool wrap_lines, bool respect_linebreaks) const;
+
     void invalidate_text_for_rendering();
     void compute_text_for_rendering();
 
@@ -57,6 +70,14 @@ private:
     virtual bool is_text_node() const final { return true; }
 
     Optional<String> m_text_for_rendering;
+
+    struct ShapedChunksCache {
+        bool wrap_lines { false };
+        bool respect_linebreaks { false };
+        NonnullRefPtr<Gfx::FontCascadeList const> font_list;
+        Vector<ShapedChunk> chunks;
+    };
+    mutable Optional<ShapedChunksCache> m_shaped_chunks_cache;
 };
 
 template<>
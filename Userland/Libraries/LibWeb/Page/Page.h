@@ -12,6 +12,7 @@
 #include <AK/Noncopyable.h>
 #include <AK/OwnPtr.h>
 #include <AK/RefPtr.h>
+#include <AK/Time.h>
 #include <AK/WeakPtr.h>
 #include <AK/Weakable.h>
 #include <Kernel/API/KeyCode.h>
@@ -185,6 +186,18 @@ public:
     void find_in_page_next_match();
     void find_in_page_previous_match();
 
+    // Time spent in the rendering pipeline of this page's documents, used by tooling to attribute page load costs.
+    struct RenderingStatistics {
+        Duration style_update_time;
+        Duration layout_time;
+        Duration paint_time;
+        u32 style_update_count { 0 };
+        u32 layout_count { 0 };
+        u32 paint_count { 0 };
+    };
+    RenderingStatistics& rendering_statistics() { return m_rendering_statistics; }
+    RenderingStatistics take_rendering_statistics() { return exchange(m_rendering_statistics, {}); }
+
 private:
     explicit Page(JS::NonnullGCPtr<PageClient>);
     virtual void visit_edges(Visitor&) override;
@@ -236,6 +249,8 @@ private:
     bool m_pdf_viewer_supported { false };
     size_t m_find_in_page_match_index { 0 };
     Vector<JS::NonnullGCPtr<DOM::Range>> m_find_in_page_matches;
+
+    RenderingStatistics m_rendering_statistics;
 };
 
 struct PaintOptions {
@@ -4,6 +4,8 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <LibCore/AllocationTracker.h>
+#include <LibCore/Tracing.h>
 #include <LibWeb/Painting/CommandList.h>
 
 namespace Web::Painting {
@@ -78,6 +80,9 @@ void CommandList::mark_unnecessary_commands()
 
 void CommandList::execute(CommandExecutor& executor)
 {
+    Core::Tracing::ScopedEvent trace_event { "Painting"sv, "CommandList::execute"sv };
+    Core::AllocationTracker::ScopedTag allocation_tag { "Painting"sv };
+
     executor.prepare_to_execute(m_corner_clip_max_depth);
 
     if (executor.needs_prepare_glyphs_texture()) {
@@ -196,6 +196,9 @@ TraversalDecision InlinePaintable::hit_test(CSSPixelPoint position, HitTestType
     if (enclosing_scroll_frame_offset().has_value())
         position_adjusted_by_scroll_offset.translate_by(-enclosing_scroll_frame_offset().value());
 
+    if (type == HitTestType::Exact && hit_test_bounds().has_value() && !hit_test_bounds()->contains(position_adjusted_by_scroll_offset))
+        return TraversalDecision::Continue;
+
     for (auto const& fragment : m_fragments) {
         if (fragment.paintable().stacking_context())
             continue;
@@ -139,6 +139,11 @@ public:
 
     [[nodiscard]] virtual TraversalDecision hit_test(CSSPixelPoint, HitTestType, Function<TraversalDecision(HitTestResult)> const& callback) const;
 
+    // The union of every rect in this subtree that an exact hit test can land on, relative to this paintable's
+    // enclosing scroll frame. Empty if the subtree can't be bounded, e.g. because part of it scrolls separately.
+    Optional<CSSPixelRect> const& hit_test_bounds() const { return m_hit_test_bounds; }
+    void set_hit_test_bounds(Optional<CSSPixelRect> bounds) { m_hit_test_bounds = bounds; }
+
     virtual bool wants_mouse_events() const { return false; }
 
     virtual bool forms_unconnected_subtree() const { return false; }
@@ -227,6 +232,8 @@ private:
 
     OwnPtr<StackingContext> m_stacking_context;
 
+    Optional<CSSPixelRect> m_hit_test_bounds;
+
     SelectionState m_selection_state { SelectionState::None };
 
     bool m_positioned : 1 { false };
@@ -872,9 +872,13 @@ TraversalDecision PaintableBox::hit_test(CSSPixelPoint position, HitTestType typ
         viewport_paintable.document().update_paint_and_hit_testing_properties_if_needed();
         viewport_paintable.refresh_scroll_state();
         viewport_paintable.refresh_clip_state();
+        viewport_paintable.update_hit_test_bounds_if_needed();
         return stacking_context()->hit_test(position, type, callback);
     }
 
+    if (type == HitTestType::Exact && hit_test_bounds().has_value() && !hit_test_bounds()->contains(position_adjusted_by_scroll_offset))
+        return TraversalDecision::Continue;
+
     for (auto const* child = last_child(); child; child = child->previous_sibling()) {
         auto z_index = child->computed_values().z_index();
         if (child->layout_node().is_positioned() && z_index.value_or(0) == 0)
@@ -918,6 +922,10 @@ TraversalDecision PaintableWithLines::hit_test(CSSPixelPoint position, HitTestTy
         return PaintableBox::hit_test(position, type, callback);
     }
 
+    // NOTE: Text cursor hit tests can land on fragments outside the position, so they can't be culled.
+    if (type == HitTestType::Exact && hit_test_bounds().has_value() && !hit_test_bounds()->contains(position_adjusted_by_scroll_offset))
+        return TraversalDecision::Continue;
+
     if (hit_test_scrollbars(position_adjusted_by_scroll_offset, callback) == TraversalDecision::Break)
         return TraversalDecision::Break;
 
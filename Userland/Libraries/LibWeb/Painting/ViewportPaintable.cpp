@@ -69,6 +69,9 @@ void ViewportPaintable::paint_all_phases(PaintContext& context)
 
 void ViewportPaintable::assign_scroll_frames()
 {
+    // Hit test bounds are relative to the enclosing scroll frame, so they have to be recomputed whenever those change.
+    m_needs_to_update_hit_test_bounds = true;
+
     int next_id = 0;
     for_each_in_subtree_of_type<PaintableBox>([&](auto const& paintable_box) {
         if (paintable_box.has_scrollable_overflow()) {
@@ -96,6 +99,61 @@ void ViewportPaintable::assign_scroll_frames()
     });
 }
 
+static Optional<int> scroll_frame_id_of(Paintable const& paintable)
+{
+    if (paintable.is_paintable_box())
+        return static_cast<PaintableBox const&>(paintable).scroll_frame_id();
+    if (paintable.is_inline_paintable())
+        return static_cast<InlinePaintable const&>(paintable).scroll_frame_id();
+    return {};
+}
+
+static Optional<CSSPixelRect> compute_hit_test_bounds(Paintable const& paintable)
+{
+    // NOTE: This must cover every rect that the hit_test() overrides can report a hit in, or hit testing will miss it.
+    CSSPixelRect bounds;
+    if (paintable.is_paintable_box())
+        bounds = static_cast<PaintableBox const&>(paintable).absolute_border_box_rect();
+    if (paintable.is_paintable_with_lines()) {
+        for (auto const& fragment : static_cast<PaintableWithLines const&>(paintable).fragments())
+            bounds = bounds.united(fragment.absolute_rect());
+    } else if (paintable.is_inline_paintable()) {
+        for (auto const& fragment : static_cast<InlinePaintable const&>(paintable).fragments())
+            bounds = bounds.united(fragment.absolute_rect());
+    }
+
+    auto scroll_frame_id = scroll_frame_id_of(paintable);
+    bool is_bounded = true;
+
+    for (auto const* child = paintable.first_child(); child; child = child->next_sibling()) {
+        auto child_bounds = compute_hit_test_bounds(*child);
+        const_cast<Paintable&>(*child).set_hit_test_bounds(child_bounds);
+
+        // Children in a different scroll frame can move relative to us without a relayout.
+        bool child_scrolls_separately = (child->is_paintable_box() || child->is_inline_paintable()) && scroll_frame_id_of(*child) != scroll_frame_id;
+        if (!child_bounds.has_value() || child_scrolls_separately) {
+            is_bounded = false;
+            continue;
+        }
+        bounds = bounds.united(*child_bounds);
+    }
+
+    if (!is_bounded)
+        return {};
+    return bounds;
+}
+
+void ViewportPaintable::update_hit_test_bounds_if_needed()
+{
+    if (!m_needs_to_update_hit_test_bounds)
+        return;
+    m_needs_to_update_hit_test_bounds = false;
+
+    // NOTE: The viewport hit tests through its stacking context, which these bounds don't account for.
+    (void)compute_hit_test_bounds(*this);
+    set_hit_test_bounds({});
+}
+
 void ViewportPaintable::assign_clip_frames()
 {
     for_each_in_subtree_of_type<PaintableBox>([&](auto const& paintable_box) {
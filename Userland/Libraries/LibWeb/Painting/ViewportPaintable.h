@@ -31,6 +31,8 @@ public:
 
     void resolve_paint_only_properties();
 
+    void update_hit_test_bounds_if_needed();
+
     JS::GCPtr<Selection::Selection> selection() const;
     void recompute_selection_states();
 
@@ -48,6 +50,7 @@ private:
 
     bool m_needs_to_refresh_clip_state { true };
     bool m_needs_to_refresh_scroll_state { true };
+    bool m_needs_to_update_hit_test_bounds { true };
 };
 
 }
@@ -305,7 +305,7 @@ JS::ThrowCompletionOr<NonnullRefPtr<CompiledWebAssemblyModule>> parse_module(JS:
     ReadonlyBytes data;
     if (is<JS::ArrayBuffer>(buffer_object)) {
         auto& buffer = static_cast<JS::ArrayBuffer&>(*buffer_object);
-        data = buffer.buffer();
+        data = buffer.bytes();
     } else if (is<JS::TypedArrayBase>(buffer_object)) {
         auto& buffer = static_cast<JS::TypedArrayBase&>(*buffer_object);
 
@@ -313,7 +313,7 @@ JS::ThrowCompletionOr<NonnullRefPtr<CompiledWebAssemblyModule>> parse_module(JS:
         if (JS::is_typed_array_out_of_bounds(typed_array_record))
             return vm.throw_completion<JS::TypeError>(JS::ErrorType::BufferOutOfBounds, "TypedArray"sv);
 
-        data = buffer.viewed_array_buffer()->buffer().span().slice(buffer.byte_offset(), JS::typed_array_byte_length(typed_array_record));
+        data = buffer.viewed_array_buffer()->bytes().slice(buffer.byte_offset(), JS::typed_array_byte_length(typed_array_record));
     } else if (is<JS::DataView>(buffer_object)) {
         auto& buffer = static_cast<JS::DataView&>(*buffer_object);
 
@@ -321,7 +321,7 @@ JS::ThrowCompletionOr<NonnullRefPtr<CompiledWebAssemblyModule>> parse_module(JS:
         if (JS::is_view_out_of_bounds(view_record))
             return vm.throw_completion<JS::TypeError>(JS::ErrorType::BufferOutOfBounds, "DataView"sv);
 
-        data = buffer.viewed_array_buffer()->buffer().span().slice(buffer.byte_offset(), JS::get_view_byte_length(view_record));
+        data = buffer.viewed_array_buffer()->bytes().slice(buffer.byte_offset(), JS::get_view_byte_length(view_record));
     } else {
         return vm.throw_completion<JS::TypeError>("Not a BufferSource"sv);
     }
@@ -0,0 +1,65 @@
+/*
+ * Copyright (c) 2024, the SerenityOS developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibWeb/WebAudio/AudioBus.h>
+#include <LibWeb/WebAudio/DSP.h>
+
+namespace Web::WebAudio {
+
+void AudioBus::zero()
+{
+    if (m_is_silent)
+        return;
+
+    for (size_t i = 0; i < m_channel_count; ++i)
+        m_channels[i].fill(0);
+    m_is_silent = true;
+}
+
+void AudioBus::copy_from(AudioBus const& other)
+{
+    set_channel_count(other.channel_count());
+    for (size_t i = 0; i < m_channel_count; ++i)
+        other.channel(i).copy_to(channel(i));
+    m_is_silent = other.is_silent();
+}
+
+// https://webaudio.github.io/web-audio-api/#channel-up-mixing-and-down-mixing
+void AudioBus::mix_from(AudioBus const& other, Bindings::ChannelInterpretation interpretation)
+{
+    if (other.is_silent())
+        return;
+
+    // Any channel of this bus that was previously silent still holds zeroes, so mixing into it is a plain addition.
+    m_is_silent = false;
+
+    auto input_channels = other.channel_count();
+    auto output_channels = channel_count();
+
+    if (interpretation == Bindings::ChannelInterpretation::Speakers) {
+        // Up-mixing from mono: output.L = input.M, output.R = input.M
+        if (input_channels == 1 && output_channels == 2) {
+            DSP::add(channel(0), other.channel(0));
+            DSP::add(channel(1), other.channel(0));
+            return;
+        }
+
+        // Down-mixing from stereo: output.M = 0.5 * (input.L + input.R)
+        if (input_channels == 2 && output_channels == 1) {
+            DSP::add_scaled(channel(0), other.channel(0), 0.5f);
+            DSP::add_scaled(channel(0), other.channel(1), 0.5f);
+            return;
+        }
+
+        // FIXME: Implement the mixing rules for quad and 5.1 layouts. Until then, they are mixed as discrete channels.
+    }
+
+    // Discrete: Fill the output channels with the input channels in order, dropping or leaving silent the rest.
+    for (size_t i = 0; i < min(input_channels, output_channels); ++i)
+        DSP::add(channel(i), other.channel(i));
+}
+
+}
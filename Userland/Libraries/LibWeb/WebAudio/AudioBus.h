@@ -0,0 +1,73 @@
+/*
+ * Copyright (c) 2024, the SerenityOS developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/Array.h>
+#include <AK/Span.h>
+#include <AK/Vector.h>
+#include <LibWeb/Bindings/AudioNodePrototype.h>
+
+namespace Web::WebAudio {
+
+// https://webaudio.github.io/web-audio-api/#render-quantum
+static constexpr size_t render_quantum_size = 128;
+
+// One render quantum of audio, with one buffer of samples per channel.
+//
+// Channel storage is never released when the channel count goes down, so that a bus reused for every render quantum
+// stops allocating once it has seen its largest channel count.
+class AudioBus {
+public:
+    using Channel = Array<float, render_quantum_size>;
+
+    explicit AudioBus(size_t channel_count = 1)
+    {
+        set_channel_count(channel_count);
+    }
+
+    size_t channel_count() const { return m_channel_count; }
+    void set_channel_count(size_t channel_count)
+    {
+        // Channels that come back into use may still hold samples from before they were dropped.
+        for (size_t i = m_channel_count; i < min(channel_count, m_channels.size()); ++i)
+            m_channels[i].fill(0);
+        while (m_channels.size() < channel_count)
+            m_channels.append(Channel {});
+        m_channel_count = channel_count;
+    }
+
+    Span<float> channel(size_t index)
+    {
+        VERIFY(index < m_channel_count);
+        return m_channels[index].span();
+    }
+
+    ReadonlySpan<float> channel(size_t index) const
+    {
+        VERIFY(index < m_channel_count);
+        return m_channels[index].span();
+    }
+
+    // A silent bus holds only zeroes, which lets nodes skip processing it.
+    bool is_silent() const { return m_is_silent; }
+    void set_silent(bool silent) { m_is_silent = silent; }
+
+    void zero();
+
+    // Mixes the other bus into this one, up-mixing or down-mixing its channels to this bus's channel count.
+    // https://webaudio.github.io/web-audio-api/#channel-up-mixing-and-down-mixing
+    void mix_from(AudioBus const&, Bindings::ChannelInterpretation);
+
+    void copy_from(AudioBus const&);
+
+private:
+    Vector<Channel> m_channels;
+    size_t m_channel_count { 0 };
+    bool m_is_silent { true };
+};
+
+}
@@ -4,11 +4,14 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <LibAudio/PlaybackStream.h>
+#include <LibCore/ThreadedPromise.h>
 #include <LibWeb/Bindings/AudioContextPrototype.h>
 #include <LibWeb/Bindings/Intrinsics.h>
 #include <LibWeb/DOM/Event.h>
 #include <LibWeb/HTML/HTMLMediaElement.h>
 #include <LibWeb/HTML/Window.h>
+#include <LibWeb/Platform/Timer.h>
 #include <LibWeb/WebAudio/AudioContext.h>
 #include <LibWeb/WebIDL/Promise.h>
 
@@ -65,7 +68,9 @@ AudioContext::AudioContext(JS::Realm& realm, AudioContextOptions const& context_
     // FIXME: 5: If the context is allowed to start, send a control message to start processing.
     // FIXME: Implement control message queue to run following steps on the rendering thread
     if (m_allowed_to_start) {
-        // FIXME: 5.1: Attempt to acquire system resources. In case of failure, abort the following steps.
+        // 5.1: Attempt to acquire system resources. In case of failure, abort the following steps.
+        if (!start_rendering_audio_graph())
+            return;
 
         // 5.2: Set the [[rendering thread state]] to "running" on the AudioContext.
         BaseAudioContext::set_rendering_state(Bindings::AudioContextState::Running);
@@ -220,7 +225,8 @@ WebIDL::ExceptionOr<JS::NonnullGCPtr<JS::Promise>> AudioContext::suspend()
     // 7. Queue a control message to suspend the AudioContext.
     // FIXME: Implement control message queue to run following steps on the rendering thread
 
-    // FIXME: 7.1: Attempt to release system resources.
+    // 7.1: Attempt to release system resources.
+    stop_rendering_audio_graph();
 
     // 7.2: Set the [[rendering thread state]] on the AudioContext to suspended.
     set_rendering_state(Bindings::AudioContextState::Suspended);
@@ -271,7 +277,10 @@ WebIDL::ExceptionOr<JS::NonnullGCPtr<JS::Promise>> AudioContext::close()
     // 5. Queue a control message to close the AudioContext.
     // FIXME: Implement control message queue to run following steps on the rendering thread
 
-    // FIXME: 5.1: Attempt to release system resources.
+    // 5.1: Attempt to release system resources.
+    stop_rendering_audio_graph();
+    m_playback_stream = nullptr;
+    m_ended_events_timer = nullptr;
 
     // 5.2: Set the [[rendering thread state]] to "suspended".
     set_rendering_state(Bindings::AudioContextState::Suspended);
@@ -298,17 +307,49 @@ WebIDL::ExceptionOr<JS::NonnullGCPtr<JS::Promise>> AudioContext::close()
     return JS::NonnullGCPtr { verify_cast<JS::Promise>(*promise->promise()) };
 }
 
-void AudioContext::queue_a_media_element_task(Function<void()> steps)
+bool AudioContext::start_rendering_audio_graph()
 {
-    auto task = HTML::Task::create(vm(), m_media_element_event_task_source.source, HTML::current_settings_object().responsible_document(), JS::create_heap_function(heap(), move(steps)));
-    HTML::main_thread_event_loop().task_queue().add(move(task));
+    // The destination is stereo, to match the playback stream.
+    static constexpr u8 channel_count = 2;
+    // FIXME: Derive this from the latency hint.
+    static constexpr u32 target_latency_ms = 50;
+
+    if (!m_playback_stream) {
+        auto stream = Audio::PlaybackStream::create(Audio::OutputState::Playing, sample_rate(), channel_count, target_latency_ms,
+            [graph = NonnullRefPtr { render_graph() }](Bytes buffer, Audio::PcmSampleFormat format, size_t sample_count) -> ReadonlyBytes {
+                VERIFY(format == Audio::PcmSampleFormat::Float32);
+
+                Span<float> samples { reinterpret_cast<float*>(buffer.data()), sample_count * channel_count };
+                graph->render_interleaved(samples, channel_count);
+                return buffer.trim(samples.size() * sizeof(float));
+            });
+        if (stream.is_error()) {
+            dbgln("Failed to create an audio stream for AudioContext: {}", stream.error());
+            return false;
+        }
+        m_playback_stream = stream.release_value();
+    } else {
+        m_playback_stream->resume();
+    }
+
+    // The rendering thread never calls back into JS, so source nodes that have ended are looked for on this thread.
+    if (!m_ended_events_timer)
+        m_ended_events_timer = Platform::Timer::create_repeating(50, [weak_this = make_weak_ptr()] {
+            if (!weak_this)
+                return;
+            static_cast<AudioContext*>(weak_this.ptr())->queue_ended_events();
+        });
+    m_ended_events_timer->start();
+
+    return true;
 }
 
-// FIXME: Actually implement the rendering thread
-bool AudioContext::start_rendering_audio_graph()
+void AudioContext::stop_rendering_audio_graph()
 {
-    bool render_result = true;
-    return render_result;
+    if (m_playback_stream)
+        m_playback_stream->discard_buffer_and_suspend();
+    if (m_ended_events_timer)
+        m_ended_events_timer->stop();
 }
 
 }
@@ -6,6 +6,7 @@
 
 #pragma once
 
+#include <LibAudio/Forward.h>
 #include <LibWeb/Bindings/AudioContextPrototype.h>
 #include <LibWeb/HighResolutionTime/DOMHighResTimeStamp.h>
 #include <LibWeb/WebAudio/BaseAudioContext.h>
@@ -52,10 +53,13 @@ private:
     Vector<JS::NonnullGCPtr<WebIDL::Promise>> m_pending_promises;
     Vector<JS::NonnullGCPtr<WebIDL::Promise>> m_pending_resume_promises;
     bool m_suspended_by_user = false;
-    HTML::UniqueTaskSource m_media_element_event_task_source {};
 
-    void queue_a_media_element_task(Function<void()> steps);
+    // The rendering thread is the thread on which the playback stream asks for more audio.
+    RefPtr<Audio::PlaybackStream> m_playback_stream;
+    RefPtr<Platform::Timer> m_ended_events_timer;
+
     bool start_rendering_audio_graph();
+    void stop_rendering_audio_graph();
 };
 
 }
@@ -0,0 +1,38 @@
+/*
+ * Copyright (c) 2024, the SerenityOS developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibWeb/Bindings/Intrinsics.h>
+#include <LibWeb/WebAudio/AudioDestinationNode.h>
+#include <LibWeb/WebAudio/BaseAudioContext.h>
+#include <LibWeb/WebAudio/RenderNodes.h>
+
+namespace Web::WebAudio {
+
+JS_DEFINE_ALLOCATOR(AudioDestinationNode);
+
+AudioDestinationNode::~AudioDestinationNode() = default;
+
+JS::NonnullGCPtr<AudioDestinationNode> AudioDestinationNode::create(JS::Realm& realm, JS::NonnullGCPtr<BaseAudioContext> context, WebIDL::UnsignedLong channel_count)
+{
+    return realm.vm().heap().allocate<AudioDestinationNode>(realm, realm, context, channel_count);
+}
+
+AudioDestinationNode::AudioDestinationNode(JS::Realm& realm, JS::NonnullGCPtr<BaseAudioContext> context, WebIDL::UnsignedLong channel_count)
+    : AudioNode(realm, context)
+    , m_max_channel_count(channel_count)
+{
+    auto render_node = AudioDestinationRenderNode::create(channel_count);
+    context->render_graph().set_destination(render_node);
+    set_render_node(move(render_node));
+}
+
+void AudioDestinationNode::initialize(JS::Realm& realm)
+{
+    Base::initialize(realm);
+    WEB_SET_PROTOTYPE_FOR_INTERFACE(AudioDestinationNode);
+}
+
+}
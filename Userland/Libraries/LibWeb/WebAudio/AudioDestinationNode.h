@@ -0,0 +1,36 @@
+/*
+ * Copyright (c) 2024, the SerenityOS developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <LibWeb/Bindings/AudioDestinationNodePrototype.h>
+#include <LibWeb/WebAudio/AudioNode.h>
+
+namespace Web::WebAudio {
+
+// https://webaudio.github.io/web-audio-api/#AudioDestinationNode
+class AudioDestinationNode : public AudioNode {
+    WEB_PLATFORM_OBJECT(AudioDestinationNode, AudioNode);
+    JS_DECLARE_ALLOCATOR(AudioDestinationNode);
+
+public:
+    virtual ~AudioDestinationNode() override;
+
+    static JS::NonnullGCPtr<AudioDestinationNode> create(JS::Realm&, JS::NonnullGCPtr<BaseAudioContext>, WebIDL::UnsignedLong channel_count);
+
+    // https://webaudio.github.io/web-audio-api/#dom-audiodestinationnode-maxchannelcount
+    WebIDL::UnsignedLong max_channel_count() const { return m_max_channel_count; }
+
+protected:
+    AudioDestinationNode(JS::Realm&, JS::NonnullGCPtr<BaseAudioContext>, WebIDL::UnsignedLong channel_count);
+
+    virtual void initialize(JS::Realm&) override;
+
+private:
+    WebIDL::UnsignedLong m_max_channel_count { 0 };
+};
+
+}
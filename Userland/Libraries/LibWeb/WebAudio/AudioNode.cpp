@@ -6,6 +6,7 @@
 
 #include <LibWeb/Bindings/Intrinsics.h>
 #include <LibWeb/WebAudio/AudioNode.h>
+#include <LibWeb/WebAudio/AudioParam.h>
 #include <LibWeb/WebAudio/BaseAudioContext.h>
 
 namespace Web::WebAudio {
@@ -15,79 +16,234 @@ JS_DEFINE_ALLOCATOR(AudioNode);
 AudioNode::AudioNode(JS::Realm& realm, JS::NonnullGCPtr<BaseAudioContext> context)
     : DOM::EventTarget(realm)
     , m_context(context)
-
+    , m_render_graph(context->render_graph())
 {
 }
 
 AudioNode::~AudioNode() = default;
 
+void AudioNode::set_render_node(NonnullRefPtr<RenderNode> render_node)
+{
+    VERIFY(!m_render_node);
+    m_render_node = move(render_node);
+}
+
 // https://webaudio.github.io/web-audio-api/#dom-audionode-connect
 WebIDL::ExceptionOr<JS::NonnullGCPtr<AudioNode>> AudioNode::connect(JS::NonnullGCPtr<AudioNode> destination_node, WebIDL::UnsignedLong output, WebIDL::UnsignedLong input)
 {
-    (void)destination_node;
-    (void)output;
-    (void)input;
-    return WebIDL::NotSupportedError::create(realm(), "FIXME: Implement AudioNode::connect (AudioNode)"_fly_string);
+    // If the destination parameter is an AudioNode that has been created using another AudioContext, an
+    // InvalidAccessError MUST be thrown.
+    if (destination_node->m_context != m_context)
+        return WebIDL::InvalidAccessError::create(realm(), "Cannot connect to an AudioNode in a different AudioContext"_fly_string);
+
+    // The output parameter is an index describing which output of the AudioNode from which to connect. If this
+    // parameter is out-of-bounds, an IndexSizeError exception MUST be thrown.
+    if (output >= number_of_outputs())
+        return WebIDL::IndexSizeError::create(realm(), "Output index is out of range"_fly_string);
+
+    // The input parameter is an index describing which input of the destination AudioNode to connect to. If this
+    // parameter is out-of-bounds, an IndexSizeError exception MUST be thrown.
+    if (input >= destination_node->number_of_inputs())
+        return WebIDL::IndexSizeError::create(realm(), "Input index is out of range"_fly_string);
+
+    // There can only be one connection between a given output of one specific node and a given input of another
+    // specific node. Multiple connections with the same termini are ignored.
+    bool already_connected = any_of(m_output_node_connections, [&](auto const& connection) {
+        return connection.destination == destination_node && connection.output == output && connection.input == input;
+    });
+    if (!already_connected) {
+        m_output_node_connections.append({ destination_node, output, input });
+        destination_node->m_input_nodes.append(*this);
+        m_render_graph->connect(*m_render_node, *destination_node->m_render_node, input);
+    }
+
+    // This method returns destination AudioNode object.
+    return destination_node;
 }
 
 // https://webaudio.github.io/web-audio-api/#dom-audionode-connect-destinationparam-output
 WebIDL::ExceptionOr<JS::NonnullGCPtr<AudioNode>> AudioNode::connect(JS::NonnullGCPtr<AudioParam> destination_param, WebIDL::UnsignedLong output)
 {
-    (void)destination_param;
-    (void)output;
-    return WebIDL::NotSupportedError::create(realm(), "FIXME: Implement AudioNode::connect (AudioParam)"_fly_string);
+    // If destinationParam belongs to an AudioNode that belongs to a BaseAudioContext that is different from the
+    // BaseAudioContext that has created the AudioNode on which this method was called, an InvalidAccessError MUST be
+    // thrown.
+    if (destination_param->context() != m_context)
+        return WebIDL::InvalidAccessError::create(realm(), "Cannot connect to an AudioParam in a different AudioContext"_fly_string);
+
+    // The output parameter is an index describing which output of the AudioNode from which to connect. If the
+    // parameter is out-of-bounds, an IndexSizeError exception MUST be thrown.
+    if (output >= number_of_outputs())
+        return WebIDL::IndexSizeError::create(realm(), "Output index is out of range"_fly_string);
+
+    bool already_connected = any_of(m_output_param_connections, [&](auto const& connection) {
+        return connection.destination == destination_param && connection.output == output;
+    });
+    if (!already_connected) {
+        m_output_param_connections.append({ destination_param, output });
+        destination_param->m_input_nodes.append(*this);
+        m_render_graph->connect(*m_render_node, destination_param->render_param());
+    }
+
+    return JS::NonnullGCPtr { *this };
+}
+
+bool AudioNode::disconnect_matching(Function<bool(NodeConnection const&)> const& node_predicate, Function<bool(ParamConnection const&)> const& param_predicate)
+{
+    auto remove_first = [](auto& nodes, AudioNode& node) {
+        nodes.remove_first_matching([&](auto& it) { return it.ptr() == &node; });
+    };
+
+    bool removed_any = false;
+
+    m_output_node_connections.remove_all_matching([&](auto const& connection) {
+        if (!node_predicate(connection))
+            return false;
+        remove_first(connection.destination->m_input_nodes, *this);
+        m_render_graph->remove_connections([&](auto const& render_connection) {
+            return render_connection.source.ptr() == m_render_node.ptr()
+                && render_connection.destination_node == connection.destination->m_render_node
+                && render_connection.input == connection.input;
+        });
+        removed_any = true;
+        return true;
+    });
+
+    m_output_param_connections.remove_all_matching([&](auto const& connection) {
+        if (!param_predicate(connection))
+            return false;
+        remove_first(connection.destination->m_input_nodes, *this);
+        m_render_graph->remove_connections([&](auto const& render_connection) {
+            return render_connection.source.ptr() == m_render_node.ptr()
+                && render_connection.destination_param.ptr() == &connection.destination->render_param();
+        });
+        removed_any = true;
+        return true;
+    });
+
+    return removed_any;
 }
 
 // https://webaudio.github.io/web-audio-api/#dom-audionode-disconnect
 void AudioNode::disconnect()
 {
-    dbgln("FIXME: Implement AudioNode::disconnect()");
+    // Disconnects all outgoing connections from the AudioNode.
+    disconnect_matching([](auto const&) { return true; }, [](auto const&) { return true; });
 }
 
 // https://webaudio.github.io/web-audio-api/#dom-audionode-disconnect-output
-void AudioNode::disconnect(WebIDL::UnsignedLong output)
+WebIDL::ExceptionOr<void> AudioNode::disconnect(WebIDL::UnsignedLong output)
 {
-    (void)output;
-    dbgln("FIXME: Implement AudioNode::disconnect(output)");
+    // This is an index describing which output of the AudioNode to disconnect. It disconnects all outgoing
+    // connections from the given output. If this parameter is out-of-bounds, an IndexSizeError exception MUST be
+    // thrown.
+    if (output >= number_of_outputs())
+        return WebIDL::IndexSizeError::create(realm(), "Output index is out of range"_fly_string);
+
+    disconnect_matching(
+        [&](auto const& connection) { return connection.output == output; },
+        [&](auto const& connection) { return connection.output == output; });
+    return {};
 }
 
 // https://webaudio.github.io/web-audio-api/#dom-audionode-disconnect-destinationnode
-void AudioNode::disconnect(JS::NonnullGCPtr<AudioNode> destination_node)
+WebIDL::ExceptionOr<void> AudioNode::disconnect(JS::NonnullGCPtr<AudioNode> destination_node)
 {
-    (void)destination_node;
-    dbgln("FIXME: Implement AudioNode::disconnect(destination_node)");
+    // The destinationNode parameter is the AudioNode to disconnect. It disconnects all outgoing connections to the
+    // given destinationNode. If there is no connection to the destinationNode, an InvalidAccessError exception MUST
+    // be thrown.
+    bool removed_any = disconnect_matching(
+        [&](auto const& connection) { return connection.destination == destination_node; },
+        [](auto const&) { return false; });
+    if (!removed_any)
+        return WebIDL::InvalidAccessError::create(realm(), "Not connected to the given AudioNode"_fly_string);
+    return {};
 }
 
 // https://webaudio.github.io/web-audio-api/#dom-audionode-disconnect-destinationnode-output
-void AudioNode::disconnect(JS::NonnullGCPtr<AudioNode> destination_node, WebIDL::UnsignedLong output)
+WebIDL::ExceptionOr<void> AudioNode::disconnect(JS::NonnullGCPtr<AudioNode> destination_node, WebIDL::UnsignedLong output)
 {
-    (void)destination_node;
-    (void)output;
-    dbgln("FIXME: Implement AudioNode::disconnect(destination_node, output)");
+    // If this parameter is out-of-bounds, an IndexSizeError exception MUST be thrown.
+    if (output >= number_of_outputs())
+        return WebIDL::IndexSizeError::create(realm(), "Output index is out of range"_fly_string);
+
+    // If there is no connection from the given output to the destination, an InvalidAccessError exception MUST be thrown.
+    bool removed_any = disconnect_matching(
+        [&](auto const& connection) { return connection.destination == destination_node && connection.output == output; },
+        [](auto const&) { return false; });
+    if (!removed_any)
+        return WebIDL::InvalidAccessError::create(realm(), "Not connected to the given AudioNode"_fly_string);
+    return {};
 }
 
 // https://webaudio.github.io/web-audio-api/#dom-audionode-disconnect-destinationnode-output-input
-void AudioNode::disconnect(JS::NonnullGCPtr<AudioNode> destination_node, WebIDL::UnsignedLong output, WebIDL::UnsignedLong input)
+WebIDL::ExceptionOr<void> AudioNode::disconnect(JS::NonnullGCPtr<AudioNode> destination_node, WebIDL::UnsignedLong output, WebIDL::UnsignedLong input)
 {
-    (void)destination_node;
-    (void)output;
-    (void)input;
-    dbgln("FIXME: Implement AudioNode::disconnect(destination_node, output, input)");
+    // If this parameter is out-of-bounds, an IndexSizeError exception MUST be thrown.
+    if (output >= number_of_outputs())
+        return WebIDL::IndexSizeError::create(realm(), "Output index is out of range"_fly_string);
+    if (input >= destination_node->number_of_inputs())
+        return WebIDL::IndexSizeError::create(realm(), "Input index is out of range"_fly_string);
+
+    // If there is no connection from the given output to the given input, an InvalidAccessError exception MUST be thrown.
+    bool removed_any = disconnect_matching(
+        [&](auto const& connection) { return connection.destination == destination_node && connection.output == output && connection.input == input; },
+        [](auto const&) { return false; });
+    if (!removed_any)
+        return WebIDL::InvalidAccessError::create(realm(), "Not connected to the given AudioNode"_fly_string);
+    return {};
 }
 
 // https://webaudio.github.io/web-audio-api/#dom-audionode-disconnect-destinationparam
-void AudioNode::disconnect(JS::NonnullGCPtr<AudioParam> destination_param)
+WebIDL::ExceptionOr<void> AudioNode::disconnect(JS::NonnullGCPtr<AudioParam> destination_param)
 {
-    (void)destination_param;
-    dbgln("FIXME: Implement AudioNode::disconnect(destination_param)");
+    // If this AudioNode has no outgoing connections to the destinationParam, an InvalidAccessError exception MUST be thrown.
+    bool removed_any = disconnect_matching(
+        [](auto const&) { return false; },
+        [&](auto const& connection) { return connection.destination == destination_param; });
+    if (!removed_any)
+        return WebIDL::InvalidAccessError::create(realm(), "Not connected to the given AudioParam"_fly_string);
+    return {};
 }
 
 // https://webaudio.github.io/web-audio-api/#dom-audionode-disconnect-destinationparam-output
-void AudioNode::disconnect(JS::NonnullGCPtr<AudioParam> destination_param, WebIDL::UnsignedLong output)
+WebIDL::ExceptionOr<void> AudioNode::disconnect(JS::NonnullGCPtr<AudioParam> destination_param, WebIDL::UnsignedLong output)
+{
+    // If the parameter is out-of-bounds, an IndexSizeError exception MUST be thrown.
+    if (output >= number_of_outputs())
+        return WebIDL::IndexSizeError::create(realm(), "Output index is out of range"_fly_string);
+
+    // If this AudioNode has no outgoing connections from the given output to the destinationParam, an
+    // InvalidAccessError exception MUST be thrown.
+    bool removed_any = disconnect_matching(
+        [](auto const&) { return false; },
+        [&](auto const& connection) { return connection.destination == destination_param && connection.output == output; });
+    if (!removed_any)
+        return WebIDL::InvalidAccessError::create(realm(), "Not connected to the given AudioParam"_fly_string);
+    return {};
+}
+
+// https://webaudio.github.io/web-audio-api/#dom-audionode-channelcount
+WebIDL::ExceptionOr<void> AudioNode::set_channel_count(WebIDL::UnsignedLong channel_count)
+{
+    // If this value is set to zero or to a value greater than the implementation’s maximum number of channels the
+    // implementation MUST throw a NotSupportedError exception.
+    if (channel_count == 0 || channel_count > BaseAudioContext::MAX_NUMBER_OF_CHANNELS)
+        return WebIDL::NotSupportedError::create(realm(), "Channel count is outside of allowed range"_fly_string);
+
+    m_render_graph->set_channel_count(*m_render_node, channel_count);
+    return {};
+}
+
+// https://webaudio.github.io/web-audio-api/#dom-audionode-channelcountmode
+void AudioNode::set_channel_count_mode(Bindings::ChannelCountMode channel_count_mode)
+{
+    m_render_graph->set_channel_count_mode(*m_render_node, channel_count_mode);
+}
+
+// https://webaudio.github.io/web-audio-api/#dom-audionode-channelinterpretation
+void AudioNode::set_channel_interpretation(Bindings::ChannelInterpretation channel_interpretation)
 {
-    (void)destination_param;
-    (void)output;
-    dbgln("FIXME: Implement AudioNode::disconnect(destination_param, output)");
+    m_render_graph->set_channel_interpretation(*m_render_node, channel_interpretation);
 }
 
 void AudioNode::initialize(JS::Realm& realm)
@@ -100,6 +256,20 @@ void AudioNode::visit_edges(Cell::Visitor& visitor)
 {
     Base::visit_edges(visitor);
     visitor.visit(m_context);
+    for (auto const& connection : m_output_node_connections)
+        visitor.visit(connection.destination);
+    for (auto const& connection : m_output_param_connections)
+        visitor.visit(connection.destination);
+    visitor.visit(m_input_nodes);
+}
+
+void AudioNode::finalize()
+{
+    Base::finalize();
+
+    // Nothing can reach this node any more, but the rendering thread still can until it is removed from the graph.
+    if (m_render_node)
+        m_render_graph->remove_node(*m_render_node);
 }
 
 }
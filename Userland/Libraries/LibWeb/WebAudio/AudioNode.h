@@ -11,6 +11,7 @@
 #include <LibWeb/Bindings/AudioNodePrototype.h>
 #include <LibWeb/Bindings/PlatformObject.h>
 #include <LibWeb/DOM/EventTarget.h>
+#include <LibWeb/WebAudio/RenderGraph.h>
 #include <LibWeb/WebIDL/Types.h>
 
 namespace Web::WebAudio {
@@ -34,12 +35,12 @@ public:
     WebIDL::ExceptionOr<JS::NonnullGCPtr<AudioNode>> connect(JS::NonnullGCPtr<AudioParam> destination_param, WebIDL::UnsignedLong output = 0);
 
     void disconnect();
-    void disconnect(WebIDL::UnsignedLong output);
-    void disconnect(JS::NonnullGCPtr<AudioNode> destination_node);
-    void disconnect(JS::NonnullGCPtr<AudioNode> destination_node, WebIDL::UnsignedLong output);
-    void disconnect(JS::NonnullGCPtr<AudioNode> destination_node, WebIDL::UnsignedLong output, WebIDL::UnsignedLong input);
-    void disconnect(JS::NonnullGCPtr<AudioParam> destination_param);
-    void disconnect(JS::NonnullGCPtr<AudioParam> destination_param, WebIDL::UnsignedLong output);
+    WebIDL::ExceptionOr<void> disconnect(WebIDL::UnsignedLong output);
+    WebIDL::ExceptionOr<void> disconnect(JS::NonnullGCPtr<AudioNode> destination_node);
+    WebIDL::ExceptionOr<void> disconnect(JS::NonnullGCPtr<AudioNode> destination_node, WebIDL::UnsignedLong output);
+    WebIDL::ExceptionOr<void> disconnect(JS::NonnullGCPtr<AudioNode> destination_node, WebIDL::UnsignedLong output, WebIDL::UnsignedLong input);
+    WebIDL::ExceptionOr<void> disconnect(JS::NonnullGCPtr<AudioParam> destination_param);
+    WebIDL::ExceptionOr<void> disconnect(JS::NonnullGCPtr<AudioParam> destination_param, WebIDL::UnsignedLong output);
 
     // https://webaudio.github.io/web-audio-api/#dom-audionode-context
     JS::NonnullGCPtr<BaseAudioContext const> context() const
@@ -47,15 +48,55 @@ public:
         // The BaseAudioContext which owns this AudioNode.
         return m_context;
     }
+    JS::NonnullGCPtr<BaseAudioContext> context() { return m_context; }
+
+    WebIDL::UnsignedLong number_of_inputs() const { return m_render_node->number_of_inputs(); }
+    WebIDL::UnsignedLong number_of_outputs() const { return m_render_node->number_of_outputs(); }
+
+    WebIDL::UnsignedLong channel_count() const { return m_render_node->channel_count(); }
+    WebIDL::ExceptionOr<void> set_channel_count(WebIDL::UnsignedLong);
+    Bindings::ChannelCountMode channel_count_mode() const { return m_render_node->channel_count_mode(); }
+    void set_channel_count_mode(Bindings::ChannelCountMode);
+    Bindings::ChannelInterpretation channel_interpretation() const { return m_render_node->channel_interpretation(); }
+    void set_channel_interpretation(Bindings::ChannelInterpretation);
+
+    RenderNode& render_node() { return *m_render_node; }
+    RenderNode const& render_node() const { return *m_render_node; }
 
 protected:
     AudioNode(JS::Realm&, JS::NonnullGCPtr<BaseAudioContext>);
 
+    // Every subclass provides the node that renders it, from its constructor.
+    void set_render_node(NonnullRefPtr<RenderNode>);
+
     virtual void initialize(JS::Realm&) override;
     virtual void visit_edges(Cell::Visitor&) override;
+    virtual void finalize() override;
 
 private:
+    struct NodeConnection {
+        JS::NonnullGCPtr<AudioNode> destination;
+        WebIDL::UnsignedLong output { 0 };
+        WebIDL::UnsignedLong input { 0 };
+    };
+
+    struct ParamConnection {
+        JS::NonnullGCPtr<AudioParam> destination;
+        WebIDL::UnsignedLong output { 0 };
+    };
+
+    // Removes the matching outgoing connections, returning whether there were any.
+    bool disconnect_matching(Function<bool(NodeConnection const&)> const&, Function<bool(ParamConnection const&)> const&);
+
     JS::NonnullGCPtr<BaseAudioContext> m_context;
+    NonnullRefPtr<RenderGraph> m_render_graph;
+    RefPtr<RenderNode> m_render_node;
+
+    Vector<NodeConnection> m_output_node_connections;
+    Vector<ParamConnection> m_output_param_connections;
+
+    // A node is kept alive by the nodes it is connected to, so that a graph reachable from the destination keeps playing.
+    Vector<JS::NonnullGCPtr<AudioNode>> m_input_nodes;
 };
 
 }
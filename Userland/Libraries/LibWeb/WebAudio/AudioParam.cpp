@@ -6,26 +6,26 @@
 
 #include <LibWeb/Bindings/AudioParamPrototype.h>
 #include <LibWeb/Bindings/Intrinsics.h>
+#include <LibWeb/WebAudio/AudioNode.h>
 #include <LibWeb/WebAudio/AudioParam.h>
+#include <LibWeb/WebAudio/BaseAudioContext.h>
 #include <LibWeb/WebIDL/ExceptionOr.h>
 
 namespace Web::WebAudio {
 
 JS_DEFINE_ALLOCATOR(AudioParam);
 
-AudioParam::AudioParam(JS::Realm& realm, float default_value, float min_value, float max_value, Bindings::AutomationRate automation_rate)
+AudioParam::AudioParam(JS::Realm& realm, JS::NonnullGCPtr<BaseAudioContext> context, float default_value, float min_value, float max_value, Bindings::AutomationRate automation_rate)
     : Bindings::PlatformObject(realm)
-    , m_current_value(default_value)
+    , m_context(context)
     , m_default_value(default_value)
-    , m_min_value(min_value)
-    , m_max_value(max_value)
-    , m_automation_rate(automation_rate)
+    , m_render_param(RenderParam::create(default_value, min_value, max_value, automation_rate))
 {
 }
 
-JS::NonnullGCPtr<AudioParam> AudioParam::create(JS::Realm& realm, float default_value, float min_value, float max_value, Bindings::AutomationRate automation_rate)
+JS::NonnullGCPtr<AudioParam> AudioParam::create(JS::Realm& realm, JS::NonnullGCPtr<BaseAudioContext> context, float default_value, float min_value, float max_value, Bindings::AutomationRate automation_rate)
 {
-    return realm.vm().heap().allocate<AudioParam>(realm, realm, default_value, min_value, max_value, automation_rate);
+    return realm.vm().heap().allocate<AudioParam>(realm, realm, context, default_value, min_value, max_value, automation_rate);
 }
 
 AudioParam::~AudioParam() = default;
@@ -36,26 +36,33 @@ float AudioParam::value() const
 {
     // Each AudioParam includes minValue and maxValue attributes that together form the simple nominal range
     // for the parameter. In effect, value of the parameter is clamped to the range [minValue, maxValue].
-    return clamp(m_current_value, min_value(), max_value());
+    return clamp(m_render_param->current_value(), min_value(), max_value());
 }
 
 // https://webaudio.github.io/web-audio-api/#dom-audioparam-value
-void AudioParam::set_value(float value)
-{
-    m_current_value = value;
+WebIDL::ExceptionOr<void> AudioParam::set_value(float value)
+{
+    // Setting this attribute has the effect of assigning the requested value to the [[current value]] slot, and
+    // calling the setValueAtTime() method with the current AudioContext's currentTime and [[current value]]. Any
+    // exceptions that would be thrown by setValueAtTime() will also be thrown by setting this attribute.
+    // NOTE: Without any automation events the value is simply held, so there is nothing to schedule.
+    if (m_render_param->has_events())
+        TRY(set_value_at_time(value, m_context->current_time()));
+    m_render_param->set_intrinsic_value(value);
+    return {};
 }
 
 // https://webaudio.github.io/web-audio-api/#dom-audioparam-automationrate
 Bindings::AutomationRate AudioParam::automation_rate() const
 {
-    return m_automation_rate;
+    return m_render_param->automation_rate();
 }
 
 // https://webaudio.github.io/web-audio-api/#dom-audioparam-automationrate
 WebIDL::ExceptionOr<void> AudioParam::set_automation_rate(Bindings::AutomationRate automation_rate)
 {
-    dbgln("FIXME: Fully implement AudioParam::set_automation_rate");
-    m_automation_rate = automation_rate;
+    // FIXME: Throw an InvalidStateError for the parameters whose automation rate is fixed, such as those of a DynamicsCompressorNode.
+    m_render_param->set_automation_rate(automation_rate);
     return {};
 }
 
@@ -68,69 +75,145 @@ float AudioParam::default_value() const
 // https://webaudio.github.io/web-audio-api/#dom-audioparam-minvalue
 float AudioParam::min_value() const
 {
-    return m_min_value;
+    return m_render_param->min_value();
 }
 
 // https://webaudio.github.io/web-audio-api/#dom-audioparam-maxvalue
 float AudioParam::max_value() const
 {
-    return m_max_value;
+    return m_render_param->max_value();
+}
+
+WebIDL::ExceptionOr<void> AudioParam::insert_event(AutomationEvent event)
+{
+    // If one of these events is added at a time where there is already one or more events, then it will be placed in
+    // the list after them, but before events whose times are after the event. If setValueCurveAtTime() is called for
+    // time T and duration D and there are any events having a time strictly greater than T, but strictly less than
+    // T + D, then a NotSupportedError exception MUST be thrown. In other words, it's not ok to schedule a value curve
+    // during a time period containing other events, but it's ok to schedule a value curve exactly at the time of
+    // another event.
+    // Similarly a NotSupportedError exception MUST be thrown if any automation method is called at a time which is
+    // contained in [T, T+D), T being the time of the curve and D its duration.
+    if (m_render_param->overlaps_value_curve(event.time, event.end_time()))
+        return WebIDL::NotSupportedError::create(realm(), "Automation event overlaps a value curve"_fly_string);
+
+    m_render_param->insert_event(move(event));
+    return {};
 }
 
 // https://webaudio.github.io/web-audio-api/#dom-audioparam-setvalueattime
 WebIDL::ExceptionOr<JS::NonnullGCPtr<AudioParam>> AudioParam::set_value_at_time(float value, double start_time)
 {
-    (void)value;
-    (void)start_time;
-    return WebIDL::NotSupportedError::create(realm(), "FIXME: Implement AudioParam::set_value_at_time"_fly_string);
+    // If startTime is negative or is not a finite number, a RangeError exception MUST be thrown.
+    if (start_time < 0)
+        return WebIDL::SimpleException { WebIDL::SimpleExceptionType::RangeError, "Start time must not be negative"sv };
+
+    // If startTime is less than currentTime, it is clamped to currentTime.
+    start_time = max(start_time, m_context->current_time());
+
+    TRY(insert_event({ .type = AutomationEvent::Type::SetValue, .time = start_time, .value = value }));
+    return JS::NonnullGCPtr { *this };
 }
 
 // https://webaudio.github.io/web-audio-api/#dom-audioparam-linearramptovalueattime
 WebIDL::ExceptionOr<JS::NonnullGCPtr<AudioParam>> AudioParam::linear_ramp_to_value_at_time(float value, double end_time)
 {
-    (void)value;
-    (void)end_time;
-    return WebIDL::NotSupportedError::create(realm(), "FIXME: Implement AudioParam::linear_ramp_to_value_at_time"_fly_string);
+    // If endTime is negative or is not a finite number, a RangeError exception MUST be thrown.
+    if (end_time < 0)
+        return WebIDL::SimpleException { WebIDL::SimpleExceptionType::RangeError, "End time must not be negative"sv };
+
+    // If endTime is less than currentTime, it is clamped to currentTime.
+    end_time = max(end_time, m_context->current_time());
+
+    TRY(insert_event({ .type = AutomationEvent::Type::LinearRamp, .time = end_time, .value = value }));
+    return JS::NonnullGCPtr { *this };
 }
 
 // https://webaudio.github.io/web-audio-api/#dom-audioparam-exponentialramptovalueattime
 WebIDL::ExceptionOr<JS::NonnullGCPtr<AudioParam>> AudioParam::exponential_ramp_to_value_at_time(float value, double end_time)
 {
-    (void)value;
-    (void)end_time;
-    return WebIDL::NotSupportedError::create(realm(), "FIXME: Implement AudioParam::exponential_ramp_to_value_at_time"_fly_string);
+    // The float value that the parameter will exponentially ramp to at the given time. A RangeError exception MUST be
+    // thrown if this value is equal to 0.
+    if (value == 0)
+        return WebIDL::SimpleException { WebIDL::SimpleExceptionType::RangeError, "Value must not be zero"sv };
+
+    // If endTime is negative or is not a finite number, a RangeError exception MUST be thrown.
+    if (end_time < 0)
+        return WebIDL::SimpleException { WebIDL::SimpleExceptionType::RangeError, "End time must not be negative"sv };
+
+    // If endTime is less than currentTime, it is clamped to currentTime.
+    end_time = max(end_time, m_context->current_time());
+
+    TRY(insert_event({ .type = AutomationEvent::Type::ExponentialRamp, .time = end_time, .value = value }));
+    return JS::NonnullGCPtr { *this };
 }
 
 // https://webaudio.github.io/web-audio-api/#dom-audioparam-settargetattime
 WebIDL::ExceptionOr<JS::NonnullGCPtr<AudioParam>> AudioParam::set_target_at_time(float target, double start_time, float time_constant)
 {
-    (void)target;
-    (void)start_time;
-    (void)time_constant;
-    return WebIDL::NotSupportedError::create(realm(), "FIXME: Implement AudioParam::set_target_at_time"_fly_string);
+    // If startTime is negative or is not a finite number, a RangeError exception MUST be thrown.
+    if (start_time < 0)
+        return WebIDL::SimpleException { WebIDL::SimpleExceptionType::RangeError, "Start time must not be negative"sv };
+
+    // If timeConstant is negative, a RangeError exception MUST be thrown.
+    if (time_constant < 0)
+        return WebIDL::SimpleException { WebIDL::SimpleExceptionType::RangeError, "Time constant must not be negative"sv };
+
+    // If startTime is less than currentTime, it is clamped to currentTime.
+    start_time = max(start_time, m_context->current_time());
+
+    TRY(insert_event({ .type = AutomationEvent::Type::SetTarget, .time = start_time, .value = target, .time_constant = time_constant }));
+    return JS::NonnullGCPtr { *this };
 }
 
 // https://webaudio.github.io/web-audio-api/#dom-audioparam-setvaluecurveattime
 WebIDL::ExceptionOr<JS::NonnullGCPtr<AudioParam>> AudioParam::set_value_curve_at_time(Span<float> values, double start_time, double duration)
 {
-    (void)values;
-    (void)start_time;
-    (void)duration;
-    return WebIDL::NotSupportedError::create(realm(), "FIXME: Implement AudioParam::set_value_curve_at_time"_fly_string);
+    // When this method is called, an internal copy of the curve is created for automation purposes. An
+    // InvalidStateError MUST be thrown if this attribute is a sequence<float> object that has a length less than 2.
+    if (values.size() < 2)
+        return WebIDL::InvalidStateError::create(realm(), "Value curve must have at least two values"_fly_string);
+
+    // If startTime is negative or is not a finite number, a RangeError exception MUST be thrown.
+    if (start_time < 0)
+        return WebIDL::SimpleException { WebIDL::SimpleExceptionType::RangeError, "Start time must not be negative"sv };
+
+    // A RangeError exception MUST be thrown if duration is not strictly positive or is not a finite number.
+    if (duration <= 0)
+        return WebIDL::SimpleException { WebIDL::SimpleExceptionType::RangeError, "Duration must be positive"sv };
+
+    // If startTime is less than currentTime, it is clamped to currentTime.
+    start_time = max(start_time, m_context->current_time());
+
+    Vector<float> curve;
+    TRY_OR_THROW_OOM(vm(), curve.try_append(values.data(), values.size()));
+
+    TRY(insert_event({ .type = AutomationEvent::Type::SetValueCurve, .time = start_time, .duration = duration, .curve = move(curve) }));
+    return JS::NonnullGCPtr { *this };
 }
 
 // https://webaudio.github.io/web-audio-api/#dom-audioparam-cancelscheduledvalues
 WebIDL::ExceptionOr<JS::NonnullGCPtr<AudioParam>> AudioParam::cancel_scheduled_values(double cancel_time)
 {
-    (void)cancel_time;
-    return WebIDL::NotSupportedError::create(realm(), "FIXME: Implement AudioParam::cancel_scheduled_values"_fly_string);
+    // If cancelTime is negative or is not a finite number, a RangeError exception MUST be thrown.
+    if (cancel_time < 0)
+        return WebIDL::SimpleException { WebIDL::SimpleExceptionType::RangeError, "Cancel time must not be negative"sv };
+
+    // If cancelTime is less than currentTime, it is clamped to currentTime.
+    m_render_param->cancel_scheduled_values(max(cancel_time, m_context->current_time()));
+    return JS::NonnullGCPtr { *this };
 }
 
 // https://webaudio.github.io/web-audio-api/#dom-audioparam-cancelandholdattime
 WebIDL::ExceptionOr<JS::NonnullGCPtr<AudioParam>> AudioParam::cancel_and_hold_at_time(double cancel_time)
 {
-    (void)cancel_time;
-    return WebIDL::NotSupportedError::create(realm(), "FIXME: Implement AudioParam::cancel_and_hold_at_time"_fly_string);
+    // If cancelTime is negative or is not a finite number, a RangeError exception MUST be thrown.
+    if (cancel_time < 0)
+        return WebIDL::SimpleException { WebIDL::SimpleExceptionType::RangeError, "Cancel time must not be negative"sv };
+
+    // If cancelTime is less than currentTime, it is clamped to currentTime.
+    m_render_param->cancel_and_hold_at_time(max(cancel_time, m_context->current_time()));
+    return JS::NonnullGCPtr { *this };
 }
 
 void AudioParam::initialize(JS::Realm& realm)
@@ -142,6 +225,8 @@ void AudioParam::initialize(JS::Realm& realm)
 void AudioParam::visit_edges(Cell::Visitor& visitor)
 {
     Base::visit_edges(visitor);
+    visitor.visit(m_context);
+    visitor.visit(m_input_nodes);
 }
 
 }
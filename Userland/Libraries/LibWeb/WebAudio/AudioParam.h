@@ -9,6 +9,7 @@
 #include <LibJS/Forward.h>
 #include <LibWeb/Bindings/AudioParamPrototype.h>
 #include <LibWeb/Bindings/PlatformObject.h>
+#include <LibWeb/WebAudio/RenderGraph.h>
 
 namespace Web::WebAudio {
 
@@ -18,12 +19,12 @@ class AudioParam final : public Bindings::PlatformObject {
     JS_DECLARE_ALLOCATOR(AudioParam);
 
 public:
-    static JS::NonnullGCPtr<AudioParam> create(JS::Realm&, float default_value, float min_value, float max_value, Bindings::AutomationRate);
+    static JS::NonnullGCPtr<AudioParam> create(JS::Realm&, JS::NonnullGCPtr<BaseAudioContext>, float default_value, float min_value, float max_value, Bindings::AutomationRate);
 
     virtual ~AudioParam() override;
 
     float value() const;
-    void set_value(float);
+    WebIDL::ExceptionOr<void> set_value(float);
 
     Bindings::AutomationRate automation_rate() const;
     WebIDL::ExceptionOr<void> set_automation_rate(Bindings::AutomationRate);
@@ -40,18 +41,25 @@ public:
     WebIDL::ExceptionOr<JS::NonnullGCPtr<AudioParam>> cancel_scheduled_values(double cancel_time);
     WebIDL::ExceptionOr<JS::NonnullGCPtr<AudioParam>> cancel_and_hold_at_time(double cancel_time);
 
+    JS::NonnullGCPtr<BaseAudioContext> context() const { return m_context; }
+    RenderParam& render_param() { return m_render_param; }
+
 private:
-    AudioParam(JS::Realm&, float default_value, float min_value, float max_value, Bindings::AutomationRate);
+    friend class AudioNode;
+
+    AudioParam(JS::Realm&, JS::NonnullGCPtr<BaseAudioContext>, float default_value, float min_value, float max_value, Bindings::AutomationRate);
+
+    WebIDL::ExceptionOr<void> insert_event(AutomationEvent);
 
-    // https://webaudio.github.io/web-audio-api/#dom-audioparam-current-value-slot
-    float m_current_value {}; //  [[current value]]
+    JS::NonnullGCPtr<BaseAudioContext> m_context;
 
     float m_default_value {};
 
-    float m_min_value {};
-    float m_max_value {};
+    // Holds the [[current value]], the automation rate and the automation events, where the rendering thread can see them.
+    NonnullRefPtr<RenderParam> m_render_param;
 
-    Bindings::AutomationRate m_automation_rate {};
+    // The nodes connected to this parameter, which are kept alive by it.
+    Vector<JS::NonnullGCPtr<AudioNode>> m_input_nodes;
 
     virtual void initialize(JS::Realm&) override;
     virtual void visit_edges(Cell::Visitor&) override;
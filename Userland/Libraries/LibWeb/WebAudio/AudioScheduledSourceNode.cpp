@@ -8,6 +8,7 @@
 #include <LibWeb/Bindings/Intrinsics.h>
 #include <LibWeb/HTML/EventNames.h>
 #include <LibWeb/WebAudio/AudioScheduledSourceNode.h>
+#include <LibWeb/WebAudio/BaseAudioContext.h>
 
 namespace Web::WebAudio {
 
@@ -35,15 +36,43 @@ void AudioScheduledSourceNode::set_onended(JS::GCPtr<WebIDL::CallbackType> value
 // https://webaudio.github.io/web-audio-api/#dom-audioscheduledsourcenode-start
 WebIDL::ExceptionOr<void> AudioScheduledSourceNode::start(double when)
 {
-    (void)when;
-    return WebIDL::NotSupportedError::create(realm(), "FIXME: Implement AudioScheduledSourceNode::start"_fly_string);
+    // 1. If this AudioScheduledSourceNode internal slot [[source started]] is true, an InvalidStateError exception MUST be thrown.
+    if (m_source_started)
+        return WebIDL::InvalidStateError::create(realm(), "AudioScheduledSourceNode has already been started"_fly_string);
+
+    // 2. Check for any errors that must be thrown due to parameter constraints described below. If any exception is
+    //    thrown during this step, abort those steps.
+    // A RangeError exception MUST be thrown if when is negative.
+    if (when < 0)
+        return WebIDL::SimpleException { WebIDL::SimpleExceptionType::RangeError, "Start time must not be negative"sv };
+
+    // 3. Set the internal slot [[source started]] on this AudioScheduledSourceNode to true.
+    m_source_started = true;
+
+    // 4. Queue a control message to start the AudioScheduledSourceNode, including the parameter values in the message.
+    scheduled_source_render_node().start(when);
+    context()->add_playing_source_node(*this);
+
+    // FIXME: 5. Send a control message to the associated AudioContext to start running its rendering thread only when
+    //           all the following conditions are met.
+    return {};
 }
 
 // https://webaudio.github.io/web-audio-api/#dom-audioscheduledsourcenode-stop
 WebIDL::ExceptionOr<void> AudioScheduledSourceNode::stop(double when)
 {
-    (void)when;
-    return WebIDL::NotSupportedError::create(realm(), "FIXME: Implement AudioScheduledSourceNode::stop"_fly_string);
+    // 1. If this AudioScheduledSourceNode internal slot [[source started]] is not true, an InvalidStateError exception MUST be thrown.
+    if (!m_source_started)
+        return WebIDL::InvalidStateError::create(realm(), "AudioScheduledSourceNode has not been started"_fly_string);
+
+    // 2. Check for any errors that must be thrown due to parameter constraints described below.
+    // A RangeError exception MUST be thrown if when is negative.
+    if (when < 0)
+        return WebIDL::SimpleException { WebIDL::SimpleExceptionType::RangeError, "Stop time must not be negative"sv };
+
+    // 3. Queue a control message to stop the AudioScheduledSourceNode, including the parameter values in the message.
+    scheduled_source_render_node().stop(when);
+    return {};
 }
 
 void AudioScheduledSourceNode::initialize(JS::Realm& realm)
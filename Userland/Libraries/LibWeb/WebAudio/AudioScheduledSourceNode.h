@@ -7,6 +7,7 @@
 #pragma once
 
 #include <LibWeb/WebAudio/AudioNode.h>
+#include <LibWeb/WebAudio/RenderNodes.h>
 
 namespace Web::WebAudio {
 
@@ -24,11 +25,20 @@ public:
     WebIDL::ExceptionOr<void> start(double when = 0);
     WebIDL::ExceptionOr<void> stop(double when = 0);
 
+    // Whether the rendering thread has played this node up to its stop time.
+    bool has_ended() const { return static_cast<ScheduledSourceRenderNode const&>(render_node()).has_ended(); }
+
 protected:
     AudioScheduledSourceNode(JS::Realm&, JS::NonnullGCPtr<BaseAudioContext>);
 
     virtual void initialize(JS::Realm&) override;
     virtual void visit_edges(Cell::Visitor&) override;
+
+private:
+    ScheduledSourceRenderNode& scheduled_source_render_node() { return static_cast<ScheduledSourceRenderNode&>(render_node()); }
+
+    // https://webaudio.github.io/web-audio-api/#dom-audioscheduledsourcenode-source-started-slot
+    bool m_source_started { false }; // [[source started]]
 };
 
 }
@@ -7,8 +7,14 @@
 
 #include <LibWeb/Bindings/BaseAudioContextPrototype.h>
 #include <LibWeb/Bindings/Intrinsics.h>
+#include <LibWeb/DOM/Document.h>
+#include <LibWeb/DOM/Event.h>
+#include <LibWeb/HTML/EventLoop/EventLoop.h>
 #include <LibWeb/HTML/EventNames.h>
+#include <LibWeb/HTML/Window.h>
 #include <LibWeb/WebAudio/AudioBuffer.h>
+#include <LibWeb/WebAudio/AudioDestinationNode.h>
+#include <LibWeb/WebAudio/AudioScheduledSourceNode.h>
 #include <LibWeb/WebAudio/BaseAudioContext.h>
 #include <LibWeb/WebAudio/DynamicsCompressorNode.h>
 #include <LibWeb/WebAudio/GainNode.h>
@@ -16,9 +22,11 @@
 
 namespace Web::WebAudio {
 
-BaseAudioContext::BaseAudioContext(JS::Realm& realm, float sample_rate)
+BaseAudioContext::BaseAudioContext(JS::Realm& realm, float sample_rate, WebIDL::UnsignedLong destination_channel_count)
     : DOM::EventTarget(realm)
     , m_sample_rate(sample_rate)
+    , m_render_graph(RenderGraph::create(sample_rate))
+    , m_destination_channel_count(destination_channel_count)
 {
 }
 
@@ -28,6 +36,15 @@ void BaseAudioContext::initialize(JS::Realm& realm)
 {
     Base::initialize(realm);
     WEB_SET_PROTOTYPE_FOR_INTERFACE(BaseAudioContext);
+
+    m_destination = AudioDestinationNode::create(realm, *this, m_destination_channel_count);
+}
+
+void BaseAudioContext::visit_edges(Cell::Visitor& visitor)
+{
+    Base::visit_edges(visitor);
+    visitor.visit(m_destination);
+    visitor.visit(m_playing_source_nodes);
 }
 
 void BaseAudioContext::set_onstatechange(WebIDL::CallbackType* event_handler)
@@ -69,6 +86,34 @@ JS::NonnullGCPtr<GainNode> BaseAudioContext::create_gain()
     return GainNode::create(realm(), *this);
 }
 
+void BaseAudioContext::add_playing_source_node(JS::NonnullGCPtr<AudioScheduledSourceNode> node)
+{
+    m_playing_source_nodes.append(node);
+}
+
+// https://webaudio.github.io/web-audio-api/#dom-audioscheduledsourcenode-onended
+void BaseAudioContext::queue_ended_events()
+{
+    m_playing_source_nodes.remove_all_matching([&](auto const& node) {
+        if (!node->has_ended())
+            return false;
+
+        // When the source node has stopped playing, the rendering thread will queue a media element task to fire an
+        // event named ended at the node.
+        queue_a_media_element_task([&realm = realm(), node] {
+            node->dispatch_event(DOM::Event::create(realm, HTML::EventNames::ended));
+        });
+        return true;
+    });
+}
+
+void BaseAudioContext::queue_a_media_element_task(Function<void()> steps)
+{
+    auto const& document = verify_cast<HTML::Window>(HTML::relevant_global_object(*this)).associated_document();
+    auto task = HTML::Task::create(vm(), m_media_element_event_task_source.source, document, JS::create_heap_function(heap(), move(steps)));
+    HTML::main_thread_event_loop().task_queue().add(move(task));
+}
+
 // https://webaudio.github.io/web-audio-api/#dom-baseaudiocontext-createbuffer
 WebIDL::ExceptionOr<void> BaseAudioContext::verify_audio_options_inside_nominal_range(JS::Realm& realm, WebIDL::UnsignedLong number_of_channels, WebIDL::UnsignedLong length, float sample_rate)
 {
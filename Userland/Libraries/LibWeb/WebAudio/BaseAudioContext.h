@@ -9,6 +9,8 @@
 
 #include <LibWeb/Bindings/BaseAudioContextPrototype.h>
 #include <LibWeb/DOM/EventTarget.h>
+#include <LibWeb/HTML/EventLoop/Task.h>
+#include <LibWeb/WebAudio/RenderGraph.h>
 #include <LibWeb/WebIDL/Types.h>
 
 namespace Web::WebAudio {
@@ -31,8 +33,9 @@ public:
     static constexpr float MIN_SAMPLE_RATE { 8000 };
     static constexpr float MAX_SAMPLE_RATE { 192000 };
 
+    JS::NonnullGCPtr<AudioDestinationNode> destination() const { return *m_destination; }
     float sample_rate() const { return m_sample_rate; }
-    double current_time() const { return m_current_time; }
+    double current_time() const { return m_render_graph->current_time(); }
     Bindings::AudioContextState state() const { return m_control_thread_state; }
 
     // https://webaudio.github.io/web-audio-api/#--nyquist-frequency
@@ -41,7 +44,11 @@ public:
     void set_onstatechange(WebIDL::CallbackType*);
     WebIDL::CallbackType* onstatechange();
 
-    void set_sample_rate(float sample_rate) { m_sample_rate = sample_rate; }
+    void set_sample_rate(float sample_rate)
+    {
+        m_sample_rate = sample_rate;
+        m_render_graph->set_sample_rate(sample_rate);
+    }
     void set_control_state(Bindings::AudioContextState state) { m_control_thread_state = state; }
     void set_rendering_state(Bindings::AudioContextState state) { m_rendering_thread_state = state; }
 
@@ -52,14 +59,34 @@ public:
     WebIDL::ExceptionOr<JS::NonnullGCPtr<DynamicsCompressorNode>> create_dynamics_compressor();
     JS::NonnullGCPtr<GainNode> create_gain();
 
+    RenderGraph& render_graph() { return *m_render_graph; }
+
+    // Keeps a started source node alive until it has played, so that it can be told when it has ended.
+    void add_playing_source_node(JS::NonnullGCPtr<AudioScheduledSourceNode>);
+
+    // Fires an ended event at every source node that the rendering thread has finished playing since the last call.
+    void queue_ended_events();
+
+    void queue_a_media_element_task(Function<void()> steps);
+
 protected:
-    explicit BaseAudioContext(JS::Realm&, float m_sample_rate = 0);
+    explicit BaseAudioContext(JS::Realm&, float m_sample_rate = 0, WebIDL::UnsignedLong destination_channel_count = 2);
 
     virtual void initialize(JS::Realm&) override;
+    virtual void visit_edges(Cell::Visitor&) override;
 
 private:
     float m_sample_rate { 0 };
-    double m_current_time { 0 };
+
+    NonnullRefPtr<RenderGraph> m_render_graph;
+
+    // https://webaudio.github.io/web-audio-api/#dom-baseaudiocontext-destination
+    WebIDL::UnsignedLong m_destination_channel_count { 2 };
+    JS::GCPtr<AudioDestinationNode> m_destination;
+
+    Vector<JS::NonnullGCPtr<AudioScheduledSourceNode>> m_playing_source_nodes;
+
+    HTML::UniqueTaskSource m_media_element_event_task_source {};
 
     Bindings::AudioContextState m_control_thread_state = Bindings::AudioContextState::Suspended;
     Bindings::AudioContextState m_rendering_thread_state = Bindings::AudioContextState::Suspended;
@@ -0,0 +1,183 @@
+/*
+ * Copyright (c) 2024, the SerenityOS developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/Math.h>
+#include <AK/SIMD.h>
+#include <AK/SIMDExtras.h>
+#include <AK/SIMDMath.h>
+#include <LibWeb/WebAudio/DSP.h>
+
+// See AK/SIMDMath.h for why this warning is disabled.
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wpsabi"
+
+namespace Web::WebAudio::DSP {
+
+using AK::SIMD::f32x4;
+
+static constexpr size_t lanes = 4;
+
+ALWAYS_INLINE static f32x4 load(float const* source)
+{
+    f32x4 value;
+    __builtin_memcpy(&value, source, sizeof(value));
+    return value;
+}
+
+ALWAYS_INLINE static void store(float* destination, f32x4 value)
+{
+    __builtin_memcpy(destination, &value, sizeof(value));
+}
+
+ALWAYS_INLINE static f32x4 abs(f32x4 value)
+{
+    return value < 0.0f ? -value : value;
+}
+
+ALWAYS_INLINE static f32x4 max(f32x4 a, f32x4 b)
+{
+    return a > b ? a : b;
+}
+
+void add(Span<float> destination, ReadonlySpan<float> source)
+{
+    VERIFY(destination.size() == source.size());
+
+    size_t i = 0;
+    for (; i + lanes <= destination.size(); i += lanes)
+        store(&destination[i], load(&destination[i]) + load(&source[i]));
+    for (; i < destination.size(); ++i)
+        destination[i] += source[i];
+}
+
+void add_scaled(Span<float> destination, ReadonlySpan<float> source, float scale)
+{
+    VERIFY(destination.size() == source.size());
+
+    auto scale4 = AK::SIMD::expand4(scale);
+
+    size_t i = 0;
+    for (; i + lanes <= destination.size(); i += lanes)
+        store(&destination[i], load(&destination[i]) + load(&source[i]) * scale4);
+    for (; i < destination.size(); ++i)
+        destination[i] += source[i] * scale;
+}
+
+void multiply(Span<float> destination, ReadonlySpan<float> source, float gain)
+{
+    VERIFY(destination.size() == source.size());
+
+    auto gain4 = AK::SIMD::expand4(gain);
+
+    size_t i = 0;
+    for (; i + lanes <= destination.size(); i += lanes)
+        store(&destination[i], load(&source[i]) * gain4);
+    for (; i < destination.size(); ++i)
+        destination[i] = source[i] * gain;
+}
+
+void multiply(Span<float> destination, ReadonlySpan<float> source, ReadonlySpan<float> gains)
+{
+    VERIFY(destination.size() == source.size());
+    VERIFY(destination.size() == gains.size());
+
+    size_t i = 0;
+    for (; i + lanes <= destination.size(); i += lanes)
+        store(&destination[i], load(&source[i]) * load(&gains[i]));
+    for (; i < destination.size(); ++i)
+        destination[i] = source[i] * gains[i];
+}
+
+void clamp(Span<float> values, float min, float max)
+{
+    size_t i = 0;
+    for (; i + lanes <= values.size(); i += lanes)
+        store(&values[i], AK::SIMD::clamp(load(&values[i]), min, max));
+    for (; i < values.size(); ++i)
+        values[i] = AK::clamp(values[i], min, max);
+}
+
+void max_magnitude(Span<float> destination, ReadonlySpan<float> source)
+{
+    VERIFY(destination.size() == source.size());
+
+    size_t i = 0;
+    for (; i + lanes <= destination.size(); i += lanes)
+        store(&destination[i], max(load(&destination[i]), abs(load(&source[i]))));
+    for (; i < destination.size(); ++i)
+        destination[i] = AK::max(destination[i], AK::fabs(source[i]));
+}
+
+// Approximates sin(2 * pi * phase) for a phase within [0, 1), with an error below 1e-6.
+ALWAYS_INLINE static f32x4 sine(f32x4 phase)
+{
+    // sin(2 * pi * p) = -sin(2 * pi * (p - 0.5)), which moves the phase into [-0.5, 0.5).
+    auto y = phase - 0.5f;
+
+    // sin(pi - x) = sin(x), which folds it further into [-0.25, 0.25].
+    y = y > 0.25f ? 0.5f - y : y;
+    y = y < -0.25f ? -0.5f - y : y;
+
+    // A Taylor series is accurate enough within [-pi / 2, pi / 2].
+    auto x = y * (2.0f * AK::Pi<float>);
+    auto x2 = x * x;
+    auto result = 1.0f - x2 / 110.0f;
+    result = 1.0f - x2 / 72.0f * result;
+    result = 1.0f - x2 / 42.0f * result;
+    result = 1.0f - x2 / 20.0f * result;
+    result = 1.0f - x2 / 6.0f * result;
+    return -(x * result);
+}
+
+// https://webaudio.github.io/web-audio-api/#oscillator-coefficients
+ALWAYS_INLINE static f32x4 waveform(f32x4 phase, Bindings::OscillatorType type)
+{
+    switch (type) {
+    case Bindings::OscillatorType::Sine:
+        return sine(phase);
+    case Bindings::OscillatorType::Square:
+        return phase < 0.5f ? AK::SIMD::expand4(1.0f) : AK::SIMD::expand4(-1.0f);
+    case Bindings::OscillatorType::Sawtooth:
+        return phase < 0.5f ? 2.0f * phase : 2.0f * phase - 2.0f;
+    case Bindings::OscillatorType::Triangle:
+        return phase < 0.25f ? 4.0f * phase : (phase < 0.75f ? 2.0f - 4.0f * phase : 4.0f * phase - 4.0f);
+    case Bindings::OscillatorType::Custom:
+        // FIXME: Support PeriodicWave.
+        return AK::SIMD::expand4(0.0f);
+    }
+    VERIFY_NOT_REACHED();
+}
+
+float generate_oscillator(Span<float> output, ReadonlySpan<float> frequencies, float sample_rate, float phase, Bindings::OscillatorType type)
+{
+    VERIFY(output.size() == frequencies.size());
+
+    // Accumulating the phase is inherently serial, so it is done first, leaving the waveform itself to be
+    // evaluated four frames at a time.
+    auto inverse_sample_rate = 1.0f / sample_rate;
+    for (size_t i = 0; i < output.size(); ++i) {
+        output[i] = phase;
+
+        // The frequency is clamped to the Nyquist frequency, so the phase never moves by more than half a cycle.
+        phase += frequencies[i] * inverse_sample_rate;
+        if (phase >= 1.0f)
+            phase -= 1.0f;
+        else if (phase < 0.0f)
+            phase += 1.0f;
+    }
+
+    size_t i = 0;
+    for (; i + lanes <= output.size(); i += lanes)
+        store(&output[i], waveform(load(&output[i]), type));
+    for (; i < output.size(); ++i)
+        output[i] = waveform(AK::SIMD::expand4(output[i]), type)[0];
+
+    return phase;
+}
+
+}
+
+#pragma GCC diagnostic pop
@@ -0,0 +1,39 @@
+/*
+ * Copyright (c) 2024, the SerenityOS developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/Span.h>
+#include <LibWeb/Bindings/OscillatorNodePrototype.h>
+
+// Vectorized kernels for the audio rendering thread. They all accept any length, but are fastest for multiples of 4.
+namespace Web::WebAudio::DSP {
+
+// destination[i] += source[i]
+void add(Span<float> destination, ReadonlySpan<float> source);
+
+// destination[i] += source[i] * scale
+void add_scaled(Span<float> destination, ReadonlySpan<float> source, float scale);
+
+// destination[i] = source[i] * gain
+void multiply(Span<float> destination, ReadonlySpan<float> source, float gain);
+
+// destination[i] = source[i] * gains[i]
+void multiply(Span<float> destination, ReadonlySpan<float> source, ReadonlySpan<float> gains);
+
+// values[i] = clamp(values[i], min, max)
+void clamp(Span<float> values, float min, float max);
+
+// destination[i] = max(destination[i], abs(source[i]))
+void max_magnitude(Span<float> destination, ReadonlySpan<float> source);
+
+// Writes one sample of the given waveform per output frame, advancing the phase (in cycles, within [0, 1)) by
+// frequencies[i] / sample_rate after each frame. Returns the phase after the last frame.
+//
+// FIXME: The non-sine waveforms are not band-limited, so they alias at high frequencies.
+float generate_oscillator(Span<float> output, ReadonlySpan<float> frequencies, float sample_rate, float phase, Bindings::OscillatorType);
+
+}
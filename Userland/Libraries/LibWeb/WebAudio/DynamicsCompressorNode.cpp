@@ -8,6 +8,7 @@
 #include <LibWeb/Bindings/Intrinsics.h>
 #include <LibWeb/WebAudio/AudioParam.h>
 #include <LibWeb/WebAudio/DynamicsCompressorNode.h>
+#include <LibWeb/WebAudio/RenderNodes.h>
 
 namespace Web::WebAudio {
 
@@ -29,12 +30,26 @@ WebIDL::ExceptionOr<JS::NonnullGCPtr<DynamicsCompressorNode>> DynamicsCompressor
 
 DynamicsCompressorNode::DynamicsCompressorNode(JS::Realm& realm, JS::NonnullGCPtr<BaseAudioContext> context, DynamicsCompressorOptions const& options)
     : AudioNode(realm, context)
-    , m_threshold(AudioParam::create(realm, options.threshold, -100, 0, Bindings::AutomationRate::KRate))
-    , m_knee(AudioParam::create(realm, options.knee, 0, 40, Bindings::AutomationRate::KRate))
-    , m_ratio(AudioParam::create(realm, options.ratio, 1, 20, Bindings::AutomationRate::KRate))
-    , m_attack(AudioParam::create(realm, options.attack, 0, 1, Bindings::AutomationRate::KRate))
-    , m_release(AudioParam::create(realm, options.release, 0, 1, Bindings::AutomationRate::KRate))
+    , m_threshold(AudioParam::create(realm, context, options.threshold, -100, 0, Bindings::AutomationRate::KRate))
+    , m_knee(AudioParam::create(realm, context, options.knee, 0, 40, Bindings::AutomationRate::KRate))
+    , m_ratio(AudioParam::create(realm, context, options.ratio, 1, 20, Bindings::AutomationRate::KRate))
+    , m_attack(AudioParam::create(realm, context, options.attack, 0, 1, Bindings::AutomationRate::KRate))
+    , m_release(AudioParam::create(realm, context, options.release, 0, 1, Bindings::AutomationRate::KRate))
 {
+    set_render_node(DynamicsCompressorRenderNode::create({
+        .threshold = m_threshold->render_param(),
+        .knee = m_knee->render_param(),
+        .ratio = m_ratio->render_param(),
+        .attack = m_attack->render_param(),
+        .release = m_release->render_param(),
+    }));
+}
+
+// https://webaudio.github.io/web-audio-api/#dom-dynamicscompressornode-reduction
+float DynamicsCompressorNode::reduction() const
+{
+    // This is the value this node reads from its [[internal reduction]] slot, which the rendering thread updates.
+    return static_cast<DynamicsCompressorRenderNode const&>(render_node()).reduction();
 }
 
 void DynamicsCompressorNode::initialize(JS::Realm& realm)
@@ -8,6 +8,7 @@
 #include <LibWeb/WebAudio/AudioParam.h>
 #include <LibWeb/WebAudio/BaseAudioContext.h>
 #include <LibWeb/WebAudio/GainNode.h>
+#include <LibWeb/WebAudio/RenderNodes.h>
 
 namespace Web::WebAudio {
 
@@ -29,8 +30,9 @@ JS::NonnullGCPtr<GainNode> GainNode::construct_impl(JS::Realm& realm, JS::Nonnul
 
 GainNode::GainNode(JS::Realm& realm, JS::NonnullGCPtr<BaseAudioContext> context, GainOptions const& options)
     : AudioNode(realm, context)
-    , m_gain(AudioParam::create(realm, options.gain, NumericLimits<float>::lowest(), NumericLimits<float>::max(), Bindings::AutomationRate::ARate))
+    , m_gain(AudioParam::create(realm, context, options.gain, NumericLimits<float>::lowest(), NumericLimits<float>::max(), Bindings::AutomationRate::ARate))
 {
+    set_render_node(GainRenderNode::create(m_gain->render_param()));
 }
 
 void GainNode::initialize(JS::Realm& realm)
@@ -4,10 +4,16 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <LibJS/Runtime/TypedArray.h>
+#include <LibWeb/Bindings/ExceptionOrUtils.h>
 #include <LibWeb/Bindings/Intrinsics.h>
+#include <LibWeb/DOM/Document.h>
+#include <LibWeb/DOM/Event.h>
 #include <LibWeb/HTML/EventNames.h>
 #include <LibWeb/HTML/Window.h>
+#include <LibWeb/WebAudio/AudioBuffer.h>
 #include <LibWeb/WebAudio/OfflineAudioContext.h>
+#include <LibWeb/WebIDL/Promise.h>
 
 namespace Web::WebAudio {
 
@@ -34,7 +40,97 @@ OfflineAudioContext::~OfflineAudioContext() = default;
 // https://webaudio.github.io/web-audio-api/#dom-offlineaudiocontext-startrendering
 WebIDL::ExceptionOr<JS::NonnullGCPtr<JS::Promise>> OfflineAudioContext::start_rendering()
 {
-    return WebIDL::NotSupportedError::create(realm(), "FIXME: Implement OfflineAudioContext::start_rendering"_fly_string);
+    auto& realm = this->realm();
+
+    // 1. If this's relevant global object's associated Document is not fully active then return a promise rejected with "InvalidStateError" DOMException.
+    auto const& associated_document = verify_cast<HTML::Window>(HTML::relevant_global_object(*this)).associated_document();
+    if (!associated_document.is_fully_active())
+        return WebIDL::InvalidStateError::create(realm, "Document is not fully active"_fly_string);
+
+    // 2. If the [[rendering started]] slot on the OfflineAudioContext is true, return a rejected promise with InvalidStateError, and abort these steps.
+    if (m_rendering_started)
+        return WebIDL::InvalidStateError::create(realm, "Rendering has already started"_fly_string);
+
+    // 3. Set the [[rendering started]] slot of the OfflineAudioContext to true.
+    m_rendering_started = true;
+
+    // 4. Let promise be a new promise.
+    auto promise = WebIDL::create_promise(realm);
+
+    // 5. Create a new AudioBuffer, with a number of channels, length and sample rate equal respectively to the
+    //    numberOfChannels, length and sampleRate values passed to this instance's constructor in the contextOptions
+    //    parameter. Assign this buffer to an internal slot [[rendered buffer]] in the OfflineAudioContext.
+    // 6. If an exception was thrown during the preceding AudioBuffer constructor call, reject promise with this exception.
+    auto buffer_or_error = AudioBuffer::create(realm, m_number_of_channels, m_length, sample_rate());
+    if (buffer_or_error.is_error()) {
+        auto completion = Bindings::dom_exception_to_throw_completion(vm(), buffer_or_error.exception());
+        WebIDL::reject_promise(realm, promise, *completion.value());
+        return JS::NonnullGCPtr { verify_cast<JS::Promise>(*promise->promise()) };
+    }
+    m_rendered_buffer = buffer_or_error.release_value();
+
+    // Otherwise, in the case that the buffer was successfully constructed, begin offline rendering.
+    // NOTE: Rendering is much faster than real time, so it is done in a single task rather than on another thread.
+    m_rendering_promise = promise;
+    queue_a_media_element_task([this] {
+        render_offline();
+    });
+
+    // 7. Append promise to [[pending promises]].
+    // 8. Return promise.
+    return JS::NonnullGCPtr { verify_cast<JS::Promise>(*promise->promise()) };
+}
+
+// https://webaudio.github.io/web-audio-api/#offline-rendering
+void OfflineAudioContext::render_offline()
+{
+    auto& realm = this->realm();
+
+    set_control_state(Bindings::AudioContextState::Running);
+    set_rendering_state(Bindings::AudioContextState::Running);
+
+    // 1. Given the current connections and scheduled changes, start rendering length sample-frames of audio into
+    //    [[rendered buffer]].
+    Vector<Span<float>> channels;
+    for (WebIDL::UnsignedLong i = 0; i < m_number_of_channels; ++i)
+        channels.append(MUST(m_rendered_buffer->get_channel_data(i))->data());
+
+    // 2. For every render quantum, check and suspend rendering if necessary.
+    // FIXME: Suspending at the times given to suspend() is not implemented.
+    // 3. If a suspended context is resumed, continue to render the buffer.
+    for (size_t frame = 0; frame < m_length; frame += render_quantum_size) {
+        auto const& quantum = render_graph().render_quantum();
+        auto frame_count = min<size_t>(render_quantum_size, m_length - frame);
+
+        // The destination has exactly as many channels as the buffer, unless nothing is connected to it.
+        for (size_t i = 0; i < channels.size(); ++i) {
+            auto destination = channels[i].slice(frame, frame_count);
+            if (quantum.is_silent() || i >= quantum.channel_count())
+                destination.fill(0);
+            else
+                quantum.channel(i).trim(frame_count).copy_to(destination);
+        }
+    }
+
+    queue_ended_events();
+
+    // 4. Once the rendering is complete, queue a media element task to execute the following steps:
+    queue_a_media_element_task([&realm, this] {
+        // 4.1. Resolve the promise created by startRendering() with [[rendered buffer]].
+        WebIDL::resolve_promise(realm, *m_rendering_promise, m_rendered_buffer);
+        m_rendering_promise = nullptr;
+
+        set_control_state(Bindings::AudioContextState::Closed);
+        set_rendering_state(Bindings::AudioContextState::Closed);
+        dispatch_event(DOM::Event::create(realm, HTML::EventNames::statechange));
+
+        // 4.2. Queue a media element task to fire an event named complete using an instance of OfflineAudioCompletionEvent
+        //      whose renderedBuffer property is set to [[rendered buffer]].
+        // FIXME: Fire an OfflineAudioCompletionEvent once it is implemented.
+        queue_a_media_element_task([&realm, this] {
+            dispatch_event(DOM::Event::create(realm, HTML::EventNames::complete));
+        });
+    });
 }
 
 WebIDL::ExceptionOr<JS::NonnullGCPtr<JS::Promise>> OfflineAudioContext::resume()
@@ -73,10 +169,10 @@ OfflineAudioContext::OfflineAudioContext(JS::Realm& realm, OfflineAudioContextOp
 }
 
 OfflineAudioContext::OfflineAudioContext(JS::Realm& realm, WebIDL::UnsignedLong number_of_channels, WebIDL::UnsignedLong length, float sample_rate)
-    : BaseAudioContext(realm, sample_rate)
+    : BaseAudioContext(realm, sample_rate, number_of_channels)
+    , m_number_of_channels(number_of_channels)
     , m_length(length)
 {
-    (void)number_of_channels;
 }
 
 void OfflineAudioContext::initialize(JS::Realm& realm)
@@ -88,6 +184,8 @@ void OfflineAudioContext::initialize(JS::Realm& realm)
 void OfflineAudioContext::visit_edges(Cell::Visitor& visitor)
 {
     Base::visit_edges(visitor);
+    visitor.visit(m_rendered_buffer);
+    visitor.visit(m_rendering_promise);
 }
 
 }
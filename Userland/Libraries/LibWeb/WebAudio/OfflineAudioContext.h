@@ -48,7 +48,18 @@ private:
     virtual void initialize(JS::Realm&) override;
     virtual void visit_edges(Cell::Visitor&) override;
 
+    void render_offline();
+
+    WebIDL::UnsignedLong m_number_of_channels {};
     WebIDL::UnsignedLong m_length {};
+
+    // https://webaudio.github.io/web-audio-api/#dom-offlineaudiocontext-rendering-started-slot
+    bool m_rendering_started { false }; // [[rendering started]]
+
+    // https://webaudio.github.io/web-audio-api/#dom-offlineaudiocontext-rendered-buffer-slot
+    JS::GCPtr<AudioBuffer> m_rendered_buffer; // [[rendered buffer]]
+
+    JS::GCPtr<WebIDL::Promise> m_rendering_promise;
 };
 
 }
@@ -9,6 +9,7 @@
 #include <LibWeb/WebAudio/AudioParam.h>
 #include <LibWeb/WebAudio/BaseAudioContext.h>
 #include <LibWeb/WebAudio/OscillatorNode.h>
+#include <LibWeb/WebAudio/RenderNodes.h>
 
 namespace Web::WebAudio {
 
@@ -32,8 +33,10 @@ WebIDL::ExceptionOr<JS::NonnullGCPtr<OscillatorNode>> OscillatorNode::construct_
 
 OscillatorNode::OscillatorNode(JS::Realm& realm, JS::NonnullGCPtr<BaseAudioContext> context, OscillatorOptions const& options)
     : AudioScheduledSourceNode(realm, context)
-    , m_frequency(AudioParam::create(realm, options.frequency, -context->nyquist_frequency(), context->nyquist_frequency(), Bindings::AutomationRate::ARate))
+    , m_type(options.type)
+    , m_frequency(AudioParam::create(realm, context, options.frequency, -context->nyquist_frequency(), context->nyquist_frequency(), Bindings::AutomationRate::ARate))
 {
+    set_render_node(OscillatorRenderNode::create(m_type, m_frequency->render_param()));
 }
 
 // https://webaudio.github.io/web-audio-api/#dom-oscillatornode-type
@@ -60,6 +63,7 @@ WebIDL::ExceptionOr<void> OscillatorNode::set_type(Bindings::OscillatorType type
 {
     TRY(verify_valid_type(realm(), type));
     m_type = type;
+    static_cast<OscillatorRenderNode&>(render_node()).set_type(type);
     return {};
 }
 
@@ -0,0 +1,554 @@
+/*
+ * Copyright (c) 2024, the SerenityOS developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/AllOf.h>
+#include <AK/HashTable.h>
+#include <AK/Math.h>
+#include <LibWeb/WebAudio/DSP.h>
+#include <LibWeb/WebAudio/RenderGraph.h>
+
+namespace Web::WebAudio {
+
+NonnullRefPtr<RenderParam> RenderParam::create(float default_value, float min_value, float max_value, Bindings::AutomationRate automation_rate)
+{
+    return adopt_ref(*new RenderParam(default_value, min_value, max_value, automation_rate));
+}
+
+RenderParam::RenderParam(float default_value, float min_value, float max_value, Bindings::AutomationRate automation_rate)
+    : m_min_value(min_value)
+    , m_max_value(max_value)
+    , m_automation_rate(automation_rate)
+    , m_current_value(default_value)
+    , m_intrinsic_value(default_value)
+{
+}
+
+void RenderParam::set_intrinsic_value(float value)
+{
+    Threading::MutexLocker locker(m_mutex);
+    m_intrinsic_value = value;
+    m_current_value.store(value, AK::MemoryOrder::memory_order_relaxed);
+    compute_start_values();
+}
+
+bool RenderParam::has_events() const
+{
+    Threading::MutexLocker locker(m_mutex);
+    return !m_events.is_empty();
+}
+
+bool RenderParam::overlaps_value_curve(double start_time, double end_time) const
+{
+    Threading::MutexLocker locker(m_mutex);
+    for (auto const& event : m_events) {
+        if (event.type == AutomationEvent::Type::SetValueCurve) {
+            if (start_time < event.end_time() && (event.time < end_time || event.time == start_time))
+                return true;
+        } else if (event.time >= start_time && event.time < end_time) {
+            return true;
+        }
+    }
+    return false;
+}
+
+// https://webaudio.github.io/web-audio-api/#dom-audioparam-setvalueattime
+void RenderParam::insert_event(AutomationEvent event)
+{
+    Threading::MutexLocker locker(m_mutex);
+
+    // If one of these events is added at a time where there is already one or more events, then it will be placed in
+    // the list after them, but before events whose times are after the event.
+    size_t index = 0;
+    while (index < m_events.size() && m_events[index].time <= event.time)
+        ++index;
+    m_events.insert(index, move(event));
+
+    compute_start_values();
+}
+
+// https://webaudio.github.io/web-audio-api/#dom-audioparam-cancelscheduledvalues
+void RenderParam::cancel_scheduled_values(double cancel_time)
+{
+    Threading::MutexLocker locker(m_mutex);
+
+    // Removes all scheduled parameter changes with times greater than or equal to cancelTime, as well as any
+    // setValueCurve event that is still running at cancelTime.
+    m_events.remove_all_matching([&](auto const& event) {
+        return event.time >= cancel_time || (event.type == AutomationEvent::Type::SetValueCurve && event.end_time() > cancel_time);
+    });
+
+    compute_start_values();
+}
+
+// https://webaudio.github.io/web-audio-api/#dom-audioparam-cancelandholdattime
+void RenderParam::cancel_and_hold_at_time(double cancel_time)
+{
+    Threading::MutexLocker locker(m_mutex);
+
+    auto held_value = value_at_time(cancel_time);
+
+    // A ramp that is still running at the cancel time is cut short, ending at the value it has reached by then.
+    Optional<AutomationEvent::Type> interrupted_ramp_type;
+    for (auto const& event : m_events) {
+        if (event.time > cancel_time) {
+            if (event.is_ramp())
+                interrupted_ramp_type = event.type;
+            break;
+        }
+    }
+
+    // FIXME: A setValueCurve that is running at the cancel time should be truncated rather than held.
+    m_events.remove_all_matching([&](auto const& event) {
+        return event.time > cancel_time || (event.type == AutomationEvent::Type::SetValueCurve && event.end_time() > cancel_time);
+    });
+
+    size_t index = 0;
+    while (index < m_events.size() && m_events[index].time <= cancel_time)
+        ++index;
+    m_events.insert(index, AutomationEvent { .type = interrupted_ramp_type.value_or(AutomationEvent::Type::SetValue), .time = cancel_time, .value = held_value });
+
+    compute_start_values();
+}
+
+void RenderParam::compute_start_values()
+{
+    m_event_start_values.resize(m_events.size());
+    m_current_event_index = 0;
+
+    for (size_t i = 0; i < m_events.size(); ++i) {
+        if (i == 0)
+            m_event_start_values[i] = m_intrinsic_value;
+        else if (m_events[i].is_ramp())
+            m_event_start_values[i] = value_of_event_at_time(i - 1, m_events[i - 1].end_time());
+        else
+            m_event_start_values[i] = value_of_event_at_time(i - 1, m_events[i].time);
+    }
+}
+
+// The value from the given event onwards, ignoring any ramp that follows it.
+float RenderParam::value_of_event_at_time(size_t index, double time) const
+{
+    auto const& event = m_events[index];
+
+    switch (event.type) {
+    case AutomationEvent::Type::SetValue:
+    case AutomationEvent::Type::LinearRamp:
+    case AutomationEvent::Type::ExponentialRamp:
+        return event.value;
+
+    // https://webaudio.github.io/web-audio-api/#dom-audioparam-settargetattime
+    case AutomationEvent::Type::SetTarget: {
+        if (event.time_constant == 0)
+            return event.value;
+
+        // v(t) = V1 + (V0 - V1) * e^(-(t - T0) / timeConstant)
+        auto start_value = m_event_start_values[index];
+        return static_cast<float>(event.value + (start_value - event.value) * AK::exp(-(time - event.time) / event.time_constant));
+    }
+
+    // https://webaudio.github.io/web-audio-api/#dom-audioparam-setvaluecurveattime
+    case AutomationEvent::Type::SetValueCurve: {
+        auto const& curve = event.curve;
+        if (time >= event.end_time())
+            return curve.last();
+
+        // k = floor((N - 1) / duration * (t - T0)), interpolating linearly between curve[k] and curve[k + 1].
+        auto position = static_cast<double>(curve.size() - 1) / event.duration * (time - event.time);
+        auto k = static_cast<size_t>(position);
+        if (k + 1 >= curve.size())
+            return curve.last();
+        return static_cast<float>(curve[k] + (curve[k + 1] - curve[k]) * (position - static_cast<double>(k)));
+    }
+    }
+    VERIFY_NOT_REACHED();
+}
+
+// The value of the given ramp event, before it has reached its end time.
+float RenderParam::ramp_value_at_time(size_t index, double time) const
+{
+    auto const& event = m_events[index];
+
+    auto start_time = index > 0 ? m_events[index - 1].end_time() : 0;
+    auto start_value = m_event_start_values[index];
+    if (event.time <= start_time)
+        return event.value;
+
+    auto progress = (time - start_time) / (event.time - start_time);
+
+    // https://webaudio.github.io/web-audio-api/#dom-audioparam-linearramptovalueattime
+    if (event.type == AutomationEvent::Type::LinearRamp)
+        return static_cast<float>(start_value + (event.value - start_value) * progress);
+
+    // https://webaudio.github.io/web-audio-api/#dom-audioparam-exponentialramptovalueattime
+    // If V0 and V1 have opposite signs or if V0 is zero, then v(t) = V0 for T0 <= t < T1.
+    if (start_value == 0 || (start_value < 0) != (event.value < 0))
+        return start_value;
+    return static_cast<float>(start_value * AK::pow(static_cast<double>(event.value) / start_value, progress));
+}
+
+float RenderParam::value_at_time(double time)
+{
+    if (m_events.is_empty())
+        return m_intrinsic_value;
+
+    // Find the last event at or before this time, starting from where the previous lookup left off.
+    auto index = m_current_event_index;
+    if (index >= m_events.size() || m_events[index].time > time)
+        index = 0;
+    while (index + 1 < m_events.size() && m_events[index + 1].time <= time)
+        ++index;
+    m_current_event_index = index;
+
+    bool is_before_first_event = m_events[index].time > time;
+
+    // A ramp runs from the end of the event before it up to its own time.
+    auto next_index = is_before_first_event ? 0 : index + 1;
+    if (next_index < m_events.size() && m_events[next_index].is_ramp()) {
+        if (is_before_first_event || time >= m_events[index].end_time())
+            return ramp_value_at_time(next_index, time);
+    }
+
+    if (is_before_first_event)
+        return m_intrinsic_value;
+    return value_of_event_at_time(index, time);
+}
+
+bool RenderParam::compute_values(RenderQuantumContext const& context, Span<float> values)
+{
+    bool is_k_rate = automation_rate() == Bindings::AutomationRate::KRate;
+    bool is_constant = true;
+
+    // NOTE: The control thread may be allocating while it holds the lock, so rather than wait for it, the value of
+    //       the last frame is held for this render quantum.
+    if (!m_mutex.try_lock()) {
+        values.fill(m_last_automation_value);
+    } else {
+        if (m_events.is_empty() || is_k_rate) {
+            values.fill(value_at_time(context.time()));
+        } else {
+            for (size_t i = 0; i < values.size(); ++i)
+                values[i] = value_at_time(static_cast<double>(context.frame + i) / context.sample_rate);
+            is_constant = all_of(values, [&](float value) { return value == values.first(); });
+        }
+        m_mutex.unlock();
+    }
+    m_last_automation_value = values.last();
+
+    // The computed value is the intrinsic value plus the audio of every node connected to this parameter, down-mixed
+    // to mono.
+    if (!m_input_bus.is_silent()) {
+        if (is_k_rate) {
+            values.fill(values.first() + m_input_bus.channel(0).first());
+        } else {
+            DSP::add(values, m_input_bus.channel(0));
+            is_constant = false;
+        }
+    }
+
+    DSP::clamp(values, m_min_value, m_max_value);
+
+    m_current_value.store(values.first(), AK::MemoryOrder::memory_order_relaxed);
+    return is_constant;
+}
+
+RenderNode::RenderNode(size_t number_of_inputs, size_t number_of_outputs, size_t channel_count, Bindings::ChannelCountMode channel_count_mode, Bindings::ChannelInterpretation channel_interpretation)
+    : m_number_of_inputs(number_of_inputs)
+    , m_number_of_outputs(number_of_outputs)
+    , m_channel_count(channel_count)
+    , m_channel_count_mode(channel_count_mode)
+    , m_channel_interpretation(channel_interpretation)
+{
+    m_input_buses.resize(number_of_inputs);
+}
+
+void RenderNode::add_param(NonnullRefPtr<RenderParam> param)
+{
+    m_params.append(move(param));
+}
+
+NonnullRefPtr<RenderGraph> RenderGraph::create(float sample_rate)
+{
+    return adopt_ref(*new RenderGraph(sample_rate));
+}
+
+// Everything the rendering thread needs to render a quantum. It is built by the control thread whenever the
+// connections change, and never modified once it has been published.
+struct RenderGraph::Snapshot {
+    struct Step {
+        NonnullRefPtr<RenderNode> node;
+
+        // The nodes connected to each input of the node, and to each of its parameters in the order of params().
+        Vector<Vector<RenderNode*>> input_sources {};
+        Vector<Vector<RenderNode*>> param_input_sources {};
+    };
+
+    // Every node that the destination depends on, ordered so that nodes come after everything connected to them. The
+    // destination comes last.
+    Vector<Step> processing_order;
+
+    Snapshot* next_retired { nullptr };
+};
+
+RenderGraph::RenderGraph(float sample_rate)
+    : m_sample_rate(sample_rate)
+{
+}
+
+RenderGraph::~RenderGraph()
+{
+    free_retired_snapshots();
+    delete m_pending_snapshot.load();
+    delete m_current_snapshot;
+}
+
+void RenderGraph::set_destination(RenderNode& destination)
+{
+    m_destination = destination;
+    publish_snapshot();
+}
+
+void RenderGraph::connect(RenderNode& source, RenderNode& destination, size_t input)
+{
+    // Connecting the same output to the same input more than once is ignored.
+    for (auto const& connection : m_connections) {
+        if (connection.source == &source && connection.destination_node == &destination && connection.input == input)
+            return;
+    }
+
+    m_connections.append({ .source = source, .destination_node = destination, .input = input });
+    publish_snapshot();
+}
+
+void RenderGraph::connect(RenderNode& source, RenderParam& destination)
+{
+    for (auto const& connection : m_connections) {
+        if (connection.source == &source && connection.destination_param == &destination)
+            return;
+    }
+
+    m_connections.append({ .source = source, .destination_param = destination });
+    publish_snapshot();
+}
+
+void RenderGraph::remove_connections(Function<bool(Connection const&)> const& predicate)
+{
+    if (m_connections.remove_all_matching(predicate))
+        publish_snapshot();
+}
+
+static Optional<size_t> index_of_param(RenderNode const& node, RefPtr<RenderParam> const& param)
+{
+    if (!param)
+        return {};
+    for (size_t i = 0; i < node.params().size(); ++i) {
+        if (node.params()[i].ptr() == param.ptr())
+            return i;
+    }
+    return {};
+}
+
+static bool has_param(RenderNode const& node, RefPtr<RenderParam> const& param)
+{
+    return index_of_param(node, param).has_value();
+}
+
+void RenderGraph::remove_node(RenderNode& node)
+{
+    m_connections.remove_all_matching([&](auto const& connection) {
+        return connection.source == &node || connection.destination_node == &node || has_param(node, connection.destination_param);
+    });
+
+    if (m_destination == &node)
+        m_destination = nullptr;
+
+    publish_snapshot();
+}
+
+void RenderGraph::set_channel_count(RenderNode& node, size_t channel_count)
+{
+    node.m_channel_count.store(channel_count, AK::MemoryOrder::memory_order_relaxed);
+}
+
+void RenderGraph::set_channel_count_mode(RenderNode& node, Bindings::ChannelCountMode channel_count_mode)
+{
+    node.m_channel_count_mode.store(channel_count_mode, AK::MemoryOrder::memory_order_relaxed);
+}
+
+void RenderGraph::set_channel_interpretation(RenderNode& node, Bindings::ChannelInterpretation channel_interpretation)
+{
+    node.m_channel_interpretation.store(channel_interpretation, AK::MemoryOrder::memory_order_relaxed);
+}
+
+// NOTE: This runs on the control thread whenever the connections change, so that the rendering thread never has to
+//       sort the graph or allocate.
+void RenderGraph::publish_snapshot()
+{
+    free_retired_snapshots();
+
+    auto snapshot = make<Snapshot>();
+
+    if (m_destination) {
+        HashTable<RenderNode*> visited_nodes;
+
+        // Nodes are ordered after everything connected to them, directly or through one of their parameters. A cycle
+        // is broken where it is found, and the node that closes it is heard as silence by the rest of the cycle.
+        // FIXME: Cycles without a DelayNode should be muted entirely.
+        Function<void(RenderNode&)> visit = [&](RenderNode& node) {
+            visited_nodes.set(&node);
+
+            Snapshot::Step step { .node = node };
+            step.input_sources.resize(node.m_number_of_inputs);
+            step.param_input_sources.resize(node.m_params.size());
+
+            for (auto const& connection : m_connections) {
+                if (connection.destination_node == &node) {
+                    step.input_sources[connection.input].append(connection.source.ptr());
+                } else if (auto param_index = index_of_param(node, connection.destination_param); param_index.has_value()) {
+                    step.param_input_sources[*param_index].append(connection.source.ptr());
+                } else {
+                    continue;
+                }
+
+                if (!visited_nodes.contains(connection.source.ptr()))
+                    visit(*connection.source);
+            }
+
+            snapshot->processing_order.append(move(step));
+        };
+
+        visit(*m_destination);
+    }
+
+    // A snapshot that the rendering thread never picked up can be freed right away.
+    delete m_pending_snapshot.exchange(snapshot.leak_ptr(), AK::MemoryOrder::memory_order_acq_rel);
+}
+
+void RenderGraph::free_retired_snapshots()
+{
+    auto* snapshot = m_retired_snapshots.exchange(nullptr, AK::MemoryOrder::memory_order_acquire);
+    while (snapshot) {
+        auto* next = snapshot->next_retired;
+        delete snapshot;
+        snapshot = next;
+    }
+}
+
+// https://webaudio.github.io/web-audio-api/#computednumberofchannels
+void RenderGraph::mix_inputs(RenderNode& node, ReadonlySpan<Vector<RenderNode*>> input_sources, RenderQuantumContext const& context)
+{
+    auto channel_count_mode = node.channel_count_mode();
+    auto channel_interpretation = node.channel_interpretation();
+
+    for (size_t input = 0; input < input_sources.size(); ++input) {
+        auto& bus = node.m_input_buses[input];
+        auto const& sources = input_sources[input];
+
+        size_t maximum_channel_count = 1;
+        for (auto* source : sources) {
+            if (source->m_processed_quantum_index == context.index)
+                maximum_channel_count = max(maximum_channel_count, source->output().channel_count());
+        }
+
+        size_t computed_channel_count = maximum_channel_count;
+        switch (channel_count_mode) {
+        case Bindings::ChannelCountMode::Max:
+            break;
+        case Bindings::ChannelCountMode::ClampedMax:
+            computed_channel_count = min(maximum_channel_count, node.channel_count());
+            break;
+        case Bindings::ChannelCountMode::Explicit:
+            computed_channel_count = node.channel_count();
+            break;
+        }
+
+        bus.zero();
+        bus.set_channel_count(computed_channel_count);
+
+        for (auto* source : sources) {
+            if (source->m_processed_quantum_index == context.index)
+                bus.mix_from(source->output(), channel_interpretation);
+        }
+    }
+}
+
+// https://webaudio.github.io/web-audio-api/#rendering-loop
+AudioBus const& RenderGraph::render_quantum()
+{
+    // Pick up the latest snapshot of the graph. The one it replaces is handed back to the control thread, so that
+    // nothing is freed here.
+    if (auto* snapshot = m_pending_snapshot.exchange(nullptr, AK::MemoryOrder::memory_order_acq_rel)) {
+        if (auto* retired_snapshot = m_current_snapshot) {
+            retired_snapshot->next_retired = m_retired_snapshots.load(AK::MemoryOrder::memory_order_relaxed);
+            while (!m_retired_snapshots.compare_exchange_strong(retired_snapshot->next_retired, retired_snapshot, AK::MemoryOrder::memory_order_release))
+                ;
+        }
+        m_current_snapshot = snapshot;
+    }
+
+    RenderQuantumContext context {
+        .sample_rate = m_sample_rate,
+        .frame = current_frame(),
+        .index = m_quantum_index++,
+    };
+
+    m_current_frame.store(context.frame + render_quantum_size, AK::MemoryOrder::memory_order_relaxed);
+
+    if (!m_current_snapshot || m_current_snapshot->processing_order.is_empty())
+        return m_silence;
+
+    for (auto& step : m_current_snapshot->processing_order) {
+        auto& node = *step.node;
+        mix_inputs(node, step.input_sources, context);
+
+        // The audio of the nodes connected to a parameter is down-mixed to mono.
+        for (size_t i = 0; i < node.m_params.size(); ++i) {
+            auto& bus = node.m_params[i]->m_input_bus;
+            bus.zero();
+            for (auto* source : step.param_input_sources[i]) {
+                if (source->m_processed_quantum_index == context.index)
+                    bus.mix_from(source->output(), Bindings::ChannelInterpretation::Speakers);
+            }
+        }
+
+        node.process(context, node.m_input_buses);
+        node.m_processed_quantum_index = context.index;
+    }
+
+    return m_current_snapshot->processing_order.last().node->output();
+}
+
+void RenderGraph::render_interleaved(Span<float> output, size_t channel_count)
+{
+    auto frame_count = output.size() / channel_count;
+
+    for (size_t frame = 0; frame < frame_count;) {
+        if (m_frames_left_in_last_quantum == 0) {
+            m_last_rendered_quantum = &render_quantum();
+            m_frames_left_in_last_quantum = render_quantum_size;
+        }
+
+        auto const& bus = *m_last_rendered_quantum;
+        auto offset = render_quantum_size - m_frames_left_in_last_quantum;
+        auto frames_to_copy = min(m_frames_left_in_last_quantum, frame_count - frame);
+
+        for (size_t channel = 0; channel < channel_count; ++channel) {
+            // A mono destination is played on every output channel, and any other missing channels are silent.
+            Optional<ReadonlySpan<float>> samples;
+            if (channel < bus.channel_count())
+                samples = bus.channel(channel);
+            else if (bus.channel_count() == 1)
+                samples = bus.channel(0);
+
+            for (size_t i = 0; i < frames_to_copy; ++i)
+                output[(frame + i) * channel_count + channel] = samples.has_value() ? (*samples)[offset + i] : 0;
+        }
+
+        frame += frames_to_copy;
+        m_frames_left_in_last_quantum -= frames_to_copy;
+    }
+}
+
+}
@@ -0,0 +1,242 @@
+/*
+ * Copyright (c) 2024, the SerenityOS developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/Atomic.h>
+#include <AK/AtomicRefCounted.h>
+#include <AK/Function.h>
+#include <AK/NonnullRefPtr.h>
+#include <AK/Vector.h>
+#include <LibThreading/Mutex.h>
+#include <LibWeb/Bindings/AudioParamPrototype.h>
+#include <LibWeb/WebAudio/AudioBus.h>
+
+// The rendering side of an audio graph.
+//
+// Every AudioNode and AudioParam owns a RenderNode or RenderParam, which is all the rendering thread ever sees. The
+// control thread (the JS thread) changes the connections through the RenderGraph, which publishes an immutable
+// snapshot of them for the rendering thread to pick up at the start of its next render quantum. Nothing here may
+// allocate, free or block while rendering.
+
+namespace Web::WebAudio {
+
+class RenderNode;
+
+struct RenderQuantumContext {
+    float sample_rate { 0 };
+
+    // The frame at which this render quantum starts.
+    u64 frame { 0 };
+
+    // Increases by one for every render quantum, so that nodes can tell whether they have been processed yet.
+    u64 index { 0 };
+
+    double time() const { return static_cast<double>(frame) / sample_rate; }
+};
+
+// https://webaudio.github.io/web-audio-api/#dfn-automation-event
+struct AutomationEvent {
+    enum class Type {
+        SetValue,
+        LinearRamp,
+        ExponentialRamp,
+        SetTarget,
+        SetValueCurve,
+    };
+
+    Type type { Type::SetValue };
+    double time { 0 };
+    float value { 0 };
+    double time_constant { 0 };
+    double duration { 0 };
+    Vector<float> curve {};
+
+    bool is_ramp() const { return type == Type::LinearRamp || type == Type::ExponentialRamp; }
+    double end_time() const { return type == Type::SetValueCurve ? time + duration : time; }
+};
+
+class RenderParam : public AtomicRefCounted<RenderParam> {
+public:
+    static NonnullRefPtr<RenderParam> create(float default_value, float min_value, float max_value, Bindings::AutomationRate);
+
+    float min_value() const { return m_min_value; }
+    float max_value() const { return m_max_value; }
+
+    Bindings::AutomationRate automation_rate() const { return m_automation_rate.load(AK::MemoryOrder::memory_order_relaxed); }
+    void set_automation_rate(Bindings::AutomationRate rate) { m_automation_rate.store(rate, AK::MemoryOrder::memory_order_relaxed); }
+
+    // https://webaudio.github.io/web-audio-api/#dom-audioparam-current-value-slot
+    float current_value() const { return m_current_value.load(AK::MemoryOrder::memory_order_relaxed); }
+
+    // Sets the value used while there are no automation events.
+    void set_intrinsic_value(float);
+
+    bool has_events() const;
+    // Whether an event from start_time up to end_time would overlap a value curve, or another event if it is a curve
+    // itself. Events that take no time pass the same start and end time.
+    bool overlaps_value_curve(double start_time, double end_time) const;
+    void insert_event(AutomationEvent);
+    void cancel_scheduled_values(double cancel_time);
+    void cancel_and_hold_at_time(double cancel_time);
+
+    // Computes the value of this parameter for every frame of the render quantum, including the audio of any nodes
+    // connected to it. For a k-rate parameter, every frame holds the value of the first frame. Returns whether every
+    // frame holds the same value, so that callers can use a cheaper path.
+    // https://webaudio.github.io/web-audio-api/#computation-of-value
+    bool compute_values(RenderQuantumContext const&, Span<float> values);
+
+private:
+    friend class RenderGraph;
+
+    RenderParam(float default_value, float min_value, float max_value, Bindings::AutomationRate);
+
+    void compute_start_values();
+    float value_at_time(double time);
+    float value_of_event_at_time(size_t index, double time) const;
+    float ramp_value_at_time(size_t index, double time) const;
+
+    float const m_min_value { 0 };
+    float const m_max_value { 0 };
+    Atomic<Bindings::AutomationRate> m_automation_rate;
+    Atomic<float> m_current_value { 0 };
+
+    mutable Threading::Mutex m_mutex;
+
+    float m_intrinsic_value { 0 };
+
+    // The automation value of the last frame rendered, which is held while the control thread is changing the events.
+    float m_last_automation_value { 0 };
+
+    // Sorted by time. The start value of each event is the value of the parameter just before the event begins.
+    Vector<AutomationEvent> m_events;
+    Vector<float> m_event_start_values;
+
+    // The first event that might still affect the value. Rendering only ever moves forward in time.
+    size_t m_current_event_index { 0 };
+
+    // The outputs of the nodes connected to this parameter, mixed by the graph before the node that owns it is processed.
+    AudioBus m_input_bus { 1 };
+};
+
+class RenderNode : public AtomicRefCounted<RenderNode> {
+public:
+    virtual ~RenderNode() = default;
+
+    size_t number_of_inputs() const { return m_number_of_inputs; }
+    size_t number_of_outputs() const { return m_number_of_outputs; }
+
+    // https://webaudio.github.io/web-audio-api/#channel-up-mixing-and-down-mixing
+    size_t channel_count() const { return m_channel_count.load(AK::MemoryOrder::memory_order_relaxed); }
+    Bindings::ChannelCountMode channel_count_mode() const { return m_channel_count_mode.load(AK::MemoryOrder::memory_order_relaxed); }
+    Bindings::ChannelInterpretation channel_interpretation() const { return m_channel_interpretation.load(AK::MemoryOrder::memory_order_relaxed); }
+
+    AudioBus const& output() const { return m_output; }
+
+    ReadonlySpan<NonnullRefPtr<RenderParam>> params() const { return m_params; }
+
+    // Renders one quantum into output(). Every input has already been mixed down to its computed channel count.
+    virtual void process(RenderQuantumContext const&, ReadonlySpan<AudioBus> inputs) = 0;
+
+protected:
+    RenderNode(size_t number_of_inputs, size_t number_of_outputs, size_t channel_count, Bindings::ChannelCountMode, Bindings::ChannelInterpretation);
+
+    void add_param(NonnullRefPtr<RenderParam>);
+
+    AudioBus m_output;
+
+private:
+    friend class RenderGraph;
+    friend class RenderParam;
+
+    size_t const m_number_of_inputs { 0 };
+    size_t const m_number_of_outputs { 0 };
+
+    Atomic<size_t> m_channel_count { 2 };
+    Atomic<Bindings::ChannelCountMode> m_channel_count_mode { Bindings::ChannelCountMode::Max };
+    Atomic<Bindings::ChannelInterpretation> m_channel_interpretation { Bindings::ChannelInterpretation::Speakers };
+
+    Vector<NonnullRefPtr<RenderParam>> m_params;
+
+    // Only used by the rendering thread: a bus per input to mix the nodes connected to it into.
+    Vector<AudioBus> m_input_buses;
+
+    // The render quantum that output() was last rendered for.
+    Optional<u64> m_processed_quantum_index;
+};
+
+// https://webaudio.github.io/web-audio-api/#rendering-loop
+class RenderGraph : public AtomicRefCounted<RenderGraph> {
+public:
+    static NonnullRefPtr<RenderGraph> create(float sample_rate);
+    ~RenderGraph();
+
+    float sample_rate() const { return m_sample_rate; }
+    void set_sample_rate(float sample_rate) { m_sample_rate = sample_rate; }
+
+    u64 current_frame() const { return m_current_frame.load(AK::MemoryOrder::memory_order_relaxed); }
+    double current_time() const { return static_cast<double>(current_frame()) / m_sample_rate; }
+
+    // Everything below up to render_quantum() may only be called from the control thread.
+    void set_destination(RenderNode&);
+
+    struct Connection {
+        NonnullRefPtr<RenderNode> source;
+        RefPtr<RenderNode> destination_node {};
+        size_t input { 0 };
+        RefPtr<RenderParam> destination_param {};
+    };
+
+    void connect(RenderNode& source, RenderNode& destination, size_t input);
+    void connect(RenderNode& source, RenderParam& destination);
+    void remove_connections(Function<bool(Connection const&)> const& predicate);
+
+    // Drops every connection to or from the node, for when its AudioNode is collected.
+    void remove_node(RenderNode&);
+
+    void set_channel_count(RenderNode&, size_t);
+    void set_channel_count_mode(RenderNode&, Bindings::ChannelCountMode);
+    void set_channel_interpretation(RenderNode&, Bindings::ChannelInterpretation);
+
+    // Renders the next quantum of the destination's input, which stays valid until the next call. This is the only
+    // thing the rendering thread calls, and it never takes a lock.
+    AudioBus const& render_quantum();
+
+    // Fills the interleaved buffer with as many frames as fit, rendering more quanta as needed, and carrying any
+    // frames left over to the next call.
+    void render_interleaved(Span<float> output, size_t channel_count);
+
+private:
+    struct Snapshot;
+
+    explicit RenderGraph(float sample_rate);
+
+    void publish_snapshot();
+    void free_retired_snapshots();
+    static void mix_inputs(RenderNode&, ReadonlySpan<Vector<RenderNode*>> input_sources, RenderQuantumContext const&);
+
+    float m_sample_rate { 0 };
+    Atomic<u64> m_current_frame { 0 };
+    u64 m_quantum_index { 0 };
+
+    RefPtr<RenderNode> m_destination;
+    Vector<Connection> m_connections;
+
+    // The latest snapshot that the rendering thread hasn't picked up yet.
+    Atomic<Snapshot*> m_pending_snapshot { nullptr };
+    // Snapshots that the rendering thread has replaced, linked through their next_retired pointer. They are freed by
+    // the control thread.
+    Atomic<Snapshot*> m_retired_snapshots { nullptr };
+    // Only used by the rendering thread.
+    Snapshot* m_current_snapshot { nullptr };
+
+    AudioBus const m_silence;
+
+    AudioBus const* m_last_rendered_quantum { nullptr };
+    size_t m_frames_left_in_last_quantum { 0 };
+};
+
+}
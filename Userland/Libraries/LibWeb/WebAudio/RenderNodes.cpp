@@ -0,0 +1,238 @@
+/*
+ * Copyright (c) 2024, the SerenityOS developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/NumericLimits.h>
+#include <LibWeb/WebAudio/DSP.h>
+#include <LibWeb/WebAudio/RenderNodes.h>
+
+namespace Web::WebAudio {
+
+NonnullRefPtr<AudioDestinationRenderNode> AudioDestinationRenderNode::create(size_t channel_count)
+{
+    return adopt_ref(*new AudioDestinationRenderNode(channel_count));
+}
+
+AudioDestinationRenderNode::AudioDestinationRenderNode(size_t channel_count)
+    : RenderNode(1, 1, channel_count, Bindings::ChannelCountMode::Explicit, Bindings::ChannelInterpretation::Speakers)
+{
+}
+
+void AudioDestinationRenderNode::process(RenderQuantumContext const&, ReadonlySpan<AudioBus> inputs)
+{
+    m_output.copy_from(inputs[0]);
+}
+
+NonnullRefPtr<GainRenderNode> GainRenderNode::create(NonnullRefPtr<RenderParam> gain)
+{
+    return adopt_ref(*new GainRenderNode(move(gain)));
+}
+
+GainRenderNode::GainRenderNode(NonnullRefPtr<RenderParam> gain)
+    : RenderNode(1, 1, 2, Bindings::ChannelCountMode::Max, Bindings::ChannelInterpretation::Speakers)
+    , m_gain(move(gain))
+{
+    add_param(m_gain);
+}
+
+// https://webaudio.github.io/web-audio-api/#GainNode
+void GainRenderNode::process(RenderQuantumContext const& context, ReadonlySpan<AudioBus> inputs)
+{
+    auto const& input = inputs[0];
+
+    bool gain_is_constant = m_gain->compute_values(context, m_gain_values);
+
+    if (input.is_silent() || (gain_is_constant && m_gain_values[0] == 0)) {
+        m_output.zero();
+        m_output.set_channel_count(input.channel_count());
+        return;
+    }
+
+    m_output.set_channel_count(input.channel_count());
+    m_output.set_silent(false);
+
+    for (size_t i = 0; i < input.channel_count(); ++i) {
+        if (gain_is_constant)
+            DSP::multiply(m_output.channel(i), input.channel(i), m_gain_values[0]);
+        else
+            DSP::multiply(m_output.channel(i), input.channel(i), m_gain_values);
+    }
+}
+
+ScheduledSourceRenderNode::ScheduledSourceRenderNode()
+    : RenderNode(0, 1, 2, Bindings::ChannelCountMode::Max, Bindings::ChannelInterpretation::Speakers)
+{
+}
+
+// https://webaudio.github.io/web-audio-api/#playback-AudioScheduledSourceNode
+Optional<ScheduledSourceRenderNode::FrameRange> ScheduledSourceRenderNode::playing_frames(RenderQuantumContext const& context)
+{
+    auto start_time = m_start_time.load(AK::MemoryOrder::memory_order_relaxed);
+    if (start_time == AK::Infinity<double> || has_ended())
+        return {};
+
+    // The first frame at or after the given time. Times are usually computed from frame counts, so a little rounding
+    // error is allowed for.
+    auto time_to_frame = [&](double time) {
+        if (time == AK::Infinity<double>)
+            return NumericLimits<u64>::max();
+        return static_cast<u64>(AK::ceil(max(time, 0.0) * context.sample_rate - 1e-6));
+    };
+
+    auto start_frame = time_to_frame(start_time);
+    auto stop_frame = time_to_frame(m_stop_time.load(AK::MemoryOrder::memory_order_relaxed));
+
+    auto quantum_end_frame = context.frame + render_quantum_size;
+    if (stop_frame <= quantum_end_frame)
+        m_has_ended.store(true, AK::MemoryOrder::memory_order_relaxed);
+
+    auto clamp_to_quantum = [&](u64 frame) -> size_t {
+        if (frame <= context.frame)
+            return 0;
+        return min(frame - context.frame, render_quantum_size);
+    };
+
+    FrameRange range { clamp_to_quantum(start_frame), clamp_to_quantum(stop_frame) };
+    if (range.begin >= range.end)
+        return {};
+    return range;
+}
+
+NonnullRefPtr<OscillatorRenderNode> OscillatorRenderNode::create(Bindings::OscillatorType type, NonnullRefPtr<RenderParam> frequency)
+{
+    return adopt_ref(*new OscillatorRenderNode(type, move(frequency)));
+}
+
+OscillatorRenderNode::OscillatorRenderNode(Bindings::OscillatorType type, NonnullRefPtr<RenderParam> frequency)
+    : m_type(type)
+    , m_frequency(move(frequency))
+{
+    add_param(m_frequency);
+}
+
+// https://webaudio.github.io/web-audio-api/#OscillatorNode
+void OscillatorRenderNode::process(RenderQuantumContext const& context, ReadonlySpan<AudioBus>)
+{
+    // An oscillator always has a single output channel.
+    m_output.set_channel_count(1);
+
+    m_frequency->compute_values(context, m_frequency_values);
+
+    auto range = playing_frames(context);
+    if (!range.has_value()) {
+        m_output.zero();
+        return;
+    }
+
+    auto output = m_output.channel(0);
+    auto frame_count = range->end - range->begin;
+
+    m_phase = DSP::generate_oscillator(output.slice(range->begin, frame_count), m_frequency_values.span().slice(range->begin, frame_count),
+        context.sample_rate, m_phase, m_type.load(AK::MemoryOrder::memory_order_relaxed));
+
+    output.trim(range->begin).fill(0);
+    output.slice(range->end).fill(0);
+    m_output.set_silent(false);
+}
+
+NonnullRefPtr<DynamicsCompressorRenderNode> DynamicsCompressorRenderNode::create(Params params)
+{
+    return adopt_ref(*new DynamicsCompressorRenderNode(move(params)));
+}
+
+DynamicsCompressorRenderNode::DynamicsCompressorRenderNode(Params params)
+    : RenderNode(1, 1, 2, Bindings::ChannelCountMode::ClampedMax, Bindings::ChannelInterpretation::Speakers)
+    , m_params(move(params))
+{
+    add_param(m_params.threshold);
+    add_param(m_params.knee);
+    add_param(m_params.ratio);
+    add_param(m_params.attack);
+    add_param(m_params.release);
+}
+
+// The static compression curve, as the gain reduction in decibels for an input level in decibels, with a quadratic
+// soft knee around the threshold.
+static float gain_reduction_for_level(float level, float threshold, float knee, float ratio)
+{
+    auto overshoot = level - threshold;
+    auto slope = 1.0f / ratio - 1.0f;
+
+    if (2 * overshoot < -knee)
+        return 0;
+    if (knee > 0 && 2 * AK::fabs(overshoot) <= knee)
+        return slope * (overshoot + knee / 2) * (overshoot + knee / 2) / (2 * knee);
+    return slope * overshoot;
+}
+
+static float smoothing_coefficient(float time, float sample_rate)
+{
+    if (time <= 0)
+        return 0;
+    return AK::exp(-1.0f / (time * sample_rate));
+}
+
+// https://webaudio.github.io/web-audio-api/#DynamicsCompressorOptions-processing
+// FIXME: This does not implement the pre-delay that lets the specified compressor react ahead of the signal.
+void DynamicsCompressorRenderNode::process(RenderQuantumContext const& context, ReadonlySpan<AudioBus> inputs)
+{
+    auto const& input = inputs[0];
+
+    // All of the compressor's parameters are k-rate.
+    auto param_value = [&](RenderParam& param) {
+        param.compute_values(context, m_param_values);
+        return m_param_values[0];
+    };
+    auto threshold = param_value(m_params.threshold);
+    auto knee = param_value(m_params.knee);
+    auto ratio = param_value(m_params.ratio);
+    auto attack = smoothing_coefficient(param_value(m_params.attack), context.sample_rate);
+    auto release = smoothing_coefficient(param_value(m_params.release), context.sample_rate);
+
+    m_output.set_channel_count(input.channel_count());
+
+    if (input.is_silent() && m_envelope == 0) {
+        m_output.zero();
+        m_reduction.store(0, AK::MemoryOrder::memory_order_relaxed);
+        return;
+    }
+
+    // The compressor reacts to the loudest channel.
+    m_detector.fill(0);
+    if (!input.is_silent()) {
+        for (size_t i = 0; i < input.channel_count(); ++i)
+            DSP::max_magnitude(m_detector, input.channel(i));
+    }
+
+    // Make-up gain brings a full-scale signal back up to (nearly) full scale.
+    auto makeup_gain = -0.6f * gain_reduction_for_level(0, threshold, knee, ratio);
+
+    for (size_t i = 0; i < render_quantum_size; ++i) {
+        auto level = m_detector[i] > 1e-6f ? 20 * AK::log10(m_detector[i]) : -120.0f;
+        auto target = gain_reduction_for_level(level, threshold, knee, ratio);
+
+        // More reduction is applied at the attack rate, and it is let go of at the release rate.
+        auto coefficient = target < m_envelope ? attack : release;
+        m_envelope = target + coefficient * (m_envelope - target);
+
+        m_gains[i] = AK::pow(10.0f, (m_envelope + makeup_gain) / 20);
+    }
+
+    // Once the envelope has been released all the way, the node can go back to outputting silence for silent input.
+    if (AK::fabs(m_envelope) < 1e-6f)
+        m_envelope = 0;
+
+    if (input.is_silent()) {
+        m_output.zero();
+    } else {
+        m_output.set_silent(false);
+        for (size_t i = 0; i < input.channel_count(); ++i)
+            DSP::multiply(m_output.channel(i), input.channel(i), m_gains);
+    }
+
+    m_reduction.store(m_envelope, AK::MemoryOrder::memory_order_relaxed);
+}
+
+}
@@ -0,0 +1,117 @@
+/*
+ * Copyright (c) 2024, the SerenityOS developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/Math.h>
+#include <LibWeb/Bindings/OscillatorNodePrototype.h>
+#include <LibWeb/WebAudio/RenderGraph.h>
+
+namespace Web::WebAudio {
+
+// https://webaudio.github.io/web-audio-api/#AudioDestinationNode
+class AudioDestinationRenderNode final : public RenderNode {
+public:
+    static NonnullRefPtr<AudioDestinationRenderNode> create(size_t channel_count);
+
+    virtual void process(RenderQuantumContext const&, ReadonlySpan<AudioBus> inputs) override;
+
+private:
+    explicit AudioDestinationRenderNode(size_t channel_count);
+};
+
+// https://webaudio.github.io/web-audio-api/#GainNode
+class GainRenderNode final : public RenderNode {
+public:
+    static NonnullRefPtr<GainRenderNode> create(NonnullRefPtr<RenderParam> gain);
+
+    virtual void process(RenderQuantumContext const&, ReadonlySpan<AudioBus> inputs) override;
+
+private:
+    explicit GainRenderNode(NonnullRefPtr<RenderParam> gain);
+
+    NonnullRefPtr<RenderParam> m_gain;
+    AudioBus::Channel m_gain_values {};
+};
+
+// https://webaudio.github.io/web-audio-api/#AudioScheduledSourceNode
+class ScheduledSourceRenderNode : public RenderNode {
+public:
+    void start(double when) { m_start_time.store(when, AK::MemoryOrder::memory_order_relaxed); }
+    void stop(double when) { m_stop_time.store(when, AK::MemoryOrder::memory_order_relaxed); }
+
+    // Set once the source has played until its stop time.
+    bool has_ended() const { return m_has_ended.load(AK::MemoryOrder::memory_order_relaxed); }
+
+protected:
+    ScheduledSourceRenderNode();
+
+    struct FrameRange {
+        size_t begin { 0 };
+        size_t end { 0 };
+    };
+
+    // Returns the frames of the render quantum during which the source plays, if any.
+    Optional<FrameRange> playing_frames(RenderQuantumContext const&);
+
+private:
+    Atomic<double> m_start_time { AK::Infinity<double> };
+    Atomic<double> m_stop_time { AK::Infinity<double> };
+    Atomic<bool> m_has_ended { false };
+};
+
+// https://webaudio.github.io/web-audio-api/#OscillatorNode
+class OscillatorRenderNode final : public ScheduledSourceRenderNode {
+public:
+    static NonnullRefPtr<OscillatorRenderNode> create(Bindings::OscillatorType, NonnullRefPtr<RenderParam> frequency);
+
+    void set_type(Bindings::OscillatorType type) { m_type.store(type, AK::MemoryOrder::memory_order_relaxed); }
+
+    virtual void process(RenderQuantumContext const&, ReadonlySpan<AudioBus> inputs) override;
+
+private:
+    OscillatorRenderNode(Bindings::OscillatorType, NonnullRefPtr<RenderParam> frequency);
+
+    Atomic<Bindings::OscillatorType> m_type;
+    NonnullRefPtr<RenderParam> m_frequency;
+    AudioBus::Channel m_frequency_values {};
+
+    // In cycles, within [0, 1).
+    float m_phase { 0 };
+};
+
+// https://webaudio.github.io/web-audio-api/#DynamicsCompressorNode
+class DynamicsCompressorRenderNode final : public RenderNode {
+public:
+    struct Params {
+        NonnullRefPtr<RenderParam> threshold;
+        NonnullRefPtr<RenderParam> knee;
+        NonnullRefPtr<RenderParam> ratio;
+        NonnullRefPtr<RenderParam> attack;
+        NonnullRefPtr<RenderParam> release;
+    };
+
+    static NonnullRefPtr<DynamicsCompressorRenderNode> create(Params);
+
+    // https://webaudio.github.io/web-audio-api/#dom-dynamicscompressornode-internal-reduction-slot
+    float reduction() const { return m_reduction.load(AK::MemoryOrder::memory_order_relaxed); }
+
+    virtual void process(RenderQuantumContext const&, ReadonlySpan<AudioBus> inputs) override;
+
+private:
+    explicit DynamicsCompressorRenderNode(Params);
+
+    Params m_params;
+    AudioBus::Channel m_param_values {};
+    AudioBus::Channel m_detector {};
+    AudioBus::Channel m_gains {};
+
+    // The smoothed gain reduction, in decibels.
+    float m_envelope { 0 };
+    Atomic<float> m_reduction { 0 };
+};
+
+}
@@ -5,6 +5,7 @@
  */
 
 #include <LibWeb/DOM/Event.h>
+#include <LibWeb/DOM/ProcessingInstruction.h>
 #include <LibWeb/HTML/HTMLTemplateElement.h>
 #include <LibWeb/HTML/Window.h>
 #include <LibWeb/HighResolutionTime/TimeOrigin.h>
@@ -57,6 +58,8 @@ void XMLDocumentBuilder::element_start(const XML::Name& name, HashMap<XML::Name,
     if (m_has_error)
         return;
 
+    flush_pending_text();
+
     if (auto it = attributes.find("xmlns"); it != attributes.end()) {
         m_namespace_stack.append({ m_namespace, 1 });
         m_namespace = MUST(FlyString::from_deprecated_fly_string(it->value));
@@ -97,6 +100,8 @@ void XMLDocumentBuilder::element_end(const XML::Name& name)
     if (m_has_error)
         return;
 
+    flush_pending_text();
+
     if (--m_namespace_stack.last().depth == 0) {
         m_namespace = m_namespace_stack.take_last().ns;
     }
@@ -146,34 +151,60 @@ void XMLDocumentBuilder::text(StringView data)
 {
     if (m_has_error)
         return;
+
+    // NOTE: The parser reports character data in pieces (around entity and character references, CDATA sections, etc.),
+    //       so we accumulate it here and only create (or extend) a single DOM text node once the run of text ends.
+    m_pending_text.append(data);
+}
+
+void XMLDocumentBuilder::flush_pending_text()
+{
+    if (m_pending_text.is_empty())
+        return;
+
+    auto data = m_pending_text.string_view();
     auto last = m_current_node->last_child();
     if (last && last->is_text()) {
         auto& text_node = static_cast<DOM::Text&>(*last);
-        text_builder.append(text_node.data());
-        text_builder.append(data);
-        text_node.set_data(MUST(text_builder.to_string()));
-        text_builder.clear();
+        StringBuilder builder;
+        builder.append(text_node.data());
+        builder.append(data);
+        text_node.set_data(MUST(builder.to_string()));
     } else {
-        if (!data.is_empty()) {
-            auto node = m_document->create_text_node(MUST(String::from_utf8(data)));
-            MUST(m_current_node->append_child(node));
-        }
+        auto node = m_document->create_text_node(MUST(String::from_utf8(data)));
+        MUST(m_current_node->append_child(node));
     }
+    m_pending_text.clear();
 }
 
 void XMLDocumentBuilder::comment(StringView data)
 {
     if (m_has_error)
         return;
+    flush_pending_text();
     MUST(m_document->append_child(m_document->create_comment(MUST(String::from_utf8(data)))));
 }
 
+void XMLDocumentBuilder::processing_instruction(StringView target, StringView data)
+{
+    if (m_has_error)
+        return;
+    flush_pending_text();
+    auto processing_instruction = m_document->create_processing_instruction(MUST(String::from_utf8(target)), MUST(String::from_utf8(data)));
+    if (processing_instruction.is_error())
+        return;
+    MUST(m_current_node->append_child(processing_instruction.release_value()));
+}
+
 void XMLDocumentBuilder::document_end()
 {
     // When an XML parser reaches the end of its input, it must stop parsing.
     // If the active speculative HTML parser is not null, then stop the speculative HTML parser and return.
     // NOTE: Noop.
 
+    if (!m_has_error && m_current_node)
+        flush_pending_text();
+
     // Set the insertion point to undefined.
     m_current_node = nullptr;
 
@@ -35,13 +35,16 @@ private:
     virtual void element_end(XML::Name const& name) override;
     virtual void text(StringView data) override;
     virtual void comment(StringView data) override;
+    virtual void processing_instruction(StringView target, StringView data) override;
     virtual void document_end() override;
 
+    void flush_pending_text();
+
     JS::NonnullGCPtr<DOM::Document> m_document;
     JS::GCPtr<DOM::Node> m_current_node;
     XMLScriptingSupport m_scripting_support { XMLScriptingSupport::Enabled };
     bool m_has_error { false };
-    StringBuilder text_builder;
+    StringBuilder m_pending_text;
     Optional<FlyString> m_namespace;
 
     struct NamespaceStackEntry {
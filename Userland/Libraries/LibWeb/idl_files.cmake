@@ -100,6 +100,7 @@ libweb_js_bindings(HTML/CanvasRenderingContext2D)
 libweb_js_bindings(HTML/CloseEvent)
 libweb_js_bindings(HTML/CustomElements/CustomElementRegistry)
 libweb_js_bindings(HTML/DOMParser)
+libweb_js_bindings(HTML/DOMStringList)
 libweb_js_bindings(HTML/DOMStringMap)
 libweb_js_bindings(HTML/DataTransfer)
 libweb_js_bindings(HTML/ErrorEvent)
@@ -218,9 +219,17 @@ libweb_js_bindings(HTML/WorkerGlobalScope)
 libweb_js_bindings(HTML/WorkerLocation)
 libweb_js_bindings(HTML/WorkerNavigator)
 libweb_js_bindings(HighResolutionTime/Performance)
+libweb_js_bindings(IndexedDB/IDBCursor)
+libweb_js_bindings(IndexedDB/IDBCursorWithValue)
+libweb_js_bindings(IndexedDB/IDBDatabase)
 libweb_js_bindings(IndexedDB/IDBFactory)
+libweb_js_bindings(IndexedDB/IDBIndex)
+libweb_js_bindings(IndexedDB/IDBKeyRange)
+libweb_js_bindings(IndexedDB/IDBObjectStore)
 libweb_js_bindings(IndexedDB/IDBOpenDBRequest)
 libweb_js_bindings(IndexedDB/IDBRequest)
+libweb_js_bindings(IndexedDB/IDBTransaction)
+libweb_js_bindings(IndexedDB/IDBVersionChangeEvent)
 libweb_js_bindings(Internals/Inspector)
 libweb_js_bindings(Internals/InternalAnimationTimeline)
 libweb_js_bindings(Internals/Internals)
@@ -302,6 +311,7 @@ libweb_js_bindings(WebAssembly/Table)
 libweb_js_bindings(WebAssembly/WebAssembly NAMESPACE)
 libweb_js_bindings(WebAudio/AudioBuffer)
 libweb_js_bindings(WebAudio/AudioContext)
+libweb_js_bindings(WebAudio/AudioDestinationNode)
 libweb_js_bindings(WebAudio/AudioNode)
 libweb_js_bindings(WebAudio/AudioParam)
 libweb_js_bindings(WebAudio/AudioScheduledSourceNode)
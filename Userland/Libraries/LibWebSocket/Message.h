@@ -26,12 +26,6 @@ public:
     {
     }
 
-    explicit Message(ByteBuffer const&& data, bool is_text)
-        : m_is_text(is_text)
-        , m_data(move(data))
-    {
-    }
-
     bool is_text() const { return m_is_text; }
     ByteBuffer const& data() const { return m_data; }
 
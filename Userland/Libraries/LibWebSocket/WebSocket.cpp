@@ -15,7 +15,29 @@
 namespace WebSocket {
 
 // Note : The websocket protocol is defined by RFC 6455, found at https://tools.ietf.org/html/rfc6455
-// In this file, section numbers will refer to the RFC 6455
+// In this file, section numbers will refer to the RFC 6455, unless RFC 7692 (permessage-deflate) is mentioned
+
+// Messages smaller than this are sent uncompressed, as the DEFLATE framing overhead makes compressing them not worthwhile.
+static constexpr size_t minimum_compressed_message_size = 128;
+
+// Section 5.3 : each octet of the payload is XORed with the octet of the masking key at its index modulo 4
+static void apply_mask(Bytes payload, u8 const (&masking_key)[4])
+{
+    // The key repeats every 4 octets, so two copies of it line up with every 8-octet chunk of the payload.
+    u32 key;
+    memcpy(&key, masking_key, sizeof(key));
+    u64 wide_key = (static_cast<u64>(key) << 32) | key;
+
+    size_t i = 0;
+    for (; i + sizeof(u64) <= payload.size(); i += sizeof(u64)) {
+        u64 chunk;
+        memcpy(&chunk, payload.offset_pointer(i), sizeof(chunk));
+        chunk ^= wide_key;
+        memcpy(payload.offset_pointer(i), &chunk, sizeof(chunk));
+    }
+    for (; i < payload.size(); ++i)
+        payload[i] ^= masking_key[i % 4];
+}
 
 NonnullRefPtr<WebSocket> WebSocket::create(ConnectionInfo connection, RefPtr<WebSocketImpl> impl)
 {
@@ -84,10 +106,18 @@ void WebSocket::send(Message const& message)
     // Calling send on a socket that is not opened is not allowed
     VERIFY(m_state == WebSocket::InternalState::Open);
     VERIFY(m_impl);
-    if (message.is_text())
-        send_frame(WebSocket::OpCode::Text, message.data(), true);
-    else
-        send_frame(WebSocket::OpCode::Binary, message.data(), true);
+    auto op_code = message.is_text() ? WebSocket::OpCode::Text : WebSocket::OpCode::Binary;
+
+    if (m_per_message_deflate_enabled && message.data().size() >= minimum_compressed_message_size) {
+        // RFC 7692, section 6.1 : a compressed message has the "Per-Message Compressed" bit (RSV1) set on its first frame
+        auto compressed_payload = compress_message(message.data());
+        if (!compressed_payload.is_error() && compressed_payload.value().size() < message.data().size()) {
+            send_frame(op_code, compressed_payload.value(), true, true);
+            return;
+        }
+    }
+
+    send_frame(op_code, message.data(), true);
 }
 
 void WebSocket::close(u16 code, ByteString const& message)
@@ -146,7 +176,7 @@ void WebSocket::drain_read()
         }
         auto bytes = result.release_value();
         m_buffered_data.append(bytes.data(), bytes.size());
-        read_frame();
+        read_frames();
     } break;
     case InternalState::Closed:
     case InternalState::Errored: {
@@ -205,11 +235,14 @@ void WebSocket::send_client_handshake()
     }
 
     // 11. Websocket extensions (optional field)
-    if (!m_connection.extensions().is_empty()) {
-        builder.append("Sec-WebSocket-Extensions: "sv);
-        builder.join(',', m_connection.extensions());
-        builder.append("\r\n"sv);
+    //     We always offer permessage-deflate (RFC 7692). Since we compress every message on its own, we can also tell the
+    //     server that it does not need to keep our compression context around between messages.
+    builder.append("Sec-WebSocket-Extensions: permessage-deflate; client_no_context_takeover"sv);
+    for (auto const& extension : m_connection.extensions()) {
+        if (!extension.starts_with("permessage-deflate"sv, CaseSensitivity::CaseInsensitive))
+            builder.appendff(", {}", extension);
     }
+    builder.append("\r\n"sv);
 
     // 12. Additional headers
     for (auto& header : m_connection.headers()) {
@@ -281,6 +314,13 @@ void WebSocket::read_server_handshake()
                 fatal_error(WebSocket::Error::ConnectionUpgradeFailed);
                 return;
             }
+            if (m_has_read_server_handshake_per_message_deflate) {
+                if (auto result = enable_per_message_deflate(); result.is_error()) {
+                    dbgln("WebSocket: Failed to set up permessage-deflate: {}", result.error());
+                    fatal_error(WebSocket::Error::ConnectionUpgradeFailed);
+                    return;
+                }
+            }
 
             m_state = WebSocket::InternalState::Open;
             notify_open();
@@ -345,6 +385,17 @@ void WebSocket::read_server_handshake()
             auto server_extensions = parts[1].split(',');
             for (auto const& extension : server_extensions) {
                 auto trimmed_extension = extension.trim_whitespace();
+
+                auto extension_parameters = trimmed_extension.split_view(';');
+                if (!extension_parameters.is_empty() && extension_parameters[0].trim_whitespace().equals_ignoring_ascii_case("permessage-deflate"sv)) {
+                    if (!parse_per_message_deflate_parameters(extension_parameters)) {
+                        dbgln("WebSocket: Server HTTP Handshake Header |Sec-WebSocket-Extensions| contains an invalid response to our permessage-deflate offer '{}'. Failing connection.", trimmed_extension);
+                        fatal_error(WebSocket::Error::ConnectionUpgradeFailed);
+                        return;
+                    }
+                    continue;
+                }
+
                 bool found_extension = false;
                 for (auto const& supported_extension : m_connection.extensions()) {
                     if (trimmed_extension.equals_ignoring_ascii_case(supported_extension)) {
@@ -383,14 +434,122 @@ void WebSocket::read_server_handshake()
     // If needed, we will keep reading the header on the next drain_read call
 }
 
-void WebSocket::read_frame()
+// RFC 7692, section 7.1 : the server's response to our permessage-deflate offer
+bool WebSocket::parse_per_message_deflate_parameters(Vector<StringView> const& parameters)
+{
+    // The server must accept at most one of the offers we made
+    if (m_has_read_server_handshake_per_message_deflate)
+        return false;
+    m_has_read_server_handshake_per_message_deflate = true;
+
+    bool has_server_no_context_takeover = false;
+    bool has_client_no_context_takeover = false;
+    bool has_server_max_window_bits = false;
+
+    for (auto const& parameter : parameters.span().slice(1)) {
+        auto name = parameter.trim_whitespace();
+        Optional<StringView> value;
+        if (auto equals_index = name.find('='); equals_index.has_value()) {
+            value = name.substring_view(*equals_index + 1).trim_whitespace().trim("\""sv);
+            name = name.substring_view(0, *equals_index).trim_whitespace();
+        }
+
+        // A parameter must not appear more than once, and the no_context_takeover parameters must not have a value
+        if (name.equals_ignoring_ascii_case("server_no_context_takeover"sv)) {
+            if (has_server_no_context_takeover || value.has_value())
+                return false;
+            has_server_no_context_takeover = true;
+            continue;
+        }
+        if (name.equals_ignoring_ascii_case("client_no_context_takeover"sv)) {
+            if (has_client_no_context_takeover || value.has_value())
+                return false;
+            has_client_no_context_takeover = true;
+            continue;
+        }
+
+        // Section 7.1.2.1 : the value is the base-2 logarithm of the server's window size, between 8 and 15.
+        // Our decompressor always keeps a 32 KiB window, which is large enough for any of them.
+        if (name.equals_ignoring_ascii_case("server_max_window_bits"sv)) {
+            if (has_server_max_window_bits || !value.has_value())
+                return false;
+            auto window_bits = value->to_number<u8>();
+            if (!window_bits.has_value() || *window_bits < 8 || *window_bits > 15)
+                return false;
+            has_server_max_window_bits = true;
+            continue;
+        }
+
+        // Section 7.1.2.2 : client_max_window_bits must not be sent since we didn't offer it, and neither may anything else
+        return false;
+    }
+
+    return true;
+}
+
+ErrorOr<void> WebSocket::enable_per_message_deflate()
+{
+    m_decompressor_input = TRY(try_make<AllocatingMemoryStream>());
+    auto bit_stream = TRY(try_make<LittleEndianInputBitStream>(MaybeOwned<Stream>(*m_decompressor_input)));
+    m_decompressor = TRY(Compress::DeflateDecompressor::construct(move(bit_stream)));
+    m_per_message_deflate_enabled = true;
+    return {};
+}
+
+// RFC 7692, section 7.2.1
+ErrorOr<ByteBuffer> WebSocket::compress_message(ReadonlyBytes payload)
+{
+    // Every message is compressed on its own, so the DEFLATE stream ends with a final block. As allowed by section 7.2.3.3,
+    // we follow it with an empty uncompressed block, of which only the first octet is left once its trailing
+    // 0x00 0x00 0xff 0xff is removed.
+    auto compressed_payload = TRY(Compress::DeflateCompressor::compress_all(payload, Compress::DeflateCompressor::CompressionLevel::FAST));
+    TRY(compressed_payload.try_append(0x00));
+    return compressed_payload;
+}
+
+// RFC 7692, section 7.2.2
+ErrorOr<ByteBuffer> WebSocket::decompress_message(ReadonlyBytes payload)
+{
+    // 1. Append 4 octets of 0x00 0x00 0xff 0xff to the tail end of the payload of the message.
+    static constexpr Array<u8, 4> empty_block_tail { 0x00, 0x00, 0xff, 0xff };
+    TRY(m_decompressor_input->write_until_depleted(payload));
+    TRY(m_decompressor_input->write_until_depleted(empty_block_tail));
+
+    // 2. Decompress the resulting data using DEFLATE.
+    //    The decompressor keeps its window between messages, as the server may refer back to previous ones.
+    ByteBuffer message;
+    TRY(m_decompressor->decompress_available_input(message));
+    return message;
+}
+
+void WebSocket::read_frames()
 {
     VERIFY(m_impl);
-    VERIFY(m_state == WebSocket::InternalState::Open || m_state == WebSocket::InternalState::Closing);
 
+    if (m_buffered_data.is_empty()) {
+        // The connection got closed.
+        m_state = WebSocket::InternalState::Closed;
+        notify_close(m_last_close_code, m_last_close_message, true);
+        discard_connection();
+        return;
+    }
+
+    // Handle every complete frame we have, and only then move what's left of a partial frame to the front of the buffer.
     size_t cursor = 0;
-    auto get_buffered_bytes = [&](size_t count) -> ReadonlyBytes {
-        if (cursor + count > m_buffered_data.size())
+    while (cursor < m_buffered_data.size() && (m_state == WebSocket::InternalState::Open || m_state == WebSocket::InternalState::Closing)) {
+        if (!read_frame(cursor))
+            break;
+    }
+
+    if (m_state == WebSocket::InternalState::Open || m_state == WebSocket::InternalState::Closing)
+        m_buffered_data.remove(0, cursor);
+}
+
+bool WebSocket::read_frame(size_t& frame_offset)
+{
+    size_t cursor = frame_offset;
+    auto get_buffered_bytes = [&](size_t count) -> Bytes {
+        if (count > m_buffered_data.size() - cursor)
             return {};
         auto bytes = m_buffered_data.span().slice(cursor, count);
         cursor += count;
@@ -398,18 +557,16 @@ void WebSocket::read_frame()
     };
 
     auto head_bytes = get_buffered_bytes(2);
-    if (head_bytes.is_null() || head_bytes.is_empty()) {
-        // The connection got closed.
-        m_state = WebSocket::InternalState::Closed;
-        notify_close(m_last_close_code, m_last_close_message, true);
-        discard_connection();
-        return;
-    }
+    if (head_bytes.is_null())
+        return false;
 
     auto op_code = (WebSocket::OpCode)(head_bytes[0] & 0x0f);
     bool is_final_frame = head_bytes[0] & 0x80;
     bool is_masked = head_bytes[1] & 0x80;
 
+    // RFC 7692, section 6 : the "Per-Message Compressed" bit (RSV1) is set on the first frame of a compressed message
+    bool is_compressed = head_bytes[0] & 0x40;
+
     // Parse the payload length.
     size_t payload_length;
     auto payload_length_bits = head_bytes[1] & 0x7f;
@@ -417,7 +574,7 @@ void WebSocket::read_frame()
         // A code of 127 means that the next 8 bytes contains the payload length
         auto actual_bytes = get_buffered_bytes(8);
         if (actual_bytes.is_null())
-            return;
+            return false;
         u64 full_payload_length = (u64)((u64)(actual_bytes[0] & 0xff) << 56)
             | (u64)((u64)(actual_bytes[1] & 0xff) << 48)
             | (u64)((u64)(actual_bytes[2] & 0xff) << 40)
@@ -432,7 +589,7 @@ void WebSocket::read_frame()
         // A code of 126 means that the next 2 bytes contains the payload length
         auto actual_bytes = get_buffered_bytes(2);
         if (actual_bytes.is_null())
-            return;
+            return false;
         payload_length = (size_t)((size_t)(actual_bytes[0] & 0xff) << 8)
             | (size_t)((size_t)(actual_bytes[1] & 0xff) << 0);
     } else {
@@ -449,161 +606,158 @@ void WebSocket::read_frame()
     if (is_masked) {
         auto masking_key_data = get_buffered_bytes(4);
         if (masking_key_data.is_null())
-            return;
+            return false;
         masking_key[0] = masking_key_data[0];
         masking_key[1] = masking_key_data[1];
         masking_key[2] = masking_key_data[2];
         masking_key[3] = masking_key_data[3];
     }
 
-    auto payload = ByteBuffer::create_uninitialized(payload_length).release_value_but_fixme_should_propagate_errors(); // FIXME: Handle possible OOM situation.
-    u64 read_length = 0;
-    while (read_length < payload_length) {
-        auto payload_part = get_buffered_bytes(payload_length - read_length);
-        if (payload_part.is_null())
-            return;
-        // We read at most "actual_length - read" bytes, so this is safe to do.
-        payload.overwrite(read_length, payload_part.data(), payload_part.size());
-        read_length += payload_part.size();
-    }
-
-    if (cursor == m_buffered_data.size()) {
-        m_buffered_data.clear();
-    } else {
-        Vector<u8> new_buffered_data;
-        new_buffered_data.append(m_buffered_data.data() + cursor, m_buffered_data.size() - cursor);
-        m_buffered_data = move(new_buffered_data);
+    // The payload is only looked at in place, until we know what to do with it.
+    if (payload_length > m_buffered_data.size() - cursor)
+        return false;
+    auto payload = m_buffered_data.span().slice(cursor, payload_length);
+    frame_offset = cursor + payload_length;
+
+    // Section 5.2 : the reserved bits must be 0, unless an extension defining them was negotiated.
+    // RSV1 is only defined for the first frame of a data message, and only if permessage-deflate is in use.
+    bool is_control_frame = (head_bytes[0] & 0x08) != 0;
+    if ((head_bytes[0] & 0x30) != 0 || (is_compressed && (!m_per_message_deflate_enabled || is_control_frame || op_code == WebSocket::OpCode::Continuation))) {
+        dbgln("WebSocket: Server sent a frame with unexpected reserved bits set. Failing connection.");
+        fatal_error(WebSocket::Error::ServerClosedSocket);
+        return false;
     }
 
-    if (is_masked) {
-        // Unmask the payload
-        for (size_t i = 0; i < payload.size(); ++i) {
-            payload[i] = payload[i] ^ (masking_key[i % 4]);
-        }
-    }
+    if (is_masked)
+        apply_mask(payload, masking_key);
 
     if (op_code == WebSocket::OpCode::ConnectionClose) {
         if (payload.size() > 1) {
             m_last_close_code = (((u16)(payload[0] & 0xff) << 8) | ((u16)(payload[1] & 0xff)));
-            m_last_close_message = ByteString(ReadonlyBytes(payload.offset_pointer(2), payload.size() - 2));
+            m_last_close_message = ByteString(payload.slice(2));
         }
         m_state = WebSocket::InternalState::Closing;
-        return;
+        return true;
     }
     if (op_code == WebSocket::OpCode::Ping) {
         // Immediately send a pong frame as a reply, with the given payload.
         send_frame(WebSocket::OpCode::Pong, payload, true);
-        return;
+        return true;
     }
     if (op_code == WebSocket::OpCode::Pong) {
         // We can safely ignore the pong
-        return;
+        return true;
     }
     if (!is_final_frame) {
         if (op_code != WebSocket::OpCode::Continuation) {
             // First fragmented message
             m_initial_fragment_opcode = op_code;
+            m_initial_fragment_is_compressed = is_compressed;
         }
         // First and next fragmented message
-        m_fragmented_data_buffer.append(payload.data(), payload_length);
-        return;
+        m_fragmented_data_buffer.append(payload);
+        return true;
     }
-    if (is_final_frame && op_code == WebSocket::OpCode::Continuation) {
+
+    ReadonlyBytes message_data = payload;
+    ByteBuffer fragmented_message;
+    bool is_fragmented = op_code == WebSocket::OpCode::Continuation;
+    if (is_fragmented) {
         // Last fragmented message
-        m_fragmented_data_buffer.append(payload.data(), payload_length);
+        m_fragmented_data_buffer.append(payload);
         op_code = m_initial_fragment_opcode;
-        payload.clear();
-        payload.append(m_fragmented_data_buffer.data(), m_fragmented_data_buffer.size());
+        is_compressed = m_initial_fragment_is_compressed;
+        fragmented_message = move(m_fragmented_data_buffer);
         m_fragmented_data_buffer.clear();
+        message_data = fragmented_message;
     }
-    if (op_code == WebSocket::OpCode::Text) {
-        notify_message(Message(payload, true));
-        return;
+
+    if (op_code != WebSocket::OpCode::Text && op_code != WebSocket::OpCode::Binary) {
+        dbgln("Websocket: Found unknown opcode {}", (u8)op_code);
+        return true;
     }
-    if (op_code == WebSocket::OpCode::Binary) {
-        notify_message(Message(payload, false));
-        return;
+
+    ByteBuffer message;
+    if (is_compressed) {
+        auto decompressed_message = decompress_message(message_data);
+        if (decompressed_message.is_error()) {
+            dbgln("WebSocket: Failed to decompress message: {}. Failing connection.", decompressed_message.error());
+            fatal_error(WebSocket::Error::ServerClosedSocket);
+            return false;
+        }
+        message = decompressed_message.release_value();
+    } else if (is_fragmented) {
+        message = move(fragmented_message);
+    } else {
+        message = ByteBuffer::copy(message_data).release_value_but_fixme_should_propagate_errors(); // FIXME: Handle possible OOM situation.
     }
-    dbgln("Websocket: Found unknown opcode {}", (u8)op_code);
+
+    notify_message(Message(move(message), op_code == WebSocket::OpCode::Text));
+    return true;
 }
 
-void WebSocket::send_frame(WebSocket::OpCode op_code, ReadonlyBytes payload, bool is_final)
+void WebSocket::send_frame(WebSocket::OpCode op_code, ReadonlyBytes payload, bool is_final, bool is_compressed)
 {
     VERIFY(m_impl);
     VERIFY(m_state == WebSocket::InternalState::Open);
-    u8 frame_head[1] = { (u8)((is_final ? 0x80 : 0x00) | ((u8)(op_code) & 0xf)) };
-    m_impl->send(ReadonlyBytes(frame_head, 1));
+
     // Section 5.1 : a client MUST mask all frames that it sends to the server
     bool has_mask = true;
+
+    // The frame is assembled in a single buffer, so that it can be sent with a single write.
+    size_t header_size = 2;
+    if (payload.size() > NumericLimits<u16>::max())
+        header_size += 8;
+    else if (payload.size() >= 126)
+        header_size += 2;
+    if (has_mask)
+        header_size += 4;
+
+    auto frame_result = ByteBuffer::create_uninitialized(header_size + payload.size());
+    if (frame_result.is_error())
+        return;
+    auto& frame = frame_result.value();
+
+    frame[0] = (u8)((is_final ? 0x80 : 0x00) | (is_compressed ? 0x40 : 0x00) | ((u8)(op_code) & 0xf));
+    size_t cursor = 2;
+
     // FIXME: If the payload has a size > size_t max on a 32-bit platform, we could
     //     technically stream it via non-final packets. However, the size was already
     //     truncated earlier in the call stack when stuffing into a ReadonlyBytes
     if (payload.size() > NumericLimits<u16>::max()) {
         // Send (the 'mask' flag + 127) + the 8-byte payload length
-        if constexpr (sizeof(size_t) >= 8) {
-            u8 payload_length[9] = {
-                (u8)((has_mask ? 0x80 : 0x00) | 127),
-                (u8)((payload.size() >> 56) & 0xff),
-                (u8)((payload.size() >> 48) & 0xff),
-                (u8)((payload.size() >> 40) & 0xff),
-                (u8)((payload.size() >> 32) & 0xff),
-                (u8)((payload.size() >> 24) & 0xff),
-                (u8)((payload.size() >> 16) & 0xff),
-                (u8)((payload.size() >> 8) & 0xff),
-                (u8)((payload.size() >> 0) & 0xff),
-            };
-            m_impl->send(ReadonlyBytes(payload_length, 9));
-        } else {
-            u8 payload_length[9] = {
-                (u8)((has_mask ? 0x80 : 0x00) | 127),
-                0,
-                0,
-                0,
-                0,
-                (u8)((payload.size() >> 24) & 0xff),
-                (u8)((payload.size() >> 16) & 0xff),
-                (u8)((payload.size() >> 8) & 0xff),
-                (u8)((payload.size() >> 0) & 0xff),
-            };
-            m_impl->send(ReadonlyBytes(payload_length, 9));
-        }
+        frame[1] = (u8)((has_mask ? 0x80 : 0x00) | 127);
+        u64 length = payload.size();
+        for (size_t i = 0; i < 8; ++i)
+            frame[cursor++] = (u8)((length >> (56 - i * 8)) & 0xff);
     } else if (payload.size() >= 126) {
         // Send (the 'mask' flag + 126) + the 2-byte payload length
-        u8 payload_length[3] = {
-            (u8)((has_mask ? 0x80 : 0x00) | 126),
-            (u8)((payload.size() >> 8) & 0xff),
-            (u8)((payload.size() >> 0) & 0xff),
-        };
-        m_impl->send(ReadonlyBytes(payload_length, 3));
+        frame[1] = (u8)((has_mask ? 0x80 : 0x00) | 126);
+        frame[cursor++] = (u8)((payload.size() >> 8) & 0xff);
+        frame[cursor++] = (u8)((payload.size() >> 0) & 0xff);
     } else {
         // Send the mask flag + the payload in a single byte
-        u8 payload_length[1] = {
-            (u8)((has_mask ? 0x80 : 0x00) | (u8)(payload.size() & 0x7f)),
-        };
-        m_impl->send(ReadonlyBytes(payload_length, 1));
+        frame[1] = (u8)((has_mask ? 0x80 : 0x00) | (u8)(payload.size() & 0x7f));
     }
+
     if (has_mask) {
         // Section 10.3 :
         // > Clients MUST choose a new masking key for each frame, using an algorithm
         // > that cannot be predicted by end applications that provide data
         u8 masking_key[4];
         fill_with_random(masking_key);
-        m_impl->send(ReadonlyBytes(masking_key, 4));
-        // don't try to send empty payload
-        if (payload.size() == 0)
-            return;
-        // Mask the payload
-        auto buffer_result = ByteBuffer::create_uninitialized(payload.size());
-        if (!buffer_result.is_error()) {
-            auto& masked_payload = buffer_result.value();
-            for (size_t i = 0; i < payload.size(); ++i) {
-                masked_payload[i] = payload[i] ^ (masking_key[i % 4]);
-            }
-            m_impl->send(masked_payload);
+        frame.overwrite(cursor, masking_key, 4);
+        cursor += 4;
+
+        if (!payload.is_empty()) {
+            frame.overwrite(cursor, payload.data(), payload.size());
+            apply_mask(frame.bytes().slice(cursor), masking_key);
         }
-    } else if (payload.size() > 0) {
-        m_impl->send(payload);
+    } else if (!payload.is_empty()) {
+        frame.overwrite(cursor, payload.data(), payload.size());
     }
+
+    m_impl->send(frame);
 }
 
 void WebSocket::fatal_error(WebSocket::Error error)
@@ -7,7 +7,10 @@
 
 #pragma once
 
+#include <AK/BitStream.h>
+#include <AK/MemoryStream.h>
 #include <AK/Span.h>
+#include <LibCompress/Deflate.h>
 #include <LibCore/EventReceiver.h>
 #include <LibWebSocket/ConnectionInfo.h>
 #include <LibWebSocket/Impl/WebSocketImpl.h>
@@ -73,8 +76,14 @@ private:
     void send_client_handshake();
     void read_server_handshake();
 
-    void read_frame();
-    void send_frame(OpCode, ReadonlyBytes, bool is_final);
+    void read_frames();
+    bool read_frame(size_t& frame_offset);
+    void send_frame(OpCode, ReadonlyBytes, bool is_final, bool is_compressed = false);
+
+    bool parse_per_message_deflate_parameters(Vector<StringView> const& parameters);
+    ErrorOr<void> enable_per_message_deflate();
+    ErrorOr<ByteBuffer> compress_message(ReadonlyBytes);
+    ErrorOr<ByteBuffer> decompress_message(ReadonlyBytes);
 
     void notify_open();
     void notify_close(u16 code, ByteString reason, bool was_clean);
@@ -114,6 +123,14 @@ private:
     Vector<u8> m_buffered_data;
     ByteBuffer m_fragmented_data_buffer;
     WebSocket::OpCode m_initial_fragment_opcode;
+    bool m_initial_fragment_is_compressed { false };
+
+    // RFC 7692, the permessage-deflate extension. The server's compression context is kept across messages, so all
+    // received messages are fed through the same decompressor.
+    bool m_has_read_server_handshake_per_message_deflate { false };
+    bool m_per_message_deflate_enabled { false };
+    OwnPtr<AllocatingMemoryStream> m_decompressor_input;
+    OwnPtr<Compress::DeflateDecompressor> m_decompressor;
 };
 
 }
@@ -408,10 +408,12 @@ Vector<Web::Cookie::Cookie> CookieJar::get_matching_cookies(const URL::URL& url,
     // https://tools.ietf.org/html/rfc6265#section-5.4
     auto now = UnixDateTime::now();
 
+    auto request_path = url.serialize_path();
+
     // 1. Let cookie-list be the set of cookies from the cookie store that meets all of the following requirements:
     Vector<Web::Cookie::Cookie> cookie_list;
 
-    m_transient_storage.for_each_cookie([&](auto& cookie) {
+    m_transient_storage.for_each_cookie_candidate(canonicalized_domain, request_path, [&](auto& cookie) {
         // Either: The cookie's host-only-flag is true and the canonicalized request-host is identical to the cookie's domain.
         // Or: The cookie's host-only-flag is false and the canonicalized request-host domain-matches the cookie's domain.
         bool is_host_only_and_has_identical_domain = cookie.host_only && (canonicalized_domain == cookie.domain);
@@ -420,7 +422,7 @@ Vector<Web::Cookie::Cookie> CookieJar::get_matching_cookies(const URL::URL& url,
             return;
 
         // The request-uri's path path-matches the cookie's path.
-        if (!path_matches(url.serialize_path(), cookie.path))
+        if (!path_matches(request_path, cookie.path))
             return;
 
         // If the cookie's secure-only-flag is true, then the request-uri's scheme must denote a "secure" protocol.
@@ -532,15 +534,26 @@ static ErrorOr<Web::Cookie::Cookie> parse_cookie(ReadonlySpan<SQL::Value> row)
 void CookieJar::TransientStorage::set_cookies(Cookies cookies)
 {
     m_cookies = move(cookies);
+
+    m_index.clear();
+    for (auto const& it : m_cookies)
+        add_to_index(it.key);
+
+    rebuild_expiry_queue();
     purge_expired_cookies();
 }
 
 void CookieJar::TransientStorage::set_cookie(CookieStorageKey key, Web::Cookie::Cookie cookie)
 {
+    auto old_cookie = m_cookies.find(key);
+    if (old_cookie == m_cookies.end() || old_cookie->value.expiry_time != cookie.expiry_time)
+        m_expiry_queue.insert(cookie.expiry_time, key);
+
     auto result = m_cookies.set(key, cookie);
 
     switch (result) {
     case HashSetResult::InsertedNewEntry:
+        add_to_index(key);
         m_inserted_cookies.set(move(key), move(cookie));
         break;
 
@@ -565,15 +578,61 @@ Optional<Web::Cookie::Cookie> CookieJar::TransientStorage::get_cookie(CookieStor
 UnixDateTime CookieJar::TransientStorage::purge_expired_cookies()
 {
     auto now = UnixDateTime::now();
-    auto is_expired = [&](auto const&, auto const& cookie) { return cookie.expiry_time < now; };
 
-    m_cookies.remove_all_matching(is_expired);
-    m_inserted_cookies.remove_all_matching(is_expired);
-    m_updated_cookies.remove_all_matching(is_expired);
+    while (!m_expiry_queue.is_empty() && m_expiry_queue.peek_min_key() < now) {
+        auto key = m_expiry_queue.pop_min();
+
+        // The cookie may have been given a later expiry time since this entry was queued.
+        auto cookie = m_cookies.find(key);
+        if (cookie == m_cookies.end() || cookie->value.expiry_time >= now)
+            continue;
+
+        m_cookies.remove(cookie);
+        m_inserted_cookies.remove(key);
+        m_updated_cookies.remove(key);
+        remove_from_index(key);
+    }
+
+    // Don't let entries for cookies whose expiry time has changed pile up.
+    if (m_expiry_queue.size() > (m_cookies.size() * 2) + 64)
+        rebuild_expiry_queue();
 
     return now;
 }
 
+void CookieJar::TransientStorage::add_to_index(CookieStorageKey const& key)
+{
+    auto& paths = m_index.ensure(key.domain);
+    auto& names = paths.ensure(key.path);
+    names.set(key.name);
+}
+
+void CookieJar::TransientStorage::remove_from_index(CookieStorageKey const& key)
+{
+    auto paths = m_index.find(key.domain);
+    if (paths == m_index.end())
+        return;
+
+    auto names = paths->value.find(key.path);
+    if (names == paths->value.end())
+        return;
+
+    names->value.remove(key.name);
+
+    if (names->value.is_empty())
+        paths->value.remove(names);
+    if (paths->value.is_empty())
+        m_index.remove(paths);
+}
+
+void CookieJar::TransientStorage::rebuild_expiry_queue()
+{
+    m_expiry_queue.clear();
+
+    for (auto const& it : m_cookies)
+        m_expiry_queue.insert(it.value.expiry_time, it.key);
+}
+
 void CookieJar::PersistedStorage::insert_cookie(Web::Cookie::Cookie const& cookie)
 {
     database.execute_statement(
@@ -6,8 +6,10 @@
 
 #pragma once
 
+#include <AK/BinaryHeap.h>
 #include <AK/Function.h>
 #include <AK/HashMap.h>
+#include <AK/HashTable.h>
 #include <AK/Optional.h>
 #include <AK/String.h>
 #include <AK/StringView.h>
@@ -61,10 +63,85 @@ class CookieJar {
                 callback(it.value);
         }
 
+        // Invokes the callback for every cookie whose domain and path may match the given host and path. These are the
+        // cookies stored for the host or one of its parent domains, with a path that is a prefix of the request path.
+        template<typename Callback>
+        void for_each_cookie_candidate(StringView canonicalized_domain, StringView request_path, Callback callback)
+        {
+            for_each_domain_candidate(canonicalized_domain, [&](auto const& domain, auto& paths) {
+                for_each_path_candidate(request_path, [&](auto candidate_path) {
+                    auto path = paths.find(candidate_path);
+                    if (path == paths.end())
+                        return;
+
+                    for (auto const& name : path->value) {
+                        auto cookie = m_cookies.find(CookieStorageKey { name, domain, path->key });
+                        VERIFY(cookie != m_cookies.end());
+
+                        callback(cookie->value);
+                    }
+                });
+            });
+        }
+
     private:
+        // Cookies are indexed by their domain and then by their path, so that matching them against a URL only looks at
+        // the cookies that may apply to it, rather than at the whole jar.
+        using PathIndex = HashMap<String, HashTable<String>>;
+
+        template<typename Callback>
+        void for_each_domain_candidate(StringView canonicalized_domain, Callback callback)
+        {
+            // A host domain-matches itself, and every domain that is a suffix of it following a "." character.
+            for (auto domain = canonicalized_domain;;) {
+                if (auto paths = m_index.find(domain); paths != m_index.end())
+                    callback(paths->key, paths->value);
+
+                auto separator = domain.find('.');
+                if (!separator.has_value())
+                    break;
+                domain = domain.substring_view(*separator + 1);
+            }
+        }
+
+        template<typename Callback>
+        static void for_each_path_candidate(StringView request_path, Callback callback)
+        {
+            // A request path path-matches itself, and every prefix of it that either ends with a "/" character or is
+            // followed by one.
+            callback(request_path);
+
+            Optional<size_t> previous_length;
+            auto invoke_for_prefix = [&](size_t length) {
+                if (length == request_path.length() || length == previous_length)
+                    return;
+
+                callback(request_path.substring_view(0, length));
+                previous_length = length;
+            };
+
+            for (size_t i = 0; i < request_path.length(); ++i) {
+                if (request_path[i] != '/')
+                    continue;
+
+                invoke_for_prefix(i);
+                invoke_for_prefix(i + 1);
+            }
+        }
+
+        void add_to_index(CookieStorageKey const&);
+        void remove_from_index(CookieStorageKey const&);
+        void rebuild_expiry_queue();
+
         Cookies m_cookies;
         Cookies m_inserted_cookies;
         Cookies m_updated_cookies;
+
+        HashMap<String, PathIndex> m_index;
+
+        // Every cookie is queued by its expiry time, so that purging expired cookies only looks at those that did expire.
+        // When a cookie's expiry time changes, its old entry is left behind and skipped once it reaches the front.
+        BinaryHeap<UnixDateTime, CookieStorageKey, 0> m_expiry_queue;
     };
 
     struct PersistedStorage {
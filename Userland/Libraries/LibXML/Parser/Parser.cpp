@@ -152,6 +152,17 @@ void Parser::leave_node()
     if (m_listener) {
         auto& element = m_entered_node->content.get<Node::Element>();
         m_listener->element_end(element.name);
+
+        // The listener has seen everything there is to see about this element, so there's no need to keep it around.
+        // Text and comments are never attached to the tree in this mode, so the node being left is always the last child
+        // of its parent; dropping it here keeps memory usage bounded by the nesting depth rather than the document size.
+        auto* parent = m_entered_node->parent;
+        if (parent)
+            (void)parent->content.get<Node::Element>().children.take_last();
+        else
+            m_root_node.clear();
+        m_entered_node = parent;
+        return;
     }
 
     m_entered_node = m_entered_node->parent;
@@ -504,7 +515,10 @@ ErrorOr<void, ParseError> Parser::parse_processing_instruction()
         data = m_lexer.consume_until("?>");
     TRY(expect("?>"sv));
 
-    m_processing_instructions.set(target, data);
+    if (m_listener)
+        m_listener->processing_instruction(target, data);
+    else
+        m_processing_instructions.set(target, data);
     rollback.disarm();
     return {};
 }
@@ -36,6 +36,7 @@ struct Listener {
     virtual void element_end(Name const&) { }
     virtual void text(StringView) { }
     virtual void comment(StringView) { }
+    virtual void processing_instruction(StringView, StringView) { }
     virtual void error(ParseError const&) { }
 };
 
@@ -11,6 +11,8 @@
 
 #include <AK/JsonObject.h>
 #include <AK/QuickSort.h>
+#include <LibCore/AllocationTracker.h>
+#include <LibCore/Tracing.h>
 #include <LibGfx/Bitmap.h>
 #include <LibGfx/Font/FontDatabase.h>
 #include <LibGfx/SystemTheme.h>
@@ -807,6 +809,53 @@ Messages::WebContentServer::DumpGcGraphResponse ConnectionFromClient::dump_gc_gr
     return MUST(String::from_byte_string(gc_graph_json.to_byte_string()));
 }
 
+Messages::WebContentServer::TakeRenderingStatisticsResponse ConnectionFromClient::take_rendering_statistics(u64 page_id)
+{
+    auto page = this->page(page_id);
+    if (!page.has_value())
+        return String {};
+
+    auto statistics = page->page().take_rendering_statistics();
+
+    JsonObject json;
+    json.set("style_update_time_us"sv, statistics.style_update_time.to_microseconds());
+    json.set("style_update_count"sv, statistics.style_update_count);
+    json.set("layout_time_us"sv, statistics.layout_time.to_microseconds());
+    json.set("layout_count"sv, statistics.layout_count);
+    json.set("paint_time_us"sv, statistics.paint_time.to_microseconds());
+    json.set("paint_count"sv, statistics.paint_count);
+    return MUST(String::from_byte_string(json.to_byte_string()));
+}
+
+// NOTE: Tracing is process-wide, so these ignore the page ID.
+void ConnectionFromClient::set_tracing_enabled(u64, bool enabled)
+{
+    Core::Tracing::set_enabled(enabled);
+}
+
+Messages::WebContentServer::TakeTraceResponse ConnectionFromClient::take_trace(u64)
+{
+    return MUST(Core::Tracing::take_events_as_chrome_trace_json());
+}
+
+// NOTE: Like tracing, allocation tracking is process-wide.
+void ConnectionFromClient::set_memory_tracking_enabled(u64, bool enabled)
+{
+    // Capture a stack trace roughly every 512 KiB allocated on each thread.
+    static constexpr size_t sample_interval = 512 * KiB;
+
+    Core::AllocationTracker::set_sample_interval(enabled ? sample_interval : 0);
+    Core::AllocationTracker::set_enabled(enabled);
+}
+
+Messages::WebContentServer::TakeMemoryReportResponse ConnectionFromClient::take_memory_report(u64)
+{
+    auto report = Core::AllocationTracker::take_report();
+    report.set("allocation_tracking_supported"sv, Core::AllocationTracker::is_supported());
+    report.set("js_heap"sv, Web::Bindings::main_thread_vm().heap().dump_cell_histogram());
+    return MUST(String::from_byte_string(report.to_byte_string()));
+}
+
 Messages::WebContentServer::GetSelectedTextResponse ConnectionFromClient::get_selected_text(u64 page_id)
 {
     if (auto page = this->page(page_id); page.has_value())
@@ -122,6 +122,11 @@ private:
     virtual void take_dom_node_screenshot(u64 page_id, i32 node_id) override;
 
     virtual Messages::WebContentServer::DumpGcGraphResponse dump_gc_graph(u64 page_id) override;
+    virtual Messages::WebContentServer::TakeRenderingStatisticsResponse take_rendering_statistics(u64 page_id) override;
+    virtual void set_tracing_enabled(u64 page_id, bool enabled) override;
+    virtual Messages::WebContentServer::TakeTraceResponse take_trace(u64 page_id) override;
+    virtual void set_memory_tracking_enabled(u64 page_id, bool enabled) override;
+    virtual Messages::WebContentServer::TakeMemoryReportResponse take_memory_report(u64 page_id) override;
 
     virtual Messages::WebContentServer::GetLocalStorageEntriesResponse get_local_storage_entries(u64 page_id) override;
     virtual Messages::WebContentServer::GetSessionStorageEntriesResponse get_session_storage_entries(u64 page_id) override;
@@ -6,6 +6,7 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <LibCore/ElapsedTimer.h>
 #include <LibGfx/ShareableBitmap.h>
 #include <LibGfx/SystemTheme.h>
 #include <LibJS/Console.h>
@@ -203,6 +204,13 @@ void PageClient::paint_next_frame()
 
 void PageClient::paint(Web::DevicePixelRect const& content_rect, Gfx::Bitmap& target, Web::PaintOptions paint_options)
 {
+    auto timer = Core::ElapsedTimer::start_new(Core::TimerType::Precise);
+    ScopeGuard record_paint_time = [&] {
+        auto& statistics = page().rendering_statistics();
+        statistics.paint_time += timer.elapsed_time();
+        ++statistics.paint_count;
+    };
+
     Web::Painting::CommandList painting_commands;
     Web::Painting::RecordingPainter recording_painter(painting_commands);
 
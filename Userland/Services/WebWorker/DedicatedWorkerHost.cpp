@@ -33,6 +33,10 @@ void DedicatedWorkerHost::run(JS::NonnullGCPtr<Web::Page> page, Web::HTML::Trans
 {
     bool const is_shared = false;
 
+    // 6. Let agent be the result of obtaining a dedicated/shared worker agent given outside settings and is shared. Run the rest of these steps in that agent.
+    // NOTE: Dedicated and shared worker agents are obtained with a [[CanBlock]] of true, and this process only hosts the worker's agent.
+    Web::Bindings::main_thread_vm().set_agent_can_block(true);
+
     // 7. Let realm execution context be the result of creating a new JavaScript realm given agent and the following customizations:
     auto realm_execution_context = Web::Bindings::create_a_new_javascript_realm(
         Web::Bindings::main_thread_vm(),
@@ -82,7 +86,8 @@ void DedicatedWorkerHost::run(JS::NonnullGCPtr<Web::Page> page, Web::HTML::Trans
                                  : Web::Fetch::Infrastructure::Request::Destination::Worker;
 
     // In both cases, let performFetch be the following perform the fetch hook given request, isTopLevel and processCustomFetchResponse:
-    auto perform_fetch_function = [inner_settings, worker_global_scope](JS::NonnullGCPtr<Web::Fetch::Infrastructure::Request> request, Web::HTML::TopLevelModule is_top_level, Web::Fetch::Infrastructure::FetchAlgorithms::ProcessResponseConsumeBodyFunction process_custom_fetch_response) -> Web::WebIDL::ExceptionOr<void> {
+    auto owner_is_cross_origin_isolated = outside_settings_snapshot.cross_origin_isolated_capability == Web::HTML::CanUseCrossOriginIsolatedAPIs::Yes;
+    auto perform_fetch_function = [inner_settings, worker_global_scope, owner_is_cross_origin_isolated](JS::NonnullGCPtr<Web::Fetch::Infrastructure::Request> request, Web::HTML::TopLevelModule is_top_level, Web::Fetch::Infrastructure::FetchAlgorithms::ProcessResponseConsumeBodyFunction process_custom_fetch_response) -> Web::WebIDL::ExceptionOr<void> {
         auto& realm = inner_settings->realm();
         auto& vm = realm.vm();
 
@@ -102,7 +107,7 @@ void DedicatedWorkerHost::run(JS::NonnullGCPtr<Web::Page> page, Web::HTML::Trans
         auto process_custom_fetch_response_function = JS::create_heap_function(vm.heap(), move(process_custom_fetch_response));
 
         // 3. Fetch request with processResponseConsumeBody set to the following steps given response response and null, failure, or a byte sequence bodyBytes:
-        fetch_algorithms_input.process_response_consume_body = [worker_global_scope, process_custom_fetch_response_function](auto response, auto body_bytes) {
+        fetch_algorithms_input.process_response_consume_body = [worker_global_scope, process_custom_fetch_response_function, owner_is_cross_origin_isolated](auto response, auto body_bytes) {
             // 1. Set worker global scope's url to response's url.
             worker_global_scope->set_url(response->url().value_or({}));
 
@@ -114,14 +119,22 @@ void DedicatedWorkerHost::run(JS::NonnullGCPtr<Web::Page> page, Web::HTML::Trans
             //    The one chosen is implementation-defined.
             // FIXME: 5. If the result of checking a global object's embedder policy with worker global scope, outside settings,
             //    and response is false, then set response to a network error.
-            // FIXME: 6. Set worker global scope's cross-origin isolated capability to true if agent's agent cluster's cross-origin
+            // 6. Set worker global scope's cross-origin isolated capability to true if agent's agent cluster's cross-origin
             //    isolation mode is "concrete".
+            // FIXME: We don't keep track of agent clusters' cross-origin isolation modes yet. A dedicated worker is in the
+            //        agent cluster of its owner, so this is reflected in the owner's capability, which is checked below.
+            worker_global_scope->set_cross_origin_isolated_capability(true);
 
             if (!is_shared) {
                 // 7.  If is shared is false and owner's cross-origin isolated capability is false, then set worker
                 //     global scope's cross-origin isolated capability to false.
+                if (!owner_is_cross_origin_isolated)
+                    worker_global_scope->set_cross_origin_isolated_capability(false);
+
                 // 8. If is shared is false and response's url's scheme is "data", then set worker global scope's
                 //     cross-origin isolated capability to false.
+                if (response->url().has_value() && response->url()->scheme() == "data"sv)
+                    worker_global_scope->set_cross_origin_isolated_capability(false);
             }
 
             // 9. Run processCustomFetchResponse with response and bodyBytes.
@@ -11,6 +11,7 @@
 #include <AK/ByteBuffer.h>
 #include <AK/ByteString.h>
 #include <AK/Function.h>
+#include <AK/JsonArray.h>
 #include <AK/JsonObject.h>
 #include <AK/JsonParser.h>
 #include <AK/LexicalPath.h>
@@ -23,6 +24,7 @@
 #include <LibCore/ConfigFile.h>
 #include <LibCore/DirIterator.h>
 #include <LibCore/Directory.h>
+#include <LibCore/ElapsedTimer.h>
 #include <LibCore/EventLoop.h>
 #include <LibCore/File.h>
 #include <LibCore/Promise.h>
@@ -61,8 +63,6 @@
 
 constexpr int DEFAULT_TIMEOUT_MS = 30000; // 30sec
 
-static StringView s_current_test_path;
-
 class HeadlessWebContentView final : public WebView::ViewImplementation {
 public:
     static ErrorOr<NonnullOwnPtr<HeadlessWebContentView>> create(Core::AnonymousBuffer theme, Gfx::IntSize const& window_size, String const& command_line, StringView web_driver_ipc_path, Ladybird::IsLayoutTestMode is_layout_test_mode = Ladybird::IsLayoutTestMode::No, Vector<ByteString> const& certificates = {}, StringView resources_folder = {})
@@ -112,34 +112,39 @@ public:
         if (!web_driver_ipc_path.is_empty())
             view->client().async_connect_to_webdriver(0, web_driver_ipc_path);
 
-        view->m_client_state.client->on_web_content_process_crash = [] {
-            warnln("\033[31;1mWebContent Crashed!!\033[0m");
-            if (!s_current_test_path.is_empty()) {
-                warnln("    Last started test: {}", s_current_test_path);
+        view->m_client_state.client->on_web_content_process_crash = [view = view.ptr()] {
+            if (view->on_web_content_crash) {
+                // Any screenshot we were waiting for will never arrive.
+                view->m_pending_screenshot = nullptr;
+                view->on_web_content_crash();
+                return;
             }
+
+            warnln("\033[31;1mWebContent Crashed!!\033[0m");
             VERIFY_NOT_REACHED();
         };
 
         return view;
     }
 
-    RefPtr<Gfx::Bitmap> take_screenshot()
+    NonnullRefPtr<Core::Promise<RefPtr<Gfx::Bitmap>>> take_screenshot()
     {
         VERIFY(!m_pending_screenshot);
 
-        m_pending_screenshot = Core::Promise<RefPtr<Gfx::Bitmap>>::construct();
+        auto pending_screenshot = Core::Promise<RefPtr<Gfx::Bitmap>>::construct();
+        m_pending_screenshot = pending_screenshot;
         client().async_take_document_screenshot(0);
 
-        auto screenshot = MUST(m_pending_screenshot->await());
-        m_pending_screenshot = nullptr;
-
-        return screenshot;
+        return pending_screenshot;
     }
 
     virtual void did_receive_screenshot(Badge<WebView::WebContentClient>, Gfx::ShareableBitmap const& screenshot) override
     {
         VERIFY(m_pending_screenshot);
-        m_pending_screenshot->resolve(screenshot.bitmap());
+
+        // NOTE: Clear the pending screenshot before resolving it, as the resolution handler may want to take another one.
+        auto pending_screenshot = m_pending_screenshot.release_nonnull();
+        pending_screenshot->resolve(screenshot.bitmap());
     }
 
     ErrorOr<String> dump_layout_tree()
@@ -162,6 +167,33 @@ public:
         client().async_set_content_filters(0, {});
     }
 
+    ErrorOr<JsonValue> take_rendering_statistics()
+    {
+        return JsonValue::from_string(client().take_rendering_statistics(0));
+    }
+
+    void set_tracing_enabled(bool enabled)
+    {
+        client().async_set_tracing_enabled(0, enabled);
+    }
+
+    String take_trace()
+    {
+        return client().take_trace(0);
+    }
+
+    void set_memory_tracking_enabled(bool enabled)
+    {
+        client().async_set_memory_tracking_enabled(0, enabled);
+    }
+
+    String take_memory_report()
+    {
+        return client().take_memory_report(0);
+    }
+
+    Function<void()> on_web_content_crash;
+
 private:
     HeadlessWebContentView(NonnullRefPtr<WebView::Database> database, NonnullOwnPtr<WebView::CookieJar> cookie_jar, RefPtr<Protocol::RequestClient> request_client = nullptr)
         : m_database(move(database))
@@ -203,6 +235,28 @@ private:
     RefPtr<Protocol::RequestClient> m_request_client;
 };
 
+static ErrorOr<void> write_trace(HeadlessWebContentView& view, StringView trace_path)
+{
+    auto trace = view.take_trace();
+
+    auto trace_file = TRY(Core::File::open(trace_path, Core::File::OpenMode::Write));
+    TRY(trace_file->write_until_depleted(trace.bytes()));
+
+    outln("Saved trace to {}", trace_path);
+    return {};
+}
+
+static ErrorOr<void> write_memory_report(HeadlessWebContentView& view, StringView memory_report_path)
+{
+    auto report = view.take_memory_report();
+
+    auto report_file = TRY(Core::File::open(memory_report_path, Core::File::OpenMode::Write));
+    TRY(report_file->write_until_depleted(report.bytes()));
+
+    outln("Saved memory report to {}", memory_report_path);
+    return {};
+}
+
 static ErrorOr<NonnullRefPtr<Core::Timer>> load_page_for_screenshot_and_exit(Core::EventLoop& event_loop, HeadlessWebContentView& view, URL::URL url, int screenshot_timeout)
 {
     // FIXME: Allow passing the output path as an argument.
@@ -216,7 +270,7 @@ static ErrorOr<NonnullRefPtr<Core::Timer>> load_page_for_screenshot_and_exit(Cor
     auto timer = Core::Timer::create_single_shot(
         screenshot_timeout * 1000,
         [&]() {
-            if (auto screenshot = view.take_screenshot()) {
+            if (auto screenshot = MUST(view.take_screenshot()->await())) {
                 outln("Saving screenshot to {}", output_file_path);
 
                 auto output_file = MUST(Core::File::open(output_file_path, Core::File::OpenMode::Write));
@@ -238,6 +292,7 @@ enum class TestMode {
     Layout,
     Text,
     Ref,
+    Screenshot,
 };
 
 enum class TestResult {
@@ -245,6 +300,7 @@ enum class TestResult {
     Fail,
     Skipped,
     Timeout,
+    Crashed,
 };
 
 static StringView test_result_to_string(TestResult result)
@@ -258,72 +314,83 @@ static StringView test_result_to_string(TestResult result)
         return "Skipped"sv;
     case TestResult::Timeout:
         return "Timeout"sv;
+    case TestResult::Crashed:
+        return "Crashed"sv;
     }
     VERIFY_NOT_REACHED();
 }
 
-static ErrorOr<TestResult> run_dump_test(HeadlessWebContentView& view, StringView input_path, StringView expectation_path, TestMode mode, int timeout_in_milliseconds = DEFAULT_TIMEOUT_MS)
-{
-    Core::EventLoop loop;
-    bool did_timeout = false;
+using TestPromise = Core::Promise<TestResult>;
 
-    auto timeout_timer = Core::Timer::create_single_shot(timeout_in_milliseconds, [&] {
-        did_timeout = true;
-        loop.quit(0);
-    });
-
-    auto url = URL::create_with_file_scheme(TRY(FileSystem::real_path(input_path)));
-
-    String result;
-    auto did_finish_test = false;
-    auto did_finish_loading = false;
-
-    if (mode == TestMode::Layout) {
-        view.on_load_finish = [&](auto const& loaded_url) {
-            // This callback will be called for 'about:blank' first, then for the URL we actually want to dump
-            VERIFY(url.equals(loaded_url, URL::ExcludeFragment::Yes) || loaded_url.equals(URL::URL("about:blank")));
+// Drives a single test on a view. The test completes exactly once: when it finishes, when it times out, or when the
+// view's WebContent process crashes, whichever comes first.
+class TestRun : public RefCounted<TestRun> {
+public:
+    static NonnullRefPtr<TestRun> create(HeadlessWebContentView& view, int timeout_in_milliseconds = DEFAULT_TIMEOUT_MS)
+    {
+        auto run = adopt_ref(*new TestRun(view));
+        run->m_timeout_timer = Core::Timer::create_single_shot(timeout_in_milliseconds, [run = run.ptr()] {
+            run->finish(TestResult::Timeout);
+        });
+        run->m_timeout_timer->start();
+        return run;
+    }
 
-            if (url.equals(loaded_url, URL::ExcludeFragment::Yes)) {
-                // NOTE: We take a screenshot here to force the lazy layout of SVG-as-image documents to happen.
-                //       It also causes a lot more code to run, which is good for finding bugs. :^)
-                (void)view.take_screenshot();
+    HeadlessWebContentView& view() { return m_view; }
+    NonnullRefPtr<TestPromise> promise() const { return m_promise; }
+    bool is_finished() const { return m_is_finished; }
 
-                StringBuilder builder;
-                builder.append(view.dump_layout_tree().release_value_but_fixme_should_propagate_errors());
-                builder.append("\n"sv);
-                builder.append(view.dump_paint_tree().release_value_but_fixme_should_propagate_errors());
-                result = builder.to_string().release_value_but_fixme_should_propagate_errors();
+    Duration elapsed_time() const { return m_timer.elapsed_time(); }
+    Optional<Duration> const& load_time() const { return m_load_time; }
 
-                loop.quit(0);
-            }
-        };
-        view.on_text_test_finish = {};
-    } else if (mode == TestMode::Text) {
+    void did_start_loading() { m_load_timer.start(); }
+    void did_finish_loading()
+    {
+        if (!m_load_time.has_value())
+            m_load_time = m_load_timer.elapsed_time();
+    }
 
-        view.on_load_finish = [&](auto const& loaded_url) {
-            // NOTE: We don't want subframe loads to trigger the test finish.
-            if (!url.equals(loaded_url, URL::ExcludeFragment::Yes))
-                return;
-            did_finish_loading = true;
-            if (did_finish_test)
-                loop.quit(0);
-        };
-        view.on_text_test_finish = [&]() {
-            result = view.dump_text().release_value_but_fixme_should_propagate_errors();
-            did_finish_test = true;
-            if (did_finish_loading)
-                loop.quit(0);
-        };
+    void finish(ErrorOr<TestResult> result)
+    {
+        if (m_is_finished)
+            return;
+        m_is_finished = true;
+
+        m_timeout_timer->stop();
+        m_view.on_load_finish = nullptr;
+        m_view.on_text_test_finish = nullptr;
+
+        // NOTE: We usually get here from inside one of the view's callbacks. Resolving the promise will start the next
+        //       test on this view, which re-assigns those callbacks, so wait until we're back in the event loop.
+        Core::deferred_invoke([self = NonnullRefPtr { *this }, result = move(result)]() mutable {
+            if (result.is_error())
+                self->m_promise->reject(result.release_error());
+            else
+                self->m_promise->resolve(result.release_value());
+        });
     }
 
-    view.load(url);
+private:
+    explicit TestRun(HeadlessWebContentView& view)
+        : m_view(view)
+        , m_promise(TestPromise::construct())
+        , m_timer(Core::ElapsedTimer::start_new(Core::TimerType::Precise))
+        , m_load_timer(Core::TimerType::Precise)
+    {
+    }
 
-    timeout_timer->start();
-    loop.exec();
+    HeadlessWebContentView& m_view;
+    NonnullRefPtr<TestPromise> m_promise;
+    RefPtr<Core::Timer> m_timeout_timer;
+    bool m_is_finished { false };
 
-    if (did_timeout)
-        return TestResult::Timeout;
+    Core::ElapsedTimer m_timer;
+    Core::ElapsedTimer m_load_timer;
+    Optional<Duration> m_load_time;
+};
 
+static ErrorOr<TestResult> compare_dump_result(StringView input_path, StringView expectation_path, String const& result)
+{
     if (expectation_path.is_empty()) {
         out("{}", result);
         return TestResult::Skipped;
@@ -363,42 +430,78 @@ static ErrorOr<TestResult> run_dump_test(HeadlessWebContentView& view, StringVie
     return TestResult::Fail;
 }
 
-static ErrorOr<TestResult> run_ref_test(HeadlessWebContentView& view, StringView input_path, bool dump_failed_ref_tests, int timeout_in_milliseconds = DEFAULT_TIMEOUT_MS)
+static void run_dump_test(TestRun& run, StringView input_path, StringView expectation_path, TestMode mode)
 {
-    Core::EventLoop loop;
-    bool did_timeout = false;
+    auto& view = run.view();
 
-    auto timeout_timer = Core::Timer::create_single_shot(timeout_in_milliseconds, [&] {
-        did_timeout = true;
-        loop.quit(0);
-    });
+    auto real_path = FileSystem::real_path(input_path);
+    if (real_path.is_error()) {
+        run.finish(real_path.release_error());
+        return;
+    }
+    auto url = URL::create_with_file_scheme(real_path.release_value());
 
-    RefPtr<Gfx::Bitmap> actual_screenshot, expectation_screenshot;
-    view.on_load_finish = [&](auto const&) {
-        if (actual_screenshot) {
-            expectation_screenshot = view.take_screenshot();
-            loop.quit(0);
-        } else {
-            actual_screenshot = view.take_screenshot();
-            view.debug_request("load-reference-page");
-        }
-    };
-    view.on_text_test_finish = [&] {
-        dbgln("Unexpected text test finished during ref test for {}", input_path);
+    auto finish_with_result = [run = NonnullRefPtr { run }, input_path = ByteString { input_path }, expectation_path = ByteString { expectation_path }](String const& result) {
+        run->finish(compare_dump_result(input_path, expectation_path, result));
     };
 
-    view.load(URL::create_with_file_scheme(TRY(FileSystem::real_path(input_path))));
+    if (mode == TestMode::Layout) {
+        view.on_load_finish = [run = NonnullRefPtr { run }, url, finish_with_result = move(finish_with_result)](auto const& loaded_url) {
+            // This callback will be called for 'about:blank' first, then for the URL we actually want to dump
+            VERIFY(url.equals(loaded_url, URL::ExcludeFragment::Yes) || loaded_url.equals(URL::URL("about:blank")));
+
+            if (!url.equals(loaded_url, URL::ExcludeFragment::Yes))
+                return;
+            run->did_finish_loading();
 
-    timeout_timer->start();
-    loop.exec();
+            // NOTE: We take a screenshot here to force the lazy layout of SVG-as-image documents to happen.
+            //       It also causes a lot more code to run, which is good for finding bugs. :^)
+            run->view().take_screenshot()->when_resolved([run, finish_with_result = move(finish_with_result)](auto&) {
+                if (run->is_finished())
+                    return;
+
+                StringBuilder builder;
+                builder.append(run->view().dump_layout_tree().release_value_but_fixme_should_propagate_errors());
+                builder.append("\n"sv);
+                builder.append(run->view().dump_paint_tree().release_value_but_fixme_should_propagate_errors());
+                finish_with_result(builder.to_string().release_value_but_fixme_should_propagate_errors());
+            });
+        };
+        view.on_text_test_finish = {};
+    } else if (mode == TestMode::Text) {
+        struct TextTestState : public RefCounted<TextTestState> {
+            String result;
+            bool did_finish_test { false };
+            bool did_finish_loading { false };
+        };
+        auto state = make_ref_counted<TextTestState>();
+        auto finish_if_done = [state, finish_with_result = move(finish_with_result)] {
+            if (state->did_finish_loading && state->did_finish_test)
+                finish_with_result(state->result);
+        };
 
-    if (did_timeout)
-        return TestResult::Timeout;
+        view.on_load_finish = [run = NonnullRefPtr { run }, url, state, finish_if_done](auto const& loaded_url) {
+            // NOTE: We don't want subframe loads to trigger the test finish.
+            if (!url.equals(loaded_url, URL::ExcludeFragment::Yes))
+                return;
+            run->did_finish_loading();
+            state->did_finish_loading = true;
+            finish_if_done();
+        };
+        view.on_text_test_finish = [run = NonnullRefPtr { run }, state, finish_if_done]() {
+            state->result = run->view().dump_text().release_value_but_fixme_should_propagate_errors();
+            state->did_finish_test = true;
+            finish_if_done();
+        };
+    }
 
-    VERIFY(actual_screenshot);
-    VERIFY(expectation_screenshot);
+    run.did_start_loading();
+    view.load(url);
+}
 
-    if (actual_screenshot->visually_equals(*expectation_screenshot))
+static ErrorOr<TestResult> compare_ref_test_screenshots(StringView input_path, Gfx::Bitmap& actual_screenshot, Gfx::Bitmap& expectation_screenshot, bool dump_failed_ref_tests)
+{
+    if (actual_screenshot.visually_equals(expectation_screenshot))
         return TestResult::Pass;
 
     if (dump_failed_ref_tests) {
@@ -415,24 +518,151 @@ static ErrorOr<TestResult> run_ref_test(HeadlessWebContentView& view, StringView
         auto mkdir_result = Core::System::mkdir("test-dumps"sv, 0755);
         if (mkdir_result.is_error() && mkdir_result.error().code() != EEXIST)
             return mkdir_result.release_error();
-        TRY(dump_screenshot(*actual_screenshot, TRY(String::formatted("test-dumps/{}.png", title))));
-        TRY(dump_screenshot(*expectation_screenshot, TRY(String::formatted("test-dumps/{}-ref.png", title))));
+        TRY(dump_screenshot(actual_screenshot, TRY(String::formatted("test-dumps/{}.png", title))));
+        TRY(dump_screenshot(expectation_screenshot, TRY(String::formatted("test-dumps/{}-ref.png", title))));
     }
 
     return TestResult::Fail;
 }
 
-static ErrorOr<TestResult> run_test(HeadlessWebContentView& view, StringView input_path, StringView expectation_path, TestMode mode, bool dump_failed_ref_tests)
+static void run_ref_test(TestRun& run, StringView input_path, bool dump_failed_ref_tests)
+{
+    auto& view = run.view();
+
+    auto real_path = FileSystem::real_path(input_path);
+    if (real_path.is_error()) {
+        run.finish(real_path.release_error());
+        return;
+    }
+
+    struct RefTestState : public RefCounted<RefTestState> {
+        bool did_load_reference_page { false };
+        RefPtr<Gfx::Bitmap> actual_screenshot;
+    };
+    auto state = make_ref_counted<RefTestState>();
+
+    view.on_load_finish = [run = NonnullRefPtr { run }, state, input_path = ByteString { input_path }, dump_failed_ref_tests](auto const&) {
+        if (state->did_load_reference_page) {
+            run->view().take_screenshot()->when_resolved([run, state, input_path, dump_failed_ref_tests](RefPtr<Gfx::Bitmap>& expectation_screenshot) {
+                if (run->is_finished())
+                    return;
+
+                VERIFY(state->actual_screenshot);
+                VERIFY(expectation_screenshot);
+                run->finish(compare_ref_test_screenshots(input_path, *state->actual_screenshot, *expectation_screenshot, dump_failed_ref_tests));
+            });
+        } else {
+            run->did_finish_loading();
+            run->view().take_screenshot()->when_resolved([run, state](RefPtr<Gfx::Bitmap>& actual_screenshot) {
+                if (run->is_finished())
+                    return;
+
+                state->actual_screenshot = move(actual_screenshot);
+                state->did_load_reference_page = true;
+                run->view().debug_request("load-reference-page");
+            });
+        }
+    };
+    view.on_text_test_finish = [input_path = ByteString { input_path }] {
+        dbgln("Unexpected text test finished during ref test for {}", input_path);
+    };
+
+    run.did_start_loading();
+    view.load(URL::create_with_file_scheme(real_path.release_value()));
+}
+
+static void run_screenshot_test(TestRun& run, StringView raw_url, StringView output_path)
+{
+    auto& view = run.view();
+
+    auto url = WebView::sanitize_url(raw_url);
+    if (!url.has_value()) {
+        warnln("Invalid URL: \"{}\"", raw_url);
+        run.finish(TestResult::Fail);
+        return;
+    }
+
+    view.on_load_finish = [run = NonnullRefPtr { run }, url = url.release_value(), output_path = ByteString { output_path }](auto const& loaded_url) {
+        // NOTE: We don't want subframe loads to trigger the screenshot.
+        if (!url.equals(loaded_url, URL::ExcludeFragment::Yes))
+            return;
+        run->did_finish_loading();
+
+        run->view().take_screenshot()->when_resolved([run, output_path](RefPtr<Gfx::Bitmap>& screenshot) {
+            if (run->is_finished())
+                return;
+            if (!screenshot) {
+                warnln("No screenshot available for {}", output_path);
+                run->finish(TestResult::Fail);
+                return;
+            }
+
+            auto write_screenshot = [&]() -> ErrorOr<void> {
+                auto output_file = TRY(Core::File::open(output_path, Core::File::OpenMode::Write));
+                auto image_buffer = TRY(Gfx::PNGWriter::encode(*screenshot));
+                TRY(output_file->write_until_depleted(image_buffer.bytes()));
+                return {};
+            };
+
+            if (auto result = write_screenshot(); result.is_error()) {
+                run->finish(result.release_error());
+                return;
+            }
+            run->finish(TestResult::Pass);
+        });
+    };
+    view.on_text_test_finish = {};
+
+    run.did_start_loading();
+    view.load(url.value());
+}
+
+struct Test {
+    String input_path;
+    String expectation_path;
+    TestMode mode;
+    Optional<TestResult> result;
+
+    Duration run_time;
+    Optional<Duration> load_time;
+    Optional<JsonValue> rendering_statistics;
+};
+
+static NonnullRefPtr<TestRun> run_test(HeadlessWebContentView& view, Test const& test, bool dump_failed_ref_tests)
 {
+    auto run = TestRun::create(view);
+
     // Clear the current document.
     // FIXME: Implement a debug-request to do this more thoroughly.
-    auto promise = Core::Promise<Empty>::construct();
-    view.on_load_finish = [&](auto) {
-        promise->resolve({});
+    view.on_load_finish = [run, &test, dump_failed_ref_tests](auto) {
+        run->view().on_load_finish = nullptr;
+
+        Core::deferred_invoke([run, &test, dump_failed_ref_tests] {
+            if (run->is_finished())
+                return;
+
+            // Discard the rendering statistics accumulated by the previous test and by clearing the document.
+            (void)run->view().take_rendering_statistics();
+
+            switch (test.mode) {
+            case TestMode::Text:
+            case TestMode::Layout:
+                run_dump_test(*run, test.input_path, test.expectation_path, test.mode);
+                break;
+            case TestMode::Ref:
+                run_ref_test(*run, test.input_path, dump_failed_ref_tests);
+                break;
+            case TestMode::Screenshot:
+                run_screenshot_test(*run, test.input_path, test.expectation_path);
+                break;
+            default:
+                VERIFY_NOT_REACHED();
+            }
+        });
     };
     view.on_text_test_finish = {};
 
-    view.on_request_file_picker = [&](auto const& accepted_file_types, auto allow_multiple_files) {
+    view.on_request_file_picker = [&view](auto const& accepted_file_types, auto allow_multiple_files) {
         // Create some dummy files for tests.
         Vector<Web::HTML::SelectedFile> selected_files;
 
@@ -474,27 +704,9 @@ static ErrorOr<TestResult> run_test(HeadlessWebContentView& view, StringView inp
     };
 
     view.load(URL::URL("about:blank"sv));
-    MUST(promise->await());
-
-    s_current_test_path = input_path;
-    switch (mode) {
-    case TestMode::Text:
-    case TestMode::Layout:
-        return run_dump_test(view, input_path, expectation_path, mode);
-    case TestMode::Ref:
-        return run_ref_test(view, input_path, dump_failed_ref_tests);
-    default:
-        VERIFY_NOT_REACHED();
-    }
+    return run;
 }
 
-struct Test {
-    String input_path;
-    String expectation_path;
-    TestMode mode;
-    Optional<TestResult> result;
-};
-
 static Vector<ByteString> s_skipped_tests;
 
 static ErrorOr<void> load_test_config(StringView test_root_path)
@@ -538,7 +750,7 @@ static ErrorOr<void> collect_dump_tests(Vector<Test>& tests, StringView path, St
         auto expectation_path = TRY(String::formatted("{}/expected/{}/{}.txt", path, trail, basename));
 
         // FIXME: Test paths should be ByteString
-        tests.append({ TRY(String::from_byte_string(input_path)), move(expectation_path), mode, {} });
+        tests.append({ TRY(String::from_byte_string(input_path)), move(expectation_path), mode, {}, {}, {}, {} });
     }
     return {};
 }
@@ -550,16 +762,158 @@ static ErrorOr<void> collect_ref_tests(Vector<Test>& tests, StringView path)
             return IterationDecision::Continue;
         auto input_path = TRY(FileSystem::real_path(TRY(String::formatted("{}/{}", path, entry.name))));
         // FIXME: Test paths should be ByteString
-        tests.append({ TRY(String::from_byte_string(input_path)), {}, TestMode::Ref, {} });
+        tests.append({ TRY(String::from_byte_string(input_path)), {}, TestMode::Ref, {}, {}, {}, {} });
         return IterationDecision::Continue;
     }));
 
     return {};
 }
 
-static ErrorOr<int> run_tests(HeadlessWebContentView& view, StringView test_root_path, StringView test_glob, bool dump_failed_ref_tests, bool dump_gc_graph)
+static ErrorOr<void> collect_screenshot_tests(Vector<Test>& tests, StringView url_list_path, StringView output_directory)
+{
+    auto file = TRY(Core::File::open(url_list_path, Core::File::OpenMode::Read));
+    auto contents = TRY(file->read_until_eof());
+
+    size_t index = 0;
+    for (auto line : StringView { contents }.lines()) {
+        line = line.trim_whitespace();
+        if (line.is_empty() || line.starts_with('#'))
+            continue;
+
+        auto output_path = TRY(String::formatted("{}/{}.png", output_directory, index++));
+        tests.append({ TRY(String::from_utf8(line)), move(output_path), TestMode::Screenshot, {}, {}, {}, {} });
+    }
+
+    return {};
+}
+
+using ViewFactory = Function<ErrorOr<NonnullOwnPtr<HeadlessWebContentView>>()>;
+
+// Distributes the tests over the given views, running one test per view at a time. A view whose WebContent process
+// crashed or hung is replaced with a fresh one, so that one misbehaving test cannot affect the ones that follow it.
+static ErrorOr<void> run_tests_on_views(Vector<Test>& tests, Vector<NonnullOwnPtr<HeadlessWebContentView>>& views, ViewFactory const& create_view, StringView test_root_path, bool dump_failed_ref_tests)
+{
+    Core::EventLoop loop;
+
+    bool is_tty = isatty(STDOUT_FILENO);
+
+    size_t next_test_index = 0;
+    size_t started_test_count = 0;
+    size_t busy_view_count = 0;
+    Optional<Error> fatal_error;
+
+    Function<void(size_t)> run_next_test;
+    run_next_test = [&](size_t view_index) {
+        while (next_test_index < tests.size() && !fatal_error.has_value()) {
+            auto test_index = next_test_index++;
+            auto& test = tests[test_index];
+
+            if (is_tty) {
+                // Keep clearing and reusing the same line if stdout is a TTY.
+                out("\33[2K\r");
+            }
+
+            auto display_path = test_root_path.is_empty() ? test.input_path.to_byte_string() : LexicalPath::relative_path(test.input_path, test_root_path);
+            out("{}/{}: {}", ++started_test_count, tests.size(), display_path);
+
+            if (is_tty)
+                fflush(stdout);
+            else
+                outln("");
+
+            if (s_skipped_tests.contains_slow(test.input_path.bytes_as_string_view())) {
+                test.result = TestResult::Skipped;
+                continue;
+            }
+
+            auto& view = *views[view_index];
+            auto run = run_test(view, test, dump_failed_ref_tests);
+
+            view.on_web_content_crash = [run, input_path = test.input_path] {
+                warnln("\033[31;1mWebContent Crashed!!\033[0m");
+                warnln("    Last started test: {}", input_path);
+                run->finish(TestResult::Crashed);
+            };
+
+            // NOTE: The run owns its promise, so we can't have the promise's handlers keep the run alive.
+            run->promise()->when_resolved([&, view_index, test_index, run = run.ptr()](TestResult& result) {
+                auto& test = tests[test_index];
+                test.result = result;
+                test.run_time = run->elapsed_time();
+                test.load_time = run->load_time();
+
+                if (result == TestResult::Timeout || result == TestResult::Crashed) {
+                    // Don't reuse a WebContent process that crashed or may still be busy with the previous test.
+                    auto new_view = create_view();
+                    if (new_view.is_error()) {
+                        fatal_error = new_view.release_error();
+                        if (--busy_view_count == 0)
+                            loop.quit(0);
+                        return;
+                    }
+                    views[view_index] = new_view.release_value();
+                } else if (auto statistics = views[view_index]->take_rendering_statistics(); !statistics.is_error()) {
+                    test.rendering_statistics = statistics.release_value();
+                }
+
+                run_next_test(view_index);
+            });
+            run->promise()->when_rejected([&, view_index, test_index](Error& error) {
+                auto& test = tests[test_index];
+                warnln("Failed to run test {}: {}", test.input_path, error);
+                test.result = TestResult::Fail;
+                run_next_test(view_index);
+            });
+            return;
+        }
+
+        if (--busy_view_count == 0)
+            loop.quit(0);
+    };
+
+    busy_view_count = views.size();
+    for (size_t view_index = 0; view_index < views.size(); ++view_index)
+        run_next_test(view_index);
+
+    if (busy_view_count != 0)
+        loop.exec();
+
+    if (is_tty)
+        outln("\33[2K\rDone!");
+
+    if (fatal_error.has_value())
+        return fatal_error.release_value();
+    return {};
+}
+
+static ErrorOr<void> write_timing_report(Vector<Test> const& tests, StringView report_path)
+{
+    JsonArray report;
+
+    for (auto const& test : tests) {
+        JsonObject entry;
+        entry.set("input"sv, test.input_path.to_byte_string());
+        entry.set("result"sv, test_result_to_string(*test.result));
+        entry.set("run_time_us"sv, test.run_time.to_microseconds());
+        if (test.load_time.has_value())
+            entry.set("load_time_us"sv, test.load_time->to_microseconds());
+        if (test.rendering_statistics.has_value() && test.rendering_statistics->is_object()) {
+            test.rendering_statistics->as_object().for_each_member([&](auto const& key, auto const& value) {
+                entry.set(key, value);
+            });
+        }
+        TRY(report.append(move(entry)));
+    }
+
+    auto file = TRY(Core::File::open(report_path, Core::File::OpenMode::Write));
+    TRY(file->write_until_depleted(report.to_byte_string()));
+    return {};
+}
+
+static ErrorOr<int> run_tests(Vector<NonnullOwnPtr<HeadlessWebContentView>>& views, ViewFactory const& create_view, StringView test_root_path, StringView test_glob, bool dump_failed_ref_tests, bool dump_gc_graph, StringView timing_report_path)
 {
-    view.clear_content_filters();
+    for (auto& view : views)
+        view->clear_content_filters();
 
     TRY(load_test_config(test_root_path));
 
@@ -572,36 +926,16 @@ static ErrorOr<int> run_tests(HeadlessWebContentView& view, StringView test_root
         return !test.input_path.bytes_as_string_view().matches(test_glob, CaseSensitivity::CaseSensitive);
     });
 
+    outln("Running {} tests on {} WebContent process(es)...", tests.size(), views.size());
+    TRY(run_tests_on_views(tests, views, create_view, test_root_path, dump_failed_ref_tests));
+
     size_t pass_count = 0;
     size_t fail_count = 0;
     size_t timeout_count = 0;
+    size_t crash_count = 0;
     size_t skipped_count = 0;
 
-    bool is_tty = isatty(STDOUT_FILENO);
-
-    outln("Running {} tests...", tests.size());
-    for (size_t i = 0; i < tests.size(); ++i) {
-        auto& test = tests[i];
-
-        if (is_tty) {
-            // Keep clearing and reusing the same line if stdout is a TTY.
-            out("\33[2K\r");
-        }
-
-        out("{}/{}: {}", i + 1, tests.size(), LexicalPath::relative_path(test.input_path, test_root_path));
-
-        if (is_tty)
-            fflush(stdout);
-        else
-            outln("");
-
-        if (s_skipped_tests.contains_slow(test.input_path.bytes_as_string_view())) {
-            test.result = TestResult::Skipped;
-            ++skipped_count;
-            continue;
-        }
-
-        test.result = TRY(run_test(view, test.input_path, test.expectation_path, test.mode, dump_failed_ref_tests));
+    for (auto const& test : tests) {
         switch (*test.result) {
         case TestResult::Pass:
             ++pass_count;
@@ -612,17 +946,17 @@ static ErrorOr<int> run_tests(HeadlessWebContentView& view, StringView test_root
         case TestResult::Timeout:
             ++timeout_count;
             break;
+        case TestResult::Crashed:
+            ++crash_count;
+            break;
         case TestResult::Skipped:
-            VERIFY_NOT_REACHED();
+            ++skipped_count;
             break;
         }
     }
 
-    if (is_tty)
-        outln("\33[2K\rDone!");
-
     outln("==================================================");
-    outln("Pass: {}, Fail: {}, Skipped: {}, Timeout: {}", pass_count, fail_count, skipped_count, timeout_count);
+    outln("Pass: {}, Fail: {}, Skipped: {}, Timeout: {}, Crashed: {}", pass_count, fail_count, skipped_count, timeout_count, crash_count);
     outln("==================================================");
     for (auto& test : tests) {
         if (*test.result == TestResult::Pass)
@@ -630,8 +964,11 @@ static ErrorOr<int> run_tests(HeadlessWebContentView& view, StringView test_root
         outln("{}: {}", test_result_to_string(*test.result), test.input_path);
     }
 
+    if (!timing_report_path.is_empty())
+        TRY(write_timing_report(tests, timing_report_path));
+
     if (dump_gc_graph) {
-        auto path = view.dump_gc_graph();
+        auto path = views.first()->dump_gc_graph();
         if (path.is_error()) {
             warnln("Failed to dump GC graph: {}", path.error());
         } else {
@@ -639,11 +976,33 @@ static ErrorOr<int> run_tests(HeadlessWebContentView& view, StringView test_root
         }
     }
 
-    if (timeout_count == 0 && fail_count == 0)
+    if (timeout_count == 0 && fail_count == 0 && crash_count == 0)
         return 0;
     return 1;
 }
 
+static ErrorOr<int> take_screenshots(Vector<NonnullOwnPtr<HeadlessWebContentView>>& views, ViewFactory const& create_view, StringView url_list_path, StringView output_directory, StringView timing_report_path)
+{
+    Vector<Test> tests;
+    TRY(collect_screenshot_tests(tests, url_list_path, output_directory));
+
+    outln("Taking {} screenshots on {} WebContent process(es)...", tests.size(), views.size());
+    TRY(run_tests_on_views(tests, views, create_view, {}, false));
+
+    size_t failure_count = 0;
+    for (auto const& test : tests) {
+        if (*test.result == TestResult::Pass)
+            continue;
+        outln("{}: {}", test_result_to_string(*test.result), test.input_path);
+        ++failure_count;
+    }
+
+    if (!timing_report_path.is_empty())
+        TRY(write_timing_report(tests, timing_report_path));
+
+    return failure_count == 0 ? 0 : 1;
+}
+
 ErrorOr<int> serenity_main(Main::Arguments arguments)
 {
     Core::EventLoop event_loop;
@@ -660,6 +1019,12 @@ ErrorOr<int> serenity_main(Main::Arguments arguments)
     StringView test_root_path;
     ByteString test_glob;
     Vector<ByteString> certificates;
+    size_t job_count = 1;
+    StringView url_list_path;
+    StringView output_directory = "."sv;
+    StringView timing_report_path;
+    StringView trace_path;
+    StringView memory_report_path;
 
 #if !defined(AK_OS_SERENITY)
     platform_init();
@@ -679,6 +1044,12 @@ ErrorOr<int> serenity_main(Main::Arguments arguments)
     args_parser.add_option(web_driver_ipc_path, "Path to the WebDriver IPC socket", "webdriver-ipc-path", 0, "path");
     args_parser.add_option(is_layout_test_mode, "Enable layout test mode", "layout-test-mode");
     args_parser.add_option(certificates, "Path to a certificate file", "certificate", 'C', "certificate");
+    args_parser.add_option(job_count, "Number of WebContent processes to run tests or screenshots on in parallel (default: 1)", "jobs", 'j', "n");
+    args_parser.add_option(url_list_path, "Take a screenshot of each URL listed (one per line) in the given file", "url-list", 'L', "path");
+    args_parser.add_option(output_directory, "Directory to write screenshots taken with --url-list to (default: .)", "output-directory", 'o', "path");
+    args_parser.add_option(timing_report_path, "Write a JSON report of per-page timings to the given path", "timing-report", 0, "path");
+    args_parser.add_option(trace_path, "Write a Chrome trace event file of the page load to the given path", "trace", 0, "path");
+    args_parser.add_option(memory_report_path, "Write a JSON report of the page's heap allocations by subsystem to the given path", "memory-report", 0, "path");
     args_parser.add_positional_argument(raw_url, "URL to open", "url", Core::ArgsParser::Required::No);
     args_parser.parse(arguments);
 
@@ -697,32 +1068,58 @@ ErrorOr<int> serenity_main(Main::Arguments arguments)
 
     StringBuilder command_line_builder;
     command_line_builder.join(' ', arguments.strings);
-    auto view = TRY(HeadlessWebContentView::create(move(theme), window_size, MUST(command_line_builder.to_string()), web_driver_ipc_path, is_layout_test_mode ? Ladybird::IsLayoutTestMode::Yes : Ladybird::IsLayoutTestMode::No, certificates, resources_folder));
+    auto command_line = MUST(command_line_builder.to_string());
+
+    ViewFactory create_view = [&]() {
+        return HeadlessWebContentView::create(theme, window_size, command_line, web_driver_ipc_path, is_layout_test_mode ? Ladybird::IsLayoutTestMode::Yes : Ladybird::IsLayoutTestMode::No, certificates, resources_folder);
+    };
+
+    if (!test_root_path.is_empty() || !url_list_path.is_empty()) {
+        Vector<NonnullOwnPtr<HeadlessWebContentView>> views;
+        for (size_t i = 0; i < max<size_t>(job_count, 1); ++i)
+            views.append(TRY(create_view()));
+
+        if (!url_list_path.is_empty())
+            return take_screenshots(views, create_view, url_list_path, output_directory, timing_report_path);
 
-    if (!test_root_path.is_empty()) {
         test_glob = ByteString::formatted("*{}*", test_glob);
-        return run_tests(*view, test_root_path, test_glob, dump_failed_ref_tests, dump_gc_graph);
+        return run_tests(views, create_view, test_root_path, test_glob, dump_failed_ref_tests, dump_gc_graph, timing_report_path);
     }
 
+    auto view = TRY(create_view());
+
+    if (!trace_path.is_empty())
+        view->set_tracing_enabled(true);
+    if (!memory_report_path.is_empty())
+        view->set_memory_tracking_enabled(true);
+
     auto url = WebView::sanitize_url(raw_url);
     if (!url.has_value()) {
         warnln("Invalid URL: \"{}\"", raw_url);
         return Error::from_string_literal("Invalid URL");
     }
 
-    if (dump_layout_tree) {
-        TRY(run_dump_test(*view, raw_url, ""sv, TestMode::Layout));
-        return 0;
-    }
+    if (dump_layout_tree || dump_text) {
+        auto run = TestRun::create(*view);
+        run_dump_test(*run, raw_url, ""sv, dump_layout_tree ? TestMode::Layout : TestMode::Text);
+        TRY(run->promise()->await());
 
-    if (dump_text) {
-        TRY(run_dump_test(*view, raw_url, ""sv, TestMode::Text));
+        if (!trace_path.is_empty())
+            TRY(write_trace(*view, trace_path));
+        if (!memory_report_path.is_empty())
+            TRY(write_memory_report(*view, memory_report_path));
         return 0;
     }
 
     if (web_driver_ipc_path.is_empty()) {
         auto timer = TRY(load_page_for_screenshot_and_exit(event_loop, *view, url.value(), screenshot_timeout));
-        return event_loop.exec();
+        auto result = event_loop.exec();
+
+        if (!trace_path.is_empty())
+            TRY(write_trace(*view, trace_path));
+        if (!memory_report_path.is_empty())
+            TRY(write_memory_report(*view, memory_report_path));
+        return result;
     }
 
     return 0;
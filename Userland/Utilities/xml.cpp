@@ -7,6 +7,7 @@
 #include <AK/LexicalPath.h>
 #include <AK/Queue.h>
 #include <LibCore/ArgsParser.h>
+#include <LibCore/ElapsedTimer.h>
 #include <LibCore/File.h>
 #include <LibFileSystem/FileSystem.h>
 #include <LibMain/Main.h>
@@ -503,16 +504,55 @@ static void do_run_tests(XML::Document& document)
     }
 }
 
+struct CountingListener final : public XML::Listener {
+    virtual void element_start(XML::Name const&, HashMap<XML::Name, ByteString> const&) override { ++element_count; }
+    virtual void text(StringView text) override { text_bytes += text.length(); }
+
+    size_t element_count { 0 };
+    size_t text_bytes { 0 };
+};
+
+static ErrorOr<void> run_benchmark(StringView contents, unsigned iterations)
+{
+    auto report = [&](StringView mode, Duration elapsed) {
+        auto seconds = static_cast<double>(elapsed.to_microseconds()) / 1'000'000.;
+        auto megabytes = static_cast<double>(contents.length()) * iterations / (1024. * 1024.);
+        outln("{:>9}: {} iterations in {:.3f} s, {:.3f} ms/iteration, {:.2f} MiB/s", mode, iterations, seconds, seconds * 1000. / iterations, megabytes / seconds);
+    };
+
+    auto timer = Core::ElapsedTimer::start_new(Core::TimerType::Precise);
+    for (unsigned i = 0; i < iterations; ++i) {
+        auto parser = parse(contents);
+        if (auto result = parser.parse(); result.is_error())
+            return Error::from_string_literal("Failed to parse document");
+    }
+    report("tree"sv, timer.elapsed_time());
+
+    CountingListener listener;
+    timer = Core::ElapsedTimer::start_new(Core::TimerType::Precise);
+    for (unsigned i = 0; i < iterations; ++i) {
+        auto parser = parse(contents);
+        if (auto result = parser.parse_with_listener(listener); result.is_error())
+            return Error::from_string_literal("Failed to parse document");
+    }
+    report("streaming"sv, timer.elapsed_time());
+    outln("{} elements, {} bytes of text per iteration", listener.element_count / iterations, listener.text_bytes / iterations);
+
+    return {};
+}
+
 ErrorOr<int> serenity_main(Main::Arguments arguments)
 {
     StringView filename;
     bool run_tests { false };
+    unsigned benchmark_iterations { 0 };
 
     Core::ArgsParser parser;
     parser.set_general_help("Parse and dump XML files");
     parser.add_option(g_color, "Syntax highlight the output", "color", 'c');
     parser.add_option(g_only_contents, "Only display markup and text", "only-contents", 'o');
     parser.add_option(run_tests, "Run tests", "run-tests", 't');
+    parser.add_option(benchmark_iterations, "Measure parsing throughput over the given number of iterations", "benchmark", 'b', "iterations");
     parser.add_positional_argument(filename, "File to read from", "file");
     parser.parse(arguments);
 
@@ -520,6 +560,11 @@ ErrorOr<int> serenity_main(Main::Arguments arguments)
     auto file = TRY(Core::File::open(s_path, Core::File::OpenMode::Read));
     auto contents = TRY(file->read_until_eof());
 
+    if (benchmark_iterations > 0) {
+        TRY(run_benchmark(contents, benchmark_iterations));
+        return 0;
+    }
+
     auto xml_parser = parse(contents);
     auto result = xml_parser.parse();
     if (result.is_error()) {